@@ -0,0 +1,285 @@
+/* audit.c */
+
+#include "ptpd.h"
+
+/* Open addressing, keyed by port identity and domain */
+static AuditRecord auditRecords[DEFAULT_AUDIT_RECORDS];
+static int16_t auditCount;
+
+static uint32_t auditHash(const PortIdentity *portIdentity, uint8_t domainNumber)
+{
+	uint32_t h = 2166136261UL;
+	int i;
+
+	/* FNV-1a */
+	for (i = 0; i < CLOCK_IDENTITY_LENGTH; i++)
+	{
+		h = (h ^ portIdentity->clockIdentity[i]) * 16777619UL;
+	}
+
+	h = (h ^ (portIdentity->portNumber & 0xFF)) * 16777619UL;
+	h = (h ^ (portIdentity->portNumber >> 8)) * 16777619UL;
+	h = (h ^ domainNumber) * 16777619UL;
+
+	return h;
+}
+
+/* Find the record of a source, taking a free or stale slot on its probe sequence if new */
+static AuditRecord *auditLookup(const PortIdentity *portIdentity, uint8_t domainNumber, int32_t now)
+{
+	AuditRecord *record, *stale = NULL;
+	uint32_t i, n;
+
+	i = auditHash(portIdentity, domainNumber) & (DEFAULT_AUDIT_RECORDS - 1);
+
+	for (n = 0; n < DEFAULT_AUDIT_RECORDS; n++)
+	{
+		record = &auditRecords[i];
+
+		if (!record->used)
+		{
+			if (auditCount >= DEFAULT_AUDIT_SOURCES)
+				break;
+
+			auditCount++;
+			stale = record;
+			break;
+		}
+
+		if (record->domainNumber == domainNumber && isSamePortIdentity(&record->portIdentity, portIdentity))
+			return record;
+
+		/* Reusing an occupied slot keeps the probe sequences of other keys intact */
+		if (stale == NULL && now - record->lastSeen > DEFAULT_AUDIT_STALE)
+			stale = record;
+
+		i = (i + 1) & (DEFAULT_AUDIT_RECORDS - 1);
+	}
+
+	if (stale == NULL)
+	{
+		DBGV("auditLookup: table full\n");
+		return NULL;
+	}
+
+	memset(stale, 0, sizeof(AuditRecord));
+	stale->used = TRUE;
+	stale->portIdentity = *portIdentity;
+	stale->domainNumber = domainNumber;
+	stale->lastSequenceId = -1;
+
+	return stale;
+}
+
+/* Sequence gaps and interval regularity, FALSE for a repeated or late Sync */
+static bool auditSequence(AuditRecord *record, const MsgHeader *header, const TimeInternal *time)
+{
+	TimeInternal interval;
+	int16_t gap;
+	int64_t nominal, error;
+
+	record->syncs++;
+	record->logSyncInterval = header->logMessageInterval;
+
+	if (record->syncs == 1)
+	{
+		record->lastSequenceId = header->sequenceId;
+		record->syncReceive = *time;
+		return TRUE;
+	}
+
+	gap = (int16_t)(header->sequenceId - record->lastSequenceId);
+
+	if (gap <= 0)
+	{
+		record->outOfOrder++;
+		return FALSE;
+	}
+
+	record->missing += gap - 1;
+	record->lastSequenceId = header->sequenceId;
+
+	subTime(&interval, time, &record->syncReceive);
+	record->syncReceive = *time;
+
+	if (header->logMessageInterval < -7 || header->logMessageInterval > 6)
+		return TRUE;
+
+	/* Deviation of the spacing per sequence step from 2^logMessageInterval */
+	nominal = header->logMessageInterval >= 0 ? 1000000000LL << header->logMessageInterval : 1000000000LL >> -header->logMessageInterval;
+	error = ((int64_t)interval.seconds * 1000000000 + interval.nanoseconds) / gap - nominal;
+	if (error < 0)
+		error = -error;
+	if (error > INT32_MAX)
+		error = INT32_MAX;
+
+	record->intervalError += ((int32_t)error - record->intervalError) / DEFAULT_AUDIT_AVERAGE;
+
+	return TRUE;
+}
+
+/* Offset of the local clock from the master, drift and jitter */
+static void auditOffset(AuditRecord *record, const TimeInternal *ingress, const TimeInternal *origin, const TimeInternal *correction)
+{
+	TimeInternal offset, step;
+	int32_t jitter;
+	int64_t rate;
+
+	subTime(&offset, ingress, origin);
+	subTime(&offset, &offset, correction);
+
+	subTime(&step, &offset, &record->offset);
+	record->offset = offset;
+
+	if (record->offsetSamples++ == 0 || step.seconds != 0)
+	{
+		/* Clock stepped on either side, restart the statistics */
+		record->offsetSamples = 1;
+		record->offsetStep = 0;
+		return;
+	}
+
+	if (record->offsetSamples > 2)
+	{
+		jitter = abs(step.nanoseconds - record->offsetStep);
+		record->jitter += (jitter - record->jitter) / DEFAULT_AUDIT_AVERAGE;
+	}
+
+	record->offsetStep = step.nanoseconds;
+
+	/* ns per sync interval to ppb, the step is negative half of the time so
+	 * it is divided and multiplied rather than shifted */
+	if (record->logSyncInterval >= 0 && record->logSyncInterval <= 6)
+		rate = step.nanoseconds / (1 << record->logSyncInterval);
+	else if (record->logSyncInterval < 0 && record->logSyncInterval >= -7)
+		rate = (int64_t)step.nanoseconds * (1 << -record->logSyncInterval);
+	else
+		return;
+
+	if (rate > INT32_MAX)
+		rate = INT32_MAX;
+	else if (rate < INT32_MIN)
+		rate = INT32_MIN;
+	record->drift += (int32_t)((rate - record->drift) / DEFAULT_AUDIT_AVERAGE);
+}
+
+void auditMessage(PtpClock *ptpClock, const TimeInternal *time)
+{
+	const MsgHeader *header = &ptpClock->msgTmpHeader;
+	AuditRecord *record;
+	TimeInternal origin, correction;
+	TimeInternal now = *time;
+
+	if (now.seconds == 0)
+		getTime(&now);
+
+	switch (header->messageType)
+	{
+		case SYNC:
+		case FOLLOW_UP:
+		case ANNOUNCE:
+			break;
+
+		default:
+			return;
+	}
+
+	record = auditLookup(&header->sourcePortIdentity, header->domainNumber, now.seconds);
+	if (record == NULL)
+		return;
+
+	record->lastSeen = now.seconds;
+
+	switch (header->messageType)
+	{
+		case SYNC:
+
+			if (ptpClock->msgIbufLength < SYNC_LENGTH)
+				break;
+
+			if (!auditSequence(record, header, time))
+				break;
+
+			scaledNanosecondsToInternalTime(&header->correctionfield, &correction);
+
+			if (getFlag(header->flagField[0], FLAG0_TWO_STEP))
+			{
+				record->waitingForFollowUp = TRUE;
+				record->followUpSequenceId = header->sequenceId;
+				record->correctionSync = correction;
+			}
+			else
+			{
+				record->waitingForFollowUp = FALSE;
+				msgUnpackSync(ptpClock->msgIbuf, &ptpClock->msgTmp.sync);
+				toInternalTime(&origin, &ptpClock->msgTmp.sync.originTimestamp);
+				auditOffset(record, time, &origin, &correction);
+			}
+
+			break;
+
+		case FOLLOW_UP:
+
+			if (ptpClock->msgIbufLength < FOLLOW_UP_LENGTH)
+				break;
+
+			record->followUps++;
+
+			if (!record->waitingForFollowUp || record->followUpSequenceId != header->sequenceId)
+				break;
+
+			record->waitingForFollowUp = FALSE;
+			msgUnpackFollowUp(ptpClock->msgIbuf, &ptpClock->msgTmp.follow);
+			toInternalTime(&origin, &ptpClock->msgTmp.follow.preciseOriginTimestamp);
+			scaledNanosecondsToInternalTime(&header->correctionfield, &correction);
+			addTime(&correction, &correction, &record->correctionSync);
+			auditOffset(record, &record->syncReceive, &origin, &correction);
+
+			break;
+
+		case ANNOUNCE:
+
+			if (ptpClock->msgIbufLength < ANNOUNCE_LENGTH)
+				break;
+
+			msgUnpackAnnounce(ptpClock->msgIbuf, &ptpClock->msgTmp.announce);
+			record->announces++;
+			memcpy(record->grandmasterIdentity, ptpClock->msgTmp.announce.grandmasterIdentity, CLOCK_IDENTITY_LENGTH);
+			record->grandmasterClockQuality = ptpClock->msgTmp.announce.grandmasterClockQuality;
+			record->grandmasterPriority1 = ptpClock->msgTmp.announce.grandmasterPriority1;
+			record->grandmasterPriority2 = ptpClock->msgTmp.announce.grandmasterPriority2;
+			record->stepsRemoved = ptpClock->msgTmp.announce.stepsRemoved;
+			record->currentUtcOffset = ptpClock->msgTmp.announce.currentUtcOffset;
+			record->timeSource = ptpClock->msgTmp.announce.timeSource;
+			record->flagField1 = header->flagField[1];
+
+			break;
+
+		default:
+			break;
+	}
+}
+
+void auditClear(void)
+{
+	taskENTER_CRITICAL();
+	memset(auditRecords, 0, sizeof(auditRecords));
+	auditCount = 0;
+	taskEXIT_CRITICAL();
+}
+
+bool auditGet(int16_t index, AuditRecord *record)
+{
+	bool used;
+
+	if (index < 0 || index >= DEFAULT_AUDIT_RECORDS)
+		return FALSE;
+
+	taskENTER_CRITICAL();
+	used = auditRecords[index].used;
+	if (used)
+		*record = auditRecords[index];
+	taskEXIT_CRITICAL();
+
+	return used;
+}
@@ -138,6 +138,45 @@ void addForeign(PtpClock *ptpClock, const MsgHeader *header, const MsgAnnounce *
 	}
 }
 
+void removeForeign(PtpClock *ptpClock, const PortIdentity *portIdentity)
+{
+	int16_t i, last;
+
+	for (i = 0; i < ptpClock->foreignMasterDS.count; i++)
+	{
+		if (isSamePortIdentity(portIdentity, &ptpClock->foreignMasterDS.records[i].foreignMasterPortIdentity))
+		{
+			/* Keep the records packed, the last one fills the hole */
+			last = ptpClock->foreignMasterDS.count - 1;
+			if (i != last)
+			{
+				ptpClock->foreignMasterDS.records[i] = ptpClock->foreignMasterDS.records[last];
+			}
+
+			ptpClock->foreignMasterDS.count--;
+			ptpClock->foreignMasterDS.i = ptpClock->foreignMasterDS.count;
+			ptpClock->foreignMasterDS.best = 0;
+			DBGV("removeForeign: record %d removed\n", i);
+			return;
+		}
+	}
+}
+
+bool isForeign(const PtpClock *ptpClock, const PortIdentity *portIdentity)
+{
+	int16_t i;
+
+	for (i = 0; i < ptpClock->foreignMasterDS.count; i++)
+	{
+		if (isSamePortIdentity(portIdentity, &ptpClock->foreignMasterDS.records[i].foreignMasterPortIdentity))
+		{
+			return TRUE;
+		}
+	}
+
+	return FALSE;
+}
+
 #define m2 m1
 
 /* Local clock is becoming Master. Table 13 (9.3.5) of the spec.*/
@@ -162,13 +201,13 @@ void m1(PtpClock *ptpClock)
 
 	/* Time Properties data set */
 	ptpClock->timePropertiesDS.currentUtcOffset = ptpClock->rtOpts->currentUtcOffset;
-	ptpClock->timePropertiesDS.currentUtcOffsetValid = DEFAULT_UTC_VALID;
+	ptpClock->timePropertiesDS.currentUtcOffsetValid = ptpClock->rtOpts->currentUtcOffsetValid;
 	ptpClock->timePropertiesDS.leap59 = FALSE;
 	ptpClock->timePropertiesDS.leap61 = FALSE;
-	ptpClock->timePropertiesDS.timeTraceable = DEFAULT_TIME_TRACEABLE;
-	ptpClock->timePropertiesDS.frequencyTraceable = DEFAULT_FREQUENCY_TRACEABLE;
-	ptpClock->timePropertiesDS.ptpTimescale = (bool)(DEFAULT_TIMESCALE == PTP_TIMESCALE);
-	ptpClock->timePropertiesDS.timeSource = DEFAULT_TIME_SOURCE;
+	ptpClock->timePropertiesDS.timeTraceable = ptpClock->rtOpts->timeTraceable;
+	ptpClock->timePropertiesDS.frequencyTraceable = ptpClock->rtOpts->frequencyTraceable;
+	ptpClock->timePropertiesDS.ptpTimescale = ptpClock->rtOpts->ptpTimescale;
+	ptpClock->timePropertiesDS.timeSource = ptpClock->rtOpts->timeSource;
 }
 
 void p1(PtpClock *ptpClock)
@@ -190,6 +229,7 @@ void s1(PtpClock *ptpClock, const MsgHeader *header, const MsgAnnounce *announce
 
 	if (!isFromCurrentParent)
 	{
+			ptpClock->previousParent = ptpClock->parentDS.parentPortIdentity;
 			setFlag(ptpClock->events, MASTER_CLOCK_CHANGED);
 	}
 
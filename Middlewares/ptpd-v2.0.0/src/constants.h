@@ -65,6 +65,40 @@
 #define DEFAULT_CALIBRATED_OFFSET_NS    10000       /* offset from master < 10us -> calibrated */
 #define DEFAULT_UNCALIBRATED_OFFSET_NS  1000000     /* offset from master > 1000us -> uncalibrated */
 #define MAX_ADJ_OFFSET_NS               100000000   /* max offset to try to adjust it < 100ms */
+#define DEFAULT_HOLDOVER_SAMPLES        16          /* calibrated servo updates before holdover is possible */
+#define DEFAULT_HOLDOVER_AVERAGE        16          /* drift averaging, samples */
+#define DEFAULT_HOLDOVER_TREND_PERIOD   64          /* drift rate estimation period, s */
+#define DEFAULT_HOLDOVER_TIMEOUT        86400       /* s, then free run on the last frequency */
+#define DEFAULT_HOLDOVER_REPORT         16          /* s between holdover reports */
+#define DEFAULT_STANDBY_MASTERS         2           /* foreign masters tracked besides the parent */
+#define DEFAULT_STANDBY_SAMPLES         8           /* offset samples before a standby can take over */
+#define DEFAULT_STANDBY_TIMEOUT         4           /* s without Sync before a standby is stale */
+#define DEFAULT_STANDBY_DRIFT_PERIOD    16          /* s, standby offset trend estimation period */
+#define DEFAULT_AUDIT_RECORDS           64          /* audit hash table slots, power of 2 */
+#define DEFAULT_AUDIT_SOURCES           48          /* sources audited at once, keeps probing short */
+#define DEFAULT_AUDIT_STALE             60          /* s without messages before a source can be replaced */
+#define DEFAULT_AUDIT_AVERAGE           16          /* audit statistics averaging, samples */
+#define DEFAULT_SLAVE_RECORDS           32          /* slaves tracked as master, least recently seen evicted */
+#define DEFAULT_SLAVE_BUCKETS           16          /* slave hash buckets, power of 2 */
+#define DEFAULT_SLAVE_DELAY_WINDOW      16          /* Delay_Req per path delay floor window */
+#define DEFAULT_SLAVE_AVERAGE           16          /* slave statistics averaging, samples */
+#define DEFAULT_SYNC_PAIRS              8           /* two step Syncs awaiting their Follow_Up, power of 2 */
+#define DEFAULT_DELAY_TRANSACTIONS      8           /* Delay_Req or Pdelay_Req awaiting their response, power of 2 */
+#define DEFAULT_DELAY_TRANSACTION_TIMEOUT 2         /* s before an unanswered request expires */
+#define DEFAULT_RX_BATCH                8           /* messages handled per state machine pass */
+#define DEFAULT_RX_BATCHES              4           /* passes per wakeup before yielding */
+#define DEFAULT_MANAGEMENT_REPLIES      64          /* clocks collected per management GET */
+#define DEFAULT_MANAGEMENT_DATA         32          /* largest dataField kept, PARENT_DATA_SET */
+#define DEFAULT_MANAGEMENT_BOUNDARY_HOPS 1          /* boundary clocks a management GET may cross */
+#define DEFAULT_RX_BUCKETS              16          /* message sources rate limited, least recently seen replaced */
+#define DEFAULT_RX_RATE                 32          /* messages per second accepted from a source, on top of its Sync, Follow_Up and Announce */
+#define DEFAULT_RX_RATE_MAX             512         /* messages per second, whatever a source announces */
+#define DEFAULT_RX_BURST                16          /* messages a source may send at once, at least */
+#define DEFAULT_RX_DELAY_REQ_MARGIN     4           /* Delay_Req accepted per source, times the rate of logMinDelayReqInterval */
+#define DEFAULT_ACCEPTABLE_MASTERS      8           /* acceptable master table entries */
+#define DEFAULT_SAMPLE_CALLBACKS        3           /* servo update listeners: MQTT, history, HTTP */
+#define DEFAULT_TX_TIMESTAMP_TIMEOUT    10          /* ms waited for the hardware timestamp of an event message */
+#define DEFAULT_TX_ERRORS_MAX           16          /* messages refused by lwIP in a row before the port is faulty */
 
 /* features, only change to refelect changes in implementation */
 #define NUMBER_PORTS      1
@@ -258,6 +292,69 @@ enum
 	MASTER_CLOCK_CHANGED = 0x0800,
 };
 
+/**
+ * \brief Management message actions (Table 38)
+ */
+
+enum
+{
+	MM_GET = 0,
+	MM_SET,
+	MM_RESPONSE,
+	MM_COMMAND,
+	MM_ACKNOWLEDGE,
+};
+
+/**
+ * \brief TLV types (Table 34)
+ */
+
+enum
+{
+	TLV_MANAGEMENT = 0x0001,
+	TLV_MANAGEMENT_ERROR_STATUS = 0x0002,
+};
+
+/**
+ * \brief Management TLV ids (Table 40)
+ */
+
+enum
+{
+	MM_NULL_MANAGEMENT = 0x0000,
+	MM_DEFAULT_DATA_SET = 0x2000,
+	MM_CURRENT_DATA_SET = 0x2001,
+	MM_PARENT_DATA_SET = 0x2002,
+	MM_TIME_PROPERTIES_DATA_SET = 0x2003,
+	MM_PORT_DATA_SET = 0x2004,
+	MM_PRIORITY1 = 0x2005,
+	MM_PRIORITY2 = 0x2006,
+	MM_DOMAIN = 0x2007,
+	MM_SLAVE_ONLY = 0x2008,
+	MM_LOG_ANNOUNCE_INTERVAL = 0x2009,
+	MM_ANNOUNCE_RECEIPT_TIMEOUT = 0x200A,
+	MM_LOG_SYNC_INTERVAL = 0x200B,
+	MM_ENABLE_PORT = 0x200D,
+	MM_DISABLE_PORT = 0x200E,
+	MM_CLOCK_ACCURACY = 0x2010,
+	MM_DELAY_MECHANISM = 0x6000,
+};
+
+/**
+ * \brief Management error ids (Table 72)
+ */
+
+enum
+{
+	MM_ERROR_RESPONSE_TOO_BIG = 0x0001,
+	MM_ERROR_NO_SUCH_ID = 0x0002,
+	MM_ERROR_WRONG_LENGTH = 0x0003,
+	MM_ERROR_WRONG_VALUE = 0x0004,
+	MM_ERROR_NOT_SETABLE = 0x0005,
+	MM_ERROR_NOT_SUPPORTED = 0x0006,
+	MM_ERROR_GENERAL_ERROR = 0xFFFE,
+};
+
 /**
  * \brief ptp time scale
  */
@@ -10,6 +10,7 @@
  */
 
 #include <stdbool.h>
+#include "constants.h"
 #include "dep/constants_dep.h"
 #include "dep/datatypes_dep.h"
 
@@ -227,13 +228,22 @@ typedef struct
  * \brief Management message fields (Table 37 of the spec)
  */
 
+typedef struct
+{
+    enum16bit_t tlvType;
+    uint16_t lengthField;
+    enum16bit_t managementId;
+    enum16bit_t managementErrorId;  /**< TLV_MANAGEMENT_ERROR_STATUS only */
+    const octet_t *dataField;       /**< left in the message buffer, NULL for an error status */
+} ManagementTLV;
+
 typedef struct
 {
     PortIdentity targetPortIdentity;
     uint8_t startingBoundaryHops;
     uint8_t boundaryHops;
     enum4bit_t actionField;
-    char *tlv;
+    ManagementTLV tlv;
 } MsgManagement;
 
 
@@ -331,6 +341,96 @@ typedef struct
     enum8bit_t timeSource; /**< spec 7.6.2.6 */
 } TimePropertiesDS;
 
+/**
+ * \struct TimeSource
+ * \brief Quality and time properties of the local time source,
+ * announced while this clock is the grandmaster
+ */
+
+typedef struct
+{
+    ClockQuality clockQuality;
+    int16_t currentUtcOffset;
+    bool currentUtcOffsetValid;
+    bool timeTraceable;
+    bool frequencyTraceable;
+    bool ptpTimescale;
+    enum8bit_t timeSource; /**< spec 7.6.2.6 */
+} TimeSource;
+
+/**
+ * \struct SyncInfo
+ * \brief Snapshot of the synchronisation state, for other time services
+ */
+
+typedef struct
+{
+    uint8_t portState;
+    int16_t stepsRemoved;
+    ClockQuality grandmasterClockQuality;
+    TimeInternal offsetFromMaster;
+    TimeInternal meanPathDelay;
+    int16_t currentUtcOffset;
+    bool currentUtcOffsetValid;
+    bool ptpTimescale;
+    enum8bit_t timeSource;
+} SyncInfo;
+
+/**
+ * \struct PtpCounters
+ * \brief Snapshot of the protocol and servo counters, for the metrics exporters
+ */
+
+typedef struct
+{
+    uint8_t portState;
+    uint32_t stateChanges;
+    uint32_t syncSequenceGaps;      /**< Syncs of the parent lost on the way */
+    uint32_t orphanSyncs;           /**< missed Follow_Ups */
+    uint32_t orphanFollowUps;
+    uint32_t lateDelayResps;
+    uint32_t expiredDelayReqs;
+    uint32_t servoUpdates;
+    uint32_t clockSteps;
+    uint32_t standbySwitches;
+    uint32_t rxDropped[RX_DROP_COUNT];
+    uint32_t txBusy;                /**< messages not sent, template still held by the driver */
+    int32_t offsetFromMaster;       /**< ns, saturated */
+    int32_t meanPathDelay;          /**< ns */
+    int32_t observedDrift;          /**< ppb */
+} PtpCounters;
+
+/**
+ * \struct ServoSample
+ * \brief One servo update, for the telemetry publishers
+ */
+
+typedef struct
+{
+    uint32_t seconds;               /**< local ingress of the Sync */
+    uint32_t nanoseconds;
+    int32_t offsetFromMaster;       /**< ns, saturated */
+    int32_t meanPathDelay;          /**< ns */
+    int32_t observedDrift;          /**< ppb */
+    uint8_t portState;
+} ServoSample;
+
+/**
+ * \struct HoldoverInfo
+ * \brief Holdover state reported to other time services
+ */
+
+typedef struct
+{
+    bool active;
+    uint32_t seconds;       /**< since the master was lost */
+    uint32_t error;         /**< estimated time error, ns */
+    uint32_t offset;        /**< offset from master when lost, ns */
+    int32_t frequency;      /**< applied frequency correction, ppb */
+    ClockQuality grandmasterClockQuality; /**< of the lost master */
+    enum8bit_t timeSource;
+} HoldoverInfo;
+
 
 /**
  * \struct PortDS
@@ -351,6 +451,20 @@ typedef struct
     uint4bit_t versionNumber;
 } PortDS;
 
+/**
+ * \struct PtpDataSets
+ * \brief Copy of the data sets taken at once, for the management exporters
+ */
+
+typedef struct
+{
+    DefaultDS defaultDS;
+    CurrentDS currentDS;
+    ParentDS parentDS;
+    TimePropertiesDS timePropertiesDS;
+    PortDS portDS;
+} PtpDataSets;
+
 
 /**
  * \struct ForeignMasterDS
@@ -382,6 +496,180 @@ typedef struct
     int16_t sOffset;
 } Servo;
 
+/**
+ * \struct Holdover
+ * \brief Frequency learned while locked, predicted after master loss
+ */
+
+typedef struct
+{
+    bool valid;             /**< enough locked samples to hold over */
+    bool active;            /**< running on the predicted frequency */
+    volatile bool release;  /**< another reference took the clock */
+    bool notify;            /**< info changed, report pending */
+    uint32_t samples;
+    float frequency;        /**< averaged servo drift, ppb */
+    float wander;           /**< mean deviation from the average, ppb */
+    float driftRate;        /**< frequency trend, ppb/s */
+    float trendFrequency;   /**< average at the start of the trend period */
+    int32_t trendTime;
+    int32_t offset;         /**< last offset from master, ns */
+    int32_t current;        /**< predicted drift, ppb */
+    int32_t startTime;
+    int32_t lastUpdate;
+    int32_t lastReport;
+    HoldoverInfo info;
+} Holdover;
+
+/**
+ * \struct StandbyMaster
+ * \brief Offset and delay tracked against a foreign master besides the parent
+ */
+
+typedef struct
+{
+    PortIdentity portIdentity;
+    bool valid;
+    bool waitingForFollowUp;
+    bool tmsValid;
+    bool driftValid;
+    uint16_t recvSyncSequenceId;
+    TimeInternal syncReceive;
+    TimeInternal correctionSync;
+    TimeInternal Tms;
+    TimeInternal offsetFromMaster;  /**< filtered */
+    TimeInternal meanPathDelay;     /**< filtered */
+    Filter ofm_filt;
+    Filter owd_filt;
+    uint32_t samples;
+    int32_t lastSync;               /**< local seconds of the last Sync */
+    int32_t drift;                  /**< offset change rate against the local clock, ppb */
+    int32_t driftOffset;
+    int32_t driftTime;
+} StandbyMaster;
+
+/**
+ * \struct SyncPair
+ * \brief Two step Sync and Follow_Up of one sequenceId, received in either order
+ */
+
+typedef struct
+{
+    int16_t sequenceId;
+    bool haveSync;
+    bool haveFollowUp;
+    TimeInternal syncReceive;
+    TimeInternal correctionSync;
+    TimeInternal preciseOrigin;
+    TimeInternal correctionFollowUp;
+} SyncPair;
+
+/**
+ * \struct DelayTransaction
+ * \brief Delay_Req or Pdelay_Req sent and not answered yet
+ */
+
+typedef struct
+{
+    int16_t sequenceId;
+    bool used;
+    bool answered;                  /**< response from the parent applied */
+    bool waitingForFollowUp;        /**< two step Pdelay_Resp received */
+    TimeInternal send;              /**< t1 (P2P) or t3 (E2E), zero if no TX timestamp */
+    TimeInternal requestReceipt;    /**< t2, P2P */
+    TimeInternal responseReceive;   /**< t4, P2P */
+    TimeInternal correction;        /**< Pdelay_Resp correction, two step */
+} DelayTransaction;
+
+/**
+ * \struct AuditRecord
+ * \brief Sync and Announce streams of one master in one domain, seen passively
+ */
+
+typedef struct
+{
+    PortIdentity portIdentity;
+    uint8_t domainNumber;
+    bool used;
+    int32_t lastSeen;               /**< local seconds */
+
+    /* Sync stream */
+    uint32_t syncs;
+    uint32_t followUps;
+    uint32_t missing;               /**< sequence gaps */
+    uint32_t outOfOrder;            /**< repeated or late sequence ids */
+    int16_t lastSequenceId;
+    int8_t logSyncInterval;
+    bool waitingForFollowUp;
+    int16_t followUpSequenceId;
+    TimeInternal syncReceive;       /**< local ingress of the last Sync */
+    TimeInternal correctionSync;
+    int32_t intervalError;          /**< mean deviation from the nominal interval, ns */
+
+    /* Local clock minus master, path delay included */
+    TimeInternal offset;
+    int32_t offsetStep;             /**< last offset change, ns */
+    int32_t drift;                  /**< averaged offset change rate, ppb */
+    int32_t jitter;                 /**< averaged second difference of the offset, ns */
+    uint32_t offsetSamples;
+
+    /* Announce content */
+    uint32_t announces;
+    ClockIdentity grandmasterIdentity;
+    ClockQuality grandmasterClockQuality;
+    uint8_t grandmasterPriority1;
+    uint8_t grandmasterPriority2;
+    int16_t stepsRemoved;
+    int16_t currentUtcOffset;
+    enum8bit_t timeSource;
+    octet_t flagField1;
+} AuditRecord;
+
+/**
+ * \struct SlaveRecord
+ * \brief Delay_Req stream of one slave, seen as master
+ */
+
+typedef struct
+{
+    PortIdentity portIdentity;
+    int8_t next;                    /**< hash chain */
+    int8_t newer, older;            /**< recently seen list */
+    int32_t firstSeen, lastSeen;    /**< local seconds */
+
+    /* Request stream */
+    uint32_t requests;
+    uint32_t missing;               /**< sequence gaps */
+    uint32_t outOfOrder;            /**< repeated or late sequence ids */
+    int16_t lastSequenceId;
+    TimeInternal lastRequest;       /**< ingress of the last Delay_Req */
+    int32_t interval;               /**< averaged request spacing, ns */
+
+    /* Delay_Req ingress minus origin, slave offset plus path delay */
+    int32_t apparentDelay;          /**< last, ns */
+    int32_t pathDelay;              /**< floor of the apparent delay over the last window, ns */
+    int32_t windowMin;
+    uint16_t windowCount;
+    uint32_t delaySamples;          /**< since the slave was last seen synchronised */
+    bool timestamped;               /**< slave fills originTimestamp */
+    TimeInternal offset;            /**< slave minus master relative to its best aligned request */
+    int32_t jitter;                 /**< averaged change of the apparent delay, ns */
+} SlaveRecord;
+
+/**
+ * \struct ManagementReply
+ * \brief Answer of one clock to a management GET sent to the domain
+ */
+
+typedef struct
+{
+    PortIdentity portIdentity;
+    enum16bit_t managementId;
+    enum16bit_t managementErrorId;  /**< zero if the data is valid */
+    uint16_t length;                /**< dataField bytes kept */
+    octet_t data[DEFAULT_MANAGEMENT_DATA];
+} ManagementReply;
+
 /**
  * \struct RunTimeOpts
  * \brief Program options set at run-time
@@ -397,6 +685,11 @@ typedef struct
     uint8_t domainNumber;
     bool slaveOnly;
     int16_t currentUtcOffset;
+    bool currentUtcOffsetValid;
+    bool timeTraceable;
+    bool frequencyTraceable;
+    bool ptpTimescale;
+    enum8bit_t timeSource;
     octet_t ifaceName[IFACE_NAME_LENGTH];
     enum8bit_t stats;
     octet_t unicastAddress[NET_ADDRESS_LENGTH];
@@ -440,6 +733,7 @@ typedef struct
 
 
     octet_t msgObuf[PACKET_SIZE];   /**< buffer for outgoing message */
+    uint16_t templateDirty;         /**< transmit templates to rebuild from the data sets */
     octet_t msgIbuf[PACKET_SIZE];   /** <buffer for incomming message */
     ssize_t msgIbufLength;          /**< length of incomming message */
 
@@ -457,10 +751,9 @@ typedef struct
     TimeInternal
          timestamp_delayReqRecieve;     /**< timestamp of delay request message */
 
-    TimeInternal correctionField_sync;  /**< correction field of Sync and FollowUp
-                                                      messages */
-    TimeInternal correctionField_pDelayResp; /**< correction fieald of peedr
-                                                              delay response */
+    DelayTransaction delayTransactions[DEFAULT_DELAY_TRANSACTIONS]; /**< indexed by sequenceId */
+    uint32_t lateDelayResps;        /**< answered after a newer request was sent */
+    uint32_t expiredDelayReqs;      /**< never answered */
 
     /* MsgHeader  PdelayReqHeader; */ /**< last recieved peer delay reques header
                                                   */
@@ -469,14 +762,25 @@ typedef struct
     int16_t sentDelayReqSequenceId;
     int16_t sentSyncSequenceId;
     int16_t sentAnnounceSequenceId;
+    int16_t sentManagementSequenceId;
+    enum16bit_t managementRequestId;    /**< last management GET sent to the domain */
 
     int16_t recvPDelayReqSequenceId;
-    int16_t recvSyncSequenceId;
 
-    bool waitingForFollowUp; /**< true if sync message was recieved and 2step
-                                         flag is set */
-    bool waitingForPDelayRespFollowUp; /**< true if PDelayResp message was
-                                                      recieved and 2step flag is set */
+    SyncPair syncPairs[DEFAULT_SYNC_PAIRS]; /**< indexed by sequenceId */
+    int16_t recvSyncSequenceId;     /**< last Sync applied to the servo */
+    bool syncApplied;               /**< recvSyncSequenceId is valid */
+    uint32_t orphanSyncs;           /**< dropped before their Follow_Up came */
+    uint32_t orphanFollowUps;       /**< dropped before their Sync came */
+    uint32_t earlyFollowUps;        /**< paired, received before their Sync */
+    uint32_t lateSyncPairs;         /**< completed after a newer Sync was applied */
+    int16_t lastSyncSequenceId;     /**< last Sync received from the parent */
+    bool syncSequenceValid;         /**< lastSyncSequenceId is valid */
+    uint32_t syncSequenceGaps;
+
+    uint32_t stateChanges;
+    uint32_t servoUpdates;          /**< offsets applied to the clock */
+    uint32_t clockSteps;
 
     Filter ofm_filt; /**< filter offset from master */
     Filter owd_filt; /**< filter one way delay */
@@ -484,6 +788,14 @@ typedef struct
     int16_t offsetHistory[2];
     int32_t observedDrift;
 
+    Holdover holdover;
+
+    bool audit;                     /**< listen only, record every master */
+
+    StandbyMaster standby[DEFAULT_STANDBY_MASTERS]; /**< hot standby masters */
+    PortIdentity previousParent;    /**< parent before the last MASTER_CLOCK_CHANGED */
+    uint32_t standbySwitches;
+
     bool messageActivity;
 
     NetPath netPath;
@@ -67,10 +67,40 @@
 
 #define MM_STARTING_BOUNDARY_HOPS  0x7fff
 
-/* Must be a power of 2 */
-#define PBUF_QUEUE_SIZE 4
+/* Messages per port queue, must be a power of 2. Messages are copied out
+ * of the driver receive buffers, a full queue never holds the RX pool. */
+#define PBUF_QUEUE_SIZE 8
 #define PBUF_QUEUE_MASK (PBUF_QUEUE_SIZE - 1)
 
+/* Reasons of the receive filter to drop a message before queuing it */
+enum {
+	RX_DROP_SHORT = 0,          /* shorter than a header */
+	RX_DROP_DOMAIN,             /* other domain, outside audit */
+	RX_DROP_NOT_ACCEPTABLE,     /* Announce, Sync or Follow_Up of a master not in the acceptable table */
+	RX_DROP_RATE,               /* source above its rate */
+	RX_DROP_QUEUE_FULL,
+	RX_DROP_COUNT
+};
+
+/* Preformatted transmit messages, one preallocated pbuf each */
+enum {
+	TEMPLATE_ANNOUNCE = 0,
+	TEMPLATE_SYNC,
+	TEMPLATE_FOLLOW_UP,
+	TEMPLATE_DELAY_REQ,
+	TEMPLATE_DELAY_RESP,
+	TEMPLATE_PDELAY_REQ,
+	TEMPLATE_PDELAY_RESP,
+	TEMPLATE_PDELAY_RESP_FOLLOW_UP,
+	TEMPLATE_COUNT
+};
+
+#define TEMPLATE_SIZE  64 /* largest template is the announce message */
+#define TEMPLATE_ALL   ((1 << TEMPLATE_COUNT) - 1)
+
+/* Replies to other ports, sent on a copy rather than dropped while the template is busy */
+#define TEMPLATE_RESPONSES ((1 << TEMPLATE_DELAY_RESP) | (1 << TEMPLATE_PDELAY_RESP) | (1 << TEMPLATE_PDELAY_RESP_FOLLOW_UP))
+
 /* others */
 
 #define SCREEN_BUFSZ  128
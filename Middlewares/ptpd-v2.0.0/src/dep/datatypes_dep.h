@@ -47,15 +47,69 @@ typedef struct
 	int32_t n;
 } Filter;
 
+// Received message, copied out of the driver buffer
+typedef struct
+{
+	int32_t   seconds;          /* ingress timestamp */
+	int32_t   nanoseconds;
+	uint32_t  order;            /* arrival count over both ports */
+	int16_t   length;
+	octet_t   buf[PACKET_SIZE];
+} RxMessage;
+
 // Network  buffer queue
 typedef struct
 {
-	void      *pbuf[PBUF_QUEUE_SIZE];
+	RxMessage msg[PBUF_QUEUE_SIZE];
 	int16_t   head;
 	int16_t   tail;
 	sys_mutex_t mutex;
 } BufQueue;
 
+// Token buckets of a message source
+typedef struct
+{
+	uint8_t   source[CLOCK_IDENTITY_LENGTH + 2];   /* sourcePortIdentity as received */
+	uint32_t  tokens;       /* thousandths of a message */
+	uint32_t  delayTokens;  /* Delay_Req and Pdelay_Req, limited on their own */
+	uint32_t  refill;       /* sys_now() of the last refill, ms */
+	int8_t    logSyncInterval;      /* as announced in the Sync headers */
+	int8_t    logAnnounceInterval;
+	bool      valid;
+} RxBucket;
+
+// Early filter of the receive callbacks, in front of the queues. The
+// identities are written by the PTP thread and read under a critical section,
+// the acceptable masters are scanned in a copy the lwIP thread refreshes there
+// when acceptableVersion moves. Buckets and counters are lwIP thread only
+typedef struct
+{
+	RxBucket  bucket[DEFAULT_RX_BUCKETS];
+	uint8_t   self[CLOCK_IDENTITY_LENGTH + 2];
+	uint8_t   parent[CLOCK_IDENTITY_LENGTH + 2];   /* never limited */
+	bool      hasParent;
+	uint8_t   standby[DEFAULT_STANDBY_MASTERS][CLOCK_IDENTITY_LENGTH + 2];  /* tracked, never limited */
+	uint8_t   standbyCount;
+	uint16_t  delayReqRate;     /* Delay_Req per second accepted from a source */
+	uint8_t   domainNumber;
+	bool      anyDomain;
+	uint8_t   acceptable[DEFAULT_ACCEPTABLE_MASTERS][CLOCK_IDENTITY_LENGTH];
+	uint8_t   acceptableCount;  /* 0 accepts any master */
+	uint32_t  acceptableVersion;
+	uint8_t   rxAcceptable[DEFAULT_ACCEPTABLE_MASTERS][CLOCK_IDENTITY_LENGTH];
+	uint8_t   rxAcceptableCount;
+	uint32_t  rxAcceptableVersion;
+	uint32_t  dropped[RX_DROP_COUNT];
+} RxFilter;
+
+// Preallocated pbuf holding a preformatted message, with room for the
+// UDP/IP/Ethernet headers prepended by lwIP on transmission
+typedef struct
+{
+	struct pbuf_custom pc;
+	uint8_t   mem[LWIP_MEM_ALIGN_SIZE(PBUF_TRANSPORT) + TEMPLATE_SIZE];
+} TxTemplate;
+
 // Struct used  to store network datas
 typedef struct
 {
@@ -68,6 +122,19 @@ typedef struct
 
 	BufQueue    eventQ;
 	BufQueue    generalQ;
+	uint32_t    rxOrder;        /* messages queued, lwIP thread only */
+	bool        rxQueueFull;    /* last message dropped, lwIP thread only */
+	RxFilter    filter;
+
+	TxTemplate  txTemplate[TEMPLATE_COUNT];
+	uint32_t    txTemplateBusy;
+	uint32_t    txErrors;       /* messages refused by lwIP */
+	uint32_t    txErrorsInRow;
+
+	struct pbuf * volatile txStampPbuf;    /* frame waiting for its transmit timestamp */
+	volatile bool txStamped;
+	int32_t     txStampSeconds;
+	int32_t     txStampNanoseconds;
 } NetPath;
 
 // Define compiler specific symbols
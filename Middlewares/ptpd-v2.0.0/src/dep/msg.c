@@ -54,6 +54,14 @@ void msgPackAnnounce(const PtpClock *ptpClock, octet_t *buf)
 	*(uint8_t*)(buf + 32) = CTRL_OTHER; /* Table 23 - controlField */
 	*(int8_t*)(buf + 33) = ptpClock->portDS.logAnnounceInterval;
 
+	/* Time properties flags (Table 20) */
+	*(uint8_t*)(buf + 7) = (ptpClock->timePropertiesDS.leap61 ? FLAG1_LEAP61 : 0) |
+		(ptpClock->timePropertiesDS.leap59 ? FLAG1_LEAP59 : 0) |
+		(ptpClock->timePropertiesDS.currentUtcOffsetValid ? FLAG1_UTC_OFFSET_VALID : 0) |
+		(ptpClock->timePropertiesDS.ptpTimescale ? FLAG1_PTP_TIMESCALE : 0) |
+		(ptpClock->timePropertiesDS.timeTraceable ? FLAG1_TIME_TRACEABLE : 0) |
+		(ptpClock->timePropertiesDS.frequencyTraceable ? FLAG1_FREQUENCY_TRACEABLE : 0);
+
 	/* Announce message */
 	memset((buf + 34), 0, 10); /* originTimestamp */
 	*(int16_t*)(buf + 44) = flip16(ptpClock->timePropertiesDS.currentUtcOffset);
@@ -288,3 +296,163 @@ void msgUnpackPDelayRespFollowUp(const octet_t *buf, MsgPDelayRespFollowUp *pres
 	memcpy(prespfollow->requestingPortIdentity.clockIdentity, (buf + 44), CLOCK_IDENTITY_LENGTH);
 	prespfollow->requestingPortIdentity.portNumber = flip16(*(int16_t*)(buf + 52));
 }
+
+/* Unpack Management message */
+void msgUnpackManagement(const octet_t *buf, MsgManagement *manage)
+{
+	memcpy(manage->targetPortIdentity.clockIdentity, (buf + 34), CLOCK_IDENTITY_LENGTH);
+	manage->targetPortIdentity.portNumber = flip16(*(int16_t*)(buf + 42));
+	manage->startingBoundaryHops = *(uint8_t*)(buf + 44);
+	manage->boundaryHops = *(uint8_t*)(buf + 45);
+	manage->actionField = *(enum4bit_t*)(buf + 46) & 0x0F;
+}
+
+/* Unpack the management TLV, the dataField stays in the buffer */
+void msgUnpackManagementPayload(const octet_t *buf, MsgManagement *manage)
+{
+	manage->tlv.tlvType = flip16(*(uint16_t*)(buf + 48));
+	manage->tlv.lengthField = flip16(*(uint16_t*)(buf + 50));
+
+	if (manage->tlv.tlvType == TLV_MANAGEMENT_ERROR_STATUS)
+	{
+		manage->tlv.managementErrorId = flip16(*(uint16_t*)(buf + 52));
+		manage->tlv.managementId = flip16(*(uint16_t*)(buf + 54));
+		manage->tlv.dataField = NULL;
+	}
+	else
+	{
+		manage->tlv.managementErrorId = 0;
+		manage->tlv.managementId = flip16(*(uint16_t*)(buf + 52));
+		manage->tlv.dataField = buf + 54;
+	}
+}
+
+/* Pack the management fields and TLV header, the dataField is written by the caller at buf + 54 */
+static int16_t msgPackManagementFields(octet_t *buf, const MsgManagement *manage)
+{
+	memcpy((buf + 34), manage->targetPortIdentity.clockIdentity, CLOCK_IDENTITY_LENGTH);
+	*(int16_t*)(buf + 42) = flip16(manage->targetPortIdentity.portNumber);
+	*(uint8_t*)(buf + 44) = manage->startingBoundaryHops;
+	*(uint8_t*)(buf + 45) = manage->boundaryHops;
+	*(uint8_t*)(buf + 46) = manage->actionField & 0x0F;
+	*(uint8_t*)(buf + 47) = 0;
+
+	*(uint16_t*)(buf + 48) = flip16(manage->tlv.tlvType);
+	*(uint16_t*)(buf + 50) = flip16(manage->tlv.lengthField);
+
+	if (manage->tlv.tlvType == TLV_MANAGEMENT_ERROR_STATUS)
+	{
+		*(uint16_t*)(buf + 52) = flip16(manage->tlv.managementErrorId);
+		*(uint16_t*)(buf + 54) = flip16(manage->tlv.managementId);
+		memset((buf + 56), 0, 4);
+	}
+	else
+	{
+		*(uint16_t*)(buf + 52) = flip16(manage->tlv.managementId);
+	}
+
+	*(int16_t*)(buf + 2) = flip16(MANAGEMENT_LENGTH + 4 + manage->tlv.lengthField);
+
+	return MANAGEMENT_LENGTH + 4 + manage->tlv.lengthField;
+}
+
+/* Pack Management message, returns its length */
+int16_t msgPackManagement(const PtpClock *ptpClock, octet_t *buf, const MsgManagement *manage)
+{
+	/* Changes in header */
+	*(char*)(buf + 0) = *(char*)(buf + 0) & 0xF0; //RAZ messageType
+	*(char*)(buf + 0) = *(char*)(buf + 0) | MANAGEMENT; //Table 19
+	*(uint8_t*)(buf + 6) = 0;
+	*(uint8_t*)(buf + 7) = 0;
+	*(int16_t*)(buf + 30) = flip16(ptpClock->sentManagementSequenceId);
+	*(uint8_t*)(buf + 32) = CTRL_MANAGEMENT; //Table 23
+	*(int8_t*)(buf + 33) = 0x7F; //Table 24
+
+	return msgPackManagementFields(buf, manage);
+}
+
+/* Pack the response to a Management message, in the domain of the request. Returns its length */
+int16_t msgPackManagementResponse(const PtpClock *ptpClock, octet_t *buf, MsgHeader *header, const MsgManagement *manage)
+{
+	/* Changes in header */
+	*(char*)(buf + 0) = *(char*)(buf + 0) & 0xF0; //RAZ messageType
+	*(char*)(buf + 0) = *(char*)(buf + 0) | MANAGEMENT; //Table 19
+	*(uint8_t*)(buf + 4) = header->domainNumber;
+	*(uint8_t*)(buf + 6) = 0;
+	*(uint8_t*)(buf + 7) = 0;
+	*(int16_t*)(buf + 30) = flip16(header->sequenceId);
+	*(uint8_t*)(buf + 32) = CTRL_MANAGEMENT; //Table 23
+	*(int8_t*)(buf + 33) = 0x7F; //Table 24
+
+	return msgPackManagementFields(buf, manage);
+}
+
+/* Build the preformatted transmit template of the given index from the data sets.
+ * Only fields that change per message are patched later (see msgPatch*) */
+void msgPackTemplate(const PtpClock *ptpClock, octet_t *buf, uint8_t index)
+{
+	const Timestamp zeroTimestamp = { { 0, 0 }, 0 };
+	MsgHeader zeroHeader;
+
+	memset(&zeroHeader, 0, sizeof(zeroHeader));
+	memset(buf, 0, TEMPLATE_SIZE);
+	msgPackHeader(ptpClock, buf);
+
+	switch (index)
+	{
+		case TEMPLATE_ANNOUNCE:
+			msgPackAnnounce(ptpClock, buf);
+			break;
+		case TEMPLATE_SYNC:
+			msgPackSync(ptpClock, buf, &zeroTimestamp);
+			break;
+		case TEMPLATE_FOLLOW_UP:
+			msgPackFollowUp(ptpClock, buf, &zeroTimestamp);
+			break;
+		case TEMPLATE_DELAY_REQ:
+			msgPackDelayReq(ptpClock, buf, &zeroTimestamp);
+			break;
+		case TEMPLATE_DELAY_RESP:
+			msgPackDelayResp(ptpClock, buf, &zeroHeader, &zeroTimestamp);
+			break;
+		case TEMPLATE_PDELAY_REQ:
+			msgPackPDelayReq(ptpClock, buf, &zeroTimestamp);
+			break;
+		case TEMPLATE_PDELAY_RESP:
+			msgPackPDelayResp(buf, &zeroHeader, &zeroTimestamp);
+			break;
+		case TEMPLATE_PDELAY_RESP_FOLLOW_UP:
+			msgPackPDelayRespFollowUp(buf, &zeroHeader, &zeroTimestamp);
+			break;
+		default:
+			break;
+	}
+}
+
+/* Patch sequenceId of a preformatted message */
+void msgPatchSequenceId(octet_t *buf, int16_t sequenceId)
+{
+	*(int16_t*)(buf + 30) = flip16(sequenceId);
+}
+
+/* Patch correctionField of a preformatted message */
+void msgPatchCorrection(octet_t *buf, int64_t correctionField)
+{
+	*(int32_t*)(buf + 8) = flip32(correctionField >> 32);
+	*(int32_t*)(buf + 12) = flip32((int32_t)correctionField);
+}
+
+/* Patch origin/receive timestamp of a preformatted message */
+void msgPatchTimestamp(octet_t *buf, const Timestamp *timestamp)
+{
+	*(int16_t*)(buf + 34) = flip16(timestamp->secondsField.msb);
+	*(uint32_t*)(buf + 36) = flip32(timestamp->secondsField.lsb);
+	*(uint32_t*)(buf + 40) = flip32(timestamp->nanosecondsField);
+}
+
+/* Patch requestingPortIdentity of a preformatted response message */
+void msgPatchRequestingPortIdentity(octet_t *buf, const PortIdentity *portIdentity)
+{
+	memcpy((buf + 44), portIdentity->clockIdentity, CLOCK_IDENTITY_LENGTH);
+	*(int16_t*)(buf + 52) = flip16(portIdentity->portNumber);
+}
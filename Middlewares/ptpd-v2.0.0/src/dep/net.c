@@ -10,19 +10,24 @@ static void netQInit(BufQueue *queue)
 	sys_mutex_new(&queue->mutex);
 }
 
-/* Put data to the network queue. */
-static bool netQPut(BufQueue *queue, void *pbuf)
+/* Copy a message into the network queue, the pbuf stays with the caller. */
+static bool netQPut(BufQueue *queue, const struct pbuf *p, const TimeInternal *time, uint32_t order)
 {
+	RxMessage *msg;
 	bool retval = FALSE;
 
 	sys_mutex_lock(&queue->mutex);
 
-	// Is there room on the queue for the buffer?
+	// Is there room on the queue for the message?
 	if (((queue->head + 1) & PBUF_QUEUE_MASK) != queue->tail)
 	{
-		// Place the buffer in the queue.
+		// Copy the message in the next slot, then publish it.
+		msg = &queue->msg[(queue->head + 1) & PBUF_QUEUE_MASK];
+		msg->seconds = time->seconds;
+		msg->nanoseconds = time->nanoseconds;
+		msg->order = order;
+		msg->length = pbuf_copy_partial(p, msg->buf, p->tot_len, 0);
 		queue->head = (queue->head + 1) & PBUF_QUEUE_MASK;
-		queue->pbuf[queue->head] = pbuf;
 		retval = TRUE;
 	}
 
@@ -31,38 +36,56 @@ static bool netQPut(BufQueue *queue, void *pbuf)
 	return retval;
 }
 
-/* Get data from the network queue. */
-static void *netQGet(BufQueue *queue)
+/* Oldest message of the network queue, NULL if empty. The slot stays valid
+ * until netQGet, only the PTP thread takes from the queue. */
+static const RxMessage *netQPeek(BufQueue *queue)
 {
-	void *pbuf = NULL;
+	const RxMessage *msg = NULL;
 
 	sys_mutex_lock(&queue->mutex);
 
-	// Is there a buffer on the queue?
+	if (queue->tail != queue->head)
+		msg = &queue->msg[(queue->tail + 1) & PBUF_QUEUE_MASK];
+
+	sys_mutex_unlock(&queue->mutex);
+
+	return msg;
+}
+
+/* Copy the oldest message out of the network queue, returns its length or 0. */
+static ssize_t netQGet(BufQueue *queue, octet_t *buf, TimeInternal *time)
+{
+	const RxMessage *msg;
+	ssize_t length = 0;
+
+	sys_mutex_lock(&queue->mutex);
+
+	// Is there a message on the queue?
 	if (queue->tail != queue->head)
 	{
-		// Get the buffer from the queue.
+		// Get the message from the queue.
 		queue->tail = (queue->tail + 1) & PBUF_QUEUE_MASK;
-		pbuf = queue->pbuf[queue->tail];
+		msg = &queue->msg[queue->tail];
+		length = msg->length;
+		memcpy(buf, msg->buf, length);
+		if (time != NULL)
+		{
+			time->seconds = msg->seconds;
+			time->nanoseconds = msg->nanoseconds;
+		}
 	}
 
 	sys_mutex_unlock(&queue->mutex);
 
-	return pbuf;
+	return length;
 }
 
-/* Free any remaining pbufs in the queue. */
+/* Drop any remaining messages in the queue. */
 static void netQEmpty(BufQueue *queue)
 {
 	sys_mutex_lock(&queue->mutex);
 
-	// Free each remaining buffer in the queue.
-	while (queue->tail != queue->head)
-	{
-		// Get the buffer from the queue.
-		queue->tail = (queue->tail + 1) & PBUF_QUEUE_MASK;
-		pbuf_free(queue->pbuf[queue->tail]);
-	}
+	queue->tail = queue->head;
 
 	sys_mutex_unlock(&queue->mutex);
 }
@@ -81,6 +104,73 @@ static bool netQCheck(BufQueue  *queue)
 	return retval;
 }
 
+/* Length and destination of each transmit template */
+static const struct
+{
+	uint16_t length;
+	bool event;
+	bool peer;
+} templateInfo[TEMPLATE_COUNT] =
+{
+	[TEMPLATE_ANNOUNCE]              = { ANNOUNCE_LENGTH, FALSE, FALSE },
+	[TEMPLATE_SYNC]                  = { SYNC_LENGTH, TRUE, FALSE },
+	[TEMPLATE_FOLLOW_UP]             = { FOLLOW_UP_LENGTH, FALSE, FALSE },
+	[TEMPLATE_DELAY_REQ]             = { DELAY_REQ_LENGTH, TRUE, FALSE },
+	[TEMPLATE_DELAY_RESP]            = { DELAY_RESP_LENGTH, FALSE, FALSE },
+	[TEMPLATE_PDELAY_REQ]            = { PDELAY_REQ_LENGTH, TRUE, TRUE },
+	[TEMPLATE_PDELAY_RESP]           = { PDELAY_RESP_LENGTH, TRUE, TRUE },
+	[TEMPLATE_PDELAY_RESP_FOLLOW_UP] = { PDELAY_RESP_FOLLOW_UP_LENGTH, FALSE, TRUE },
+};
+
+/* Templates live in NetPath, there is nothing to give back to lwIP. */
+static void netTemplateFree(struct pbuf *p)
+{
+}
+
+/* Wrap the static template storage into pbufs, leaving room for the headers. */
+static void netInitTemplates(NetPath *netPath)
+{
+	TxTemplate *template;
+	int i;
+
+	for (i = 0; i < TEMPLATE_COUNT; i++)
+	{
+		template = &netPath->txTemplate[i];
+		template->pc.custom_free_function = netTemplateFree;
+		pbuf_alloced_custom(PBUF_TRANSPORT, templateInfo[i].length, PBUF_RAM,
+				&template->pc, template->mem, sizeof(template->mem));
+	}
+
+	netPath->txTemplateBusy = 0;
+	netPath->txErrors = 0;
+	netPath->txErrorsInRow = 0;
+}
+
+/* Port whose frames are waiting for their transmit timestamp */
+static NetPath *txStampPath;
+
+/* Transmit timestamp of every frame, in whichever thread releases the
+ * descriptors. Only the frame the PTP thread waits for is kept. */
+static void netTxTimestampCallback(struct pbuf *p, const struct ptptime_t *timestamp)
+{
+	NetPath *netPath = txStampPath;
+
+	if (netPath != NULL && p != NULL && p == netPath->txStampPbuf)
+	{
+		netPath->txStampSeconds = timestamp->tv_sec;
+		netPath->txStampNanoseconds = timestamp->tv_nsec;
+		netPath->txStampPbuf = NULL;
+		netPath->txStamped = TRUE;
+	}
+}
+
+/* Mark the frame about to be sent as the one whose timestamp is wanted. */
+static void netTxTimestampArm(NetPath *netPath, struct pbuf *p, const TimeInternal *time)
+{
+	netPath->txStamped = FALSE;
+	netPath->txStampPbuf = (time != NULL) ? p : NULL;
+}
+
 /* Shut down  the UDP and network stuff */
 bool netShutdown(NetPath *netPath)
 {
@@ -128,22 +218,254 @@ static int32_t findIface(const octet_t *ifaceName, octet_t *uuid, NetPath *netPa
 	return iface->ip_addr.addr;
 }
 
+/* Token bucket of a source, the least recently refilled one is replaced when full. */
+static RxBucket *netRxBucket(RxFilter *filter, const uint8_t *source, uint32_t now)
+{
+	RxBucket *bucket = NULL;
+	int i;
+
+	for (i = 0; i < DEFAULT_RX_BUCKETS; i++)
+	{
+		RxBucket *b = &filter->bucket[i];
+
+		if (b->valid && memcmp(b->source, source, sizeof(b->source)) == 0)
+			return b;
+
+		if (bucket == NULL || !b->valid || (bucket->valid && (int32_t)(b->refill - bucket->refill) < 0))
+			bucket = b;
+	}
+
+	memcpy(bucket->source, source, sizeof(bucket->source));
+	bucket->tokens = DEFAULT_RX_BURST * 1000;
+	bucket->delayTokens = DEFAULT_RX_BURST * 1000;
+	bucket->refill = now;
+	bucket->logSyncInterval = 0;
+	bucket->logAnnounceInterval = 0;
+	bucket->valid = TRUE;
+
+	return bucket;
+}
+
+/* Messages per second of a log2 interval, within what the limits allow. */
+static uint32_t netRxPerSecond(int8_t logInterval)
+{
+	if (logInterval >= 0)
+		return 1;
+	if (logInterval < -9)
+		return DEFAULT_RX_RATE_MAX;
+
+	return 1UL << -logInterval;
+}
+
+/* Messages per second accepted from a source, its Sync, Follow_Up and
+ * Announce at the intervals it announces, plus everything else. */
+static uint32_t netRxRate(const RxBucket *bucket)
+{
+	uint32_t rate = DEFAULT_RX_RATE
+		+ 2 * netRxPerSecond(bucket->logSyncInterval)
+		+ netRxPerSecond(bucket->logAnnounceInterval);
+
+	return rate > DEFAULT_RX_RATE_MAX ? DEFAULT_RX_RATE_MAX : rate;
+}
+
+/* Refill a token bucket at rate messages per second, a quarter second of
+ * messages may come at once. */
+static void netRxRefill(uint32_t *tokens, uint32_t elapsed, uint32_t rate)
+{
+	uint32_t burst = rate / 4 > DEFAULT_RX_BURST ? rate / 4 : DEFAULT_RX_BURST;
+
+	if (elapsed > burst * 1000 / rate)
+		*tokens = burst * 1000;
+	else
+		*tokens += elapsed * rate;
+	if (*tokens > burst * 1000)
+		*tokens = burst * 1000;
+}
+
+static bool netRxTracked(const RxFilter *filter, const uint8_t *source)
+{
+	int i;
+
+	/* The selected parent, it also multicasts the Delay_Resp of every slave */
+	if (filter->hasParent && memcmp(source, filter->parent, sizeof(filter->parent)) == 0)
+		return TRUE;
+
+	for (i = 0; i < filter->standbyCount; i++)
+	{
+		if (memcmp(source, filter->standby[i], sizeof(filter->standby[i])) == 0)
+			return TRUE;
+	}
+
+	return FALSE;
+}
+
+/* Scans the copy of the lwIP thread, no lock is held. */
+static bool netRxAcceptable(const RxFilter *filter, const uint8_t *source)
+{
+	int i;
+
+	if (filter->rxAcceptableCount == 0)
+		return TRUE;
+
+	for (i = 0; i < filter->rxAcceptableCount; i++)
+	{
+		if (memcmp(filter->rxAcceptable[i], source, CLOCK_IDENTITY_LENGTH) == 0)
+			return TRUE;
+	}
+
+	return FALSE;
+}
+
+/* Decide from the header whether a message is worth queuing. Runs in the lwIP
+ * thread, so a flood is shed before it costs a copy and a pass of the PTP thread. */
+static bool netRxFilter(RxFilter *filter, const struct pbuf *p)
+{
+	uint8_t header[HEADER_LENGTH];
+	const uint8_t *source = header + 20;
+	enum4bit_t messageType;
+	int8_t logMessageInterval;
+	RxBucket *bucket;
+	uint32_t *tokens;
+	uint32_t now, elapsed;
+	uint16_t delayReqRate;
+	bool tracked;
+	int reason = -1;
+
+	if (pbuf_copy_partial(p, header, HEADER_LENGTH, 0) != HEADER_LENGTH)
+	{
+		filter->dropped[RX_DROP_SHORT]++;
+		return FALSE;
+	}
+
+	messageType = header[0] & 0x0F;
+	logMessageInterval = (int8_t)header[33];
+	now = sys_now();
+
+	/* Only what the PTP thread writes is read under the critical section:
+	 * our own messages on the multicast loop, the domain, and the parent and
+	 * standby masters, which are never limited */
+	taskENTER_CRITICAL();
+	tracked = memcmp(source, filter->self, sizeof(filter->self)) == 0 || netRxTracked(filter, source);
+	if (!tracked && !filter->anyDomain && header[4] != filter->domainNumber)
+		reason = RX_DROP_DOMAIN;
+	delayReqRate = filter->delayReqRate;
+	if (filter->rxAcceptableVersion != filter->acceptableVersion)
+	{
+		/* The table changed, rare enough to copy it here */
+		memcpy(filter->rxAcceptable, filter->acceptable, filter->acceptableCount * CLOCK_IDENTITY_LENGTH);
+		filter->rxAcceptableCount = filter->acceptableCount;
+		filter->rxAcceptableVersion = filter->acceptableVersion;
+	}
+	taskEXIT_CRITICAL();
+
+	if (tracked || reason >= 0)
+		goto done;
+
+	if ((messageType == ANNOUNCE || messageType == SYNC || messageType == FOLLOW_UP) &&
+		!netRxAcceptable(filter, source))
+	{
+		reason = RX_DROP_NOT_ACCEPTABLE;
+		goto done;
+	}
+
+	bucket = netRxBucket(filter, source, now);
+
+	/* A master runs at the intervals it announces, within DEFAULT_RX_RATE_MAX */
+	if (messageType == SYNC)
+		bucket->logSyncInterval = logMessageInterval;
+	else if (messageType == ANNOUNCE)
+		bucket->logAnnounceInterval = logMessageInterval;
+
+	elapsed = now - bucket->refill;
+	bucket->refill = now;
+	netRxRefill(&bucket->tokens, elapsed, netRxRate(bucket));
+	netRxRefill(&bucket->delayTokens, elapsed, delayReqRate);
+
+	/* Requests of the slaves are paced by our logMinDelayReqInterval */
+	if (messageType == DELAY_REQ || messageType == PDELAY_REQ)
+		tokens = &bucket->delayTokens;
+	else
+		tokens = &bucket->tokens;
+
+	if (*tokens < 1000)
+	{
+		reason = RX_DROP_RATE;
+		goto done;
+	}
+
+	*tokens -= 1000;
+
+done:
+	if (reason >= 0)
+		filter->dropped[reason]++;
+
+	return reason < 0;
+}
+
+/* Timestamp a received message and copy it to a port queue. The driver buffer
+ * is given back at once, queued PTP messages never hold the receive pool. */
+static void netRecvQueue(NetPath *netPath, BufQueue *queue, struct pbuf *p)
+{
+	TimeInternal time;
+	bool queued;
+#if defined(STM32F7)
+	struct ptptime_t ts;
+#endif
+
+	if (p->tot_len > PACKET_SIZE)
+	{
+		ERROR("netRecv: received truncated message\n");
+		pbuf_free(p);
+		return;
+	}
+
+#if defined(STM32F7)
+	/* Timestamp stored with the frame, other traffic is stamped too */
+	if (ethernetif_get_rx_timestamp(p, &ts))
+	{
+		time.seconds = ts.tv_sec;
+		time.nanoseconds = ts.tv_nsec;
+	}
+	else
+	{
+		ethernetif_ptp_get_rx_timestamp(&time); // get timestamp from hw
+	}
+#else
+	getTime(&time);
+#endif
+
+	/* Place the incoming message on the port QUEUE. */
+	queued = netQPut(queue, p, &time, netPath->rxOrder++);
+	pbuf_free(p);
+
+	if (!queued)
+	{
+		/* Reported once per run of drops, the drop counter has the rest */
+		netPath->filter.dropped[RX_DROP_QUEUE_FULL]++;
+		if (!netPath->rxQueueFull)
+			ERROR("netRecvCallback: queue full\n");
+		netPath->rxQueueFull = TRUE;
+		return;
+	}
+	netPath->rxQueueFull = FALSE;
+
+	/* Alert the PTP thread there is now something to do. */
+	ptpd_alert();
+}
+
 /* Process an incoming message on the Event port. */
 static void netRecvEventCallback(void *arg, struct udp_pcb *pcb, struct pbuf *p,
 																const ip_addr_t *addr, u16_t port)
 {
 	NetPath *netPath = (NetPath *) arg;
 
-	/* Place the incoming message on the Event Port QUEUE. */
-	if (!netQPut(&netPath->eventQ, p))
+	if (!netRxFilter(&netPath->filter, p))
 	{
 		pbuf_free(p);
-		ERROR("netRecvEventCallback: queue full\n");
 		return;
 	}
 
-	/* Alert the PTP thread there is now something to do. */
-	ptpd_alert();
+	netRecvQueue(netPath, &netPath->eventQ, p);
 }
 
 /* Process an incoming message on the General port. */
@@ -152,16 +474,13 @@ static void netRecvGeneralCallback(void *arg, struct udp_pcb *pcb, struct pbuf *
 {
 	NetPath *netPath = (NetPath *) arg;
 
-	/* Place the incoming message on the Event Port QUEUE. */
-	if (!netQPut(&netPath->generalQ, p))
+	if (!netRxFilter(&netPath->filter, p))
 	{
 		pbuf_free(p);
-		ERROR("netRecvGeneralCallback: queue full\n");
 		return;
 	}
 
-	/* Alert the PTP thread there is now something to do. */
-	ptpd_alert();
+	netRecvQueue(netPath, &netPath->generalQ, p);
 }
 
 /* Start  all of the UDP stuff */
@@ -177,6 +496,17 @@ bool netInit(NetPath *netPath, PtpClock *ptpClock)
 	/* Initialize the buffer queues. */
 	netQInit(&netPath->eventQ);
 	netQInit(&netPath->generalQ);
+	netPath->filter.delayReqRate = DEFAULT_RX_RATE;
+
+	/* Bind the transmit templates to their preallocated pbufs. */
+	netInitTemplates(netPath);
+
+	/* Event messages take their hardware timestamp from the driver callback */
+	netTxTimestampArm(netPath, NULL, NULL);
+	txStampPath = netPath;
+#if defined(STM32F7)
+	ethernetif_add_tx_timestamp_cb(netTxTimestampCallback);
+#endif
 
 	/* Find a network interface */
 	interfaceAddr.addr = findIface(ptpClock->rtOpts->ifaceName, ptpClock->portUuidField, netPath);
@@ -271,88 +601,169 @@ int32_t netSelect(NetPath *netPath, const TimeInternal *timeout)
 	return 0;
 }
 
-/* Delete all waiting packets in event queue. */
-void netEmptyEventQ(NetPath *netPath)
+/* Follow the identities and domain of the PTP thread in the receive filter. */
+void netUpdateFilter(NetPath *netPath, const PtpClock *ptpClock)
 {
-	netQEmpty(&netPath->eventQ);
+	RxFilter *filter = &netPath->filter;
+	uint8_t state = ptpClock->portDS.portState;
+	int8_t logInterval = ptpClock->portDS.delayMechanism == P2P ?
+		ptpClock->portDS.logMinPdelayReqInterval : ptpClock->portDS.logMinDelayReqInterval;
+	uint32_t delayReqRate = DEFAULT_RX_DELAY_REQ_MARGIN * netRxPerSecond(logInterval);
+	int i;
+
+	/* Never below the rate of any other source */
+	if (delayReqRate < DEFAULT_RX_RATE)
+		delayReqRate = DEFAULT_RX_RATE;
+	if (delayReqRate > DEFAULT_RX_RATE_MAX)
+		delayReqRate = DEFAULT_RX_RATE_MAX;
+
+	taskENTER_CRITICAL();
+	memcpy(filter->self, ptpClock->portDS.portIdentity.clockIdentity, CLOCK_IDENTITY_LENGTH);
+	*(int16_t*)(filter->self + CLOCK_IDENTITY_LENGTH) = flip16(ptpClock->portDS.portIdentity.portNumber);
+	memcpy(filter->parent, ptpClock->parentDS.parentPortIdentity.clockIdentity, CLOCK_IDENTITY_LENGTH);
+	*(int16_t*)(filter->parent + CLOCK_IDENTITY_LENGTH) = flip16(ptpClock->parentDS.parentPortIdentity.portNumber);
+	filter->hasParent = state == PTP_SLAVE || state == PTP_UNCALIBRATED;
+	filter->standbyCount = 0;
+	for (i = 0; i < DEFAULT_STANDBY_MASTERS; i++)
+	{
+		const PortIdentity *id = &ptpClock->standby[i].portIdentity;
+
+		if (!filter->hasParent || !ptpClock->standby[i].valid)
+			continue;
+		memcpy(filter->standby[filter->standbyCount], id->clockIdentity, CLOCK_IDENTITY_LENGTH);
+		*(int16_t*)(filter->standby[filter->standbyCount] + CLOCK_IDENTITY_LENGTH) = flip16(id->portNumber);
+		filter->standbyCount++;
+	}
+	filter->delayReqRate = delayReqRate;
+	filter->domainNumber = ptpClock->defaultDS.domainNumber;
+	filter->anyDomain = ptpClock->audit;
+	taskEXIT_CRITICAL();
 }
 
-static ssize_t netRecv(octet_t *buf, TimeInternal *time, BufQueue *msgQueue)
+/* Add a clock to the acceptable master table, FALSE if full. */
+bool netAcceptMaster(NetPath *netPath, const ClockIdentity clockIdentity)
 {
+	RxFilter *filter = &netPath->filter;
+	bool added = FALSE;
 	int i;
-	int j;
-	u16_t length;
-	struct pbuf *p;
-	struct pbuf *pcopy;
 
-	/* Get the next buffer from the queue. */
-	if ((p = (struct pbuf*) netQGet(msgQueue)) == NULL)
+	taskENTER_CRITICAL();
+	for (i = 0; i < filter->acceptableCount; i++)
 	{
-		return 0;
+		if (memcmp(filter->acceptable[i], clockIdentity, CLOCK_IDENTITY_LENGTH) == 0)
+			break;
 	}
-
-	/* Verify that we have enough space to store the contents. */
-	if (p->tot_len > PACKET_SIZE)
+	if (i < filter->acceptableCount)
 	{
-		ERROR("netRecv: received truncated message\n");
-		pbuf_free(p);
-		return 0;
+		added = TRUE;
 	}
-
-	/* Verify there is contents to copy. */
-	if (p->tot_len == 0)
+	else if (filter->acceptableCount < DEFAULT_ACCEPTABLE_MASTERS)
 	{
-		ERROR("netRecv: received empty packet\n");
-		pbuf_free(p);
-		return 0;
+		memcpy(filter->acceptable[filter->acceptableCount++], clockIdentity, CLOCK_IDENTITY_LENGTH);
+		filter->acceptableVersion++;
+		added = TRUE;
 	}
+	taskEXIT_CRITICAL();
 
+	return added;
+}
+
+/* Empty the acceptable master table, any master is accepted again. */
+void netClearAcceptable(NetPath *netPath)
+{
+	taskENTER_CRITICAL();
+	netPath->filter.acceptableCount = 0;
+	netPath->filter.acceptableVersion++;
+	taskEXIT_CRITICAL();
+}
+
+/* Delete all waiting packets in event queue. */
+void netEmptyEventQ(NetPath *netPath)
+{
+	netQEmpty(&netPath->eventQ);
+}
+
+/* TRUE if message a reached the port before message b. Timestamps decide,
+ * the arrival order at lwIP when one of them is not stamped. */
+static bool netRecvBefore(const RxMessage *a, const RxMessage *b)
+{
+	if ((a->seconds == 0 && a->nanoseconds == 0) ||
+		(b->seconds == 0 && b->nanoseconds == 0))
+		return (int32_t)(a->order - b->order) < 0;
+
+	if (a->seconds != b->seconds)
+		return a->seconds < b->seconds;
+
+	if (a->nanoseconds != b->nanoseconds)
+		return a->nanoseconds < b->nanoseconds;
+
+	return (int32_t)(a->order - b->order) < 0;
+}
+
+/* Receive the earliest message of either port, by ingress timestamp.
+ * Returns its length, 0 when both queues are empty. */
+ssize_t netRecv(NetPath *netPath, octet_t *buf, TimeInternal *time)
+{
+	const RxMessage *event = netQPeek(&netPath->eventQ);
+	const RxMessage *general = netQPeek(&netPath->generalQ);
+
+	if (event != NULL && (general == NULL || netRecvBefore(event, general)))
+		return netQGet(&netPath->eventQ, buf, time);
+
+	if (general != NULL)
+		return netQGet(&netPath->generalQ, buf, time);
+
+	return 0;
+}
+
+/* Read the transmit timestamp of the message just sent. */
+static void netTxTimestamp(NetPath *netPath, TimeInternal *time)
+{
 	if (time != NULL)
 	{
 #if defined(STM32F7)
-        ethernetif_ptp_get_rx_timestamp(time); // get timestamp from hw
-#else
-		getTime(time);
-#endif
-	}
+		uint32_t start = sys_now();
 
-	/* Get the length of the buffer to copy. */
-	length = p->tot_len;
+		/* Another thread may release the frame first, its timestamp is kept either way */
+		while (!netPath->txStamped && sys_now() - start < DEFAULT_TX_TIMESTAMP_TIMEOUT)
+			ethernetif_wait_tx(1);
 
-	/* Copy the pbuf payload into the buffer. */
-	pcopy = p;
-	j = 0;
-	for (i = 0; i < length; i++)
-	{
-		// Copy the next byte in the payload.
-		buf[i] = ((u8_t *)pcopy->payload)[j++];
-
-		// Skip to the next buffer in the payload?
-		if (j == pcopy->len)
+		netPath->txStampPbuf = NULL;
+		if (netPath->txStamped)
+		{
+			time->seconds = netPath->txStampSeconds; // get timestamp from hw
+			time->nanoseconds = netPath->txStampNanoseconds;
+		}
+		else
 		{
-			// Move to the next buffer.
-			pcopy = pcopy->next;
-			j = 0;
+			ERROR("netSend: no transmit timestamp\n");
+			getTime(time);
 		}
+#else
+		getTime(time); // get timestamp from counter
+#endif
+		DBGV("netSend: %d sec %d nsec\n", (int)time->seconds, (int)time->nanoseconds);
+	} else {
+		DBGV("netSend\n");
 	}
-
-	/* Free up the pbuf (chain). */
-	pbuf_free(p);
-
-	return length;
 }
 
-ssize_t netRecvEvent(NetPath *netPath, octet_t *buf, TimeInternal *time)
+/* Count a message lwIP refused, its transmit time is cleared so nothing
+ * follows up on it. */
+static void netTxFailed(NetPath *netPath, TimeInternal *time)
 {
-	return netRecv(buf, time, &netPath->eventQ);
-}
+	netTxTimestampArm(netPath, NULL, NULL);
+	netPath->txErrors++;
+	netPath->txErrorsInRow++;
 
-ssize_t netRecvGeneral(NetPath *netPath, octet_t *buf, TimeInternal *time)
-{
-	return netRecv(buf, time, &netPath->generalQ);
+	if (time != NULL)
+	{
+		time->seconds = 0;
+		time->nanoseconds = 0;
+	}
 }
 
-static ssize_t netSend(const octet_t *buf, int16_t  length, TimeInternal *time, const int32_t * addr, struct udp_pcb * pcb)
+static ssize_t netSend(NetPath *netPath, const octet_t *buf, int16_t  length, TimeInternal *time, const int32_t * addr, struct udp_pcb * pcb)
 {
 	err_t result;
 	struct pbuf * p;
@@ -379,6 +790,7 @@ static ssize_t netSend(const octet_t *buf, int16_t  length, TimeInternal *time,
 //	printf("\n");
 
 	/* send the buffer. */
+	netTxTimestampArm(netPath, p, time);
 #if PROTOCOL == IEEE802_3
 	result = raw_sendto(pcb, p, (void *)addr);
 #else
@@ -386,22 +798,13 @@ static ssize_t netSend(const octet_t *buf, int16_t  length, TimeInternal *time,
 #endif
 	if (ERR_OK != result)
 	{
+		netTxFailed(netPath, time);
 		ERROR("netSend: Failed to send data (%d)\n", result);
 		goto fail02;
 	}
 
-	if (time != NULL)
-	{
-#if defined(STM32F7)
-        ethernetif_ptp_get_tx_timestamp(time); // get timestamp from hw
-#else
-		getTime(time); // get timestamp from counter
-#endif
-		DBGV("netSend: %d sec %d nsec\n", (int)time->seconds, (int)time->nanoseconds);
-	} else {
-		DBGV("netSend\n");
-	}
-
+	netPath->txErrorsInRow = 0;
+	netTxTimestamp(netPath, time);
 
 fail02:
 	pbuf_free(p);
@@ -414,20 +817,91 @@ fail01:
 
 ssize_t netSendEvent(NetPath *netPath, const octet_t *buf, int16_t  length, TimeInternal *time)
 {
-	return netSend(buf, length, time, &netPath->multicastAddr, netPath->eventPcb);
+	return netSend(netPath, buf, length, time, &netPath->multicastAddr, netPath->eventPcb);
 }
 
 ssize_t netSendGeneral(NetPath *netPath, const octet_t *buf, int16_t  length)
 {
-	return netSend(buf, length, NULL, &netPath->multicastAddr, netPath->generalPcb);
+	return netSend(netPath, buf, length, NULL, &netPath->multicastAddr, netPath->generalPcb);
 }
 
 ssize_t netSendPeerGeneral(NetPath *netPath, const octet_t *buf, int16_t  length)
 {
-	return netSend(buf, length, NULL, &netPath->peerMulticastAddr, netPath->generalPcb);
+	return netSend(netPath, buf, length, NULL, &netPath->peerMulticastAddr, netPath->generalPcb);
 }
 
 ssize_t netSendPeerEvent(NetPath *netPath, const octet_t *buf, int16_t  length, TimeInternal* time)
 {
-	return netSend(buf, length, time, &netPath->peerMulticastAddr, netPath->eventPcb);
+	return netSend(netPath, buf, length, time, &netPath->peerMulticastAddr, netPath->eventPcb);
+}
+
+/* Get the payload of a transmit template for patching. Returns NULL while the
+ * Ethernet driver still holds the pbuf of the previous transmission. */
+octet_t *netGetTemplate(NetPath *netPath, uint8_t index)
+{
+	struct pbuf *p = &netPath->txTemplate[index].pc.pbuf;
+
+	if (p->ref > 1)
+	{
+#if defined(STM32F7)
+		ethernetif_release_tx();
+#endif
+		if (p->ref > 1)
+			return NULL;
+	}
+
+	return (octet_t *) p->payload;
+}
+
+/* Send a patched transmit template, the pbuf is reused so nothing is allocated or copied.
+ * A message lwIP refuses is counted and its time cleared, 0 is returned only
+ * once DEFAULT_TX_ERRORS_MAX messages in a row failed. */
+ssize_t netSendTemplate(NetPath *netPath, uint8_t index, TimeInternal *time)
+{
+	err_t result;
+	struct pbuf *p = &netPath->txTemplate[index].pc.pbuf;
+	struct udp_pcb *pcb = templateInfo[index].event ? netPath->eventPcb : netPath->generalPcb;
+	const int32_t *addr = templateInfo[index].peer ? &netPath->peerMulticastAddr : &netPath->multicastAddr;
+
+	/* send the buffer. */
+	netTxTimestampArm(netPath, p, time);
+#if PROTOCOL == IEEE802_3
+	result = raw_sendto(pcb, p, (void *)addr);
+#else
+	result = udp_sendto(pcb, p, (void *)addr, pcb->local_port);
+#endif
+
+	/* lwIP leaves its headers prepended to a caller owned pbuf, move the
+	 * payload back to the message so the template can be patched again. */
+	pbuf_remove_header(p, p->len - templateInfo[index].length);
+
+	if (ERR_OK != result)
+	{
+		netTxFailed(netPath, time);
+
+		/* Out of memory or no route yet passes like a frame lost on the wire */
+		if (netPath->txErrorsInRow < DEFAULT_TX_ERRORS_MAX)
+		{
+			DBG("netSendTemplate: Failed to send data (%d)\n", result);
+			return templateInfo[index].length;
+		}
+
+		ERROR("netSendTemplate: Failed to send data (%d)\n", result);
+		return 0;
+	}
+
+	netPath->txErrorsInRow = 0;
+	netTxTimestamp(netPath, time);
+
+	return templateInfo[index].length;
+}
+
+/* Send a message packed like a template into a buffer of the caller, copied
+ * into a new pbuf. Used while the driver still holds the template. */
+ssize_t netSendCopy(NetPath *netPath, uint8_t index, const octet_t *buf, TimeInternal *time)
+{
+	struct udp_pcb *pcb = templateInfo[index].event ? netPath->eventPcb : netPath->generalPcb;
+	const int32_t *addr = templateInfo[index].peer ? &netPath->peerMulticastAddr : &netPath->multicastAddr;
+
+	return netSend(netPath, buf, templateInfo[index].length, time, addr, pcb);
 }
@@ -113,6 +113,11 @@ void msgPackPDelayResp(octet_t*, const MsgHeader*, const Timestamp*);
 void msgPackPDelayRespFollowUp(octet_t*, const MsgHeader*, const Timestamp*);
 int16_t msgPackManagement(const PtpClock*,  octet_t*, const MsgManagement*);
 int16_t msgPackManagementResponse(const PtpClock*,  octet_t*, MsgHeader*, const MsgManagement*);
+void msgPackTemplate(const PtpClock*, octet_t*, uint8_t);
+void msgPatchSequenceId(octet_t*, int16_t);
+void msgPatchCorrection(octet_t*, int64_t);
+void msgPatchTimestamp(octet_t*, const Timestamp*);
+void msgPatchRequestingPortIdentity(octet_t*, const PortIdentity*);
 /** \}*/
 
 /** \name net.c (Linux API dependent)
@@ -122,13 +127,18 @@ int16_t msgPackManagementResponse(const PtpClock*,  octet_t*, MsgHeader*, const
 bool  netInit(NetPath*, PtpClock*);
 bool  netShutdown(NetPath*);
 int32_t netSelect(NetPath*, const TimeInternal*);
-ssize_t netRecvEvent(NetPath*, octet_t*, TimeInternal*);
-ssize_t netRecvGeneral(NetPath*, octet_t*, TimeInternal*);
+ssize_t netRecv(NetPath*, octet_t*, TimeInternal*);
 ssize_t netSendEvent(NetPath*, const octet_t*, int16_t, TimeInternal*);
 ssize_t netSendGeneral(NetPath*, const octet_t*, int16_t);
 ssize_t netSendPeerGeneral(NetPath*, const octet_t*, int16_t);
 ssize_t netSendPeerEvent(NetPath*, const octet_t*, int16_t, TimeInternal*);
+octet_t *netGetTemplate(NetPath*, uint8_t);
+ssize_t netSendTemplate(NetPath*, uint8_t, TimeInternal*);
+ssize_t netSendCopy(NetPath*, uint8_t, const octet_t*, TimeInternal*);
 void netEmptyEventQ(NetPath *netPath);
+void netUpdateFilter(NetPath*, const PtpClock*);
+bool netAcceptMaster(NetPath*, const ClockIdentity);
+void netClearAcceptable(NetPath*);
 /** \}*/
 
 /** \name servo.c
@@ -140,6 +150,15 @@ void updatePeerDelay(PtpClock*, const TimeInternal*, bool);
 void updateDelay(PtpClock*, const TimeInternal*, const TimeInternal*, const TimeInternal*);
 void updateOffset(PtpClock *, const TimeInternal*, const TimeInternal*, const TimeInternal*);
 void updateClock(PtpClock*);
+void startHoldover(PtpClock*);
+void updateHoldover(PtpClock*);
+void stopHoldover(PtpClock*);
+StandbyMaster *findStandby(PtpClock*, const PortIdentity*);
+StandbyMaster *addStandby(PtpClock*, const PortIdentity*, const TimeInternal*);
+void updateStandbyOffset(PtpClock*, StandbyMaster*, const TimeInternal*, const TimeInternal*, const TimeInternal*);
+void updateStandbyDelay(PtpClock*, StandbyMaster*, const TimeInternal*, const TimeInternal*, const TimeInternal*);
+bool hasWarmStandby(PtpClock*);
+bool switchStandby(PtpClock*);
 /** \}*/
 
 /** \name startup.c (Linux API dependent)
@@ -6,7 +6,8 @@ void initClock(PtpClock *ptpClock)
 
 	/* Clear vars */
 	ptpClock->Tms.seconds = ptpClock->Tms.nanoseconds = 0;
-	ptpClock->observedDrift = 0;  /* clears clock servo accumulator (the I term) */
+	/* clears clock servo accumulator (the I term), or seeds it with the holdover prediction */
+	ptpClock->observedDrift = ptpClock->holdover.active ? ptpClock->holdover.current : 0;
 
 	/* One way delay */
 	ptpClock->owd_filt.n = 0;
@@ -25,9 +26,15 @@ void initClock(PtpClock *ptpClock)
 		ptpClock->offsetHistory[1] = 0;
 	}
 
-	ptpClock->waitingForFollowUp = FALSE;
+	memset(ptpClock->syncPairs, 0, sizeof(ptpClock->syncPairs));
+	ptpClock->syncApplied = FALSE;
+	ptpClock->syncSequenceValid = FALSE;
 
-	ptpClock->waitingForPDelayRespFollowUp = FALSE;
+	/* Transmit timestamps of outstanding requests are on the old time base */
+	memset(ptpClock->delayTransactions, 0, sizeof(ptpClock->delayTransactions));
+
+	/* Standby offsets are relative to the local clock */
+	memset(ptpClock->standby, 0, sizeof(ptpClock->standby));
 
 	ptpClock->pdelay_t1.seconds = ptpClock->pdelay_t1.nanoseconds = 0;
 	ptpClock->pdelay_t2.seconds = ptpClock->pdelay_t2.nanoseconds = 0;
@@ -39,9 +46,10 @@ void initClock(PtpClock *ptpClock)
 	ptpClock->parentDS.observedParentClockPhaseChangeRate = 0;
 	ptpClock->parentDS.observedParentOffsetScaledLogVariance = 0;
 
-	/* Level clock */
-	if (!ptpClock->servo.noAdjust)
-		adjTime(0);
+	/* Level clock, only if the servo was steering it */
+	if (!ptpClock->servo.noAdjust &&
+		(ptpClock->portDS.portState == PTP_SLAVE || ptpClock->portDS.portState == PTP_UNCALIBRATED))
+		adjTime(-ptpClock->observedDrift);
 
 	netEmptyEventQ(&ptpClock->netPath);
 }
@@ -246,6 +254,371 @@ void updatePeerDelay(PtpClock *ptpClock, const TimeInternal *correctionField, bo
 	}
 }
 
+/* Average the servo drift and its trend while locked */
+static void learnHoldover(PtpClock *ptpClock)
+{
+	Holdover *h = &ptpClock->holdover;
+	TimeInternal now;
+	int32_t dt;
+	float d;
+
+	getTime(&now);
+
+	if (h->samples == 0)
+	{
+		h->frequency = ptpClock->observedDrift;
+		h->wander = 0;
+		h->driftRate = 0;
+		h->trendFrequency = h->frequency;
+		h->trendTime = now.seconds;
+	}
+	else
+	{
+		d = ptpClock->observedDrift - h->frequency;
+		h->frequency += d / DEFAULT_HOLDOVER_AVERAGE;
+		h->wander += ((d < 0 ? -d : d) - h->wander) / DEFAULT_HOLDOVER_AVERAGE;
+	}
+
+	h->samples++;
+	h->offset = ptpClock->currentDS.offsetFromMaster.nanoseconds;
+
+	dt = now.seconds - h->trendTime;
+	if (dt < 0 || dt > 4 * DEFAULT_HOLDOVER_TREND_PERIOD)
+	{
+		/* Clock was stepped, restart the trend period */
+		h->trendFrequency = h->frequency;
+		h->trendTime = now.seconds;
+	}
+	else if (dt >= DEFAULT_HOLDOVER_TREND_PERIOD)
+	{
+		h->driftRate += ((h->frequency - h->trendFrequency) / dt - h->driftRate) / 4;
+		h->trendFrequency = h->frequency;
+		h->trendTime = now.seconds;
+	}
+
+	h->valid = h->samples >= DEFAULT_HOLDOVER_SAMPLES && abs(h->offset) < DEFAULT_CALIBRATED_OFFSET_NS;
+}
+
+/* Master lost, keep running on the learned frequency */
+void startHoldover(PtpClock *ptpClock)
+{
+	Holdover *h = &ptpClock->holdover;
+	TimeInternal now;
+
+	if (!h->valid || h->active)
+		return;
+
+	getTime(&now);
+
+	h->active = TRUE;
+	h->release = FALSE;
+	h->current = (int32_t)h->frequency;
+	h->startTime = h->lastUpdate = h->lastReport = now.seconds;
+
+	h->info.active = TRUE;
+	h->info.seconds = 0;
+	h->info.offset = abs(h->offset);
+	h->info.error = h->info.offset;
+	h->info.frequency = -h->current;
+	h->info.grandmasterClockQuality = ptpClock->parentDS.grandmasterClockQuality;
+	h->info.timeSource = ptpClock->timePropertiesDS.timeSource;
+	h->notify = TRUE;
+
+	DBG("startHoldover: drift %d ppb, rate %d ppb/ks\n", (int)h->current, (int)(h->driftRate * 1000));
+}
+
+/* Apply the predicted frequency and grow the error estimate, once per second */
+void updateHoldover(PtpClock *ptpClock)
+{
+	Holdover *h = &ptpClock->holdover;
+	TimeInternal now;
+	float predicted, error;
+	int32_t t;
+
+	if (!h->active)
+		return;
+
+	if (h->release)
+	{
+		/* Another reference steers the clock now, leave it alone */
+		stopHoldover(ptpClock);
+		return;
+	}
+
+	getTime(&now);
+
+	if (now.seconds == h->lastUpdate)
+		return;
+
+	h->lastUpdate = now.seconds;
+	t = now.seconds - h->startTime;
+	if (t < 0)
+	{
+		h->startTime = now.seconds;
+		t = 0;
+	}
+
+	/* Follow the frequency trend learned while locked */
+	predicted = h->frequency + h->driftRate * t;
+	if (predicted > ADJ_FREQ_MAX)
+		predicted = ADJ_FREQ_MAX;
+	else if (predicted < -ADJ_FREQ_MAX)
+		predicted = -ADJ_FREQ_MAX;
+
+	h->current = (int32_t)predicted;
+	ptpClock->observedDrift = h->current;
+	if (!ptpClock->servo.noAdjust)
+		adjTime(-h->current);
+
+	/* Initial offset, frequency wander and half the trend mispredicted */
+	error = h->info.offset + h->wander * t + (h->driftRate < 0 ? -h->driftRate : h->driftRate) * t * t / 4;
+
+	h->info.seconds = t;
+	h->info.error = error > 4e9f ? 4000000000UL : (uint32_t)error;
+	h->info.frequency = -h->current;
+
+	if (t >= DEFAULT_HOLDOVER_TIMEOUT)
+	{
+		DBG("updateHoldover: timeout, free running\n");
+		stopHoldover(ptpClock);
+		return;
+	}
+
+	if (now.seconds - h->lastReport >= DEFAULT_HOLDOVER_REPORT)
+	{
+		h->lastReport = now.seconds;
+		h->notify = TRUE;
+	}
+}
+
+/* Master back, timed out or clock handed over. The frequency is left as is */
+void stopHoldover(PtpClock *ptpClock)
+{
+	Holdover *h = &ptpClock->holdover;
+
+	if (!h->active)
+		return;
+
+	h->active = FALSE;
+	h->release = FALSE;
+	h->info.active = FALSE;
+	h->notify = TRUE;
+
+	DBG("stopHoldover: after %d s\n", (int)h->info.seconds);
+}
+
+StandbyMaster *findStandby(PtpClock *ptpClock, const PortIdentity *portIdentity)
+{
+	int i;
+
+	for (i = 0; i < DEFAULT_STANDBY_MASTERS; i++)
+	{
+		if (ptpClock->standby[i].valid && isSamePortIdentity(&ptpClock->standby[i].portIdentity, portIdentity))
+			return &ptpClock->standby[i];
+	}
+
+	return NULL;
+}
+
+/* Track a foreign master in a free or stale slot */
+StandbyMaster *addStandby(PtpClock *ptpClock, const PortIdentity *portIdentity, const TimeInternal *time)
+{
+	StandbyMaster *standby = NULL;
+	int i;
+
+	if (!isForeign(ptpClock, portIdentity))
+		return NULL;
+
+	for (i = 0; i < DEFAULT_STANDBY_MASTERS; i++)
+	{
+		if (!ptpClock->standby[i].valid ||
+			time->seconds - ptpClock->standby[i].lastSync > DEFAULT_STANDBY_TIMEOUT)
+		{
+			standby = &ptpClock->standby[i];
+			break;
+		}
+	}
+
+	if (standby == NULL)
+		return NULL;
+
+	memset(standby, 0, sizeof(StandbyMaster));
+	standby->valid = TRUE;
+	standby->portIdentity = *portIdentity;
+	standby->lastSync = time->seconds;
+	standby->ofm_filt.s = ptpClock->servo.sOffset;
+	standby->owd_filt.s = ptpClock->servo.sDelay;
+
+	DBG("addStandby: slot %d\n", i);
+
+	return standby;
+}
+
+/* 11.2 against a standby master, the clock is not adjusted */
+void updateStandbyOffset(PtpClock *ptpClock, StandbyMaster *standby, const TimeInternal *syncEventIngressTimestamp,
+									const TimeInternal *preciseOriginTimestamp, const TimeInternal *correctionField)
+{
+	TimeInternal ofm;
+	int32_t dt, rate;
+
+	subTime(&standby->Tms, syncEventIngressTimestamp, preciseOriginTimestamp);
+	subTime(&standby->Tms, &standby->Tms, correctionField);
+	standby->tmsValid = TRUE;
+	standby->lastSync = syncEventIngressTimestamp->seconds;
+
+	if (ptpClock->portDS.delayMechanism == P2P)
+	{
+		subTime(&ofm, &standby->Tms, &ptpClock->portDS.peerMeanPathDelay);
+	}
+	else if (standby->owd_filt.n != 0)
+	{
+		subTime(&ofm, &standby->Tms, &standby->meanPathDelay);
+	}
+	else
+	{
+		/* Offset is meaningless before the first delay measurement */
+		return;
+	}
+
+	if (ofm.seconds != 0)
+	{
+		standby->samples = 0;
+		standby->ofm_filt.n = 0;
+		standby->driftValid = FALSE;
+		return;
+	}
+
+	filter(&ofm.nanoseconds, &standby->ofm_filt);
+	standby->offsetFromMaster = ofm;
+
+	/* Offset trend against the local clock, which follows the parent */
+	if (standby->samples == 0)
+	{
+		standby->driftOffset = ofm.nanoseconds;
+		standby->driftTime = syncEventIngressTimestamp->seconds;
+	}
+	else
+	{
+		dt = syncEventIngressTimestamp->seconds - standby->driftTime;
+
+		if (dt >= DEFAULT_STANDBY_DRIFT_PERIOD)
+		{
+			rate = (ofm.nanoseconds - standby->driftOffset) / dt;
+			standby->drift = standby->driftValid ? standby->drift + (rate - standby->drift) / 4 : rate;
+			standby->driftValid = TRUE;
+			standby->driftOffset = ofm.nanoseconds;
+			standby->driftTime = syncEventIngressTimestamp->seconds;
+		}
+	}
+
+	standby->samples++;
+
+	DBGV("updateStandbyOffset: %d nsec, drift %d ppb\n", (int)ofm.nanoseconds, (int)standby->drift);
+}
+
+/* 11.3 against a standby master, answering the same Delay_Req as the parent */
+void updateStandbyDelay(PtpClock *ptpClock, StandbyMaster *standby, const TimeInternal *delayEventEgressTimestamp,
+								 const TimeInternal *recieveTimestamp, const TimeInternal *correctionField)
+{
+	TimeInternal Tsm, delay;
+
+	if (!standby->tmsValid)
+		return;
+
+	subTime(&Tsm, recieveTimestamp, delayEventEgressTimestamp);
+	subTime(&Tsm, &Tsm, correctionField);
+	addTime(&delay, &standby->Tms, &Tsm);
+	div2Time(&delay);
+
+	if (delay.seconds != 0)
+		return;
+
+	filter(&delay.nanoseconds, &standby->owd_filt);
+	standby->meanPathDelay = delay;
+}
+
+static bool isStandbyWarm(const PtpClock *ptpClock, const StandbyMaster *standby, int32_t now)
+{
+	return standby->valid && standby->samples >= DEFAULT_STANDBY_SAMPLES &&
+		now - standby->lastSync <= DEFAULT_STANDBY_TIMEOUT &&
+		isForeign(ptpClock, &standby->portIdentity);
+}
+
+bool hasWarmStandby(PtpClock *ptpClock)
+{
+	TimeInternal now;
+	int i;
+
+	getTime(&now);
+
+	for (i = 0; i < DEFAULT_STANDBY_MASTERS; i++)
+	{
+		if (isStandbyWarm(ptpClock, &ptpClock->standby[i], now.seconds))
+			return TRUE;
+	}
+
+	return FALSE;
+}
+
+/* New parent selected, take over its converged estimates and keep the old parent as standby */
+bool switchStandby(PtpClock *ptpClock)
+{
+	StandbyMaster *standby;
+	StandbyMaster previous;
+	TimeInternal now;
+
+	standby = findStandby(ptpClock, &ptpClock->parentDS.parentPortIdentity);
+	getTime(&now);
+
+	if (standby == NULL || !isStandbyWarm(ptpClock, standby, now.seconds))
+		return FALSE;
+
+	memset(&previous, 0, sizeof(StandbyMaster));
+	previous.valid = TRUE;
+	previous.portIdentity = ptpClock->previousParent;
+	previous.tmsValid = ptpClock->ofm_filt.n != 0;
+	previous.Tms = ptpClock->Tms;
+	previous.offsetFromMaster = ptpClock->currentDS.offsetFromMaster;
+	previous.meanPathDelay = ptpClock->currentDS.meanPathDelay;
+	previous.ofm_filt = ptpClock->ofm_filt;
+	previous.owd_filt = ptpClock->owd_filt;
+	previous.samples = ptpClock->ofm_filt.n != 0 ? DEFAULT_STANDBY_SAMPLES : 0;
+	previous.lastSync = now.seconds;
+	/* Once locked to the new parent the old one drifts the other way */
+	previous.drift = -standby->drift;
+	previous.driftValid = standby->driftValid;
+	previous.driftOffset = ptpClock->currentDS.offsetFromMaster.nanoseconds;
+	previous.driftTime = now.seconds;
+
+	ptpClock->Tms = standby->Tms;
+	ptpClock->currentDS.offsetFromMaster = standby->offsetFromMaster;
+	ptpClock->currentDS.meanPathDelay = standby->meanPathDelay;
+	ptpClock->ofm_filt = standby->ofm_filt;
+	ptpClock->owd_filt = standby->owd_filt;
+
+	/* Sequence ids of the new parent are unrelated */
+	memset(ptpClock->syncPairs, 0, sizeof(ptpClock->syncPairs));
+	ptpClock->syncApplied = FALSE;
+
+	/* The standby offset trend is the frequency step to its time base */
+	if (standby->driftValid)
+	{
+		ptpClock->observedDrift += standby->drift;
+		if (ptpClock->observedDrift > ADJ_FREQ_MAX)
+			ptpClock->observedDrift = ADJ_FREQ_MAX;
+		else if (ptpClock->observedDrift < -ADJ_FREQ_MAX)
+			ptpClock->observedDrift = -ADJ_FREQ_MAX;
+	}
+
+	DBG("switchStandby: offset %d nsec, delay %d nsec, drift %d ppb\n",
+		(int)standby->offsetFromMaster.nanoseconds, (int)standby->meanPathDelay.nanoseconds, (int)standby->drift);
+
+	*standby = previous;
+	ptpClock->standbySwitches++;
+
+	return TRUE;
+}
+
 void updateClock(PtpClock *ptpClock)
 {
 	int32_t adj;
@@ -254,6 +627,8 @@ void updateClock(PtpClock *ptpClock)
 
 	DBGV("updateClock\n");
 
+	ptpClock->servoUpdates++;
+
 	if (ptpClock->currentDS.offsetFromMaster.seconds != 0 || abs(ptpClock->currentDS.offsetFromMaster.nanoseconds) > MAX_ADJ_OFFSET_NS)
 	{
 		/* if secs, reset clock or set freq adjustment to max */
@@ -265,6 +640,7 @@ void updateClock(PtpClock *ptpClock)
 				subTime(&timeTmp, &timeTmp, &ptpClock->currentDS.offsetFromMaster);
 				setTime(&timeTmp);
 				initClock(ptpClock);
+				ptpClock->clockSteps++;
 			}
 			else
 			{
@@ -302,6 +678,9 @@ void updateClock(PtpClock *ptpClock)
 			adjTime(-adj);
 		}
 
+		if (ptpClock->portDS.portState == PTP_SLAVE)
+			learnHoldover(ptpClock);
+
 		if (DEFAULT_PARENTS_STATS)
 		{
 			int a, scaledLogVariance;
@@ -341,4 +720,6 @@ void updateClock(PtpClock *ptpClock)
 			(int)ptpClock->currentDS.offsetFromMaster.seconds,
 			(int)ptpClock->currentDS.offsetFromMaster.nanoseconds);
 	DBG("updateClock: observed drift: %d\n", (int)ptpClock->observedDrift);
+
+	reportServoUpdate(ptpClock);
 }
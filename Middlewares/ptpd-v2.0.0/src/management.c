@@ -0,0 +1,556 @@
+/* management.c */
+
+#include "ptpd.h"
+
+#define ACTION(x)   (1 << (x))
+
+/* Management TLV handled by this clock, dataField packed straight into the transmit buffer */
+typedef struct
+{
+	enum16bit_t managementId;
+	const char *name;
+	uint16_t length;                                /* dataField, even */
+	uint8_t actions;                                /* ACTION(MM_GET) | ... */
+	void (*get)(const PtpClock*, octet_t*);
+	enum16bit_t (*set)(PtpClock*, const octet_t*);  /* SET or COMMAND, 0 or an error id */
+} ManagementEntry;
+
+/* Answers to the last GET sent to the domain */
+static ManagementReply managementReplies[DEFAULT_MANAGEMENT_REPLIES];
+static int16_t managementReplyCount;
+static uint32_t managementRepliesDropped;
+
+static void packTimeInterval(octet_t *buf, const TimeInternal *t)
+{
+	int64_t scaled = ((int64_t)t->seconds * 1000000000 + t->nanoseconds) << 16;
+
+	*(int32_t*)(buf + 0) = flip32(scaled >> 32);
+	*(int32_t*)(buf + 4) = flip32((int32_t)scaled);
+}
+
+static void packClockQuality(octet_t *buf, const ClockQuality *q)
+{
+	*(uint8_t*)(buf + 0) = q->clockClass;
+	*(enum8bit_t*)(buf + 1) = q->clockAccuracy;
+	*(int16_t*)(buf + 2) = flip16(q->offsetScaledLogVariance);
+}
+
+static void packPortIdentity(octet_t *buf, const PortIdentity *p)
+{
+	memcpy(buf, p->clockIdentity, CLOCK_IDENTITY_LENGTH);
+	*(int16_t*)(buf + 8) = flip16(p->portNumber);
+}
+
+/* 15.5.3.3.1 */
+static void getDefaultDS(const PtpClock *ptpClock, octet_t *buf)
+{
+	*(uint8_t*)(buf + 0) = (ptpClock->defaultDS.twoStepFlag ? 0x01 : 0) | (ptpClock->defaultDS.slaveOnly ? 0x02 : 0);
+	*(uint8_t*)(buf + 1) = 0;
+	*(int16_t*)(buf + 2) = flip16(ptpClock->defaultDS.numberPorts);
+	*(uint8_t*)(buf + 4) = ptpClock->defaultDS.priority1;
+	packClockQuality(buf + 5, &ptpClock->defaultDS.clockQuality);
+	*(uint8_t*)(buf + 9) = ptpClock->defaultDS.priority2;
+	memcpy((buf + 10), ptpClock->defaultDS.clockIdentity, CLOCK_IDENTITY_LENGTH);
+	*(uint8_t*)(buf + 18) = ptpClock->defaultDS.domainNumber;
+	*(uint8_t*)(buf + 19) = 0;
+}
+
+/* 15.5.3.4.1 */
+static void getCurrentDS(const PtpClock *ptpClock, octet_t *buf)
+{
+	*(int16_t*)(buf + 0) = flip16(ptpClock->currentDS.stepsRemoved);
+	packTimeInterval(buf + 2, &ptpClock->currentDS.offsetFromMaster);
+	packTimeInterval(buf + 10, &ptpClock->currentDS.meanPathDelay);
+}
+
+/* 15.5.3.5.1 */
+static void getParentDS(const PtpClock *ptpClock, octet_t *buf)
+{
+	packPortIdentity(buf, &ptpClock->parentDS.parentPortIdentity);
+	*(uint8_t*)(buf + 10) = ptpClock->parentDS.parentStats ? 0x01 : 0;
+	*(uint8_t*)(buf + 11) = 0;
+	*(int16_t*)(buf + 12) = flip16(ptpClock->parentDS.observedParentOffsetScaledLogVariance);
+	*(int32_t*)(buf + 14) = flip32(ptpClock->parentDS.observedParentClockPhaseChangeRate);
+	*(uint8_t*)(buf + 18) = ptpClock->parentDS.grandmasterPriority1;
+	packClockQuality(buf + 19, &ptpClock->parentDS.grandmasterClockQuality);
+	*(uint8_t*)(buf + 23) = ptpClock->parentDS.grandmasterPriority2;
+	memcpy((buf + 24), ptpClock->parentDS.grandmasterIdentity, CLOCK_IDENTITY_LENGTH);
+}
+
+/* 15.5.3.6.1 */
+static void getTimePropertiesDS(const PtpClock *ptpClock, octet_t *buf)
+{
+	*(int16_t*)(buf + 0) = flip16(ptpClock->timePropertiesDS.currentUtcOffset);
+	*(uint8_t*)(buf + 2) = (ptpClock->timePropertiesDS.leap61 ? FLAG1_LEAP61 : 0) |
+		(ptpClock->timePropertiesDS.leap59 ? FLAG1_LEAP59 : 0) |
+		(ptpClock->timePropertiesDS.currentUtcOffsetValid ? FLAG1_UTC_OFFSET_VALID : 0) |
+		(ptpClock->timePropertiesDS.ptpTimescale ? FLAG1_PTP_TIMESCALE : 0) |
+		(ptpClock->timePropertiesDS.timeTraceable ? FLAG1_TIME_TRACEABLE : 0) |
+		(ptpClock->timePropertiesDS.frequencyTraceable ? FLAG1_FREQUENCY_TRACEABLE : 0);
+	*(enum8bit_t*)(buf + 3) = ptpClock->timePropertiesDS.timeSource;
+}
+
+/* 15.5.3.7.1 */
+static void getPortDS(const PtpClock *ptpClock, octet_t *buf)
+{
+	packPortIdentity(buf, &ptpClock->portDS.portIdentity);
+	*(enum8bit_t*)(buf + 10) = ptpClock->portDS.portState;
+	*(int8_t*)(buf + 11) = ptpClock->portDS.logMinDelayReqInterval;
+	packTimeInterval(buf + 12, &ptpClock->portDS.peerMeanPathDelay);
+	*(int8_t*)(buf + 20) = ptpClock->portDS.logAnnounceInterval;
+	*(uint8_t*)(buf + 21) = ptpClock->portDS.announceReceiptTimeout;
+	*(int8_t*)(buf + 22) = ptpClock->portDS.logSyncInterval;
+	*(enum8bit_t*)(buf + 23) = ptpClock->portDS.delayMechanism;
+	*(int8_t*)(buf + 24) = ptpClock->portDS.logMinPdelayReqInterval;
+	*(uint8_t*)(buf + 25) = ptpClock->portDS.versionNumber & 0x0F;
+}
+
+/* Single octet values, followed by a reserved octet */
+static void getPriority1(const PtpClock *ptpClock, octet_t *buf)
+{
+	buf[0] = ptpClock->defaultDS.priority1;
+	buf[1] = 0;
+}
+
+static void getPriority2(const PtpClock *ptpClock, octet_t *buf)
+{
+	buf[0] = ptpClock->defaultDS.priority2;
+	buf[1] = 0;
+}
+
+static void getDomain(const PtpClock *ptpClock, octet_t *buf)
+{
+	buf[0] = ptpClock->defaultDS.domainNumber;
+	buf[1] = 0;
+}
+
+static void getSlaveOnly(const PtpClock *ptpClock, octet_t *buf)
+{
+	buf[0] = ptpClock->defaultDS.slaveOnly ? 0x01 : 0;
+	buf[1] = 0;
+}
+
+static void getLogAnnounceInterval(const PtpClock *ptpClock, octet_t *buf)
+{
+	buf[0] = (octet_t)ptpClock->portDS.logAnnounceInterval;
+	buf[1] = 0;
+}
+
+static void getAnnounceReceiptTimeout(const PtpClock *ptpClock, octet_t *buf)
+{
+	buf[0] = ptpClock->portDS.announceReceiptTimeout;
+	buf[1] = 0;
+}
+
+static void getLogSyncInterval(const PtpClock *ptpClock, octet_t *buf)
+{
+	buf[0] = (octet_t)ptpClock->portDS.logSyncInterval;
+	buf[1] = 0;
+}
+
+static void getClockAccuracy(const PtpClock *ptpClock, octet_t *buf)
+{
+	buf[0] = ptpClock->defaultDS.clockQuality.clockAccuracy;
+	buf[1] = 0;
+}
+
+static void getDelayMechanism(const PtpClock *ptpClock, octet_t *buf)
+{
+	buf[0] = ptpClock->portDS.delayMechanism;
+	buf[1] = 0;
+}
+
+/* Our own Announce and the BMC follow a changed default data set */
+static void defaultDSChanged(PtpClock *ptpClock)
+{
+	if (ptpClock->portDS.portState == PTP_MASTER) m1(ptpClock);
+	ptpClock->templateDirty = TEMPLATE_ALL;
+	if (ptpClock->foreignMasterDS.count > 0) setFlag(ptpClock->events, STATE_DECISION_EVENT);
+}
+
+static enum16bit_t setPriority1(PtpClock *ptpClock, const octet_t *data)
+{
+	ptpClock->defaultDS.priority1 = ptpClock->rtOpts->priority1 = data[0];
+	defaultDSChanged(ptpClock);
+	return 0;
+}
+
+static enum16bit_t setPriority2(PtpClock *ptpClock, const octet_t *data)
+{
+	ptpClock->defaultDS.priority2 = ptpClock->rtOpts->priority2 = data[0];
+	defaultDSChanged(ptpClock);
+	return 0;
+}
+
+static enum16bit_t setDomain(PtpClock *ptpClock, const octet_t *data)
+{
+	/* 7.1, 128 to 255 are reserved */
+	if (data[0] > 127)
+		return MM_ERROR_WRONG_VALUE;
+
+	if (data[0] == ptpClock->defaultDS.domainNumber)
+		return 0;
+
+	ptpClock->defaultDS.domainNumber = ptpClock->rtOpts->domainNumber = data[0];
+
+	/* Masters of the old domain are no longer heard */
+	ptpClock->foreignMasterDS.count = 0;
+	ptpClock->foreignMasterDS.i = 0;
+	ptpClock->templateDirty = TEMPLATE_ALL;
+	if (ptpClock->portDS.portState != PTP_DISABLED)
+		toState(ptpClock, PTP_LISTENING);
+
+	return 0;
+}
+
+static enum16bit_t setLogAnnounceInterval(PtpClock *ptpClock, const octet_t *data)
+{
+	int8_t value = (int8_t)data[0];
+
+	if (value < -3 || value > 4)
+		return MM_ERROR_WRONG_VALUE;
+
+	ptpClock->portDS.logAnnounceInterval = ptpClock->rtOpts->announceInterval = value;
+	ptpClock->templateDirty = TEMPLATE_ALL;
+	return 0;
+}
+
+static enum16bit_t setAnnounceReceiptTimeout(PtpClock *ptpClock, const octet_t *data)
+{
+	if (data[0] < 2)
+		return MM_ERROR_WRONG_VALUE;
+
+	ptpClock->portDS.announceReceiptTimeout = data[0];
+	return 0;
+}
+
+static enum16bit_t setLogSyncInterval(PtpClock *ptpClock, const octet_t *data)
+{
+	int8_t value = (int8_t)data[0];
+
+	if (value < -7 || value > 4)
+		return MM_ERROR_WRONG_VALUE;
+
+	ptpClock->portDS.logSyncInterval = ptpClock->rtOpts->syncInterval = value;
+	ptpClock->templateDirty = TEMPLATE_ALL;
+	return 0;
+}
+
+static enum16bit_t commandNull(PtpClock *ptpClock, const octet_t *data)
+{
+	return 0;
+}
+
+/* The network stays up while disabled, so enabling restarts from LISTENING */
+static enum16bit_t commandEnablePort(PtpClock *ptpClock, const octet_t *data)
+{
+	if (ptpClock->portDS.portState == PTP_DISABLED)
+		toState(ptpClock, PTP_LISTENING);
+	return 0;
+}
+
+static enum16bit_t commandDisablePort(PtpClock *ptpClock, const octet_t *data)
+{
+	stopHoldover(ptpClock);
+	toState(ptpClock, PTP_DISABLED);
+	return 0;
+}
+
+static const ManagementEntry managementTable[] =
+{
+	{ MM_NULL_MANAGEMENT, "NULL_MANAGEMENT", 0, ACTION(MM_GET) | ACTION(MM_SET) | ACTION(MM_COMMAND), NULL, commandNull },
+	{ MM_DEFAULT_DATA_SET, "DEFAULT_DATA_SET", 20, ACTION(MM_GET), getDefaultDS, NULL },
+	{ MM_CURRENT_DATA_SET, "CURRENT_DATA_SET", 18, ACTION(MM_GET), getCurrentDS, NULL },
+	{ MM_PARENT_DATA_SET, "PARENT_DATA_SET", 32, ACTION(MM_GET), getParentDS, NULL },
+	{ MM_TIME_PROPERTIES_DATA_SET, "TIME_PROPERTIES_DATA_SET", 4, ACTION(MM_GET), getTimePropertiesDS, NULL },
+	{ MM_PORT_DATA_SET, "PORT_DATA_SET", 26, ACTION(MM_GET), getPortDS, NULL },
+	{ MM_PRIORITY1, "PRIORITY1", 2, ACTION(MM_GET) | ACTION(MM_SET), getPriority1, setPriority1 },
+	{ MM_PRIORITY2, "PRIORITY2", 2, ACTION(MM_GET) | ACTION(MM_SET), getPriority2, setPriority2 },
+	{ MM_DOMAIN, "DOMAIN", 2, ACTION(MM_GET) | ACTION(MM_SET), getDomain, setDomain },
+	{ MM_SLAVE_ONLY, "SLAVE_ONLY", 2, ACTION(MM_GET), getSlaveOnly, NULL },
+	{ MM_LOG_ANNOUNCE_INTERVAL, "LOG_ANNOUNCE_INTERVAL", 2, ACTION(MM_GET) | ACTION(MM_SET), getLogAnnounceInterval, setLogAnnounceInterval },
+	{ MM_ANNOUNCE_RECEIPT_TIMEOUT, "ANNOUNCE_RECEIPT_TIMEOUT", 2, ACTION(MM_GET) | ACTION(MM_SET), getAnnounceReceiptTimeout, setAnnounceReceiptTimeout },
+	{ MM_LOG_SYNC_INTERVAL, "LOG_SYNC_INTERVAL", 2, ACTION(MM_GET) | ACTION(MM_SET), getLogSyncInterval, setLogSyncInterval },
+	{ MM_ENABLE_PORT, "ENABLE_PORT", 0, ACTION(MM_COMMAND), NULL, commandEnablePort },
+	{ MM_DISABLE_PORT, "DISABLE_PORT", 0, ACTION(MM_COMMAND), NULL, commandDisablePort },
+	{ MM_CLOCK_ACCURACY, "CLOCK_ACCURACY", 2, ACTION(MM_GET), getClockAccuracy, NULL },
+	{ MM_DELAY_MECHANISM, "DELAY_MECHANISM", 2, ACTION(MM_GET), getDelayMechanism, NULL },
+};
+
+#define MANAGEMENT_ENTRIES (sizeof(managementTable) / sizeof(managementTable[0]))
+
+static const ManagementEntry *findManagementEntry(enum16bit_t managementId)
+{
+	uint16_t i;
+
+	for (i = 0; i < MANAGEMENT_ENTRIES; i++)
+	{
+		if (managementTable[i].managementId == managementId)
+			return &managementTable[i];
+	}
+
+	return NULL;
+}
+
+/* 15.3.1, all ones in either field is a wildcard */
+static bool isManagementTarget(const PtpClock *ptpClock, const PortIdentity *target)
+{
+	static const ClockIdentity allOnes = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+
+	if (memcmp(target->clockIdentity, allOnes, CLOCK_IDENTITY_LENGTH) != 0 &&
+		memcmp(target->clockIdentity, ptpClock->defaultDS.clockIdentity, CLOCK_IDENTITY_LENGTH) != 0)
+		return FALSE;
+
+	return (uint16_t)target->portNumber == 0xFFFF || target->portNumber == ptpClock->portDS.portIdentity.portNumber;
+}
+
+/* Keep the answer of a clock, one per port identity */
+static void addManagementReply(const PortIdentity *portIdentity, const ManagementTLV *tlv)
+{
+	ManagementReply *reply = NULL;
+	int16_t i;
+
+	for (i = 0; i < managementReplyCount; i++)
+	{
+		if (isSamePortIdentity(&managementReplies[i].portIdentity, portIdentity))
+		{
+			reply = &managementReplies[i];
+			break;
+		}
+	}
+
+	if (reply == NULL)
+	{
+		if (managementReplyCount >= DEFAULT_MANAGEMENT_REPLIES)
+		{
+			managementRepliesDropped++;
+			return;
+		}
+
+		reply = &managementReplies[managementReplyCount];
+	}
+
+	taskENTER_CRITICAL();
+	reply->portIdentity = *portIdentity;
+	reply->managementId = tlv->managementId;
+	reply->managementErrorId = tlv->managementErrorId;
+	reply->length = 0;
+	if (tlv->dataField != NULL && tlv->lengthField > 2)
+	{
+		reply->length = tlv->lengthField - 2;
+		if (reply->length > DEFAULT_MANAGEMENT_DATA)
+			reply->length = DEFAULT_MANAGEMENT_DATA;
+		memcpy(reply->data, tlv->dataField, reply->length);
+	}
+	if (reply == &managementReplies[managementReplyCount])
+		managementReplyCount++;
+	taskEXIT_CRITICAL();
+}
+
+/* Answer a GET, SET or COMMAND addressed to this clock */
+static void managementRequest(PtpClock *ptpClock, MsgManagement *manage)
+{
+	const ManagementEntry *entry;
+	octet_t *buf = ptpClock->msgObuf;
+	MsgManagement response;
+	enum16bit_t error = 0;
+	int16_t length;
+
+	entry = findManagementEntry(manage->tlv.managementId);
+
+	if (entry == NULL)
+		error = MM_ERROR_NO_SUCH_ID;
+	else if (!(entry->actions & ACTION(manage->actionField)))
+		error = manage->actionField == MM_SET && (entry->actions & ACTION(MM_GET)) ? MM_ERROR_NOT_SETABLE : MM_ERROR_NOT_SUPPORTED;
+	else if (manage->actionField == MM_SET && manage->tlv.lengthField != 2 + entry->length)
+		error = MM_ERROR_WRONG_LENGTH;
+	else if (manage->actionField == MM_SET)
+		error = entry->set(ptpClock, manage->tlv.dataField);
+
+	memset(buf, 0, MANAGEMENT_LENGTH + 6);
+	msgPackHeader(ptpClock, buf);
+
+	response.targetPortIdentity = ptpClock->msgTmpHeader.sourcePortIdentity;
+	response.startingBoundaryHops = manage->startingBoundaryHops - manage->boundaryHops;
+	response.boundaryHops = response.startingBoundaryHops;
+	response.actionField = manage->actionField == MM_COMMAND ? MM_ACKNOWLEDGE : MM_RESPONSE;
+	response.tlv.managementId = manage->tlv.managementId;
+	response.tlv.dataField = NULL;
+
+	if (error)
+	{
+		response.tlv.tlvType = TLV_MANAGEMENT_ERROR_STATUS;
+		response.tlv.managementErrorId = error;
+		response.tlv.lengthField = 8;
+	}
+	else
+	{
+		response.tlv.tlvType = TLV_MANAGEMENT;
+		response.tlv.managementErrorId = 0;
+		response.tlv.lengthField = 2;
+
+		/* A COMMAND is acknowledged without data */
+		if (manage->actionField != MM_COMMAND && entry->get != NULL)
+		{
+			response.tlv.lengthField += entry->length;
+			entry->get(ptpClock, buf + MANAGEMENT_LENGTH + 6);
+		}
+	}
+
+	length = msgPackManagementResponse(ptpClock, buf, &ptpClock->msgTmpHeader, &response);
+
+	if (!netSendGeneral(&ptpClock->netPath, buf, length))
+	{
+		ERROR("managementRequest: can't send\n");
+	}
+
+	DBGV("managementRequest: id 0x%04x action %d error 0x%04x\n", manage->tlv.managementId, manage->actionField, error);
+
+	/* Acknowledged before the port changes state */
+	if (!error && manage->actionField == MM_COMMAND)
+		entry->set(ptpClock, NULL);
+}
+
+void handleManagementMessage(PtpClock *ptpClock)
+{
+	MsgManagement *manage = &ptpClock->msgTmp.manage;
+
+	if (ptpClock->msgIbufLength < MANAGEMENT_LENGTH + 6)
+	{
+		DBGV("handleManagement: short message\n");
+		return;
+	}
+
+	msgUnpackManagement(ptpClock->msgIbuf, manage);
+	msgUnpackManagementPayload(ptpClock->msgIbuf, manage);
+
+	if (manage->tlv.lengthField < 2 || MANAGEMENT_LENGTH + 4 + manage->tlv.lengthField > ptpClock->msgIbufLength)
+	{
+		DBGV("handleManagement: bad TLV length\n");
+		return;
+	}
+
+	switch (manage->actionField)
+	{
+		case MM_GET:
+		case MM_SET:
+		case MM_COMMAND:
+
+			if (manage->tlv.tlvType != TLV_MANAGEMENT)
+				break;
+
+			if (!isManagementTarget(ptpClock, &manage->targetPortIdentity))
+				break;
+
+			managementRequest(ptpClock, manage);
+			break;
+
+		case MM_RESPONSE:
+		case MM_ACKNOWLEDGE:
+
+			/* Answers to our last GET only */
+			if (ptpClock->msgTmpHeader.sequenceId != (int16_t)(ptpClock->sentManagementSequenceId - 1) ||
+				manage->tlv.managementId != ptpClock->managementRequestId ||
+				!isSamePortIdentity(&manage->targetPortIdentity, &ptpClock->portDS.portIdentity))
+				break;
+
+			addManagementReply(&ptpClock->msgTmpHeader.sourcePortIdentity, &manage->tlv);
+			break;
+
+		default:
+			break;
+	}
+}
+
+void issueManagementGet(PtpClock *ptpClock, enum16bit_t managementId)
+{
+	const ManagementEntry *entry = findManagementEntry(managementId);
+	octet_t *buf = ptpClock->msgObuf;
+	MsgManagement manage;
+	int16_t length;
+
+	managementClear();
+	ptpClock->managementRequestId = managementId;
+
+	/* This clock answers too */
+	if (entry != NULL && entry->get != NULL)
+	{
+		entry->get(ptpClock, buf + MANAGEMENT_LENGTH + 6);
+		manage.tlv.managementId = managementId;
+		manage.tlv.managementErrorId = 0;
+		manage.tlv.lengthField = 2 + entry->length;
+		manage.tlv.dataField = buf + MANAGEMENT_LENGTH + 6;
+		addManagementReply(&ptpClock->portDS.portIdentity, &manage.tlv);
+	}
+
+	memset(buf, 0, MANAGEMENT_LENGTH + 6);
+	msgPackHeader(ptpClock, buf);
+
+	memset(manage.targetPortIdentity.clockIdentity, 0xFF, CLOCK_IDENTITY_LENGTH);
+	manage.targetPortIdentity.portNumber = (int16_t)0xFFFF;
+	manage.startingBoundaryHops = DEFAULT_MANAGEMENT_BOUNDARY_HOPS;
+	manage.boundaryHops = DEFAULT_MANAGEMENT_BOUNDARY_HOPS;
+	manage.actionField = MM_GET;
+	manage.tlv.tlvType = TLV_MANAGEMENT;
+	manage.tlv.lengthField = 2;
+	manage.tlv.managementId = managementId;
+	manage.tlv.managementErrorId = 0;
+	manage.tlv.dataField = NULL;
+
+	length = msgPackManagement(ptpClock, buf, &manage);
+
+	if (!netSendGeneral(&ptpClock->netPath, buf, length))
+	{
+		ERROR("issueManagementGet: can't send\n");
+		return;
+	}
+
+	DBGV("issueManagementGet: id 0x%04x\n", managementId);
+	ptpClock->sentManagementSequenceId++;
+}
+
+int32_t managementIdByName(const char *name)
+{
+	uint16_t i;
+
+	for (i = 0; i < MANAGEMENT_ENTRIES; i++)
+	{
+		if (strcmp(managementTable[i].name, name) == 0)
+			return managementTable[i].managementId;
+	}
+
+	return -1;
+}
+
+const char *managementName(enum16bit_t managementId)
+{
+	const ManagementEntry *entry = findManagementEntry(managementId);
+
+	return entry != NULL ? entry->name : "?";
+}
+
+void managementClear(void)
+{
+	taskENTER_CRITICAL();
+	managementReplyCount = 0;
+	managementRepliesDropped = 0;
+	taskEXIT_CRITICAL();
+}
+
+bool managementGet(int16_t index, ManagementReply *reply)
+{
+	bool valid;
+
+	taskENTER_CRITICAL();
+	valid = index >= 0 && index < managementReplyCount;
+	if (valid)
+		*reply = managementReplies[index];
+	taskEXIT_CRITICAL();
+
+	return valid;
+}
+
+uint32_t managementDropped(void)
+{
+	return managementRepliesDropped;
+}
@@ -3,6 +3,7 @@
 #include "ptpd.h"
 
 static void handle(PtpClock*);
+static void handleMessage(PtpClock*);
 static void handleAnnounce(PtpClock*, bool);
 static void handleSync(PtpClock*, TimeInternal*, bool);
 static void handleFollowUp(PtpClock*, bool);
@@ -13,6 +14,13 @@ static void handleDelayResp(PtpClock*, bool);
 static void handlePDelayRespFollowUp(PtpClock*, bool);
 static void handleManagement(PtpClock*, bool);
 static void handleSignaling(PtpClock*, bool);
+static SyncPair *getSyncPair(PtpClock*, int16_t);
+static void applySyncPair(PtpClock*, SyncPair*);
+static void addDelayTransaction(PtpClock*, int16_t, const TimeInternal*);
+static DelayTransaction *findDelayTransaction(PtpClock*, int16_t);
+static void handleStandbySync(PtpClock*, const TimeInternal*);
+static void handleStandbyFollowUp(PtpClock*);
+static bool failoverStandby(PtpClock*);
 
 static void issueDelayReqTimerExpired(PtpClock*);
 static void issueAnnounce(PtpClock*);
@@ -26,6 +34,7 @@ static void issuePDelayRespFollowUp(PtpClock*, const TimeInternal*, const MsgHea
 //static void issueManagement(const MsgHeader*,MsgManagement*,PtpClock*);
 
 static bool doInit(PtpClock*);
+static octet_t *getTemplate(PtpClock*, uint8_t);
 
 #ifdef PTPD_DBG
 static char *stateString(uint8_t state)
@@ -51,6 +60,8 @@ static char *stateString(uint8_t state)
 void toState(PtpClock *ptpClock, uint8_t state)
 {
 	ptpClock->messageActivity = TRUE;
+	ptpClock->stateChanges++;
+	ptpClock->templateDirty = TEMPLATE_ALL;
 
 	DBG("leaving state %s\n", stateString(ptpClock->portDS.portState));
 
@@ -184,6 +195,8 @@ void toState(PtpClock *ptpClock, uint8_t state)
 
 		case PTP_UNCALIBRATED:
 
+			/* Master back, the servo resumes from the predicted drift */
+			stopHoldover(ptpClock);
 			timerStart(ANNOUNCE_RECEIPT_TIMER, (ptpClock->portDS.announceReceiptTimeout)*(pow2ms(ptpClock->portDS.logAnnounceInterval)));
 			switch (ptpClock->portDS.delayMechanism)
 			{
@@ -234,6 +247,7 @@ static bool doInit(PtpClock *ptpClock)
 		initClock(ptpClock);
 		m1(ptpClock);
 		msgPackHeader(ptpClock, ptpClock->msgObuf);
+		ptpClock->templateDirty = TEMPLATE_ALL;
 		return TRUE;
 	}
 }
@@ -258,6 +272,7 @@ void doState(PtpClock *ptpClock)
 				DBGV("event STATE_DECISION_EVENT\n");
 				clearFlag(ptpClock->events, STATE_DECISION_EVENT);
 				ptpClock->recommendedState = bmc(ptpClock);
+				ptpClock->templateDirty = TEMPLATE_ALL;
 				DBGV("recommending state %s\n", stateString(ptpClock->recommendedState));
 
 				switch (ptpClock->recommendedState)
@@ -318,6 +333,7 @@ void doState(PtpClock *ptpClock)
 					{
 						DBG("event MASTER_CLOCK_CHANGED\n");
 						clearFlag(ptpClock->events, MASTER_CLOCK_CHANGED);
+						switchStandby(ptpClock);
 					}
 
 					break;
@@ -335,7 +351,11 @@ void doState(PtpClock *ptpClock)
 					{
 							DBG("event MASTER_CLOCK_CHANGED\n");
 							clearFlag(ptpClock->events, MASTER_CLOCK_CHANGED);
-							toState(ptpClock, PTP_UNCALIBRATED);
+							/* A converged standby keeps the port calibrated */
+							if (!switchStandby(ptpClock))
+							{
+								toState(ptpClock, PTP_UNCALIBRATED);
+							}
 					}
 
 					break;
@@ -399,10 +419,24 @@ void doState(PtpClock *ptpClock)
 			if (timerExpired(ANNOUNCE_RECEIPT_TIMER))
 			{
 				DBGV("event ANNOUNCE_RECEIPT_TIMEOUT_EXPIRES for state %s\n", stateString(ptpClock->portDS.portState));
+
+				if ((ptpClock->portDS.portState == PTP_SLAVE || ptpClock->portDS.portState == PTP_UNCALIBRATED) &&
+					failoverStandby(ptpClock))
+				{
+					timerStart(ANNOUNCE_RECEIPT_TIMER, (ptpClock->portDS.announceReceiptTimeout) * (pow2ms(ptpClock->portDS.logAnnounceInterval)));
+					break;
+				}
+
 				ptpClock->foreignMasterDS.count = 0;
 				ptpClock->foreignMasterDS.i = 0;
 
-				if (!(ptpClock->defaultDS.slaveOnly || ptpClock->defaultDS.clockQuality.clockClass == 255))
+				/* Before m1() overwrites the parent data set */
+				if (ptpClock->portDS.portState == PTP_SLAVE || ptpClock->portDS.portState == PTP_UNCALIBRATED)
+				{
+					startHoldover(ptpClock);
+				}
+
+				if (!(ptpClock->defaultDS.slaveOnly || ptpClock->defaultDS.clockQuality.clockClass == 255 || ptpClock->audit))
 				{
 					m1(ptpClock);
 					ptpClock->recommendedState = PTP_MASTER;
@@ -450,57 +484,57 @@ void doState(PtpClock *ptpClock)
 /* Check and handle received messages */
 static void handle(PtpClock *ptpClock)
 {
+	uint8_t state = ptpClock->portDS.portState;
+	int ret;
+	int n;
 
-		int ret;
-		bool  isFromSelf;
-		TimeInternal time = { 0, 0 };
+	/* Drain a bounded batch, the state decision runs once after it */
+	for (n = 0; n < DEFAULT_RX_BATCH; n++)
+	{
+		ret = netSelect(&ptpClock->netPath, 0);
 
-		if (FALSE == ptpClock->messageActivity)
+		if (ret < 0)
 		{
-				ret = netSelect(&ptpClock->netPath, 0);
-
-				if (ret < 0)
-				{
-						ERROR("handle: failed to poll sockets\n");
-						toState(ptpClock, PTP_FAULTY);
-						return;
-				}
-				else if (!ret)
-				{
-						DBGVV("handle: nothing\n");
-						return;
-				}
+			ERROR("handle: failed to poll sockets\n");
+			toState(ptpClock, PTP_FAULTY);
+			return;
+		}
+		else if (!ret)
+		{
+			DBGVV("handle: nothing\n");
+			break;
 		}
 
+		handleMessage(ptpClock);
+
+		/* Messages after a state change are handled in the new state */
+		if (ptpClock->portDS.portState != state)
+			break;
+	}
+}
+
+/* Receive one message, the earliest by ingress timestamp of both ports */
+static void handleMessage(PtpClock *ptpClock)
+{
+
+		bool  isFromSelf;
+		TimeInternal time = { 0, 0 };
+
 		DBGVV("handle: something\n");
 
-		/* Receive an event. */
-		ptpClock->msgIbufLength = netRecvEvent(&ptpClock->netPath, ptpClock->msgIbuf, &time);
+		ptpClock->msgIbufLength = netRecv(&ptpClock->netPath, ptpClock->msgIbuf, &time);
 		/* local time is not UTC, we can calculate UTC on demand, otherwise UTC time is not used */
 		/* time.seconds += ptpClock->timePropertiesDS.currentUtcOffset; */
-		DBGV("handle: netRecvEvent returned %d\n", ptpClock->msgIbufLength);
+		DBGV("handle: netRecv returned %d\n", ptpClock->msgIbufLength);
 
 		if (ptpClock->msgIbufLength < 0)
 		{
-				ERROR("handle: failed to receive on the event socket\n");
+				ERROR("handle: failed to receive\n");
 				toState(ptpClock, PTP_FAULTY);
 				return;
 		}
 		else if (!ptpClock->msgIbufLength)
-		{
-				/* Receive a general packet. */
-				ptpClock->msgIbufLength = netRecvGeneral(&ptpClock->netPath, ptpClock->msgIbuf, &time);
-				DBGV("handle: netRecvGeneral returned %d\n", ptpClock->msgIbufLength);
-
-				if (ptpClock->msgIbufLength < 0)
-				{
-						ERROR("handle: failed to receive on the general socket\n");
-						toState(ptpClock, PTP_FAULTY);
-						return;
-				}
-				else if (!ptpClock->msgIbufLength)
-						return;
-		}
+				return;
 
 		ptpClock->messageActivity = TRUE;
 
@@ -520,6 +554,18 @@ static void handle(PtpClock *ptpClock)
 				return;
 		}
 
+		if (ptpClock->audit)
+		{
+			/* Listen only, every domain */
+			if (!isSamePortIdentity(&ptpClock->portDS.portIdentity, &ptpClock->msgTmpHeader.sourcePortIdentity))
+			{
+				if (time.seconds > 0)
+						subTime(&time, &time, &ptpClock->inboundLatency);
+				auditMessage(ptpClock, &time);
+			}
+			return;
+		}
+
 		if (ptpClock->msgTmpHeader.domainNumber != ptpClock->defaultDS.domainNumber)
 		{
 				DBGV("handle: ignore message from domainNumber %d\n", ptpClock->msgTmpHeader.domainNumber);
@@ -660,6 +706,7 @@ static void handleSync(PtpClock *ptpClock, TimeInternal *time, bool isFromSelf)
 {
 	TimeInternal originTimestamp;
 	TimeInternal correctionField;
+	SyncPair *pair;
 	bool  isFromCurrentParent = FALSE;
 
 	DBGV("handleSync: received in state %s\n", stateString(ptpClock->portDS.portState));
@@ -695,24 +742,41 @@ static void handleSync(PtpClock *ptpClock, TimeInternal *time, bool isFromSelf)
 
 			if (!isFromCurrentParent)
 			{
-				DBGV("handleSync: ignore from another master\n");
+				handleStandbySync(ptpClock, time);
 				break;
 			}
 
-			ptpClock->timestamp_syncRecieve = *time;
+			/* Syncs of the parent lost on the way */
+			if (ptpClock->syncSequenceValid &&
+				(int16_t)(ptpClock->msgTmpHeader.sequenceId - ptpClock->lastSyncSequenceId) > 1)
+			{
+				ptpClock->syncSequenceGaps += (int16_t)(ptpClock->msgTmpHeader.sequenceId - ptpClock->lastSyncSequenceId) - 1;
+			}
+			ptpClock->lastSyncSequenceId = ptpClock->msgTmpHeader.sequenceId;
+			ptpClock->syncSequenceValid = TRUE;
+
 			scaledNanosecondsToInternalTime(&ptpClock->msgTmpHeader.correctionfield, &correctionField);
 
 			if (getFlag(ptpClock->msgTmpHeader.flagField[0], FLAG0_TWO_STEP))
 			{
-				ptpClock->waitingForFollowUp = TRUE;
-				ptpClock->recvSyncSequenceId = ptpClock->msgTmpHeader.sequenceId;
-				/* Save correctionField of Sync message for future use */
-				ptpClock->correctionField_sync = correctionField;
+				/* Paired with its Follow_Up whichever comes first */
+				pair = getSyncPair(ptpClock, ptpClock->msgTmpHeader.sequenceId);
+				pair->haveSync = TRUE;
+				pair->syncReceive = *time;
+				pair->correctionSync = correctionField;
+
+				if (pair->haveFollowUp)
+				{
+					ptpClock->earlyFollowUps++;
+					applySyncPair(ptpClock, pair);
+				}
 			}
 			else
 			{
 				msgUnpackSync(ptpClock->msgIbuf, &ptpClock->msgTmp.sync);
-				ptpClock->waitingForFollowUp = FALSE;
+				ptpClock->timestamp_syncRecieve = *time;
+				ptpClock->recvSyncSequenceId = ptpClock->msgTmpHeader.sequenceId;
+				ptpClock->syncApplied = TRUE;
 				/* Synchronize  local clock */
 				toInternalTime(&originTimestamp, &ptpClock->msgTmp.sync.originTimestamp);
 				/* use correctionField of Sync message for future use */
@@ -761,8 +825,7 @@ static void handleSync(PtpClock *ptpClock, TimeInternal *time, bool isFromSelf)
 
 static void handleFollowUp(PtpClock *ptpClock, bool isFromSelf)
 {
-	TimeInternal preciseOriginTimestamp;
-	TimeInternal correctionField;
+	SyncPair *pair;
 	bool  isFromCurrentParent = FALSE;
 
 	DBGV("handleFollowup: received in state %s\n", stateString(ptpClock->portDS.portState));
@@ -797,35 +860,27 @@ static void handleFollowUp(PtpClock *ptpClock, bool isFromSelf)
 			&ptpClock->parentDS.parentPortIdentity,
 			&ptpClock->msgTmpHeader.sourcePortIdentity);
 
-			if (!ptpClock->waitingForFollowUp)
-			{
-				DBGV("handleFollowup: not waiting a message\n");
-				break;
-			}
-
 			if (!isFromCurrentParent)
 			{
-				DBGV("handleFollowup: not from current parent\n");
+				handleStandbyFollowUp(ptpClock);
 				break;
 			}
 
-			if (ptpClock->recvSyncSequenceId !=  ptpClock->msgTmpHeader.sequenceId)
+			msgUnpackFollowUp(ptpClock->msgIbuf, &ptpClock->msgTmp.follow);
+
+			pair = getSyncPair(ptpClock, ptpClock->msgTmpHeader.sequenceId);
+			pair->haveFollowUp = TRUE;
+			toInternalTime(&pair->preciseOrigin, &ptpClock->msgTmp.follow.preciseOriginTimestamp);
+			scaledNanosecondsToInternalTime(&ptpClock->msgTmpHeader.correctionfield, &pair->correctionFollowUp);
+
+			if (!pair->haveSync)
 			{
-				DBGV("handleFollowup: SequenceID doesn't match with last Sync message\n");
+				DBGV("handleFollowup: Sync not received yet\n");
 				break;
 			}
 
-			msgUnpackFollowUp(ptpClock->msgIbuf, &ptpClock->msgTmp.follow);
-
-			ptpClock->waitingForFollowUp = FALSE;
 			/* synchronize local clock */
-			toInternalTime(&preciseOriginTimestamp, &ptpClock->msgTmp.follow.preciseOriginTimestamp);
-			scaledNanosecondsToInternalTime(&ptpClock->msgTmpHeader.correctionfield, &correctionField);
-			addTime(&correctionField, &correctionField, &ptpClock->correctionField_sync);
-			updateOffset(ptpClock, &ptpClock->timestamp_syncRecieve, &preciseOriginTimestamp, &correctionField);
-			updateClock(ptpClock);
-
-			issueDelayReqTimerExpired(ptpClock);
+			applySyncPair(ptpClock, pair);
 			break;
 
 		case PTP_MASTER:
@@ -847,6 +902,126 @@ static void handleFollowUp(PtpClock *ptpClock, bool isFromSelf)
 }
 
 
+/* Slot of a two step sequenceId, a different sequence left in it is dropped as an orphan */
+static SyncPair *getSyncPair(PtpClock *ptpClock, int16_t sequenceId)
+{
+	SyncPair *pair = &ptpClock->syncPairs[(uint16_t)sequenceId & (DEFAULT_SYNC_PAIRS - 1)];
+
+	if (pair->sequenceId != sequenceId || !(pair->haveSync || pair->haveFollowUp))
+	{
+		if (pair->haveSync)
+			ptpClock->orphanSyncs++;
+		if (pair->haveFollowUp)
+			ptpClock->orphanFollowUps++;
+
+		memset(pair, 0, sizeof(SyncPair));
+		pair->sequenceId = sequenceId;
+	}
+
+	return pair;
+}
+
+/* Feed a completed pair to the servo unless a newer Sync was already used */
+static void applySyncPair(PtpClock *ptpClock, SyncPair *pair)
+{
+	TimeInternal correctionField;
+
+	if (ptpClock->syncApplied && (int16_t)(pair->sequenceId - ptpClock->recvSyncSequenceId) <= 0)
+	{
+		DBGV("applySyncPair: older than the last Sync\n");
+		ptpClock->lateSyncPairs++;
+		memset(pair, 0, sizeof(SyncPair));
+		return;
+	}
+
+	ptpClock->recvSyncSequenceId = pair->sequenceId;
+	ptpClock->syncApplied = TRUE;
+	ptpClock->timestamp_syncRecieve = pair->syncReceive;
+
+	addTime(&correctionField, &pair->correctionSync, &pair->correctionFollowUp);
+	updateOffset(ptpClock, &ptpClock->timestamp_syncRecieve, &pair->preciseOrigin, &correctionField);
+	updateClock(ptpClock);
+	memset(pair, 0, sizeof(SyncPair));
+
+	issueDelayReqTimerExpired(ptpClock);
+}
+
+/* Sync from a foreign master besides the parent, tracked as hot standby */
+static void handleStandbySync(PtpClock *ptpClock, const TimeInternal *time)
+{
+	StandbyMaster *standby;
+	TimeInternal originTimestamp;
+	TimeInternal correctionField;
+
+	standby = findStandby(ptpClock, &ptpClock->msgTmpHeader.sourcePortIdentity);
+	if (standby == NULL)
+	{
+		standby = addStandby(ptpClock, &ptpClock->msgTmpHeader.sourcePortIdentity, time);
+	}
+
+	if (standby == NULL)
+	{
+		DBGV("handleSync: ignore from another master\n");
+		return;
+	}
+
+	scaledNanosecondsToInternalTime(&ptpClock->msgTmpHeader.correctionfield, &correctionField);
+
+	if (getFlag(ptpClock->msgTmpHeader.flagField[0], FLAG0_TWO_STEP))
+	{
+		standby->waitingForFollowUp = TRUE;
+		standby->recvSyncSequenceId = ptpClock->msgTmpHeader.sequenceId;
+		standby->syncReceive = *time;
+		standby->correctionSync = correctionField;
+	}
+	else
+	{
+		msgUnpackSync(ptpClock->msgIbuf, &ptpClock->msgTmp.sync);
+		standby->waitingForFollowUp = FALSE;
+		toInternalTime(&originTimestamp, &ptpClock->msgTmp.sync.originTimestamp);
+		updateStandbyOffset(ptpClock, standby, time, &originTimestamp, &correctionField);
+	}
+}
+
+static void handleStandbyFollowUp(PtpClock *ptpClock)
+{
+	StandbyMaster *standby;
+	TimeInternal preciseOriginTimestamp;
+	TimeInternal correctionField;
+
+	standby = findStandby(ptpClock, &ptpClock->msgTmpHeader.sourcePortIdentity);
+
+	if (standby == NULL || !standby->waitingForFollowUp ||
+		standby->recvSyncSequenceId != ptpClock->msgTmpHeader.sequenceId)
+	{
+		DBGV("handleFollowup: not from current parent\n");
+		return;
+	}
+
+	msgUnpackFollowUp(ptpClock->msgIbuf, &ptpClock->msgTmp.follow);
+
+	standby->waitingForFollowUp = FALSE;
+	toInternalTime(&preciseOriginTimestamp, &ptpClock->msgTmp.follow.preciseOriginTimestamp);
+	scaledNanosecondsToInternalTime(&ptpClock->msgTmpHeader.correctionfield, &correctionField);
+	addTime(&correctionField, &correctionField, &standby->correctionSync);
+	updateStandbyOffset(ptpClock, standby, &standby->syncReceive, &preciseOriginTimestamp, &correctionField);
+}
+
+/* Parent lost, let the BMC pick among the remaining masters if one is tracked */
+static bool failoverStandby(PtpClock *ptpClock)
+{
+	if (!hasWarmStandby(ptpClock))
+	{
+		return FALSE;
+	}
+
+	DBG("failoverStandby: parent lost\n");
+	removeForeign(ptpClock, &ptpClock->parentDS.parentPortIdentity);
+	setFlag(ptpClock->events, STATE_DECISION_EVENT);
+
+	return TRUE;
+}
+
 static void handleDelayReq(PtpClock *ptpClock, TimeInternal *time, bool isFromSelf)
 {
 	switch (ptpClock->portDS.delayMechanism)
@@ -888,6 +1063,8 @@ static void handleDelayReq(PtpClock *ptpClock, TimeInternal *time, bool isFromSe
 				case PTP_MASTER:
 					/* TODO: manage the value of ptpClock->logMinDelayReqInterval form logSyncInterval to logSyncInterval + 5 */
 					issueDelayResp(ptpClock, time, &ptpClock->msgTmpHeader);
+					if (!isFromSelf)
+						slaveRequest(ptpClock, time);
 					break;
 
 				default:
@@ -916,6 +1093,9 @@ static void handleDelayResp(PtpClock *ptpClock, bool  isFromSelf)
 	bool  isFromCurrentParent = FALSE;
 	bool  isCurrentRequest = FALSE;
 	TimeInternal correctionField;
+	TimeInternal receiveTimestamp;
+	StandbyMaster *standby;
+	DelayTransaction *transaction;
 
 	switch (ptpClock->portDS.delayMechanism)
 	{
@@ -951,9 +1131,17 @@ static void handleDelayResp(PtpClock *ptpClock, bool  isFromSelf)
 					&ptpClock->portDS.portIdentity,
 					&ptpClock->msgTmp.resp.requestingPortIdentity);
 
-					if (((ptpClock->sentDelayReqSequenceId - 1) == ptpClock->msgTmpHeader.sequenceId) && isCurrentRequest && isFromCurrentParent)
+					/* Any outstanding request may be answered, not only the last one */
+					transaction = isCurrentRequest ? findDelayTransaction(ptpClock, ptpClock->msgTmpHeader.sequenceId) : NULL;
+
+					if (transaction != NULL && isFromCurrentParent && !transaction->answered)
 					{
 						/* TODO: revisit 11.3 */
+						transaction->answered = TRUE;
+						if ((int16_t)(ptpClock->sentDelayReqSequenceId - 1) != ptpClock->msgTmpHeader.sequenceId)
+							ptpClock->lateDelayResps++;
+
+						ptpClock->timestamp_delayReqSend = transaction->send;
 						toInternalTime(&ptpClock->timestamp_delayReqRecieve, &ptpClock->msgTmp.resp.receiveTimestamp);
 
 						scaledNanosecondsToInternalTime(&ptpClock->msgTmpHeader.correctionfield, &correctionField);
@@ -961,6 +1149,14 @@ static void handleDelayResp(PtpClock *ptpClock, bool  isFromSelf)
 
 						ptpClock->portDS.logMinDelayReqInterval = ptpClock->msgTmpHeader.logMessageInterval;
 					}
+					else if (transaction != NULL && !isFromCurrentParent &&
+							 (standby = findStandby(ptpClock, &ptpClock->msgTmpHeader.sourcePortIdentity)) != NULL)
+					{
+						/* Standby masters answer the same request */
+						toInternalTime(&receiveTimestamp, &ptpClock->msgTmp.resp.receiveTimestamp);
+						scaledNanosecondsToInternalTime(&ptpClock->msgTmpHeader.correctionfield, &correctionField);
+						updateStandbyDelay(ptpClock, standby, &transaction->send, &receiveTimestamp, &correctionField);
+					}
 					else
 					{
 						DBGV("handleDelayResp: doesn't match with the delayReq\n");
@@ -981,6 +1177,50 @@ static void handleDelayResp(PtpClock *ptpClock, bool  isFromSelf)
 }
 
 
+/* Remember a sent request, the slot of the same sequenceId one table length ago is given up */
+static void addDelayTransaction(PtpClock *ptpClock, int16_t sequenceId, const TimeInternal *send)
+{
+	DelayTransaction *transaction = &ptpClock->delayTransactions[(uint16_t)sequenceId & (DEFAULT_DELAY_TRANSACTIONS - 1)];
+
+	if (transaction->used && !transaction->answered)
+		ptpClock->expiredDelayReqs++;
+
+	memset(transaction, 0, sizeof(DelayTransaction));
+	transaction->used = TRUE;
+	transaction->sequenceId = sequenceId;
+	transaction->send = *send;
+}
+
+/* Outstanding request of a response, NULL if unknown, expired or not timestamped */
+static DelayTransaction *findDelayTransaction(PtpClock *ptpClock, int16_t sequenceId)
+{
+	DelayTransaction *transaction = &ptpClock->delayTransactions[(uint16_t)sequenceId & (DEFAULT_DELAY_TRANSACTIONS - 1)];
+	TimeInternal now;
+
+	if (!transaction->used || transaction->sequenceId != sequenceId)
+		return NULL;
+
+	if (transaction->send.seconds == 0)
+	{
+		DBGV("findDelayTransaction: no TX timestamp\n");
+		return NULL;
+	}
+
+	getTime(&now);
+	subTime(&now, &now, &transaction->send);
+
+	if (now.seconds >= DEFAULT_DELAY_TRANSACTION_TIMEOUT)
+	{
+		DBGV("findDelayTransaction: expired\n");
+		if (!transaction->answered)
+			ptpClock->expiredDelayReqs++;
+		memset(transaction, 0, sizeof(DelayTransaction));
+		return NULL;
+	}
+
+	return transaction;
+}
+
 static void handlePDelayReq(PtpClock *ptpClock, TimeInternal *time, bool  isFromSelf)
 {
 	switch (ptpClock->portDS.delayMechanism)
@@ -1061,6 +1301,7 @@ static void handlePDelayResp(PtpClock *ptpClock, TimeInternal *time, bool isFrom
 	TimeInternal requestReceiptTimestamp;
 	TimeInternal correctionField;
 	bool  isCurrentRequest;
+	DelayTransaction *transaction;
 
 	switch (ptpClock->portDS.delayMechanism)
 	{
@@ -1113,27 +1354,33 @@ static void handlePDelayResp(PtpClock *ptpClock, TimeInternal *time, bool isFrom
 					&ptpClock->portDS.portIdentity,
 					&ptpClock->msgTmp.presp.requestingPortIdentity);
 
-					if (((ptpClock->sentPDelayReqSequenceId - 1) == ptpClock->msgTmpHeader.sequenceId) && isCurrentRequest)
+					transaction = isCurrentRequest ? findDelayTransaction(ptpClock, ptpClock->msgTmpHeader.sequenceId) : NULL;
+
+					if (transaction != NULL && !transaction->answered)
 					{
+						if ((int16_t)(ptpClock->sentPDelayReqSequenceId - 1) != ptpClock->msgTmpHeader.sequenceId)
+							ptpClock->lateDelayResps++;
+
 						if (getFlag(ptpClock->msgTmpHeader.flagField[0], FLAG0_TWO_STEP))
 						{
-							ptpClock->waitingForPDelayRespFollowUp = TRUE;
+							transaction->waitingForFollowUp = TRUE;
 
 							/* Store  t4 (Fig 35)*/
-							ptpClock->pdelay_t4 = *time;
+							transaction->responseReceive = *time;
 
 							/* store  t2 (Fig 35)*/
 							toInternalTime(&requestReceiptTimestamp, &ptpClock->msgTmp.presp.requestReceiptTimestamp);
-							ptpClock->pdelay_t2 = requestReceiptTimestamp;
+							transaction->requestReceipt = requestReceiptTimestamp;
 
 							scaledNanosecondsToInternalTime(&ptpClock->msgTmpHeader.correctionfield, &correctionField);
-							ptpClock->correctionField_pDelayResp = correctionField;
+							transaction->correction = correctionField;
 						}//Two Step Clock
 						else //One step Clock
 						{
-							ptpClock->waitingForPDelayRespFollowUp = FALSE;
+							transaction->answered = TRUE;
 
-							/* Store  t4 (Fig 35)*/
+							/* Store  t1 and t4 (Fig 35)*/
+							ptpClock->pdelay_t1 = transaction->send;
 							ptpClock->pdelay_t4 = *time;
 
 							scaledNanosecondsToInternalTime(&ptpClock->msgTmpHeader.correctionfield, &correctionField);
@@ -1164,6 +1411,7 @@ static void handlePDelayRespFollowUp(PtpClock *ptpClock, bool isFromSelf)
 {
 	TimeInternal responseOriginTimestamp;
 	TimeInternal correctionField;
+	DelayTransaction *transaction;
 
 	switch (ptpClock->portDS.delayMechanism)
 	{
@@ -1194,23 +1442,26 @@ static void handlePDelayRespFollowUp(PtpClock *ptpClock, bool isFromSelf)
 				case PTP_SLAVE:
 				case PTP_MASTER:
 
-					if (!ptpClock->waitingForPDelayRespFollowUp)
+					transaction = findDelayTransaction(ptpClock, ptpClock->msgTmpHeader.sequenceId);
+
+					if (transaction == NULL || !transaction->waitingForFollowUp)
 					{
 						DBG("handlePDelayRespFollowUp: not waiting a message\n");
 						break;
 					}
 
-					if (ptpClock->msgTmpHeader.sequenceId == ptpClock->sentPDelayReqSequenceId - 1)
-					{
-							msgUnpackPDelayRespFollowUp(ptpClock->msgIbuf, &ptpClock->msgTmp.prespfollow);
-							toInternalTime(&responseOriginTimestamp, &ptpClock->msgTmp.prespfollow.responseOriginTimestamp);
-							ptpClock->pdelay_t3 = responseOriginTimestamp;
-							scaledNanosecondsToInternalTime(&ptpClock->msgTmpHeader.correctionfield, &correctionField);
-							addTime(&correctionField, &correctionField, &ptpClock->correctionField_pDelayResp);
-							updatePeerDelay(ptpClock, &correctionField, TRUE);
-							ptpClock->waitingForPDelayRespFollowUp = FALSE;
-							break;
-					}
+					msgUnpackPDelayRespFollowUp(ptpClock->msgIbuf, &ptpClock->msgTmp.prespfollow);
+					toInternalTime(&responseOriginTimestamp, &ptpClock->msgTmp.prespfollow.responseOriginTimestamp);
+					ptpClock->pdelay_t1 = transaction->send;
+					ptpClock->pdelay_t2 = transaction->requestReceipt;
+					ptpClock->pdelay_t3 = responseOriginTimestamp;
+					ptpClock->pdelay_t4 = transaction->responseReceive;
+					scaledNanosecondsToInternalTime(&ptpClock->msgTmpHeader.correctionfield, &correctionField);
+					addTime(&correctionField, &correctionField, &transaction->correction);
+					updatePeerDelay(ptpClock, &correctionField, TRUE);
+					transaction->waitingForFollowUp = FALSE;
+					transaction->answered = TRUE;
+					break;
 
 				default:
 
@@ -1226,8 +1477,11 @@ static void handlePDelayRespFollowUp(PtpClock *ptpClock, bool isFromSelf)
 
 static void handleManagement(PtpClock *ptpClock, bool isFromSelf)
 {
-	/* ENABLE_PORT -> DESIGNATED_ENABLED -> toState(PTP_INITIALIZING) */
-	/* DISABLE_PORT -> DESIGNATED_DISABLED -> toState(PTP_DISABLED) */
+	/* Our own requests and responses come back through the multicast loop */
+	if (isFromSelf)
+		return;
+
+	handleManagementMessage(ptpClock);
 }
 
 static void handleSignaling(PtpClock *ptpClock, bool  isFromSelf)
@@ -1270,12 +1524,59 @@ static void issueDelayReqTimerExpired(PtpClock *ptpClock)
 }
 
 
-/* Pack and send  on general multicast ip adress an Announce message */
+/* Get a transmit template for patching, rebuilding it first if the data sets changed.
+ * While the driver holds a response template the response is packed into
+ * msgObuf instead, to be sent on a copy: answering several ports back to
+ * back must not drop any. */
+static octet_t *getTemplate(PtpClock *ptpClock, uint8_t index)
+{
+	octet_t *buf = netGetTemplate(&ptpClock->netPath, index);
+
+	if (buf == NULL)
+	{
+		if (!getFlag(TEMPLATE_RESPONSES, 1 << index))
+		{
+			ptpClock->netPath.txTemplateBusy++;
+			return NULL;
+		}
+
+		buf = ptpClock->msgObuf;
+		msgPackTemplate(ptpClock, buf, index);
+		return buf;
+	}
+
+	if (getFlag(ptpClock->templateDirty, 1 << index))
+	{
+		msgPackTemplate(ptpClock, buf, index);
+		clearFlag(ptpClock->templateDirty, 1 << index);
+	}
+
+	return buf;
+}
+
+/* Send a message patched in the buffer given by getTemplate */
+static ssize_t sendTemplate(PtpClock *ptpClock, uint8_t index, const octet_t *buf, TimeInternal *time)
+{
+	if (buf == ptpClock->msgObuf)
+		return netSendCopy(&ptpClock->netPath, index, buf, time);
+
+	return netSendTemplate(&ptpClock->netPath, index, time);
+}
+
+/* Patch and send  on general multicast ip adress an Announce message */
 static void issueAnnounce(PtpClock *ptpClock)
 {
-	msgPackAnnounce(ptpClock, ptpClock->msgObuf);
+	octet_t *buf;
+
+	if ((buf = getTemplate(ptpClock, TEMPLATE_ANNOUNCE)) == NULL)
+	{
+		ERROR("issueAnnounce: template busy\n");
+		return;
+	}
 
-	if (!netSendGeneral(&ptpClock->netPath, ptpClock->msgObuf, ANNOUNCE_LENGTH))
+	msgPatchSequenceId(buf, ptpClock->sentAnnounceSequenceId);
+
+	if (!sendTemplate(ptpClock, TEMPLATE_ANNOUNCE, buf, NULL))
 	{
 		ERROR("issueAnnounce: can't sent\n");
 		toState(ptpClock, PTP_FAULTY);
@@ -1287,17 +1588,26 @@ static void issueAnnounce(PtpClock *ptpClock)
 	}
 }
 
-/* Pack and send  on event multicast ip address a Sync message */
+/* Patch and send  on event multicast ip address a Sync message */
 static void issueSync(PtpClock *ptpClock)
 {
 	Timestamp originTimestamp;
 	TimeInternal internalTime;
+	octet_t *buf;
+
+	if ((buf = getTemplate(ptpClock, TEMPLATE_SYNC)) == NULL)
+	{
+		ERROR("issueSync: template busy\n");
+		return;
+	}
 
 	/* try to predict outgoing time stamp */
 	getTime(&internalTime);
 	fromInternalTime(&internalTime, &originTimestamp);
-	msgPackSync(ptpClock, ptpClock->msgObuf, &originTimestamp);
-	if (!netSendEvent(&ptpClock->netPath, ptpClock->msgObuf, SYNC_LENGTH, &internalTime))
+	msgPatchSequenceId(buf, ptpClock->sentSyncSequenceId);
+	msgPatchTimestamp(buf, &originTimestamp);
+
+	if (!sendTemplate(ptpClock, TEMPLATE_SYNC, buf, &internalTime))
 	{
 		ERROR("issueSync: can't sent\n");
 		toState(ptpClock, PTP_FAULTY);
@@ -1321,15 +1631,23 @@ static void issueSync(PtpClock *ptpClock)
 	}
 }
 
-/* Pack and send on general multicast ip adress a FollowUp message */
+/* Patch and send on general multicast ip adress a FollowUp message */
 static void issueFollowup(PtpClock *ptpClock, const TimeInternal *time)
 {
 	Timestamp preciseOriginTimestamp;
+	octet_t *buf;
+
+	if ((buf = getTemplate(ptpClock, TEMPLATE_FOLLOW_UP)) == NULL)
+	{
+		ERROR("issueFollowup: template busy\n");
+		return;
+	}
 
 	fromInternalTime(time, &preciseOriginTimestamp);
-	msgPackFollowUp(ptpClock, ptpClock->msgObuf, &preciseOriginTimestamp);
+	msgPatchSequenceId(buf, ptpClock->sentSyncSequenceId - 1); /* sentSyncSequenceId has already been incremented in issueSync */
+	msgPatchTimestamp(buf, &preciseOriginTimestamp);
 
-	if (!netSendGeneral(&ptpClock->netPath, ptpClock->msgObuf, FOLLOW_UP_LENGTH))
+	if (!sendTemplate(ptpClock, TEMPLATE_FOLLOW_UP, buf, NULL))
 	{
 		ERROR("issueFollowup: can't sent\n");
 		toState(ptpClock, PTP_FAULTY);
@@ -1341,18 +1659,25 @@ static void issueFollowup(PtpClock *ptpClock, const TimeInternal *time)
 }
 
 
-/* Pack and send on event multicast ip address a DelayReq message */
+/* Patch and send on event multicast ip address a DelayReq message */
 static void issueDelayReq(PtpClock *ptpClock)
 {
 	Timestamp originTimestamp;
 	TimeInternal internalTime;
+	octet_t *buf;
+
+	if ((buf = getTemplate(ptpClock, TEMPLATE_DELAY_REQ)) == NULL)
+	{
+		ERROR("issueDelayReq: template busy\n");
+		return;
+	}
 
 	getTime(&internalTime);
 	fromInternalTime(&internalTime, &originTimestamp);
+	msgPatchSequenceId(buf, ptpClock->sentDelayReqSequenceId);
+	msgPatchTimestamp(buf, &originTimestamp);
 
-	msgPackDelayReq(ptpClock, ptpClock->msgObuf, &originTimestamp);
-
-	if (!netSendEvent(&ptpClock->netPath, ptpClock->msgObuf, DELAY_REQ_LENGTH, &internalTime))
+	if (!sendTemplate(ptpClock, TEMPLATE_DELAY_REQ, buf, &internalTime))
 	{
 		ERROR("issueDelayReq: can't sent\n");
 		toState(ptpClock, PTP_FAULTY);
@@ -1360,29 +1685,36 @@ static void issueDelayReq(PtpClock *ptpClock)
 	else
 	{
 		DBGV("issueDelayReq\n");
-		ptpClock->sentDelayReqSequenceId++;
 
 		/* Delay req TX timestamp is valid */
 		if (internalTime.seconds != 0)
 		{
 			addTime(&internalTime, &internalTime, &ptpClock->outboundLatency);
-			ptpClock->timestamp_delayReqSend = internalTime;
 		}
+		addDelayTransaction(ptpClock, ptpClock->sentDelayReqSequenceId, &internalTime);
+		ptpClock->sentDelayReqSequenceId++;
 	}
 }
 
-/* Pack and send on event multicast ip adress a PDelayReq message */
+/* Patch and send on event multicast ip adress a PDelayReq message */
 static void issuePDelayReq(PtpClock *ptpClock)
 {
 	Timestamp originTimestamp;
 	TimeInternal internalTime;
+	octet_t *buf;
+
+	if ((buf = getTemplate(ptpClock, TEMPLATE_PDELAY_REQ)) == NULL)
+	{
+		ERROR("issuePDelayReq: template busy\n");
+		return;
+	}
 
 	getTime(&internalTime);
 	fromInternalTime(&internalTime, &originTimestamp);
+	msgPatchSequenceId(buf, ptpClock->sentPDelayReqSequenceId);
+	msgPatchTimestamp(buf, &originTimestamp);
 
-	msgPackPDelayReq(ptpClock, ptpClock->msgObuf, &originTimestamp);
-
-	if (!netSendPeerEvent(&ptpClock->netPath, ptpClock->msgObuf, PDELAY_REQ_LENGTH, &internalTime))
+	if (!sendTemplate(ptpClock, TEMPLATE_PDELAY_REQ, buf, &internalTime))
 	{
 		ERROR("issuePDelayReq: can't sent\n");
 		toState(ptpClock, PTP_FAULTY);
@@ -1390,26 +1722,35 @@ static void issuePDelayReq(PtpClock *ptpClock)
 	else
 	{
 		DBGV("issuePDelayReq\n");
-		ptpClock->sentPDelayReqSequenceId++;
 
 		/* Delay req TX timestamp is valid */
 		if (internalTime.seconds != 0)
 		{
 			addTime(&internalTime, &internalTime, &ptpClock->outboundLatency);
-			ptpClock->pdelay_t1 = internalTime;
 		}
+		addDelayTransaction(ptpClock, ptpClock->sentPDelayReqSequenceId, &internalTime);
+		ptpClock->sentPDelayReqSequenceId++;
 	}
 }
 
-/* Pack and send on event multicast ip adress a PDelayResp message */
+/* Patch and send on event multicast ip adress a PDelayResp message */
 static void issuePDelayResp(PtpClock *ptpClock, TimeInternal *time, const MsgHeader * pDelayReqHeader)
 {
 	Timestamp requestReceiptTimestamp;
+	octet_t *buf;
+
+	if ((buf = getTemplate(ptpClock, TEMPLATE_PDELAY_RESP)) == NULL)
+	{
+		ERROR("issuePDelayResp: template busy\n");
+		return;
+	}
 
 	fromInternalTime(time, &requestReceiptTimestamp);
-	msgPackPDelayResp(ptpClock->msgObuf, pDelayReqHeader, &requestReceiptTimestamp);
+	msgPatchSequenceId(buf, pDelayReqHeader->sequenceId);
+	msgPatchTimestamp(buf, &requestReceiptTimestamp);
+	msgPatchRequestingPortIdentity(buf, &pDelayReqHeader->sourcePortIdentity);
 
-	if (!netSendPeerEvent(&ptpClock->netPath, ptpClock->msgObuf, PDELAY_RESP_LENGTH, time))
+	if (!sendTemplate(ptpClock, TEMPLATE_PDELAY_RESP, buf, time))
 	{
 		ERROR("issuePDelayResp: can't sent\n");
 		toState(ptpClock, PTP_FAULTY);
@@ -1427,15 +1768,25 @@ static void issuePDelayResp(PtpClock *ptpClock, TimeInternal *time, const MsgHea
 }
 
 
-/* Pack and send on event multicast ip adress a DelayResp message */
+/* Patch and send on event multicast ip adress a DelayResp message */
 static void issueDelayResp(PtpClock *ptpClock, const TimeInternal *time, const MsgHeader * delayReqHeader)
 {
 	Timestamp requestReceiptTimestamp;
+	octet_t *buf;
+
+	if ((buf = getTemplate(ptpClock, TEMPLATE_DELAY_RESP)) == NULL)
+	{
+		ERROR("issueDelayResp: template busy\n");
+		return;
+	}
 
 	fromInternalTime(time, &requestReceiptTimestamp);
-	msgPackDelayResp(ptpClock, ptpClock->msgObuf, delayReqHeader, &requestReceiptTimestamp);
+	msgPatchCorrection(buf, delayReqHeader->correctionfield);
+	msgPatchSequenceId(buf, delayReqHeader->sequenceId);
+	msgPatchTimestamp(buf, &requestReceiptTimestamp);
+	msgPatchRequestingPortIdentity(buf, &delayReqHeader->sourcePortIdentity);
 
-	if (!netSendGeneral(&ptpClock->netPath, ptpClock->msgObuf, PDELAY_RESP_LENGTH))
+	if (!sendTemplate(ptpClock, TEMPLATE_DELAY_RESP, buf, NULL))
 	{
 		ERROR("issueDelayResp: can't sent\n");
 		toState(ptpClock, PTP_FAULTY);
@@ -1449,11 +1800,21 @@ static void issueDelayResp(PtpClock *ptpClock, const TimeInternal *time, const M
 static void issuePDelayRespFollowUp(PtpClock *ptpClock, const TimeInternal *time, const MsgHeader * pDelayReqHeader)
 {
 	Timestamp responseOriginTimestamp;
-	fromInternalTime(time, &responseOriginTimestamp);
+	octet_t *buf;
 
-	msgPackPDelayRespFollowUp(ptpClock->msgObuf, pDelayReqHeader, &responseOriginTimestamp);
+	if ((buf = getTemplate(ptpClock, TEMPLATE_PDELAY_RESP_FOLLOW_UP)) == NULL)
+	{
+		ERROR("issuePDelayRespFollowUp: template busy\n");
+		return;
+	}
 
-	if (!netSendPeerGeneral(&ptpClock->netPath, ptpClock->msgObuf, PDELAY_RESP_FOLLOW_UP_LENGTH))
+	fromInternalTime(time, &responseOriginTimestamp);
+	msgPatchCorrection(buf, pDelayReqHeader->correctionfield);
+	msgPatchSequenceId(buf, pDelayReqHeader->sequenceId);
+	msgPatchTimestamp(buf, &responseOriginTimestamp);
+	msgPatchRequestingPortIdentity(buf, &pDelayReqHeader->sourcePortIdentity);
+
+	if (!sendTemplate(ptpClock, TEMPLATE_PDELAY_RESP_FOLLOW_UP, buf, NULL))
 	{
 		ERROR("issuePDelayRespFollowUp: can't sent\n");
 		toState(ptpClock, PTP_FAULTY);
@@ -1463,4 +1824,3 @@ static void issuePDelayRespFollowUp(PtpClock *ptpClock, const TimeInternal *time
 		DBGV("issuePDelayRespFollowUp\n");
 	}
 }
-
@@ -2,6 +2,7 @@
 
 #include "ptpd.h"
 #include "syslog.h"
+#include "metrics.h"
 
 #define PTPD_THREAD_PRIO    (tskIDLE_PRIORITY + 2)
 
@@ -13,8 +14,116 @@ static PtpClock ptpClock;
 static RunTimeOpts rtOpts;
 static ForeignMasterRecord ptpForeignRecords[DEFAULT_MAX_FOREIGN_RECORDS];
 
+// Time source update posted by other threads, applied by the PTP thread.
+static TimeSource pendingTimeSource;
+static volatile bool timeSourcePending;
+
+// Audit mode change posted by other threads, applied by the PTP thread.
+static volatile bool auditPending;
+static bool auditRequest;
+
+// Slave table reset posted by other threads, the table is only changed by the PTP thread.
+static volatile bool slaveClearPending;
+
+// Management GET posted by other threads, sent by the PTP thread.
+static volatile bool managementPending;
+static enum16bit_t managementPendingId;
+
+// Holdover state changes are reported to this callback from the PTP thread.
+static void (*holdoverCallback)(const HoldoverInfo *info);
+
+// Servo updates are reported to these callbacks from the PTP thread.
+static void (*sampleCallbacks[DEFAULT_SAMPLE_CALLBACKS])(const ServoSample *sample);
+
+// Odd while the PTP thread runs the sample callbacks.
+static volatile uint32_t sampleReporting;
+
 __IO uint32_t PTPTimer = 0;
 
+// Apply a pending time source update to the run-time options and data sets.
+static void ptpd_apply_time_source(void)
+{
+	TimeSource ts;
+
+	taskENTER_CRITICAL();
+	ts = pendingTimeSource;
+	timeSourcePending = FALSE;
+	taskEXIT_CRITICAL();
+
+	rtOpts.clockQuality = ts.clockQuality;
+	if (rtOpts.slaveOnly) rtOpts.clockQuality.clockClass = DEFAULT_CLOCK_CLASS_SLAVE_ONLY;
+	rtOpts.currentUtcOffset = ts.currentUtcOffset;
+	rtOpts.currentUtcOffsetValid = ts.currentUtcOffsetValid;
+	rtOpts.timeTraceable = ts.timeTraceable;
+	rtOpts.frequencyTraceable = ts.frequencyTraceable;
+	rtOpts.ptpTimescale = ts.ptpTimescale;
+	rtOpts.timeSource = ts.timeSource;
+
+	ptpClock.defaultDS.clockQuality = rtOpts.clockQuality;
+
+	// Our own announce carries the new quality, foreign masters are re-ranked against it.
+	if (ptpClock.portDS.portState == PTP_MASTER) m1(&ptpClock);
+	ptpClock.templateDirty = TEMPLATE_ALL;
+	if (ptpClock.foreignMasterDS.count > 0) setFlag(ptpClock.events, STATE_DECISION_EVENT);
+
+	DBG("ptpd: time source class %d source 0x%02x\n", ts.clockQuality.clockClass, ts.timeSource);
+}
+
+// Enter or leave the listen only audit mode.
+static void ptpd_apply_audit(void)
+{
+	auditPending = FALSE;
+
+	if (auditRequest == ptpClock.audit) return;
+
+	ptpClock.audit = auditRequest;
+
+	// The PHC is left to the other time sources while auditing.
+	if (ptpClock.audit) stopHoldover(&ptpClock);
+
+	ptpClock.foreignMasterDS.count = 0;
+	ptpClock.foreignMasterDS.i = 0;
+
+	switch (ptpClock.portDS.portState)
+	{
+		case PTP_INITIALIZING:
+		case PTP_FAULTY:
+			break;
+		default:
+			toState(&ptpClock, PTP_LISTENING);
+			break;
+	}
+
+	DBG("ptpd: audit %s\n", ptpClock.audit ? "on" : "off");
+}
+
+// Hand a servo update to the offset histogram and the telemetry callbacks.
+void reportServoUpdate(PtpClock *ptpClock)
+{
+	const TimeInternal *offset = &ptpClock->currentDS.offsetFromMaster;
+	void (*cb)(const ServoSample *sample);
+	ServoSample sample;
+	int i;
+
+	metrics_observe(METRIC_HIST_PTP_OFFSET, offset->seconds ? UINT32_MAX : (uint32_t)abs(offset->nanoseconds));
+
+	sample.seconds = ptpClock->timestamp_syncRecieve.seconds;
+	sample.nanoseconds = ptpClock->timestamp_syncRecieve.nanoseconds;
+	sample.offsetFromMaster = offset->seconds > 1 ? INT32_MAX : offset->seconds < -1 ? INT32_MIN :
+		offset->seconds * 1000000000 + offset->nanoseconds;
+	sample.meanPathDelay = ptpClock->currentDS.meanPathDelay.nanoseconds;
+	sample.observedDrift = ptpClock->observedDrift;
+	sample.portState = ptpClock->portDS.portState;
+
+	sampleReporting++;
+	for (i = 0; i < DEFAULT_SAMPLE_CALLBACKS; i++)
+	{
+		cb = sampleCallbacks[i];
+		if (cb) cb(&sample);
+	}
+	sampleReporting++;
+}
+
 static void ptpd_thread(void const *arg)
 {
 	// Initialize run-time options to default values.
@@ -28,6 +137,11 @@ static void ptpd_thread(void const *arg)
 	rtOpts.domainNumber = DEFAULT_DOMAIN_NUMBER;
 	rtOpts.slaveOnly = SLAVE_ONLY;
 	rtOpts.currentUtcOffset = DEFAULT_UTC_OFFSET;
+	rtOpts.currentUtcOffsetValid = DEFAULT_UTC_VALID;
+	rtOpts.timeTraceable = DEFAULT_TIME_TRACEABLE;
+	rtOpts.frequencyTraceable = DEFAULT_FREQUENCY_TRACEABLE;
+	rtOpts.ptpTimescale = (bool)(DEFAULT_TIMESCALE == PTP_TIMESCALE);
+	rtOpts.timeSource = DEFAULT_TIME_SOURCE;
 	rtOpts.servo.noResetClock = DEFAULT_NO_RESET_CLOCK;
 	rtOpts.servo.noAdjust = NO_ADJUST;
 	rtOpts.inboundLatency.nanoseconds = DEFAULT_INBOUND_LATENCY;
@@ -47,6 +161,8 @@ static void ptpd_thread(void const *arg)
 		return;
 	}
 
+	slaveClear();
+
 	LOG_INF("PTP thread ready.\n");
 
 #ifdef USE_DHCP
@@ -62,28 +178,66 @@ static void ptpd_thread(void const *arg)
 	for (;;)
 	{
 		void *msg;
+		int batches;
+
+		if (timeSourcePending) ptpd_apply_time_source();
+		if (auditPending) ptpd_apply_audit();
+		if (slaveClearPending)
+		{
+			slaveClearPending = FALSE;
+			slaveClear();
+		}
+		if (managementPending)
+		{
+			managementPending = FALSE;
+			if (ptpClock.portDS.portState != PTP_INITIALIZING && ptpClock.portDS.portState != PTP_FAULTY)
+				issueManagementGet(&ptpClock, managementPendingId);
+		}
+
+		// Keep the PHC on the predicted frequency while the master is lost.
+		if (ptpClock.holdover.active) updateHoldover(&ptpClock);
 
 		// Process the current state.
+		batches = 0;
 		do
 		{
 			// doState() has a switch for the actions and events to be
 			// checked for 'port_state'. The actions and events may or may not change
 			// 'port_state' by calling toState(), but once they are done we loop around
 			// again and perform the actions required for the new 'port_state'.
+			// Each pass drains a batch of received messages.
 			doState(&ptpClock);
 		}
-		while (netSelect(&ptpClock.netPath, 0) > 0);
+		while (netSelect(&ptpClock.netPath, 0) > 0 && ++batches < DEFAULT_RX_BATCHES);
+
+		// Come back right after the wait if messages are left.
+		if (batches == DEFAULT_RX_BATCHES) ptpd_alert();
+
+		// Parent, domain and audit mode of the receive filter.
+		netUpdateFilter(&ptpClock.netPath, &ptpClock);
+
+		if (ptpClock.holdover.notify)
+		{
+			ptpClock.holdover.notify = FALSE;
+			if (holdoverCallback) holdoverCallback(&ptpClock.holdover.info);
+		}
+
 		// Wait up to 100ms for something to do, then do something anyway.
 		sys_arch_mbox_fetch(&ptp_alert_queue, &msg, 100);
+
+		// Every packet posts an alert, one pass serves those already queued.
+		while (sys_arch_mbox_tryfetch(&ptp_alert_queue, &msg) != SYS_MBOX_EMPTY);
 	}
 }
 
 
 static void ptpd_displayStats(const PtpClock *ptpClock)
 {
+	const uint32_t *dropped = ptpClock->netPath.filter.dropped;
 	const char *s;
 	unsigned char *uuid;
 	char sign;
+	int i;
 
 	uuid = (unsigned char*) ptpClock->parentDS.parentPortIdentity.clockIdentity;
 
@@ -142,6 +296,68 @@ static void ptpd_displayStats(const PtpClock *ptpClock)
 	if (ptpClock->observedDrift < 0) sign = '-';
 
 	LOG_PRINT("\tdrift: %c%d.%03d ppm", sign, abs(ptpClock->observedDrift / 1000), abs(ptpClock->observedDrift % 1000));
+
+	/* Hot standby masters */
+	for (i = 0; i < DEFAULT_STANDBY_MASTERS; i++)
+	{
+		const StandbyMaster *standby = &ptpClock->standby[i];
+
+		if (!standby->valid) continue;
+
+		uuid = (unsigned char*) standby->portIdentity.clockIdentity;
+		LOG_PRINT("\tstandby %02X%02X:%02X%02X:%02X%02X:%02X%02X offset %d nsec delay %d nsec drift %d ppb",
+					uuid[0], uuid[1], uuid[2], uuid[3], uuid[4], uuid[5], uuid[6], uuid[7],
+					(int)standby->offsetFromMaster.nanoseconds, (int)standby->meanPathDelay.nanoseconds,
+					(int)standby->drift);
+	}
+
+	if (ptpClock->orphanSyncs || ptpClock->orphanFollowUps || ptpClock->earlyFollowUps || ptpClock->lateSyncPairs)
+	{
+		LOG_PRINT("\tsync pairing: orphan syncs %u, orphan follow-ups %u, early follow-ups %u, late %u",
+					(unsigned)ptpClock->orphanSyncs, (unsigned)ptpClock->orphanFollowUps,
+					(unsigned)ptpClock->earlyFollowUps, (unsigned)ptpClock->lateSyncPairs);
+	}
+
+	if (ptpClock->lateDelayResps || ptpClock->expiredDelayReqs)
+	{
+		LOG_PRINT("\tdelay requests: late responses %u, expired %u",
+					(unsigned)ptpClock->lateDelayResps, (unsigned)ptpClock->expiredDelayReqs);
+	}
+
+	if (ptpClock->netPath.filter.acceptableCount)
+	{
+		LOG_PRINT("\tacceptable masters: %u", (unsigned)ptpClock->netPath.filter.acceptableCount);
+	}
+
+	LOG_PRINT("\trx drops: short %u, domain %u, not acceptable %u, rate %u, queue full %u",
+				(unsigned)dropped[RX_DROP_SHORT], (unsigned)dropped[RX_DROP_DOMAIN],
+				(unsigned)dropped[RX_DROP_NOT_ACCEPTABLE], (unsigned)dropped[RX_DROP_RATE],
+				(unsigned)dropped[RX_DROP_QUEUE_FULL]);
+
+	if (ptpClock->netPath.txTemplateBusy)
+	{
+		LOG_PRINT("\ttx drops: template busy %u", (unsigned)ptpClock->netPath.txTemplateBusy);
+	}
+
+	if (ptpClock->netPath.txErrors)
+	{
+		LOG_PRINT("\ttx errors: %u", (unsigned)ptpClock->netPath.txErrors);
+	}
+
+	if (ptpClock->standbySwitches)
+	{
+		LOG_PRINT("\tstandby switches: %u", (unsigned)ptpClock->standbySwitches);
+	}
+
+	if (ptpClock->holdover.active)
+	{
+		LOG_PRINT("\tholdover: %u sec, error %u nsec", (unsigned)ptpClock->holdover.info.seconds,
+					(unsigned)ptpClock->holdover.info.error);
+	}
+	else
+	{
+		LOG_PRINT("\tholdover: %s", ptpClock->holdover.valid ? "ready" : "learning");
+	}
 }
 
 // Notify the PTP thread of a pending operation.
@@ -169,3 +385,312 @@ void ptpd_stats(void)
 {
     ptpd_displayStats(&ptpClock);
 }
+
+// Post a new local time source quality, applied by the PTP thread.
+void ptpd_set_time_source(const TimeSource *ts)
+{
+	taskENTER_CRITICAL();
+	pendingTimeSource = *ts;
+	timeSourcePending = TRUE;
+	taskEXIT_CRITICAL();
+
+	// Picked up on thread start if the daemon is not running yet.
+	if (sys_mbox_valid(&ptp_alert_queue)) ptpd_alert();
+}
+
+uint8_t ptpd_port_state(void)
+{
+	return ptpClock.portDS.portState;
+}
+
+void ptpd_get_sync_info(SyncInfo *info)
+{
+	taskENTER_CRITICAL();
+	info->portState = ptpClock.portDS.portState;
+	info->stepsRemoved = ptpClock.currentDS.stepsRemoved;
+	info->grandmasterClockQuality = ptpClock.parentDS.grandmasterClockQuality;
+	info->offsetFromMaster = ptpClock.currentDS.offsetFromMaster;
+	info->meanPathDelay = ptpClock.currentDS.meanPathDelay;
+	info->currentUtcOffset = ptpClock.timePropertiesDS.currentUtcOffset;
+	info->currentUtcOffsetValid = ptpClock.timePropertiesDS.currentUtcOffsetValid;
+	info->ptpTimescale = ptpClock.timePropertiesDS.ptpTimescale;
+	info->timeSource = ptpClock.timePropertiesDS.timeSource;
+	taskEXIT_CRITICAL();
+}
+
+void ptpd_get_counters(PtpCounters *counters)
+{
+	const TimeInternal *offset = &ptpClock.currentDS.offsetFromMaster;
+
+	taskENTER_CRITICAL();
+	counters->portState = ptpClock.portDS.portState;
+	counters->stateChanges = ptpClock.stateChanges;
+	counters->syncSequenceGaps = ptpClock.syncSequenceGaps;
+	counters->orphanSyncs = ptpClock.orphanSyncs;
+	counters->orphanFollowUps = ptpClock.orphanFollowUps;
+	counters->lateDelayResps = ptpClock.lateDelayResps;
+	counters->expiredDelayReqs = ptpClock.expiredDelayReqs;
+	counters->servoUpdates = ptpClock.servoUpdates;
+	counters->clockSteps = ptpClock.clockSteps;
+	counters->standbySwitches = ptpClock.standbySwitches;
+	memcpy(counters->rxDropped, ptpClock.netPath.filter.dropped, sizeof(counters->rxDropped));
+	counters->txBusy = ptpClock.netPath.txTemplateBusy;
+	counters->offsetFromMaster = offset->seconds > 1 ? INT32_MAX : offset->seconds < -1 ? INT32_MIN :
+		offset->seconds * 1000000000 + offset->nanoseconds;
+	counters->meanPathDelay = ptpClock.currentDS.meanPathDelay.nanoseconds;
+	counters->observedDrift = ptpClock.observedDrift;
+	taskEXIT_CRITICAL();
+}
+
+void ptpd_get_datasets(PtpDataSets *ds)
+{
+	taskENTER_CRITICAL();
+	ds->defaultDS = ptpClock.defaultDS;
+	ds->currentDS = ptpClock.currentDS;
+	ds->parentDS = ptpClock.parentDS;
+	ds->timePropertiesDS = ptpClock.timePropertiesDS;
+	ds->portDS = ptpClock.portDS;
+	taskEXIT_CRITICAL();
+}
+
+void ptpd_set_holdover_callback(void (*cb)(const HoldoverInfo *info))
+{
+	holdoverCallback = cb;
+}
+
+bool ptpd_add_sample_callback(void (*cb)(const ServoSample *sample))
+{
+	bool added = FALSE;
+	int i;
+
+	taskENTER_CRITICAL();
+	for (i = 0; i < DEFAULT_SAMPLE_CALLBACKS && !added; i++)
+	{
+		added = sampleCallbacks[i] == cb;
+	}
+	for (i = 0; i < DEFAULT_SAMPLE_CALLBACKS && !added; i++)
+	{
+		if (sampleCallbacks[i] == NULL)
+		{
+			sampleCallbacks[i] = cb;
+			added = TRUE;
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	return added;
+}
+
+void ptpd_remove_sample_callback(void (*cb)(const ServoSample *sample))
+{
+	uint32_t reporting;
+	int i;
+
+	taskENTER_CRITICAL();
+	for (i = 0; i < DEFAULT_SAMPLE_CALLBACKS; i++)
+	{
+		if (sampleCallbacks[i] == cb) sampleCallbacks[i] = NULL;
+	}
+	reporting = sampleReporting;
+	taskEXIT_CRITICAL();
+
+	// A callback already running may be this one, wait for it to return.
+	if (osThreadGetId() == PTPTaskHandle) return;
+	while ((reporting & 1) && sampleReporting == reporting) sys_msleep(1);
+}
+
+// Another reference takes the PHC, stop steering it on the next loop.
+void ptpd_release_holdover(void)
+{
+	if (!ptpClock.holdover.active) return;
+
+	ptpClock.holdover.release = TRUE;
+	if (sys_mbox_valid(&ptp_alert_queue)) ptpd_alert();
+}
+
+void ptpd_set_audit(bool enable)
+{
+	auditRequest = enable;
+	auditPending = TRUE;
+
+	if (sys_mbox_valid(&ptp_alert_queue)) ptpd_alert();
+}
+
+void ptpd_audit_clear(void)
+{
+	auditClear();
+}
+
+const char *ptpd_audit_header(void)
+{
+	return "source                 dom   syncs  miss   ooo  int-err  offset-s offset-ns  drift  jitter  class acc  var   p1  p2  steps src  flags";
+}
+
+bool ptpd_audit_format(int16_t index, char *buf, size_t len)
+{
+	AuditRecord r;
+	const unsigned char *id;
+
+	if (!auditGet(index, &r)) return FALSE;
+
+	id = (const unsigned char*) r.portIdentity.clockIdentity;
+
+	snprintf(buf, len, "%02X%02X%02X%02X%02X%02X%02X%02X/%-4u %3u %7lu %5lu %5lu %8ld %9ld %9ld %6ld %7ld  %3u 0x%02X %04X %3u %3u %6d 0x%02X 0x%02X",
+		id[0], id[1], id[2], id[3], id[4], id[5], id[6], id[7], (unsigned)r.portIdentity.portNumber,
+		(unsigned)r.domainNumber, (unsigned long)r.syncs, (unsigned long)r.missing, (unsigned long)r.outOfOrder,
+		(long)r.intervalError, (long)r.offset.seconds, (long)r.offset.nanoseconds, (long)r.drift, (long)r.jitter,
+		(unsigned)r.grandmasterClockQuality.clockClass, (unsigned)r.grandmasterClockQuality.clockAccuracy,
+		(unsigned)r.grandmasterClockQuality.offsetScaledLogVariance, (unsigned)r.grandmasterPriority1,
+		(unsigned)r.grandmasterPriority2, (int)r.stepsRemoved, (unsigned)r.timeSource, (unsigned)r.flagField1);
+
+	return TRUE;
+}
+
+void ptpd_slaves_clear(void)
+{
+	slaveClearPending = TRUE;
+
+	if (sys_mbox_valid(&ptp_alert_queue)) ptpd_alert();
+}
+
+const char *ptpd_slaves_header(void)
+{
+	return "slave                   requests  miss   ooo   rate/s  delay-ns  offset-s offset-ns  jitter    age";
+}
+
+bool ptpd_slaves_format(int16_t rank, char *buf, size_t len)
+{
+	SlaveRecord r;
+	TimeInternal now;
+	const unsigned char *id;
+	uint32_t rate;
+
+	if (!slaveGet(rank, &r)) return FALSE;
+
+	getTime(&now);
+	id = (const unsigned char*) r.portIdentity.clockIdentity;
+
+	// Requests per second in thousandths.
+	rate = r.interval > 0 ? (uint32_t)(1000000000000LL / r.interval) : 0;
+
+	if (r.timestamped)
+	{
+		snprintf(buf, len, "%02X%02X%02X%02X%02X%02X%02X%02X/%-4u %9lu %5lu %5lu %4lu.%03lu %9ld %9ld %9ld %7ld %6ld",
+			id[0], id[1], id[2], id[3], id[4], id[5], id[6], id[7], (unsigned)r.portIdentity.portNumber,
+			(unsigned long)r.requests, (unsigned long)r.missing, (unsigned long)r.outOfOrder,
+			(unsigned long)(rate / 1000), (unsigned long)(rate % 1000), (long)r.pathDelay,
+			(long)r.offset.seconds, (long)r.offset.nanoseconds, (long)r.jitter, (long)(now.seconds - r.lastSeen));
+	}
+	else
+	{
+		snprintf(buf, len, "%02X%02X%02X%02X%02X%02X%02X%02X/%-4u %9lu %5lu %5lu %4lu.%03lu %9s %9s %9s %7s %6ld",
+			id[0], id[1], id[2], id[3], id[4], id[5], id[6], id[7], (unsigned)r.portIdentity.portNumber,
+			(unsigned long)r.requests, (unsigned long)r.missing, (unsigned long)r.outOfOrder,
+			(unsigned long)(rate / 1000), (unsigned long)(rate % 1000), "-", "-", "-", "-",
+			(long)(now.seconds - r.lastSeen));
+	}
+
+	return TRUE;
+}
+
+bool ptpd_accept_master(const uint8_t *clockIdentity)
+{
+	return netAcceptMaster(&ptpClock.netPath, (const octet_t*) clockIdentity);
+}
+
+void ptpd_accept_clear(void)
+{
+	netClearAcceptable(&ptpClock.netPath);
+}
+
+bool ptpd_management_get(const char *name)
+{
+	int32_t id = managementIdByName(name);
+
+	if (id < 0) return FALSE;
+
+	managementPendingId = (enum16bit_t)id;
+	managementPending = TRUE;
+
+	if (sys_mbox_valid(&ptp_alert_queue)) ptpd_alert();
+
+	return TRUE;
+}
+
+// Scaled nanoseconds of a management dataField, whole ns.
+static long ptpd_management_ns(const octet_t *buf)
+{
+	int64_t scaled = ((int64_t)flip32(*(int32_t*)(buf + 0)) << 32) | (uint32_t)flip32(*(int32_t*)(buf + 4));
+
+	return (long)(scaled >> 16);
+}
+
+bool ptpd_management_format(int16_t index, char *buf, size_t len)
+{
+	ManagementReply r;
+	const unsigned char *id;
+	const octet_t *d;
+	int n;
+
+	if (!managementGet(index, &r)) return FALSE;
+
+	id = (const unsigned char*) r.portIdentity.clockIdentity;
+	d = r.data;
+
+	n = snprintf(buf, len, "%02X%02X%02X%02X%02X%02X%02X%02X/%-4u %s ",
+		id[0], id[1], id[2], id[3], id[4], id[5], id[6], id[7], (unsigned)r.portIdentity.portNumber,
+		managementName(r.managementId));
+
+	if (n < 0 || (size_t)n >= len) return TRUE;
+	buf += n;
+	len -= n;
+
+	if (r.managementErrorId != 0)
+	{
+		snprintf(buf, len, "error 0x%04X", (unsigned)r.managementErrorId);
+		return TRUE;
+	}
+
+	switch (r.managementId)
+	{
+		case MM_DEFAULT_DATA_SET:
+			if (r.length < 20) break;
+			snprintf(buf, len, "priority1 %u class %u accuracy 0x%02X variance 0x%04X priority2 %u domain %u%s",
+				d[4], d[5], d[6], (unsigned)(uint16_t)flip16(*(int16_t*)(d + 7)), d[9], d[18],
+				(d[0] & 0x02) ? " slaveOnly" : "");
+			return TRUE;
+
+		case MM_CURRENT_DATA_SET:
+			if (r.length < 18) break;
+			snprintf(buf, len, "stepsRemoved %u offset %ld ns delay %ld ns",
+				(unsigned)(uint16_t)flip16(*(int16_t*)d), ptpd_management_ns(d + 2), ptpd_management_ns(d + 10));
+			return TRUE;
+
+		case MM_PARENT_DATA_SET:
+			if (r.length < 32) break;
+			snprintf(buf, len, "gm %02X%02X%02X%02X%02X%02X%02X%02X priority1 %u class %u accuracy 0x%02X priority2 %u",
+				d[24], d[25], d[26], d[27], d[28], d[29], d[30], d[31], d[18], d[19], d[20], d[23]);
+			return TRUE;
+
+		case MM_TIME_PROPERTIES_DATA_SET:
+			if (r.length < 4) break;
+			snprintf(buf, len, "utcOffset %d flags 0x%02X timeSource 0x%02X",
+				(int)(int16_t)flip16(*(int16_t*)d), d[2], d[3]);
+			return TRUE;
+
+		case MM_PORT_DATA_SET:
+			if (r.length < 26) break;
+			snprintf(buf, len, "state %u logSync %d logAnnounce %d timeout %u delayMechanism %u",
+				d[10], (int8_t)d[22], (int8_t)d[20], d[21], d[23]);
+			return TRUE;
+
+		default:
+			if (r.length < 1) break;
+			snprintf(buf, len, "%d", (int8_t)d[0]);
+			return TRUE;
+	}
+
+	snprintf(buf, len, "-");
+
+	return TRUE;
+}
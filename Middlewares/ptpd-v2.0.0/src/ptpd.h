@@ -157,6 +157,16 @@ bool  isSamePortIdentity(const PortIdentity*, const PortIdentity*);
  */
 void addForeign(PtpClock*, const MsgHeader*, const MsgAnnounce*);
 
+/**
+ * \brief Remove a foreign master record, no longer heard from
+ */
+void removeForeign(PtpClock*, const PortIdentity*);
+
+/**
+ * \brief Check if a port identity has a foreign master record
+ */
+bool isForeign(const PtpClock*, const PortIdentity*);
+
 
 /** \}*/
 
@@ -180,6 +190,95 @@ void doState(PtpClock*);
 void toState(PtpClock*, uint8_t);
 /** \}*/
 
+/** \name ptpd.c
+ * -Daemon thread and the interface to the application */
+/**\{*/
+/**
+ * \brief Report a servo update to the metrics and sample callbacks
+ */
+void reportServoUpdate(PtpClock*);
+/** \}*/
+
+/** \name audit.c
+ * -Passive audit of every master on the segment */
+/**\{*/
+/**
+ * \brief Record a message of any domain in the audit table
+ */
+void auditMessage(PtpClock*, const TimeInternal*);
+
+/**
+ * \brief Empty the audit table
+ */
+void auditClear(void);
+
+/**
+ * \brief Copy an audit table slot
+ * \return FALSE if the slot is unused or out of range
+ */
+bool auditGet(int16_t, AuditRecord*);
+/** \}*/
+
+/** \name slaves.c
+ * -Delay_Req statistics of the slaves served as master */
+/**\{*/
+/**
+ * \brief Record a Delay_Req in the slave table
+ */
+void slaveRequest(PtpClock*, const TimeInternal*);
+
+/**
+ * \brief Empty the slave table
+ */
+void slaveClear(void);
+
+/**
+ * \brief Copy a slave record, 0 being the most recently seen
+ * \return FALSE past the last record
+ */
+bool slaveGet(int16_t, SlaveRecord*);
+/** \}*/
+
+/** \name management.c
+ * -Management messages, answered from the data sets and sent to the domain */
+/**\{*/
+/**
+ * \brief Answer a management request or keep the reply to our last GET
+ */
+void handleManagementMessage(PtpClock*);
+
+/**
+ * \brief Send a GET of a management id to every clock of the domain
+ */
+void issueManagementGet(PtpClock*, enum16bit_t);
+
+/**
+ * \brief Management id of a name as printed by pmc, -1 if unknown
+ */
+int32_t managementIdByName(const char*);
+
+/**
+ * \brief Name of a management id
+ */
+const char *managementName(enum16bit_t);
+
+/**
+ * \brief Empty the reply table
+ */
+void managementClear(void);
+
+/**
+ * \brief Copy a reply to the last GET
+ * \return FALSE past the last reply
+ */
+bool managementGet(int16_t, ManagementReply*);
+
+/**
+ * \brief Replies lost to a full table
+ */
+uint32_t managementDropped(void);
+/** \}*/
+
 // Send an alert to the PTP daemon thread.
 void ptpd_alert(void);
 
@@ -188,4 +287,62 @@ osThreadId ptpd_init(void);
 
 void ptpd_stats(void);
 
+// Update the clock quality and time properties announced as grandmaster.
+void ptpd_set_time_source(const TimeSource *ts);
+
+// Current state of the PTP port.
+uint8_t ptpd_port_state(void);
+
+// Synchronisation state for services deriving time from the PHC.
+void ptpd_get_sync_info(SyncInfo *info);
+
+// Protocol and servo counters for the metrics exporters.
+void ptpd_get_counters(PtpCounters *counters);
+
+// Data sets as of one point in time, the PTP thread is not waited for.
+void ptpd_get_datasets(PtpDataSets *ds);
+
+// Holdover start, progress and end, called from the PTP thread.
+void ptpd_set_holdover_callback(void (*cb)(const HoldoverInfo *info));
+
+// Every servo update, called from the PTP thread which the callbacks must not block.
+// Returns FALSE if DEFAULT_SAMPLE_CALLBACKS are already registered.
+bool ptpd_add_sample_callback(void (*cb)(const ServoSample *sample));
+// The callback is not called once this returns, a call in progress on the
+// PTP thread is waited for. Must not be called from a callback.
+void ptpd_remove_sample_callback(void (*cb)(const ServoSample *sample));
+
+// Stop the holdover, another reference steers the clock.
+void ptpd_release_holdover(void);
+
+// Listen only audit of the masters of every domain, the PHC is never adjusted.
+void ptpd_set_audit(bool enable);
+void ptpd_audit_clear(void);
+
+// Column titles of the audit table.
+const char *ptpd_audit_header(void);
+
+// Format an audit table slot, 0 to DEFAULT_AUDIT_RECORDS - 1. Returns FALSE if unused.
+bool ptpd_audit_format(int16_t index, char *buf, size_t len);
+
+// Delay_Req statistics of the slaves served as master.
+void ptpd_slaves_clear(void);
+
+// Column titles of the slave table.
+const char *ptpd_slaves_header(void);
+
+// Format a slave record, 0 being the most recently seen. Returns FALSE past the last.
+bool ptpd_slaves_format(int16_t rank, char *buf, size_t len);
+
+// Acceptable master table, Announce, Sync and Follow_Up of other masters are dropped
+// on reception. Empty accepts any master. Returns FALSE if the table is full.
+bool ptpd_accept_master(const uint8_t *clockIdentity);
+void ptpd_accept_clear(void);
+
+// Send a management GET (pmc name, e.g. PARENT_DATA_SET) to the domain. Returns FALSE if unknown.
+bool ptpd_management_get(const char *name);
+
+// Format a reply to the last management GET, 0 being the first. Returns FALSE past the last.
+bool ptpd_management_format(int16_t index, char *buf, size_t len);
+
 #endif /* PTPD_H_*/
@@ -0,0 +1,257 @@
+/* slaves.c */
+
+#include "ptpd.h"
+
+/* Chained hash over a fixed pool, the least recently seen slave is evicted when full */
+static SlaveRecord slaveRecords[DEFAULT_SLAVE_RECORDS];
+static int8_t slaveBuckets[DEFAULT_SLAVE_BUCKETS];
+static int8_t slaveNewest, slaveOldest;
+static int16_t slaveCount;
+
+static uint32_t slaveHash(const PortIdentity *portIdentity)
+{
+	uint32_t h = 2166136261UL;
+	int i;
+
+	/* FNV-1a */
+	for (i = 0; i < CLOCK_IDENTITY_LENGTH; i++)
+	{
+		h = (h ^ portIdentity->clockIdentity[i]) * 16777619UL;
+	}
+
+	h = (h ^ (portIdentity->portNumber & 0xFF)) * 16777619UL;
+	h = (h ^ (portIdentity->portNumber >> 8)) * 16777619UL;
+
+	return h & (DEFAULT_SLAVE_BUCKETS - 1);
+}
+
+static void slaveUnlink(int8_t index)
+{
+	SlaveRecord *record = &slaveRecords[index];
+
+	if (record->newer >= 0)
+		slaveRecords[record->newer].older = record->older;
+	else
+		slaveNewest = record->older;
+
+	if (record->older >= 0)
+		slaveRecords[record->older].newer = record->newer;
+	else
+		slaveOldest = record->newer;
+}
+
+static void slaveLinkNewest(int8_t index)
+{
+	SlaveRecord *record = &slaveRecords[index];
+
+	record->newer = -1;
+	record->older = slaveNewest;
+
+	if (slaveNewest >= 0)
+		slaveRecords[slaveNewest].newer = index;
+	else
+		slaveOldest = index;
+
+	slaveNewest = index;
+}
+
+/* Remove the oldest record from its hash chain and hand its slot over */
+static int8_t slaveEvict(void)
+{
+	int8_t index = slaveOldest;
+	int8_t *link = &slaveBuckets[slaveHash(&slaveRecords[index].portIdentity)];
+
+	while (*link != index)
+		link = &slaveRecords[*link].next;
+
+	*link = slaveRecords[index].next;
+	slaveUnlink(index);
+
+	DBGV("slaveEvict: slot %d\n", index);
+
+	return index;
+}
+
+/* Find the record of a slave, creating it if new, and mark it most recently seen */
+static SlaveRecord *slaveLookup(const PortIdentity *portIdentity)
+{
+	SlaveRecord *record;
+	uint32_t bucket = slaveHash(portIdentity);
+	int8_t index;
+
+	for (index = slaveBuckets[bucket]; index >= 0; index = slaveRecords[index].next)
+	{
+		if (isSamePortIdentity(&slaveRecords[index].portIdentity, portIdentity))
+		{
+			if (index != slaveNewest)
+			{
+				slaveUnlink(index);
+				slaveLinkNewest(index);
+			}
+
+			return &slaveRecords[index];
+		}
+	}
+
+	index = slaveCount < DEFAULT_SLAVE_RECORDS ? slaveCount++ : slaveEvict();
+
+	record = &slaveRecords[index];
+	memset(record, 0, sizeof(SlaveRecord));
+	record->portIdentity = *portIdentity;
+	record->lastSequenceId = -1;
+	record->next = slaveBuckets[bucket];
+	slaveBuckets[bucket] = index;
+	slaveLinkNewest(index);
+
+	return record;
+}
+
+/* Sequence gaps and request rate, FALSE for a repeated or late request */
+static bool slaveSequence(SlaveRecord *record, const MsgHeader *header, const TimeInternal *time)
+{
+	TimeInternal interval;
+	int64_t ns;
+	int16_t gap;
+
+	record->requests++;
+
+	if (record->requests == 1)
+	{
+		record->lastSequenceId = header->sequenceId;
+		record->lastRequest = *time;
+		return TRUE;
+	}
+
+	gap = (int16_t)(header->sequenceId - record->lastSequenceId);
+
+	if (gap <= 0)
+	{
+		record->outOfOrder++;
+		return FALSE;
+	}
+
+	record->missing += gap - 1;
+	record->lastSequenceId = header->sequenceId;
+
+	subTime(&interval, time, &record->lastRequest);
+	record->lastRequest = *time;
+
+	/* Spacing of the received requests, the actual load on the master */
+	ns = (int64_t)interval.seconds * 1000000000 + interval.nanoseconds;
+	if (ns > INT32_MAX)
+		ns = INT32_MAX;
+
+	if (record->interval == 0)
+		record->interval = (int32_t)ns;
+	else
+		record->interval += ((int32_t)ns - record->interval) / DEFAULT_SLAVE_AVERAGE;
+
+	return TRUE;
+}
+
+/* The slave sends originTimestamp on its own clock, so ingress minus origin is its
+ * path delay minus its offset. The floor over a window is taken as the path delay,
+ * the offset is the excursion from it. */
+static void slaveDelay(SlaveRecord *record, const TimeInternal *ingress, const TimeInternal *origin, const TimeInternal *correction)
+{
+	TimeInternal apparent, delay;
+	int32_t step;
+
+	subTime(&apparent, ingress, origin);
+	subTime(&apparent, &apparent, correction);
+
+	/* Not synchronised, report the raw offset and restart the delay estimate */
+	if (apparent.seconds != 0)
+	{
+		record->offset.seconds = -apparent.seconds;
+		record->offset.nanoseconds = -apparent.nanoseconds;
+		record->delaySamples = 0;
+		record->windowCount = 0;
+		record->jitter = 0;
+		return;
+	}
+
+	if (record->delaySamples++ > 0)
+	{
+		step = abs(apparent.nanoseconds - record->apparentDelay);
+		record->jitter += (step - record->jitter) / DEFAULT_SLAVE_AVERAGE;
+	}
+
+	record->apparentDelay = apparent.nanoseconds;
+
+	if (record->windowCount == 0 || apparent.nanoseconds < record->windowMin)
+		record->windowMin = apparent.nanoseconds;
+
+	/* The first window uses its running floor, later ones replace it when complete */
+	if (++record->windowCount >= DEFAULT_SLAVE_DELAY_WINDOW || record->delaySamples < DEFAULT_SLAVE_DELAY_WINDOW)
+		record->pathDelay = record->windowMin;
+
+	if (record->windowCount >= DEFAULT_SLAVE_DELAY_WINDOW)
+		record->windowCount = 0;
+
+	delay.seconds = 0;
+	delay.nanoseconds = record->pathDelay;
+	subTime(&record->offset, &delay, &apparent);
+}
+
+void slaveRequest(PtpClock *ptpClock, const TimeInternal *time)
+{
+	const MsgHeader *header = &ptpClock->msgTmpHeader;
+	SlaveRecord *record;
+	TimeInternal origin, correction;
+
+	record = slaveLookup(&header->sourcePortIdentity);
+
+	if (record->requests == 0)
+		record->firstSeen = time->seconds;
+	record->lastSeen = time->seconds;
+
+	if (!slaveSequence(record, header, time))
+		return;
+
+	msgUnpackDelayReq(ptpClock->msgIbuf, &ptpClock->msgTmp.req);
+
+	/* Some slaves leave originTimestamp zero */
+	record->timestamped = ptpClock->msgTmp.req.originTimestamp.secondsField.lsb != 0 ||
+		ptpClock->msgTmp.req.originTimestamp.nanosecondsField != 0;
+	if (!record->timestamped || time->seconds == 0)
+		return;
+
+	toInternalTime(&origin, &ptpClock->msgTmp.req.originTimestamp);
+	scaledNanosecondsToInternalTime(&header->correctionfield, &correction);
+	slaveDelay(record, time, &origin, &correction);
+}
+
+void slaveClear(void)
+{
+	int i;
+
+	taskENTER_CRITICAL();
+	memset(slaveRecords, 0, sizeof(slaveRecords));
+	for (i = 0; i < DEFAULT_SLAVE_BUCKETS; i++)
+	{
+		slaveBuckets[i] = -1;
+	}
+	slaveNewest = slaveOldest = -1;
+	slaveCount = 0;
+	taskEXIT_CRITICAL();
+}
+
+bool slaveGet(int16_t rank, SlaveRecord *record)
+{
+	int8_t index;
+
+	if (rank < 0 || rank >= DEFAULT_SLAVE_RECORDS)
+		return FALSE;
+
+	taskENTER_CRITICAL();
+	for (index = slaveNewest; index >= 0 && rank > 0; rank--)
+	{
+		index = slaveRecords[index].older;
+	}
+	if (index >= 0)
+		*record = slaveRecords[index];
+	taskEXIT_CRITICAL();
+
+	return index >= 0;
+}
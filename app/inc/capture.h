@@ -0,0 +1,58 @@
+#ifndef CAPTURE_H
+#define CAPTURE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "cmsis_os.h"
+
+/**
+ * Frames sent and received by the MAC, with their hardware timestamps, kept
+ * in a ring in the upper half of the SDRAM, the lower half holding the LCD
+ * frame buffer and the servo history. The oldest frames are overwritten. The ring is exported as
+ * pcapng with nanosecond timestamps on the PHC timescale, by HTTP
+ * (GET /capture.pcapng) or TFTP (read CAPTURE_FILE_NAME).
+ */
+
+#define CAPTURE_RING_ADDR       0xC0800000UL    /* MPU region in main.c */
+#define CAPTURE_RING_SIZE       0x00800000UL
+#define CAPTURE_SNAPLEN         1518            /* bytes kept of each frame */
+#define CAPTURE_FILE_NAME       "capture.pcapng"
+
+typedef struct capture_filter {
+    uint8_t all;            /* every frame, else PTP only (Ethertype 0x88F7, UDP 319 and 320) */
+    uint16_t ethertype;     /* 0 for any */
+    uint16_t port;          /* UDP or TCP source or destination, 0 for any */
+} capture_filter_t;
+
+typedef struct capture_export capture_export_t;
+
+// Public API
+
+void capture_init(void);
+void capture_start(void);
+void capture_stop(void);
+void capture_clear(void);
+void capture_set_filter(const capture_filter_t *filter);
+void capture_get_filter(capture_filter_t *filter);
+void capture_stats(void);
+
+/**
+ * @brief Stop the capture and start an export, one at a time.
+ * @return NULL if another export is in progress
+ */
+capture_export_t *capture_export_open(void);
+
+/**
+ * @brief Next bytes of the pcapng file, a short count marks the end.
+ */
+int capture_export_read(capture_export_t *exp, void *buf, int len);
+void capture_export_close(capture_export_t *exp);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CAPTURE_H
@@ -0,0 +1,136 @@
+#ifndef DASH_DRAW_H
+#define DASH_DRAW_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "fonts.h"
+
+/**
+ * Layout and drawing of the PTP dashboard into an ARGB8888 frame buffer.
+ * Nothing here touches the hardware or the RTOS, the frame buffer may as
+ * well be an array on a host.
+ *
+ * Each widget remembers what it last drew. Labels are redrawn when their
+ * text changes. Strip charts sweep like an oscilloscope: a new value draws
+ * one column at the cursor and clears the one ahead, a whole chart is only
+ * redrawn when its scale changes. dash_render() stops once a pixel budget
+ * is spent and continues on the next call.
+ */
+
+#define DASH_WIDTH              800
+#define DASH_HEIGHT             480
+#define DASH_CHART_WIDTH        540     /* columns, one per servo update */
+#define DASH_CHART_GAP          6       /* blank columns ahead of the cursor */
+#define DASH_LABEL_LEN          48
+#define DASH_ROWS               9       /* values listed left of the charts */
+
+#define DASH_COLOR_BACK         0xFF101418
+#define DASH_COLOR_PANEL        0xFF1C232B
+#define DASH_COLOR_GRID         0xFF34404C
+#define DASH_COLOR_TEXT         0xFFE0E6EC
+#define DASH_COLOR_DIM          0xFF8C98A4
+#define DASH_COLOR_OK           0xFF2EA043
+#define DASH_COLOR_WARN         0xFFD29922
+#define DASH_COLOR_BAD          0xFFDA3633
+#define DASH_COLOR_MASTER       0xFF1F6FEB
+#define DASH_COLOR_OFFSET       0xFF58A6FF
+#define DASH_COLOR_DELAY        0xFFA371F7
+#define DASH_COLOR_DRIFT        0xFF3FB950
+
+enum {
+    DASH_HEALTH_IDLE = 0,       /* not synchronised, listening */
+    DASH_HEALTH_OK,             /* slave within the offset limit */
+    DASH_HEALTH_WARN,           /* slave settling or past the limit */
+    DASH_HEALTH_BAD,            /* faulty or disabled */
+    DASH_HEALTH_MASTER
+};
+
+typedef struct dash_fb {
+    uint32_t *pixels;
+    uint16_t width;
+    uint16_t height;
+    uint16_t stride;            /* pixels per line */
+} dash_fb_t;
+
+/* Everything shown, taken at once by the caller */
+typedef struct dash_state {
+    const char *port_state;
+    uint8_t health;
+    int32_t offset;             /* ns */
+    int32_t delay;              /* ns */
+    int32_t drift;              /* ppb */
+    uint32_t updates;           /* servo updates, a change adds a chart column */
+    uint32_t steps;
+    uint32_t state_changes;
+    uint32_t gaps;
+    uint8_t grandmaster[8];
+    uint8_t gm_class;
+    int16_t steps_removed;
+    int16_t utc_offset;
+    uint8_t utc_valid;
+    uint8_t domain;
+} dash_state_t;
+
+typedef struct dash_label {
+    uint16_t x, y, w;
+    const sFONT *font;
+    uint32_t fg, bg;
+    uint8_t dirty;
+    char text[DASH_LABEL_LEN];
+} dash_label_t;
+
+typedef struct dash_chart {
+    uint16_t x, y, w, h;
+    uint32_t color;
+    uint8_t symmetric;          /* scale centred on zero */
+    int32_t lo, hi;             /* scale, values outside are clipped */
+    int32_t values[DASH_CHART_WIDTH];
+    uint32_t count;             /* values added */
+    uint32_t drawn;             /* values drawn */
+    uint16_t redraw;            /* next column of a whole redraw, w when none */
+    uint16_t small;             /* consecutive values within a quarter of the scale */
+    const char *name;
+    const char *unit;
+    dash_label_t title;
+} dash_chart_t;
+
+typedef struct dash {
+    dash_fb_t fb;
+    uint32_t updates;           /* of the last state */
+    uint16_t clear_row;         /* next row of the background */
+    dash_label_t state;
+    dash_label_t master;
+    dash_label_t names[DASH_ROWS];
+    dash_label_t values[DASH_ROWS];
+    dash_chart_t charts[3];     /* offset, delay, drift */
+} dash_t;
+
+// Public API
+
+void dash_init(dash_t *d, const dash_fb_t *fb);
+
+/**
+ * @brief Take a new state: labels that changed are marked, a new servo
+ * update adds a value to each chart.
+ */
+void dash_update(dash_t *d, const dash_state_t *s);
+
+/**
+ * @brief Draw what changed, up to about budget pixels.
+ * @return pixels drawn, 0 when the screen is up to date
+ */
+uint32_t dash_render(dash_t *d, uint32_t budget);
+
+/**
+ * @brief Force everything to be drawn again.
+ */
+void dash_invalidate(dash_t *d);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DASH_DRAW_H
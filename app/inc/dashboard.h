@@ -0,0 +1,37 @@
+#ifndef DASHBOARD_H
+#define DASHBOARD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/**
+ * Live PTP view on the LCD: port state, grandmaster, offset, delay and
+ * frequency as values and strip charts, drawn by dash_draw.c.
+ *
+ * The dashboard has its own frame buffer on LTDC layer 0, under the log on
+ * layer 1. Showing it hides the log layer, the log keeps being written and
+ * is back as it was when the dashboard is hidden. A low priority thread
+ * takes a snapshot of the PTP data sets and counters every frame and draws
+ * only what changed, at most DASHBOARD_FRAME_PIXELS per frame, so a full
+ * redraw is spread over a few frames instead of taking the CPU at once.
+ */
+
+#define DASHBOARD_FB_ADDR       0xC0200000UL    /* after the log layer, 800x480x4 bytes */
+#define DASHBOARD_FRAME_MS      100
+#define DASHBOARD_FRAME_PIXELS  96000           /* about a quarter of the screen */
+#define DASHBOARD_OFFSET_LIMIT  1000            /* ns, slave shown healthy within */
+
+// Public API
+
+void dashboard_init(void);
+void dashboard_show(uint8_t on);
+void dashboard_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DASHBOARD_H
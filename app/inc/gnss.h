@@ -0,0 +1,35 @@
+#ifndef GNSS_H
+#define GNSS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "cmsis_os.h"
+
+/* NMEA receiver on USART6: PC6 TX, PC7 RX (Arduino D1/D0) */
+#define GNSS_UART               USART6
+#define GNSS_UART_IRQ           USART6_IRQn
+#define GNSS_UART_BAUDRATE      9600
+
+/* Holdover duration still announced as within specification (clockClass 7) */
+#define GNSS_HOLDOVER_SPEC      3600
+
+// Public API
+
+/**
+ * @brief Start disciplining the PHC to the GNSS PPS and NMEA time of day.
+ *
+ * Reported to the source manager as clockClass 6 when locked, 7 in holdover
+ * within GNSS_HOLDOVER_SPEC and 52 beyond it. Disciplining is suspended
+ * while another source owns the PHC.
+ */
+osStatus gnss_start(void);
+void gnss_stop(void);
+void gnss_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GNSS_H
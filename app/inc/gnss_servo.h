@@ -0,0 +1,75 @@
+#ifndef GNSS_SERVO_H
+#define GNSS_SERVO_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/**
+ * PI servo disciplining the PHC to a 1 Hz reference.
+ * One sample per second, offsets in ns (positive: PHC ahead of the reference),
+ * frequency corrections in ppb (positive: PHC runs faster).
+ * No hardware dependencies, the caller applies the returned correction.
+ */
+
+enum {
+    GNSS_SERVO_UNLOCKED = 0,
+    GNSS_SERVO_LOCKING,
+    GNSS_SERVO_LOCKED,
+    GNSS_SERVO_HOLDOVER
+};
+
+enum {
+    GNSS_SERVO_ADJUST = 0,  /* apply freq */
+    GNSS_SERVO_STEP         /* step the PHC by -offset, then apply freq */
+};
+
+typedef struct gnss_servo {
+    /* Configuration */
+    float kp;
+    float ki;
+    int32_t step_threshold;     /* ns, larger offsets are stepped */
+    int32_t lock_threshold;     /* ns, offsets below count as locked */
+    uint16_t lock_samples;      /* consecutive good samples to declare lock */
+    uint16_t missed_max;        /* missing samples before leaving lock */
+    uint32_t holdover_timeout;  /* s, holdover duration before unlocked */
+    int32_t freq_max;           /* ppb */
+
+    /* State */
+    uint8_t state;
+    float integral;             /* ppb, frequency estimate */
+    int32_t freq;               /* ppb, last correction */
+    int32_t offset;             /* ns, last sample */
+    uint16_t good;
+    uint16_t missed;
+    uint32_t holdover;          /* s spent in holdover */
+} gnss_servo_t;
+
+// Public API
+
+/**
+ * @brief Reset state and load default configuration.
+ */
+void gnss_servo_init(gnss_servo_t *servo);
+
+/**
+ * @brief Process one PPS offset.
+ *
+ * @return GNSS_SERVO_STEP if the offset must be stepped out, GNSS_SERVO_ADJUST otherwise.
+ */
+int gnss_servo_sample(gnss_servo_t *servo, int32_t offset);
+
+/**
+ * @brief Advance one second without a PPS sample.
+ */
+void gnss_servo_tick(gnss_servo_t *servo);
+
+const char *gnss_servo_state_name(uint8_t state);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GNSS_SERVO_H
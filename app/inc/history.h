@@ -0,0 +1,107 @@
+#ifndef HISTORY_H
+#define HISTORY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "ptpd.h"
+
+/**
+ * Servo updates kept in SDRAM for days. Blocks of HISTORY_BLOCK bytes start
+ * with one update stored whole, the following ones are encoded as varints of
+ * the zigzag differences to the previous update: time as the change of the
+ * interval (delta of delta), offset, delay and drift as plain deltas, the
+ * port state only when it changes. A steady slave takes about 6 bytes per
+ * update. The oldest block is overwritten when the area is full.
+ *
+ * Only the PTP thread writes. Readers copy a block and drop it if it was
+ * reopened meanwhile, the writer is never waited for.
+ */
+
+#define HISTORY_ADDR        0xC0400000UL    /* MPU region in main.c */
+#define HISTORY_SIZE        0x00400000UL
+#define HISTORY_BLOCK       4096
+#define HISTORY_BLOCKS      (HISTORY_SIZE / HISTORY_BLOCK)
+
+/* Block header, little endian as decoded by tools/history_decode.py */
+typedef struct history_block {
+    uint32_t seq;               /* 1 for the first block, 0 while opened or unused */
+    uint32_t fill;              /* updates << 16 | encoded bytes */
+    uint32_t first_sec;         /* first update, whole */
+    uint32_t first_nsec;
+    int32_t offset;
+    int32_t delay;
+    int32_t drift;
+    uint8_t state;
+    uint8_t reserved[3];
+    uint32_t last_sec;          /* last update */
+} history_block_t;
+
+#define HISTORY_DATA        (HISTORY_BLOCK - sizeof(history_block_t))
+
+typedef struct history_bucket {
+    uint32_t sec;               /* start of the bucket */
+    uint32_t count;
+    int32_t offset_min;
+    int32_t offset_mean;
+    int32_t offset_max;
+    int32_t delay_mean;
+    int32_t drift;              /* last */
+    uint8_t state;              /* last */
+} history_bucket_t;
+
+/* Reader state, one block copy */
+typedef struct history_query {
+    uint32_t from;
+    uint32_t to;
+    uint32_t newest;            /* seq of the block written when opened */
+    uint16_t index;             /* next block to visit */
+    uint16_t visited;
+    const uint8_t *pos;         /* next encoded update of the copy */
+    uint16_t remaining;         /* updates left in the copy */
+    ServoSample last;
+    int64_t interval;
+    uint8_t pending;            /* last holds an update not returned yet */
+    uint8_t held;               /* next holds the update after a bucket */
+    ServoSample next;
+    union {
+        history_block_t header;
+        uint8_t raw[HISTORY_BLOCK];
+    } copy;
+} history_query_t;
+
+// Public API
+
+void history_init(void);
+void history_clear(void);
+void history_stats(void);
+
+/**
+ * @brief Start reading the updates from and to a PHC second, inclusive.
+ */
+void history_query_open(history_query_t *q, uint32_t from, uint32_t to);
+
+/**
+ * @brief Next update in time order. Returns 0 past the last.
+ */
+uint8_t history_query_next(history_query_t *q, ServoSample *sample);
+
+/**
+ * @brief Next downsampled view of step seconds, empty buckets are skipped.
+ * Returns 0 past the last.
+ */
+uint8_t history_query_bucket(history_query_t *q, uint32_t step, history_bucket_t *bucket);
+
+/**
+ * @brief Next whole block overlapping the range, for the raw export.
+ * Returns NULL past the last.
+ */
+const uint8_t *history_query_block(history_query_t *q);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HISTORY_H
@@ -0,0 +1,59 @@
+#ifndef HTTP_API_H
+#define HTTP_API_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "ptpd.h"
+
+/**
+ * Machine readable views for the HTTP server: the PTP data sets and the
+ * metrics as one JSON document (GET /api/status), and the servo updates as
+ * server-sent events (GET /api/events), one event per update:
+ *
+ *   id: <sequence>
+ *   event: sample
+ *   data: {"t":<s>.<ns>,"offset":<ns>,"delay":<ns>,"drift":<ppb>,"state":<n>}
+ *
+ * The PTP thread adds updates to a ring that every stream reads at its own
+ * pace; a stream falling more than HTTP_API_SAMPLES behind skips the oldest,
+ * the gap shows in the event ids. Documents are formatted into buffers of
+ * the caller, nothing is allocated.
+ */
+
+#define HTTP_API_SAMPLES        32      /* servo updates kept for the streams, power of 2 */
+#define HTTP_API_STATUS_SIZE    2560    /* bytes of the status document */
+#define HTTP_API_EVENT_SIZE     192
+
+// Public API
+
+void http_api_init(void);
+
+/**
+ * @brief Sequence of the next servo update to come.
+ */
+uint32_t http_api_head(void);
+
+/**
+ * @brief Copy a servo update. Returns 0 if it was overwritten, or is not
+ * there yet.
+ */
+uint8_t http_api_sample(uint32_t seq, ServoSample *sample);
+
+/**
+ * @brief Format the status response. Returns its length.
+ */
+int http_api_status(char *buf, int size);
+
+/**
+ * @brief Format one servo update event. Returns its length.
+ */
+int http_api_event(uint32_t seq, const ServoSample *sample, char *buf, int size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HTTP_API_H
@@ -53,7 +53,6 @@
 /* Exported macro ------------------------------------------------------------*/
 /* Exported functions ------------------------------------------------------- */
 void http_server_socket_init(void);
-void DynWebPage(int conn);
 
 #endif /* __HTTPSERVER_SOCKET_H__ */
 
@@ -68,8 +68,9 @@ a lot of data that needs to be copied, this should be set high. */
    should be set high. */
 #define MEMP_NUM_PBUF           10
 /* MEMP_NUM_UDP_PCB: the number of UDP protocol control blocks. One
-   per active UDP "connection". */
-#define MEMP_NUM_UDP_PCB        6
+   per active UDP "connection": PTP event and general, DHCP client and
+   server, NTP client and server, SNMP, TFTP. */
+#define MEMP_NUM_UDP_PCB        8
 /* MEMP_NUM_TCP_PCB: the number of simulatenously active TCP
    connections. */
 #define MEMP_NUM_TCP_PCB        10
@@ -134,7 +135,20 @@ a lot of data that needs to be copied, this should be set high. */
 
 
 /* ---------- Statistics options ---------- */
-#define LWIP_STATS 0
+#define LWIP_STATS 1
+#define LWIP_STATS_LARGE 1
+#define LWIP_STATS_DISPLAY 0
+
+/* ---------- SNMP options ---------- */
+#ifdef ENABLE_SNMP
+#define LWIP_SNMP               1
+#define MIB2_STATS              1
+#define SNMP_LWIP_MIB2_SYSDESC  "disco-ptp IEEE 1588 clock"
+#endif
+
+/* ---------- MQTT options ---------- */
+/* A telemetry message must fit the output buffer whole */
+#define MQTT_OUTPUT_RINGBUF_SIZE 2048
 
 /* ---------- link callback options ---------- */
 /* LWIP_NETIF_LINK_CALLBACK==1: Support a callback function from an interface
@@ -209,6 +223,14 @@ The STM32F7xx allows computing and verifying the IP, UDP, TCP and ICMP checksums
  */
 #define LWIP_SOCKET                     1
 
+/* MEMP_NUM_NETCONN: one per socket, the HTTP server listens and serves
+   HTTP_MAX_CLIENTS connections, one more is accepted to be refused. */
+#define MEMP_NUM_NETCONN                6
+
+/* LWIP_SO_SNDTIMEO==1: bounds how long an HTTP response waits on a
+   slow client. */
+#define LWIP_SO_SNDTIMEO                1
+
 /*
    ------------------------------------
    ---------- httpd options ----------
@@ -234,12 +256,6 @@ The STM32F7xx allows computing and verifying the IP, UDP, TCP and ICMP checksums
 #define DEFAULT_THREAD_STACKSIZE        500
 #define TCPIP_THREAD_PRIO               osPriorityHigh
 
-#define SNTP_ENABLED                    1
-
-extern void app_ethernet_set_system_time (uint32_t sec);
-
-#define SNTP_SET_SYSTEM_TIME(time) app_ethernet_set_system_time(time)
-
 #endif /* __LWIPOPTS_H__ */
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,115 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * Statically allocated counters, gauges and histograms shared by the
+ * exporters. Writers use single atomic operations and never block, so they
+ * may run in any thread or interrupt. Counters kept by other modules (ptpd,
+ * lwIP, the MAC, the RTOS) are read just before a snapshot is taken, each
+ * module as consistently as it offers them. The registry itself is copied in
+ * one short critical section.
+ */
+
+enum {
+    /* ptpd */
+    METRIC_PTP_PORT_STATE = 0,
+    METRIC_PTP_STATE_CHANGES,
+    METRIC_PTP_SYNC_GAPS,
+    METRIC_PTP_MISSED_FOLLOW_UPS,
+    METRIC_PTP_ORPHAN_FOLLOW_UPS,
+    METRIC_PTP_LATE_DELAY_RESPS,
+    METRIC_PTP_EXPIRED_DELAY_REQS,
+    METRIC_PTP_SERVO_UPDATES,
+    METRIC_PTP_CLOCK_STEPS,
+    METRIC_PTP_STANDBY_SWITCHES,
+    METRIC_PTP_RX_DROP_SHORT,
+    METRIC_PTP_RX_DROP_DOMAIN,
+    METRIC_PTP_RX_DROP_NOT_ACCEPTABLE,
+    METRIC_PTP_RX_DROP_RATE,
+    METRIC_PTP_RX_DROP_QUEUE_FULL,
+    METRIC_PTP_TX_BUSY,
+    METRIC_PTP_OFFSET,
+    METRIC_PTP_PATH_DELAY,
+    METRIC_PTP_DRIFT,
+    /* lwIP */
+    METRIC_LINK_RX,
+    METRIC_LINK_TX,
+    METRIC_LINK_DROP,
+    METRIC_IP_DROP,
+    METRIC_UDP_RX,
+    METRIC_UDP_DROP,
+    METRIC_MEM_ERRORS,
+    /* Ethernet MAC */
+    METRIC_ETH_RX_UNICAST,
+    METRIC_ETH_RX_CRC_ERRORS,
+    METRIC_ETH_RX_ALIGN_ERRORS,
+    METRIC_ETH_TX_GOOD,
+    METRIC_ETH_TX_COLLISIONS,
+    /* RTOS */
+    METRIC_CPU_USAGE,
+    METRIC_HEAP_FREE,
+    METRIC_HEAP_MIN_FREE,
+    METRIC_TASKS,
+    /* application */
+    METRIC_HTTP_REQUESTS,
+    METRIC_HTTP_TIMEOUTS,
+    METRIC_COUNT
+};
+
+enum {
+    METRIC_HIST_PTP_OFFSET = 0, /* |offsetFromMaster| per servo update, ns */
+    METRIC_HIST_COUNT
+};
+
+#define METRIC_HIST_BUCKETS     8   /* last bucket has no upper bound */
+
+enum {
+    METRIC_COUNTER = 0,
+    METRIC_GAUGE
+};
+
+typedef struct metrics_snapshot {
+    uint32_t time;                  /* ms, sys_now() */
+    uint32_t value[METRIC_COUNT];   /* gauges are int32_t */
+    uint32_t hist[METRIC_HIST_COUNT][METRIC_HIST_BUCKETS];
+    uint32_t hist_sum[METRIC_HIST_COUNT];
+} metrics_snapshot_t;
+
+// Public API
+
+void metrics_inc(uint16_t id);
+void metrics_add(uint16_t id, uint32_t n);
+void metrics_set(uint16_t id, int32_t value);
+void metrics_observe(uint16_t hist, uint32_t value);
+
+/**
+ * @brief Read the counters of the other modules and copy every metric.
+ */
+void metrics_snapshot(metrics_snapshot_t *snap);
+
+const char *metrics_name(uint16_t id);
+uint8_t metrics_type(uint16_t id);
+
+/**
+ * @brief Format a line of a snapshot in the Prometheus text format.
+ *
+ * Lines are numbered from 0, metrics first then the histogram buckets,
+ * sum and count.
+ * Returns 0 past the last line.
+ */
+uint8_t metrics_format(const metrics_snapshot_t *snap, uint16_t line, char *buf, size_t len);
+
+void metrics_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // METRICS_H
@@ -0,0 +1,48 @@
+#ifndef MQTT_TELEMETRY_H
+#define MQTT_TELEMETRY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "cmsis_os.h"
+#include "lwip/ip_addr.h"
+
+#define MQTT_TELEMETRY_PORT         1883
+#define MQTT_TELEMETRY_TOPIC        "ptp/telemetry"
+#define MQTT_TELEMETRY_TOPIC_LEN    64
+#define MQTT_TELEMETRY_CLIENT_ID    "disco-ptp"
+#define MQTT_TELEMETRY_KEEP_ALIVE   60      /* s */
+#define MQTT_TELEMETRY_PERIOD       1000    /* ms between publications */
+#define MQTT_TELEMETRY_SAMPLES      64      /* queued servo updates, power of 2 */
+#define MQTT_TELEMETRY_BATCH        32      /* servo updates per message at most */
+#define MQTT_TELEMETRY_PAYLOAD      1024
+#define MQTT_TELEMETRY_BACKOFF_MAX  64000   /* ms, longest wait after a failure */
+
+// Public API
+
+/**
+ * @brief Publish PTP state and statistics to a broker.
+ *
+ * Every period one message carries the port state, the current offset,
+ * delay and drift, the protocol counters and the servo updates queued since
+ * the last message with their offset statistics. The PTP thread only adds
+ * updates to a queue, full queues drop them. The client runs in the lwIP
+ * thread; connections and messages refused by a slow or absent broker are
+ * retried with a doubling wait, the updates being kept meanwhile.
+ */
+osStatus mqtt_telemetry_start(const ip_addr_t *broker, uint16_t port);
+void mqtt_telemetry_stop(void);
+
+/**
+ * @brief Change the topic, only while stopped.
+ */
+osStatus mqtt_telemetry_set_topic(const char *topic);
+void mqtt_telemetry_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MQTT_TELEMETRY_H
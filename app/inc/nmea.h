@@ -0,0 +1,49 @@
+#ifndef NMEA_H
+#define NMEA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#define NMEA_MAX_SENTENCE   83  /* including '$' and <CR><LF> */
+
+typedef struct nmea_time {
+    uint32_t utc;       /* seconds since 1970, UTC */
+    uint8_t valid;      /* receiver reports a valid fix */
+} nmea_time_t;
+
+typedef struct nmea_parser {
+    char line[NMEA_MAX_SENTENCE + 1];
+    uint8_t len;
+    uint32_t errors;    /* bad checksums and overlong sentences */
+} nmea_parser_t;
+
+// Public API
+
+/**
+ * @brief Feed one received character.
+ *
+ * @return 1 when a RMC or ZDA sentence carrying a time of day was completed
+ *         and written to time, 0 otherwise.
+ */
+int nmea_feed(nmea_parser_t *parser, char c, nmea_time_t *time);
+
+/**
+ * @brief Parse a complete sentence starting with '$', checksum optional.
+ *
+ * @return 1 if time was extracted, 0 for other sentences, -1 on error.
+ */
+int nmea_parse(const char *sentence, nmea_time_t *time);
+
+/**
+ * @brief Convert a broken down UTC date to seconds since 1970.
+ */
+uint32_t nmea_mktime(int year, int mon, int day, int hour, int min, int sec);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NMEA_H
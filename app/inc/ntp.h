@@ -0,0 +1,89 @@
+#ifndef NTP_H
+#define NTP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "lwip/def.h"
+
+#define NTP_PORT            123
+#define NTP_PACKET_SIZE     48
+#define NTP_UNIX_OFFSET     2208988800UL    /* 1900 to 1970 */
+
+/* Standard NTP header, fields in network byte order */
+typedef struct ntp_packet {
+    uint8_t li_vn_mode;
+    uint8_t stratum;
+    int8_t poll;
+    int8_t precision;
+    uint32_t root_delay;        /* 16.16 s */
+    uint32_t root_dispersion;   /* 16.16 s */
+    uint32_t ref_id;
+    uint32_t ref_ts[2];
+    uint32_t orig_ts[2];
+    uint32_t rx_ts[2];
+    uint32_t tx_ts[2];
+} ntp_packet_t;
+
+#define NTP_LI(x)           ((x) >> 6)
+#define NTP_VN(x)           (((x) >> 3) & 7)
+#define NTP_MODE(x)         ((x) & 7)
+#define NTP_LI_VN_MODE(li, vn, mode) (((li) << 6) | ((vn) << 3) | (mode))
+
+#define NTP_VERSION         4
+#define NTP_MODE_CLIENT     3
+#define NTP_MODE_SERVER     4
+#define NTP_LI_ALARM        3
+#define NTP_STRATUM_UNSYNC  16
+
+/* 32.32 fixed point seconds since 1900 */
+typedef uint64_t ntp_ts_t;
+
+static inline ntp_ts_t ntp_ts_get(const uint32_t ts[2])
+{
+    return ((uint64_t)lwip_ntohl(ts[0]) << 32) | lwip_ntohl(ts[1]);
+}
+
+static inline void ntp_ts_set(uint32_t ts[2], ntp_ts_t t)
+{
+    ts[0] = lwip_htonl((uint32_t)(t >> 32));
+    ts[1] = lwip_htonl((uint32_t)t);
+}
+
+/**
+ * @brief Convert a PHC time to NTP, utc_offset is the PHC offset from UTC
+ */
+static inline ntp_ts_t ntp_ts_from_phc(int32_t sec, int32_t nsec, int32_t utc_offset)
+{
+    uint32_t s = (uint32_t)sec - utc_offset + NTP_UNIX_OFFSET;
+
+    return ((uint64_t)s << 32) | (uint32_t)(((uint64_t)nsec << 32) / 1000000000ULL);
+}
+
+/**
+ * @brief Difference a - b in ns, valid within 68 years
+ */
+static inline int64_t ntp_ts_diff(ntp_ts_t a, ntp_ts_t b)
+{
+    int64_t d = (int64_t)(a - b);
+
+    return (d >> 32) * 1000000000LL + (int64_t)(((d & 0xFFFFFFFFLL) * 1000000000LL) >> 32);
+}
+
+/**
+ * @brief Convert a 16.16 short format value to ns
+ */
+static inline uint32_t ntp_short_ns(uint32_t s)
+{
+    uint64_t ns = ((uint64_t)lwip_ntohl(s) * 1000000000ULL) >> 16;
+
+    return ns > 0xFFFFFFFFULL ? 0xFFFFFFFFUL : (uint32_t)ns;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NTP_H
@@ -0,0 +1,46 @@
+#ifndef NTP_CLIENT_H
+#define NTP_CLIENT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "cmsis_os.h"
+#include "lwip/ip_addr.h"
+#include "ntp.h"
+#include "ntp_clock.h"
+
+#define NTP_CLIENT_MAX_SERVERS  NTP_CLOCK_MAX_PEERS
+#define NTP_CLIENT_POLL         16      /* s */
+#define NTP_CLIENT_TIMEOUT      1000    /* ms, reply wait per server */
+#define NTP_CLIENT_MAX_DELAY    500000000UL /* ns, round trips above are discarded */
+#define NTP_CLIENT_LOCK_UPDATES 4       /* discipline updates before reporting lock */
+#define NTP_CLIENT_LOCK_ERROR   10000000ULL /* ns, error bound to report lock */
+
+// Public API
+
+/**
+ * @brief Start polling the configured servers.
+ *
+ * Requests and replies are hardware timestamped. Each server keeps a clock
+ * filter over its last samples and the system peer is selected among them
+ * every poll. The PHC is disciplined in frequency only, the offset being
+ * slewed within a bounded rate; the clock is stepped once, when the first
+ * sync finds it far off. Disciplining is suspended while another source
+ * owns the PHC, the offset found when the clock is handed back is slewed
+ * out like any other.
+ */
+osStatus ntp_client_start(void);
+void ntp_client_stop(void);
+
+/**
+ * @brief Add a server, up to NTP_CLIENT_MAX_SERVERS.
+ */
+osStatus ntp_client_add_server(const ip_addr_t *addr);
+void ntp_client_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NTP_CLIENT_H
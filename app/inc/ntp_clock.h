@@ -0,0 +1,102 @@
+#ifndef NTP_CLOCK_H
+#define NTP_CLOCK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/**
+ * NTP clock filter, source selection and PHC discipline.
+ * Offsets in ns (positive: server ahead of the PHC), frequency corrections
+ * in ppb (positive: PHC runs faster).
+ * No hardware dependencies, the caller applies the returned correction.
+ */
+
+#define NTP_CLOCK_FILTER_SIZE   8
+#define NTP_CLOCK_MAX_PEERS     4
+
+enum {
+    NTP_CLOCK_ADJUST = 0,   /* apply freq */
+    NTP_CLOCK_STEP          /* initial time set, step the PHC by +offset */
+};
+
+typedef struct ntp_sample {
+    int64_t offset;         /* ns */
+    uint32_t delay;         /* ns, round trip */
+    uint32_t seq;
+} ntp_sample_t;
+
+typedef struct ntp_peer {
+    ntp_sample_t samples[NTP_CLOCK_FILTER_SIZE];
+    uint8_t count;
+    uint8_t next;
+    uint32_t seq;           /* samples taken */
+
+    /* Filter output, the lowest delay sample */
+    int64_t offset;
+    uint32_t delay;
+    uint32_t jitter;        /* ns, mean offset deviation from the best sample */
+    uint32_t root;          /* ns, server root delay / 2 + root dispersion */
+    uint32_t best_seq;
+} ntp_peer_t;
+
+typedef struct ntp_discipline {
+    /* Configuration */
+    float kp;
+    float ki;
+    int64_t step_threshold;     /* ns, larger offsets are stepped before first sync */
+    int32_t slew_max;           /* ppb, bound on the phase correction */
+    int32_t freq_max;           /* ppb, bound on the frequency estimate */
+
+    /* State */
+    float integral;             /* ppb, frequency estimate */
+    int32_t freq;               /* ppb, last correction */
+    int64_t offset;             /* ns, last offset */
+    uint32_t used_seq;          /* last peer sample consumed */
+    uint8_t synced;
+} ntp_discipline_t;
+
+// Public API
+
+void ntp_peer_reset(ntp_peer_t *peer);
+
+/**
+ * @brief Add an offset/delay sample and refilter.
+ */
+void ntp_peer_add(ntp_peer_t *peer, int64_t offset, uint32_t delay, uint32_t root);
+
+/**
+ * @brief Error bound of the filtered peer offset.
+ */
+uint32_t ntp_peer_distance(const ntp_peer_t *peer);
+
+/**
+ * @brief Select the system peer among the servers with samples.
+ *
+ * Servers whose offset is further from the median than both their
+ * distances allow are dropped as falsetickers (needs three servers to
+ * outvote one), the survivor with the lowest distance is returned.
+ *
+ * @return peer index, -1 if none
+ */
+int ntp_clock_select(const ntp_peer_t *peers, uint8_t n);
+
+void ntp_discipline_init(ntp_discipline_t *d);
+
+/**
+ * @brief Process the filtered offset of the system peer.
+ *
+ * Offsets are slewed by a frequency correction held for the next poll
+ * interval. Only the first sync may step the clock.
+ *
+ * @return NTP_CLOCK_STEP if the offset must be stepped in, NTP_CLOCK_ADJUST otherwise.
+ */
+int ntp_discipline_update(ntp_discipline_t *d, int64_t offset, uint32_t interval);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NTP_CLOCK_H
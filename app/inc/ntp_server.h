@@ -0,0 +1,32 @@
+#ifndef NTP_SERVER_H
+#define NTP_SERVER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "cmsis_os.h"
+#include "ntp.h"
+
+// Public API
+
+/**
+ * @brief Start the NTPv4 server on UDP 123.
+ *
+ * Requests are answered from the lwIP receive callback into a static reply
+ * buffer. The receive timestamp is the MAC hardware timestamp of the request.
+ *
+ * Clients using the interleaved mode (chrony xleave) get the hardware
+ * transmit timestamp of the previous reply. Others get the PHC read before
+ * sending, corrected by the average delay to the hardware transmit
+ * timestamp of previous replies. The last exchange of NTP_CLIENTS clients
+ * is remembered for this.
+ */
+osStatus ntp_server_init(void);
+void ntp_server_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NTP_SERVER_H
@@ -0,0 +1,34 @@
+#ifndef PPS_MEAS_H
+#define PPS_MEAS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "cmsis_os.h"
+
+// Public API
+
+/**
+ * @brief Start measuring the device under test PPS against the PHC.
+ *
+ * Each edge is reported as the offset of the DUT pulse from the nearest
+ * PHC second (positive: DUT pulse after the PHC second), with timer clock
+ * resolution (10 ns).
+ */
+osStatus pps_meas_start(void);
+void pps_meas_stop(void);
+
+/**
+ * @brief Enable or disable printing of every per-second offset.
+ */
+void pps_meas_stream(uint8_t enable);
+
+void pps_meas_reset(void);
+void pps_meas_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // PPS_MEAS_H
@@ -0,0 +1,36 @@
+#ifndef PPS_STATS_H
+#define PPS_STATS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/**
+ * Running statistics of PPS offsets (Welford), no stored samples.
+ */
+typedef struct pps_stats {
+    uint32_t count;
+    int32_t last;
+    int32_t min;
+    int32_t max;
+    double mean;
+    double m2;
+} pps_stats_t;
+
+// Public API
+
+void pps_stats_reset(pps_stats_t *stats);
+void pps_stats_add(pps_stats_t *stats, int32_t offset);
+
+/**
+ * @brief Sample standard deviation in ns, 0 with less than two samples.
+ */
+uint32_t pps_stats_stddev(const pps_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // PPS_STATS_H
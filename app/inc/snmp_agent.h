@@ -0,0 +1,34 @@
+#ifndef SNMP_AGENT_H
+#define SNMP_AGENT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/**
+ * SNMPv2c agent on UDP 161 serving MIB-2 and a PTP subtree under
+ * SNMP_AGENT_PTP_OID: default, current, parent and port data sets, servo
+ * state and error counters. Requests are answered in the lwIP thread from
+ * a snapshot of ptpd and the metrics registry, the PTP thread is never
+ * waited for.
+ */
+
+/* Private enterprise subtree, replace 26381 (lwIP) by the owner's number */
+#define SNMP_AGENT_PTP_OID          { 1, 3, 6, 1, 4, 1, 26381, 319 }
+
+/* Snapshot age after which a request takes a new one, ms. A walk within
+ * this time reads values taken at the same instant */
+#define SNMP_AGENT_SNAPSHOT_MS      500
+
+// Public API
+
+void snmp_agent_init(void);
+void snmp_agent_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SNMP_AGENT_H
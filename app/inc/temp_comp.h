@@ -0,0 +1,49 @@
+#ifndef TEMP_COMP_H
+#define TEMP_COMP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "cmsis_os.h"
+#include "temp_model.h"
+
+#define TEMP_COMP_PERIOD        1000    /* ms, temperature reading and bias update */
+#define TEMP_COMP_AVERAGE       16      /* readings averaged into one model sample */
+#define TEMP_COMP_FILTER        8       /* readings, temperature smoothing */
+#define TEMP_COMP_MAX_BIAS      20000   /* ppb */
+
+// Public API
+
+/**
+ * @brief Start the temperature compensation.
+ *
+ * The die temperature is read every second and the frequency correction
+ * predicted by the model is applied through the PHC frequency bias, ahead
+ * of the servo that owns the clock. This keeps running in holdover. The
+ * model only learns while the PHC is locked to a reference, from the total
+ * correction, so the bias itself does not feed back into the fit.
+ */
+osStatus temp_comp_start(void);
+
+/**
+ * @brief Stop and remove the bias, the learned model is kept.
+ */
+void temp_comp_stop(void);
+
+/**
+ * @brief Forget the learned model.
+ */
+void temp_comp_reset(void);
+
+/**
+ * @brief Print every model sample as "tcomp,<s>,<mdegC>,<ppb>" for host side fitting.
+ */
+void temp_comp_trace(uint8_t enable);
+void temp_comp_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TEMP_COMP_H
@@ -0,0 +1,67 @@
+#ifndef TEMP_MODEL_H
+#define TEMP_MODEL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/**
+ * Oscillator temperature model, an exponentially weighted least squares
+ * line of the PHC frequency correction (ppb, positive: PHC runs faster)
+ * against die temperature (degC). Old samples are forgotten so the fit
+ * follows ageing. No hardware dependencies, so recorded traces can be
+ * replayed through the same code on a host.
+ */
+
+#define TEMP_MODEL_MEMORY       1024    /* samples, weight decays by 1/e after this */
+#define TEMP_MODEL_MIN_SAMPLES  64
+#define TEMP_MODEL_MIN_SPREAD   0.5f    /* degC, temperature deviation needed to fit a slope */
+#define TEMP_MODEL_SLOPE_MAX    1000.0f /* ppb/degC, larger fits are discarded */
+
+typedef struct temp_model {
+    /* Configuration */
+    float forget;               /* weight kept per sample */
+    float min_spread;
+    float slope_max;
+    uint32_t min_samples;
+
+    /* Weighted sums, x relative to ref, y relative to the first frequency */
+    float w;
+    float sx, sy;
+    float sxx, sxy;
+    float y0;
+    uint32_t samples;
+
+    /* Fit */
+    float ref;                  /* degC, first sample, feed-forward is zero here */
+    float slope;                /* ppb/degC */
+    float spread;               /* degC, weighted temperature deviation */
+    uint8_t valid;
+} temp_model_t;
+
+// Public API
+
+void temp_model_init(temp_model_t *m);
+
+/**
+ * @brief Add a temperature, frequency correction pair and refit.
+ */
+void temp_model_add(temp_model_t *m, float temp, float freq);
+
+/**
+ * @brief Feed-forward frequency correction at a temperature.
+ *
+ * Only the temperature dependent part is returned, the servo keeps the
+ * frequency at the reference temperature.
+ *
+ * @return ppb, 0 until the model is valid
+ */
+float temp_model_bias(const temp_model_t *m, float temp);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TEMP_MODEL_H
@@ -0,0 +1,98 @@
+#ifndef TIME_SOURCE_H
+#define TIME_SOURCE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/**
+ * Arbitration between the references able to discipline the PHC.
+ * Each source reports its state and error estimates, the manager selects
+ * the one allowed to steer the clock and publishes the matching clock
+ * quality to ptpd, so Announce and the BMC follow the actual reference.
+ * While ptpd is a slave the PHC belongs to the PTP servo, after losing the
+ * master it competes with the other sources through its holdover quality.
+ */
+
+/* TAI - UTC, the PHC runs on the PTP timescale while a local source drives it */
+#define TIME_SOURCE_UTC_OFFSET      37
+
+/* Assumed frequency error while free running on a learned frequency, ns/s */
+#define TIME_SOURCE_HOLDOVER_DRIFT  10
+
+/* PTP holdover error still announced as within specification (class 7), ns */
+#define TIME_SOURCE_HOLDOVER_SPEC   1000
+
+enum {
+    TIME_SOURCE_GNSS = 0,
+    TIME_SOURCE_NTP,
+    TIME_SOURCE_PTP,            /* ptpd servo, reported while holding over a lost master */
+    TIME_SOURCE_COUNT,
+    TIME_SOURCE_FREE_RUN = TIME_SOURCE_COUNT
+};
+
+enum {
+    TIME_SOURCE_NONE = 0,       /* unusable */
+    TIME_SOURCE_ACQUIRING,      /* usable, converging */
+    TIME_SOURCE_LOCKED,
+    TIME_SOURCE_HOLDOVER        /* reference lost, running on the learned frequency */
+};
+
+typedef struct time_source_status {
+    uint8_t state;
+    uint8_t clock_class;        /* announced while locked or in holdover */
+    uint32_t error;             /* ns, estimated time error */
+    uint32_t jitter;            /* ns */
+} time_source_status_t;
+
+// Public API
+
+/**
+ * @brief Register with ptpd for holdover reports.
+ */
+void time_source_init(void);
+
+/**
+ * @brief Update a source and reselect.
+ *
+ * Sources are ranked by clock class, then error. Acquiring sources are
+ * selected so they can converge, but only locked or holdover sources
+ * change the announced quality.
+ */
+void time_source_report(uint8_t id, const time_source_status_t *status);
+
+/**
+ * @brief Source currently steering the PHC.
+ */
+uint8_t time_source_active(void);
+
+/**
+ * @brief Check if a source may adjust the PHC.
+ */
+uint8_t time_source_may_discipline(uint8_t id);
+
+/**
+ * @brief Check if the PHC is locked to a reference, ptpd slave or a locked source.
+ */
+uint8_t time_source_locked(void);
+
+/**
+ * @brief clockAccuracy enumeration covering an error in ns.
+ */
+uint8_t time_source_accuracy(uint32_t error);
+
+/**
+ * @brief offsetScaledLogVariance for a standard deviation in ns.
+ */
+uint16_t time_source_variance(uint32_t jitter);
+
+const char *time_source_name(uint8_t id);
+void time_source_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TIME_SOURCE_H
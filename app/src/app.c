@@ -12,6 +12,41 @@
 #include "dhcp_server.h"
 #include "ping.h"
 #include "ptpd.h"
+#include "time_source.h"
+#include "metrics.h"
+#ifdef ENABLE_GNSS
+#include "gnss.h"
+#endif
+#ifdef ENABLE_PPS_MEAS
+#include "pps_meas.h"
+#endif
+#ifdef ENABLE_PPS_OUTPUT
+#include "pps_output.h"
+#endif
+#ifdef ENABLE_NTP_SERVER
+#include "ntp_server.h"
+#endif
+#ifdef ENABLE_NTP_CLIENT
+#include "ntp_client.h"
+#endif
+#ifdef ENABLE_TEMP_COMP
+#include "temp_comp.h"
+#endif
+#ifdef ENABLE_SNMP
+#include "snmp_agent.h"
+#endif
+#ifdef ENABLE_MQTT
+#include "mqtt_telemetry.h"
+#endif
+#ifdef ENABLE_CAPTURE
+#include "capture.h"
+#endif
+#ifdef ENABLE_HISTORY
+#include "history.h"
+#endif
+#ifdef ENABLE_DASHBOARD
+#include "dashboard.h"
+#endif
 
 static struct netif gnetif; /* network interface structure */
 
@@ -56,7 +91,9 @@ static int cmdDate(int argc, char **argv)
                    now.tm_hour, now.tm_min, now.tm_sec, 1900 + now.tm_year);
     }else{
         if(CLI_GET_INT_PARM(1, time)){
-            app_ethernet_set_system_time(time);
+            ptptime.tv_sec = time;
+            ptptime.tv_nsec = 0;
+            ethernetif_ptp_set_time(&ptptime);
         }else{
             return CLI_BAD_PARAM;
         }
@@ -136,7 +173,7 @@ static osThreadId ptpTaskHandle;
 static int cmdPtpd(int argc, char **argv)
 {
     if(argc < 2){
-        LOG_PRINT("usage: ptpd <init|start|stop|stat>");
+        LOG_PRINT("usage: ptpd <init|start|stop|stat|audit <on|off|show|clear>|slaves [clear]|accept <ID|clear>|pmc <get NAME|show>>");
     }
 
     if(CLI_IS_PARM(1, "init")){
@@ -161,8 +198,441 @@ static int cmdPtpd(int argc, char **argv)
     if(CLI_IS_PARM(1, "stat")){
         ptpd_stats();
     }
+
+    if(CLI_IS_PARM(1, "audit")){
+        if(CLI_IS_PARM(2, "on")){
+            ptpd_set_audit(TRUE);
+        }else if(CLI_IS_PARM(2, "off")){
+            ptpd_set_audit(FALSE);
+        }else if(CLI_IS_PARM(2, "clear")){
+            ptpd_audit_clear();
+        }else{
+            char line[160];
+            int16_t i;
+
+            LOG_PRINT("%s", ptpd_audit_header());
+            for(i = 0; i < DEFAULT_AUDIT_RECORDS; i++){
+                if(ptpd_audit_format(i, line, sizeof(line))){
+                    LOG_PRINT("%s", line);
+                }
+            }
+        }
+    }
+
+    if(CLI_IS_PARM(1, "slaves")){
+        if(CLI_IS_PARM(2, "clear")){
+            ptpd_slaves_clear();
+        }else{
+            char line[128];
+            int16_t i;
+
+            LOG_PRINT("%s", ptpd_slaves_header());
+            for(i = 0; ptpd_slaves_format(i, line, sizeof(line)); i++){
+                LOG_PRINT("%s", line);
+            }
+        }
+    }
+
+    if(CLI_IS_PARM(1, "accept") && argc > 2){
+        if(CLI_IS_PARM(2, "clear")){
+            ptpd_accept_clear();
+        }else{
+            uint8_t id[CLOCK_IDENTITY_LENGTH];
+            unsigned int byte;
+            int16_t i;
+
+            // Clock identity as 16 hex digits, as printed by the audit table
+            for(i = 0; i < CLOCK_IDENTITY_LENGTH; i++){
+                if(sscanf(argv[2] + 2 * i, "%2x", &byte) != 1){
+                    break;
+                }
+                id[i] = byte;
+            }
+
+            if(i < CLOCK_IDENTITY_LENGTH || strlen(argv[2]) != 2 * CLOCK_IDENTITY_LENGTH){
+                LOG_PRINT("invalid clock identity %s", argv[2]);
+            }else if(!ptpd_accept_master(id)){
+                LOG_PRINT("acceptable master table full");
+            }
+        }
+    }
+
+    if(CLI_IS_PARM(1, "pmc")){
+        if(CLI_IS_PARM(2, "get") && argc > 3){
+            if(!ptpd_management_get(argv[3])){
+                LOG_PRINT("unknown management id %s", argv[3]);
+            }
+        }else{
+            char line[160];
+            int16_t i;
+
+            for(i = 0; ptpd_management_format(i, line, sizeof(line)); i++){
+                LOG_PRINT("%s", line);
+            }
+        }
+    }
+    return CLI_OK;
+}
+
+static int cmdSource(int argc, char **argv)
+{
+    time_source_stats();
+    return CLI_OK;
+}
+
+static int cmdMetrics(int argc, char **argv)
+{
+    metrics_stats();
+    return CLI_OK;
+}
+
+#ifdef ENABLE_GNSS
+static int cmdGnss(int argc, char **argv)
+{
+    if(argc < 2){
+        LOG_PRINT("usage: gnss <start|stop|stat>");
+        return CLI_OK;
+    }
+
+    if(CLI_IS_PARM(1, "start")){
+        gnss_start();
+    }
+
+    if(CLI_IS_PARM(1, "stop")){
+        gnss_stop();
+    }
+
+    if(CLI_IS_PARM(1, "stat")){
+        gnss_stats();
+    }
     return CLI_OK;
 }
+#endif
+
+#ifdef ENABLE_PPS_MEAS
+static int cmdPps(int argc, char **argv)
+{
+    if(argc < 2){
+        LOG_PRINT("usage: pps <start|stop|stat|reset|stream [0|1]>");
+        return CLI_OK;
+    }
+
+    if(CLI_IS_PARM(1, "start")){
+        pps_meas_start();
+    }
+
+    if(CLI_IS_PARM(1, "stop")){
+        pps_meas_stop();
+    }
+
+    if(CLI_IS_PARM(1, "stat")){
+        pps_meas_stats();
+    }
+
+    if(CLI_IS_PARM(1, "reset")){
+        pps_meas_reset();
+    }
+
+    if(CLI_IS_PARM(1, "stream")){
+        int32_t enable = 1;
+        if(argc > 2 && !CLI_GET_INT_PARM(2, enable)){
+            return CLI_BAD_PARAM;
+        }
+        pps_meas_stream(enable != 0);
+    }
+    return CLI_OK;
+}
+#endif
+
+#ifdef ENABLE_PPS_OUTPUT
+static int cmdOut(int argc, char **argv)
+{
+    int32_t sec, ns, width;
+    pps_output_cfg_t cfg;
+
+    if(argc < 2){
+        LOG_PRINT("usage: out <rate> <width ns> [phase ns]");
+        LOG_PRINT("       out at <sec> <ns> <width ns>");
+        LOG_PRINT("       out <stop|stat>");
+        return CLI_OK;
+    }
+
+    if(CLI_IS_PARM(1, "stop")){
+        pps_output_stop();
+        return CLI_OK;
+    }
+
+    if(CLI_IS_PARM(1, "stat")){
+        pps_output_stats();
+        return CLI_OK;
+    }
+
+    if(CLI_IS_PARM(1, "at")){
+        if(!CLI_GET_INT_PARM(2, sec) || !CLI_GET_INT_PARM(3, ns) || !CLI_GET_INT_PARM(4, width)){
+            return CLI_BAD_PARAM;
+        }
+        if(pps_output_trigger(sec, ns, width) != 0){
+            LOG_PRINT("Invalid trigger");
+            return CLI_BAD_PARAM;
+        }
+        return CLI_OK;
+    }
+
+    cfg.phase = 0;
+    if(!CLI_GET_INT_PARM(1, cfg.rate) || !CLI_GET_INT_PARM(2, cfg.width)){
+        return CLI_BAD_PARAM;
+    }
+    if(argc > 3 && !CLI_GET_INT_PARM(3, cfg.phase)){
+        return CLI_BAD_PARAM;
+    }
+    if(pps_output_start(&cfg) != 0){
+        LOG_PRINT("Invalid rate/width/phase, rate <= %d, width >= %d ns", PPS_OUTPUT_MAX_RATE, PPS_OUTPUT_MIN_WIDTH);
+        return CLI_BAD_PARAM;
+    }
+    return CLI_OK;
+}
+#endif
+
+#ifdef ENABLE_NTP_SERVER
+static int cmdNtpd(int argc, char **argv)
+{
+    if(CLI_IS_PARM(1, "stat")){
+        ntp_server_stats();
+        return CLI_OK;
+    }
+
+    LOG_PRINT("usage: ntpd <stat>");
+    return CLI_OK;
+}
+#endif
+
+#ifdef ENABLE_NTP_CLIENT
+static int cmdNtpc(int argc, char **argv)
+{
+    ip_addr_t addr;
+
+    if(CLI_IS_PARM(1, "start")){
+        ntp_client_start();
+        return CLI_OK;
+    }
+
+    if(CLI_IS_PARM(1, "stop")){
+        ntp_client_stop();
+        return CLI_OK;
+    }
+
+    if(CLI_IS_PARM(1, "stat")){
+        ntp_client_stats();
+        return CLI_OK;
+    }
+
+    if(CLI_IS_PARM(1, "server")){
+        if(argc < 3 || !ipaddr_aton(argv[2], &addr)){
+            return CLI_BAD_PARAM;
+        }
+        if(ntp_client_add_server(&addr) != osOK){
+            LOG_PRINT("Server list full");
+        }
+        return CLI_OK;
+    }
+
+    LOG_PRINT("usage: ntpc <start|stop|stat|server <ip>>");
+    return CLI_OK;
+}
+#endif
+
+#ifdef ENABLE_SNMP
+static int cmdSnmp(int argc, char **argv)
+{
+    if(CLI_IS_PARM(1, "stat")){
+        snmp_agent_stats();
+        return CLI_OK;
+    }
+
+    LOG_PRINT("usage: snmp <stat>");
+    return CLI_OK;
+}
+#endif
+
+#ifdef ENABLE_MQTT
+static int cmdMqtt(int argc, char **argv)
+{
+    ip_addr_t addr;
+    int32_t port = 0;
+
+    if(CLI_IS_PARM(1, "start")){
+        if(argc < 3 || !ipaddr_aton(argv[2], &addr)){
+            return CLI_BAD_PARAM;
+        }
+        if(argc > 3 && !CLI_GET_INT_PARM(3, port)){
+            return CLI_BAD_PARAM;
+        }
+        if(mqtt_telemetry_start(&addr, (uint16_t)port) != osOK){
+            LOG_PRINT("Already running");
+        }
+        return CLI_OK;
+    }
+
+    if(CLI_IS_PARM(1, "stop")){
+        mqtt_telemetry_stop();
+        return CLI_OK;
+    }
+
+    if(CLI_IS_PARM(1, "stat")){
+        mqtt_telemetry_stats();
+        return CLI_OK;
+    }
+
+    if(CLI_IS_PARM(1, "topic")){
+        if(argc < 3){
+            return CLI_BAD_PARAM;
+        }
+        if(mqtt_telemetry_set_topic(argv[2]) != osOK){
+            LOG_PRINT("Stop first, at most %d characters", MQTT_TELEMETRY_TOPIC_LEN - 1);
+        }
+        return CLI_OK;
+    }
+
+    LOG_PRINT("usage: mqtt <start <ip> [port]|stop|stat|topic <topic>>");
+    return CLI_OK;
+}
+#endif
+
+#ifdef ENABLE_CAPTURE
+static int cmdCap(int argc, char **argv)
+{
+    capture_filter_t filter;
+    unsigned int type;
+    int32_t value;
+
+    capture_get_filter(&filter);
+
+    if(CLI_IS_PARM(1, "start")){
+        filter.all = CLI_IS_PARM(2, "all");
+        capture_set_filter(&filter);
+        capture_start();
+        return CLI_OK;
+    }
+
+    if(CLI_IS_PARM(1, "stop")){
+        capture_stop();
+        return CLI_OK;
+    }
+
+    if(CLI_IS_PARM(1, "clear")){
+        capture_clear();
+        return CLI_OK;
+    }
+
+    if(CLI_IS_PARM(1, "stat")){
+        capture_stats();
+        return CLI_OK;
+    }
+
+    if(CLI_IS_PARM(1, "ether")){
+        if(CLI_IS_PARM(2, "any")){
+            filter.ethertype = 0;
+        }else if(argc < 3 || sscanf(argv[2], "%x", &type) != 1){
+            return CLI_BAD_PARAM;
+        }else{
+            filter.ethertype = (uint16_t)type;
+        }
+        capture_set_filter(&filter);
+        return CLI_OK;
+    }
+
+    if(CLI_IS_PARM(1, "port")){
+        if(CLI_IS_PARM(2, "any")){
+            filter.port = 0;
+        }else if(argc < 3 || !CLI_GET_INT_PARM(2, value)){
+            return CLI_BAD_PARAM;
+        }else{
+            filter.port = (uint16_t)value;
+        }
+        capture_set_filter(&filter);
+        return CLI_OK;
+    }
+
+    LOG_PRINT("usage: cap <start [all]|stop|clear|stat|ether <hex|any>|port <n|any>>");
+    LOG_PRINT("       export: GET /" CAPTURE_FILE_NAME " or tftp get " CAPTURE_FILE_NAME);
+    return CLI_OK;
+}
+#endif
+
+#ifdef ENABLE_HISTORY
+static int cmdHist(int argc, char **argv)
+{
+    if(CLI_IS_PARM(1, "stat")){
+        history_stats();
+        return CLI_OK;
+    }
+
+    if(CLI_IS_PARM(1, "clear")){
+        history_clear();
+        return CLI_OK;
+    }
+
+    LOG_PRINT("usage: hist <stat|clear>");
+    LOG_PRINT("       export: GET /history?from=&to=&step= or GET /history.bin");
+    return CLI_OK;
+}
+#endif
+
+#ifdef ENABLE_DASHBOARD
+static int cmdDash(int argc, char **argv)
+{
+    if(CLI_IS_PARM(1, "on")){
+        dashboard_show(1);
+        return CLI_OK;
+    }
+
+    if(CLI_IS_PARM(1, "off")){
+        dashboard_show(0);
+        return CLI_OK;
+    }
+
+    if(CLI_IS_PARM(1, "stat")){
+        dashboard_stats();
+        return CLI_OK;
+    }
+
+    LOG_PRINT("usage: dash <on|off|stat>");
+    return CLI_OK;
+}
+#endif
+
+#ifdef ENABLE_TEMP_COMP
+static int cmdTcomp(int argc, char **argv)
+{
+    if(CLI_IS_PARM(1, "start")){
+        temp_comp_start();
+        return CLI_OK;
+    }
+
+    if(CLI_IS_PARM(1, "stop")){
+        temp_comp_stop();
+        return CLI_OK;
+    }
+
+    if(CLI_IS_PARM(1, "stat")){
+        temp_comp_stats();
+        return CLI_OK;
+    }
+
+    if(CLI_IS_PARM(1, "reset")){
+        temp_comp_reset();
+        return CLI_OK;
+    }
+
+    if(CLI_IS_PARM(1, "trace")){
+        temp_comp_trace(CLI_IS_PARM(2, "on"));
+        return CLI_OK;
+    }
+
+    LOG_PRINT("usage: tcomp <start|stop|stat|reset|trace <on|off>>");
+    return CLI_OK;
+}
+#endif
 
 static const cli_command_t cli_cmds [] = {
     {"help", ((int (*)(int, char**))CLI_Commands)},
@@ -172,6 +642,41 @@ static const cli_command_t cli_cmds [] = {
 	{"ping", cmdPing},
     {"ptpd", cmdPtpd},
     {"date", cmdDate},
+    {"source", cmdSource},
+    {"metrics", cmdMetrics},
+#ifdef ENABLE_GNSS
+    {"gnss", cmdGnss},
+#endif
+#ifdef ENABLE_PPS_MEAS
+    {"pps", cmdPps},
+#endif
+#ifdef ENABLE_PPS_OUTPUT
+    {"out", cmdOut},
+#endif
+#ifdef ENABLE_NTP_SERVER
+    {"ntpd", cmdNtpd},
+#endif
+#ifdef ENABLE_NTP_CLIENT
+    {"ntpc", cmdNtpc},
+#endif
+#ifdef ENABLE_TEMP_COMP
+    {"tcomp", cmdTcomp},
+#endif
+#ifdef ENABLE_SNMP
+    {"snmp", cmdSnmp},
+#endif
+#ifdef ENABLE_MQTT
+    {"mqtt", cmdMqtt},
+#endif
+#ifdef ENABLE_CAPTURE
+    {"cap", cmdCap},
+#endif
+#ifdef ENABLE_HISTORY
+    {"hist", cmdHist},
+#endif
+#ifdef ENABLE_DASHBOARD
+    {"dash", cmdDash},
+#endif
 };
 
 static void CLI_thread(void const *argument)
@@ -259,6 +764,8 @@ void APP_Setup(void)
     /* Initialize the LwIP stack */
     Netif_Config();
 
+    time_source_init();
+
     /* Initialize webserver demo */
     http_server_socket_init();
 
@@ -270,6 +777,26 @@ void APP_Setup(void)
     dhcp_server_start();
 #endif
 
+#ifdef ENABLE_NTP_SERVER
+    ntp_server_init();
+#endif
+
+#ifdef ENABLE_SNMP
+    snmp_agent_init();
+#endif
+
+#ifdef ENABLE_CAPTURE
+    capture_init();
+#endif
+
+#ifdef ENABLE_HISTORY
+    history_init();
+#endif
+
+#ifdef ENABLE_DASHBOARD
+    dashboard_init();
+#endif
+
 #ifdef ENABLE_DHCP
     /* Start DHCPClient */
     osThreadDef(DHCP, DHCP_thread, osPriorityBelowNormal, 0, configMINIMAL_STACK_SIZE * 2);
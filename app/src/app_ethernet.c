@@ -50,7 +50,9 @@
 #include "lwip/dhcp.h"
 #include "lwip/ip4_addr.h"
 #include "ethernetif.h"
-#include "lwip/apps/sntp.h"
+#ifdef ENABLE_NTP_CLIENT
+#include "ntp_client.h"
+#endif
 #include "ptpd.h"
 
 /* Private typedef -----------------------------------------------------------*/
@@ -65,32 +67,15 @@ volatile uint8_t DHCP_state = DHCP_OFF;
 /* Private function prototypes -----------------------------------------------*/
 /* Private functions ---------------------------------------------------------*/
 
-#if SNTP_ENABLED
+#ifdef ENABLE_NTP_CLIENT
 
-void app_ethernet_set_system_time (uint32_t sec)
+static void app_network_ntp_start (void)
 {
-    TimeInternal ti;
-    /* start ptp counter before setting system time */
-    ethernetif_ptp_init();
-
-    ti.seconds = sec;
-    ti.nanoseconds = 0;
+    const ip_addr_t ntp_ip =
+            IPADDR4_INIT_BYTES(200, 160, 7, 186);   // NTP server ip
 
-    setTime(&ti);
-    LOG_INF("System time set!\n\r");
-}
-
-static void app_network_sntp_start (void)
-{
-    const ip4_addr_t sntp_ip =
-            IPADDR4_INIT_BYTES(200, 160, 7, 186);   // SNTP server ip
-
-	if (sntp_enabled() != 1){
-		LOG_INF("Initializing SNTP");
-	    sntp_setoperatingmode(SNTP_OPMODE_POLL);	// Set SNTP operation mode to Polling
-	    sntp_setserver(0, &sntp_ip);				// Set server 0 as the supplied ip address
-	    sntp_init();								// Start STNP process
-	}
+    ntp_client_add_server(&ntp_ip);
+    ntp_client_start();
 }
 
 #endif
@@ -161,9 +146,9 @@ void DHCP_thread(void const * argument)
 
           sprintf((char *)iptxt, "%s", ip4addr_ntoa((const ip4_addr_t *)&netif->ip_addr));
           LOG_INF ("IP address assigned by a DHCP server: %s\n", iptxt);
-        #if SNTP_ENABLED
+        #ifdef ENABLE_NTP_CLIENT
           if(!ip4_addr_isany(netif_ip4_addr(netif))){
-            app_network_sntp_start();
+            app_network_ntp_start();
           }
         #endif
         }
@@ -0,0 +1,438 @@
+#include <stdint.h>
+#include <string.h>
+#include "lwip/pbuf.h"
+#include "lwip/def.h"
+#include "lwip/apps/tftp_server.h"
+#include "app.h"
+#include "cmsis_os.h"
+#include "ethernetif.h"
+#include "capture.h"
+
+#define ETHTYPE_PTP         0x88F7
+#define ETHTYPE_IPV4        0x0800
+#define ETHTYPE_VLAN        0x8100
+#define IP_PROTO_UDP        17
+#define IP_PROTO_TCP        6
+#define PTP_EVENT_PORT      319
+#define PTP_GENERAL_PORT    320
+
+/* Frame bytes looked at by the filter, Ethernet, VLAN tag, IPv4 and ports */
+#define CAPTURE_HEADER_LEN  (14 + 4 + 60 + 4)
+
+#define PCAPNG_SHB          0x0A0D0D0AUL
+#define PCAPNG_IDB          0x00000001UL
+#define PCAPNG_EPB          0x00000006UL
+#define PCAPNG_BOM          0x1A2B3C4DUL
+#define PCAPNG_LINK_ETH     1
+#define PCAPNG_PAD(n)       (((n) + 3) & ~3UL)
+
+/* Ring record, the frame follows padded to 4 bytes */
+typedef struct capture_record {
+    uint16_t size;          /* header and frame, 0 marks the end of the ring */
+    uint16_t caplen;
+    uint16_t len;           /* on the wire */
+    uint8_t dir;            /* ETHERNETIF_RX or ETHERNETIF_TX */
+    uint8_t ready;          /* frame copied */
+    uint32_t sec;
+    uint32_t nsec;
+} capture_record_t;
+
+struct capture_export {
+    uint32_t offset;        /* next record */
+    uint32_t remaining;     /* records */
+    uint8_t stage;          /* section header, interface, then frames */
+    uint16_t block_len;
+    uint16_t block_off;
+    uint32_t block[(28 + CAPTURE_SNAPLEN + 3 + 16) / 4];
+};
+
+typedef struct _capture {
+    uint8_t *ring;
+    uint32_t head;          /* offset of the next record */
+    uint32_t tail;          /* offset of the oldest record */
+    uint32_t used;          /* bytes from tail to head, the skipped end included */
+    uint32_t count;         /* records in the ring */
+    volatile uint8_t running;
+    volatile uint8_t writers;   /* records being copied */
+    uint8_t exporting;
+    capture_filter_t filter;
+    uint32_t captured;
+    uint32_t overwritten;
+    uint32_t filtered;
+    capture_export_t exp;
+} capture_t;
+
+static capture_t cap = {
+    .ring = (uint8_t *)CAPTURE_RING_ADDR,
+};
+
+static int capture_match(const struct pbuf *p)
+{
+    uint8_t hdr[CAPTURE_HEADER_LEN];
+    uint16_t n, type, off, sport, dport;
+    uint8_t proto;
+
+    n = pbuf_copy_partial(p, hdr, sizeof(hdr), 0);
+    if (n < 14) {
+        return 0;
+    }
+
+    off = 12;
+    type = (hdr[off] << 8) | hdr[off + 1];
+    if (type == ETHTYPE_VLAN && n >= 18) {
+        off += 4;
+        type = (hdr[off] << 8) | hdr[off + 1];
+    }
+    off += 2;
+
+    if (cap.filter.ethertype && type != cap.filter.ethertype) {
+        return 0;
+    }
+
+    /* Ports of an unfragmented IPv4 UDP or TCP packet */
+    sport = dport = 0;
+    proto = 0;
+    if (type == ETHTYPE_IPV4 && n >= off + 20 && (((hdr[off + 6] & 0x1F) | hdr[off + 7]) == 0)) {
+        proto = hdr[off + 9];
+        off += (hdr[off] & 0x0F) * 4;
+        if ((proto == IP_PROTO_UDP || proto == IP_PROTO_TCP) && n >= off + 4) {
+            sport = (hdr[off] << 8) | hdr[off + 1];
+            dport = (hdr[off + 2] << 8) | hdr[off + 3];
+        }
+    }
+
+    if (cap.filter.port && sport != cap.filter.port && dport != cap.filter.port) {
+        return 0;
+    }
+
+    if (!cap.filter.all) {
+        return type == ETHTYPE_PTP || (proto == IP_PROTO_UDP &&
+            (dport == PTP_EVENT_PORT || dport == PTP_GENERAL_PORT ||
+             sport == PTP_EVENT_PORT || sport == PTP_GENERAL_PORT));
+    }
+
+    return 1;
+}
+
+// Make room for a record, the oldest ones are dropped. Called in a critical section.
+static capture_record_t *capture_reserve(uint32_t size)
+{
+    capture_record_t *rec;
+
+    if (cap.head + size > CAPTURE_RING_SIZE) {
+        if (cap.head < CAPTURE_RING_SIZE) {
+            ((capture_record_t *)(cap.ring + cap.head))->size = 0;
+        }
+        cap.used += CAPTURE_RING_SIZE - cap.head;
+        cap.head = 0;
+    }
+
+    while (CAPTURE_RING_SIZE - cap.used < size) {
+        rec = (capture_record_t *)(cap.ring + cap.tail);
+
+        if (cap.tail >= CAPTURE_RING_SIZE || rec->size == 0) {
+            cap.used -= CAPTURE_RING_SIZE - cap.tail;
+            cap.tail = 0;
+            continue;
+        }
+
+        cap.used -= rec->size;
+        cap.tail += rec->size;
+        cap.count--;
+        cap.overwritten++;
+    }
+
+    rec = (capture_record_t *)(cap.ring + cap.head);
+    rec->size = size;
+    rec->ready = 0;
+
+    cap.head += size;
+    cap.used += size;
+    cap.count++;
+
+    return rec;
+}
+
+// Input thread for received frames, the releasing thread for sent ones
+static void capture_frame(const struct pbuf *p, const struct ptptime_t *timestamp, uint8_t dir)
+{
+    capture_record_t *rec;
+    uint16_t caplen;
+
+    if (!cap.running) {
+        return;
+    }
+
+    if (!capture_match(p)) {
+        cap.filtered++;
+        return;
+    }
+
+    caplen = p->tot_len > CAPTURE_SNAPLEN ? CAPTURE_SNAPLEN : p->tot_len;
+
+    taskENTER_CRITICAL();
+    if (!cap.running) {
+        taskEXIT_CRITICAL();
+        return;
+    }
+    rec = capture_reserve(sizeof(capture_record_t) + PCAPNG_PAD(caplen));
+    cap.writers++;
+    taskEXIT_CRITICAL();
+
+    rec->caplen = caplen;
+    rec->len = p->tot_len;
+    rec->dir = dir;
+    rec->sec = timestamp->tv_sec;
+    rec->nsec = timestamp->tv_nsec;
+    pbuf_copy_partial(p, rec + 1, caplen, 0);
+    rec->ready = 1;
+
+    taskENTER_CRITICAL();
+    cap.writers--;
+    cap.captured++;
+    taskEXIT_CRITICAL();
+}
+
+/* ---------- pcapng export ---------- */
+
+static uint16_t capture_shb(uint32_t *b)
+{
+    b[0] = PCAPNG_SHB;
+    b[1] = 28;
+    b[2] = PCAPNG_BOM;
+    b[3] = 1;               /* version 1.0 */
+    b[4] = 0xFFFFFFFFUL;    /* section length unknown */
+    b[5] = 0xFFFFFFFFUL;
+    b[6] = 28;
+
+    return 28;
+}
+
+static uint16_t capture_idb(uint32_t *b)
+{
+    b[0] = PCAPNG_IDB;
+    b[1] = 32;
+    b[2] = PCAPNG_LINK_ETH;
+    b[3] = CAPTURE_SNAPLEN;
+    b[4] = 9 | (1 << 16);   /* if_tsresol, 10^-9 s */
+    b[5] = 9;
+    b[6] = 0;               /* opt_endofopt */
+    b[7] = 32;
+
+    return 32;
+}
+
+static uint16_t capture_epb(uint32_t *b, const capture_record_t *rec)
+{
+    uint64_t ts = (uint64_t)rec->sec * 1000000000ULL + rec->nsec;
+    uint32_t pad = PCAPNG_PAD(rec->caplen);
+    uint32_t total = 28 + pad + 12 + 4;
+    uint32_t *opt = b + 7 + pad / 4;
+
+    b[0] = PCAPNG_EPB;
+    b[1] = total;
+    b[2] = 0;               /* interface */
+    b[3] = (uint32_t)(ts >> 32);
+    b[4] = (uint32_t)ts;
+    b[5] = rec->caplen;
+    b[6] = rec->len;
+    memcpy(b + 7, rec + 1, pad);
+    memset((uint8_t *)(b + 7) + rec->caplen, 0, pad - rec->caplen);
+    opt[0] = 2 | (4 << 16); /* epb_flags, direction */
+    opt[1] = rec->dir == ETHERNETIF_TX ? 2 : 1;
+    opt[2] = 0;
+    opt[3] = total;
+
+    return total;
+}
+
+// Build the next block, 0 past the last record
+static uint16_t capture_next_block(capture_export_t *exp)
+{
+    const capture_record_t *rec;
+
+    switch (exp->stage) {
+        case 0:
+            exp->stage++;
+            return capture_shb(exp->block);
+        case 1:
+            exp->stage++;
+            return capture_idb(exp->block);
+        default:
+            break;
+    }
+
+    while (exp->remaining > 0) {
+        rec = (const capture_record_t *)(cap.ring + exp->offset);
+
+        if (exp->offset >= CAPTURE_RING_SIZE || rec->size == 0) {
+            exp->offset = 0;
+            continue;
+        }
+
+        exp->offset += rec->size;
+        exp->remaining--;
+
+        if (rec->ready) {
+            return capture_epb(exp->block, rec);
+        }
+    }
+
+    return 0;
+}
+
+capture_export_t *capture_export_open(void)
+{
+    capture_export_t *exp = &cap.exp;
+
+    taskENTER_CRITICAL();
+    if (cap.exporting) {
+        taskEXIT_CRITICAL();
+        return NULL;
+    }
+    cap.exporting = 1;
+    cap.running = 0;
+    taskEXIT_CRITICAL();
+
+    /* Let the frames being copied complete */
+    while (cap.writers) {
+        osDelay(1);
+    }
+
+    exp->offset = cap.tail;
+    exp->remaining = cap.count;
+    exp->stage = 0;
+    exp->block_len = 0;
+    exp->block_off = 0;
+
+    return exp;
+}
+
+int capture_export_read(capture_export_t *exp, void *buf, int len)
+{
+    uint8_t *dst = buf;
+    int n = 0, chunk;
+
+    while (n < len) {
+        if (exp->block_off == exp->block_len) {
+            exp->block_len = capture_next_block(exp);
+            exp->block_off = 0;
+
+            if (exp->block_len == 0) {
+                break;
+            }
+        }
+
+        chunk = exp->block_len - exp->block_off;
+        if (chunk > len - n) {
+            chunk = len - n;
+        }
+
+        memcpy(dst + n, (uint8_t *)exp->block + exp->block_off, chunk);
+        exp->block_off += chunk;
+        n += chunk;
+    }
+
+    return n;
+}
+
+void capture_export_close(capture_export_t *exp)
+{
+    cap.exporting = 0;
+}
+
+/* ---------- TFTP ---------- */
+
+static void *capture_tftp_open(const char *fname, const char *mode, u8_t write)
+{
+    if (write || strcmp(fname, CAPTURE_FILE_NAME) != 0) {
+        return NULL;
+    }
+
+    return capture_export_open();
+}
+
+static void capture_tftp_close(void *handle)
+{
+    capture_export_close(handle);
+}
+
+static int capture_tftp_read(void *handle, void *buf, int bytes)
+{
+    return capture_export_read(handle, buf, bytes);
+}
+
+static int capture_tftp_write(void *handle, struct pbuf *p)
+{
+    return -1;
+}
+
+static const struct tftp_context capture_tftp = {
+    capture_tftp_open,
+    capture_tftp_close,
+    capture_tftp_read,
+    capture_tftp_write,
+};
+
+/* ---------- control ---------- */
+
+void capture_init(void)
+{
+    if (tftp_init(&capture_tftp) != ERR_OK) {
+        LOG_ERR("Capture: failed to start TFTP server");
+    }
+
+    ethernetif_set_capture_cb(capture_frame);
+}
+
+void capture_start(void)
+{
+    if (cap.exporting) {
+        LOG_WRN("Capture: export in progress");
+        return;
+    }
+
+    cap.running = 1;
+}
+
+void capture_stop(void)
+{
+    cap.running = 0;
+}
+
+void capture_clear(void)
+{
+    taskENTER_CRITICAL();
+    if (cap.running || cap.exporting || cap.writers) {
+        taskEXIT_CRITICAL();
+        LOG_WRN("Capture: stop it first");
+        return;
+    }
+    cap.head = cap.tail = cap.used = cap.count = 0;
+    cap.captured = cap.overwritten = cap.filtered = 0;
+    taskEXIT_CRITICAL();
+}
+
+void capture_set_filter(const capture_filter_t *filter)
+{
+    taskENTER_CRITICAL();
+    cap.filter = *filter;
+    taskEXIT_CRITICAL();
+}
+
+void capture_get_filter(capture_filter_t *filter)
+{
+    *filter = cap.filter;
+}
+
+void capture_stats(void)
+{
+    LOG_PRINT("\t%s, %s frames, ethertype: 0x%04x, port: %u",
+              cap.exporting ? "exporting" : cap.running ? "running" : "stopped",
+              cap.filter.all ? "all" : "PTP", cap.filter.ethertype, cap.filter.port);
+    LOG_PRINT("\trecords: %lu, %lu of %lu KiB",
+              (unsigned long)cap.count, (unsigned long)(cap.used / 1024),
+              (unsigned long)(CAPTURE_RING_SIZE / 1024));
+    LOG_PRINT("\tcaptured: %lu, overwritten: %lu, filtered out: %lu",
+              (unsigned long)cap.captured, (unsigned long)cap.overwritten, (unsigned long)cap.filtered);
+}
@@ -0,0 +1,441 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include "dash_draw.h"
+
+/* Layout, 800 x 480 */
+#define HEADER_H        48
+#define PANEL_X         0
+#define PANEL_W         240
+#define ROW_Y           60
+#define ROW_H           44
+#define CHART_X         248
+#define CHART_Y         56
+#define CHART_STEP      140
+#define CHART_H         120
+#define TITLE_H         16
+
+static const char *const row_names[DASH_ROWS] = {
+    "Offset from master",
+    "Mean path delay",
+    "Frequency",
+    "Servo updates",
+    "Clock steps",
+    "State changes",
+    "Sync sequence gaps",
+    "Steps removed",
+    "UTC offset",
+};
+
+/* ---------- primitives ---------- */
+
+static void fill(const dash_fb_t *fb, int x, int y, int w, int h, uint32_t color)
+{
+    uint32_t *p;
+    int i;
+
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > fb->width) w = fb->width - x;
+    if (y + h > fb->height) h = fb->height - y;
+
+    for (; h > 0; h--, y++) {
+        p = fb->pixels + (uint32_t)y * fb->stride + x;
+        for (i = 0; i < w; i++) {
+            p[i] = color;
+        }
+    }
+}
+
+// Glyph rows are (Width + 7) / 8 bytes, leftmost pixel in the top bit
+static void glyph(const dash_fb_t *fb, int x, int y, const sFONT *font, char ch, uint32_t fg, uint32_t bg)
+{
+    uint16_t bytes = (font->Width + 7) / 8;
+    const uint8_t *row;
+    uint32_t *p;
+    int i, j;
+
+    if (ch < ' ' || ch > '~') {
+        ch = '?';
+    }
+    row = &font->table[(ch - ' ') * font->Height * bytes];
+
+    for (i = 0; i < font->Height && y + i < fb->height; i++, row += bytes) {
+        p = fb->pixels + (uint32_t)(y + i) * fb->stride + x;
+        for (j = 0; j < font->Width && x + j < fb->width; j++) {
+            p[j] = (row[j / 8] & (0x80 >> (j % 8))) ? fg : bg;
+        }
+    }
+}
+
+/* ---------- labels ---------- */
+
+static void label_init(dash_label_t *l, int x, int y, int w, const sFONT *font, uint32_t fg, uint32_t bg)
+{
+    l->x = x;
+    l->y = y;
+    l->w = w;
+    l->font = font;
+    l->fg = fg;
+    l->bg = bg;
+    l->text[0] = '\0';
+    l->dirty = 1;
+}
+
+static void label_set(dash_label_t *l, const char *fmt, ...)
+{
+    char text[DASH_LABEL_LEN];
+    va_list ap;
+
+    va_start(ap, fmt);
+    vsnprintf(text, sizeof(text), fmt, ap);
+    va_end(ap);
+
+    if (strcmp(text, l->text) != 0) {
+        strcpy(l->text, text);
+        l->dirty = 1;
+    }
+}
+
+static void label_color(dash_label_t *l, uint32_t fg, uint32_t bg)
+{
+    if (l->fg != fg || l->bg != bg) {
+        l->fg = fg;
+        l->bg = bg;
+        l->dirty = 1;
+    }
+}
+
+static uint32_t label_draw(const dash_fb_t *fb, dash_label_t *l)
+{
+    const char *c;
+    int x = l->x;
+
+    for (c = l->text; *c != '\0' && x + l->font->Width <= l->x + l->w; c++) {
+        glyph(fb, x, l->y, l->font, *c, l->fg, l->bg);
+        x += l->font->Width;
+    }
+    fill(fb, x, l->y, l->x + l->w - x, l->font->Height, l->bg);
+    l->dirty = 0;
+
+    return (uint32_t)l->w * l->font->Height;
+}
+
+// Time in ns as ns, us or ms, keeping three to four digits
+static void format_ns(char *buf, int len, int32_t ns)
+{
+    int32_t a = ns < 0 ? -ns : ns;
+    const char *sign = ns < 0 ? "-" : "";
+
+    if (a < 10000) {
+        snprintf(buf, len, "%s%ld ns", sign, (long)a);
+    } else if (a < 10000000) {
+        snprintf(buf, len, "%s%ld.%01ld us", sign, (long)(a / 1000), (long)(a % 1000 / 100));
+    } else {
+        snprintf(buf, len, "%s%ld.%01ld ms", sign, (long)(a / 1000000), (long)(a % 1000000 / 100000));
+    }
+}
+
+/* ---------- strip charts ---------- */
+
+static void chart_init(dash_chart_t *c, int y, uint32_t color, uint8_t symmetric, const char *name, const char *unit)
+{
+    memset(c, 0, sizeof(*c));
+    c->x = CHART_X;
+    c->y = y + TITLE_H;
+    c->w = DASH_CHART_WIDTH;
+    c->h = CHART_H;
+    c->color = color;
+    c->symmetric = symmetric;
+    c->lo = symmetric ? -100 : 0;
+    c->hi = 100;
+    c->redraw = 0;
+    c->name = name;
+    c->unit = unit;
+    label_init(&c->title, CHART_X, y, DASH_CHART_WIDTH, &Font12, DASH_COLOR_DIM, DASH_COLOR_BACK);
+}
+
+// Index of the newest value shown in a column, -1 for a blank column
+static int32_t chart_index(const dash_chart_t *c, uint16_t col)
+{
+    int32_t last = (int32_t)c->count - 1;
+    int32_t i;
+
+    if (last < 0) {
+        return -1;
+    }
+
+    i = last - (int32_t)((last % c->w - col + c->w) % c->w);
+
+    return (i >= 0 && last - i < c->w - DASH_CHART_GAP) ? i : -1;
+}
+
+static int chart_row(const dash_chart_t *c, int32_t v)
+{
+    if (v < c->lo) v = c->lo;
+    if (v > c->hi) v = c->hi;
+
+    return c->y + (c->h - 1) - (int)((int64_t)(v - c->lo) * (c->h - 1) / (c->hi - c->lo));
+}
+
+static uint32_t chart_column(const dash_fb_t *fb, const dash_chart_t *c, uint16_t col)
+{
+    int32_t i = chart_index(c, col);
+    int x = c->x + col;
+    int y0, y1, t;
+
+    fill(fb, x, c->y, 1, c->h, DASH_COLOR_PANEL);
+
+    /* Dotted quarter lines, solid zero */
+    if (col % 4 == 0) {
+        for (t = 1; t < 4; t++) {
+            fill(fb, x, c->y + t * (c->h - 1) / 4, 1, 1, DASH_COLOR_GRID);
+        }
+    }
+    if (c->lo < 0 && c->hi > 0) {
+        fill(fb, x, chart_row(c, 0), 1, 1, DASH_COLOR_GRID);
+    }
+
+    if (i >= 0) {
+        y1 = chart_row(c, c->values[col]);
+        y0 = y1;
+        /* Joined to the previous value, still stored when it went into
+         * the gap, so the oldest column looks the same redrawn or swept */
+        if (i > 0) {
+            y0 = chart_row(c, c->values[(col + c->w - 1) % c->w]);
+        }
+        if (y0 > y1) {
+            t = y0; y0 = y1; y1 = t;
+        }
+        fill(fb, x, y0, 1, y1 - y0 + 1, c->color);
+    }
+
+    return c->h;
+}
+
+// 1, 2 or 5 times a power of ten, at least v
+static int32_t nice(int32_t v)
+{
+    int32_t p = 1;
+
+    while (p <= INT32_MAX / 10 && p * 10 <= v) {
+        p *= 10;
+    }
+    if (v <= p) return p;
+    if (v <= 2 * p) return 2 * p;
+    if (v <= 5 * p) return 5 * p;
+
+    return p <= INT32_MAX / 10 ? 10 * p : INT32_MAX;
+}
+
+static void chart_title(dash_chart_t *c)
+{
+    label_set(&c->title, "%s, %s   %ld .. %ld", c->name, c->unit, (long)c->lo, (long)c->hi);
+}
+
+// Fit the scale to the values shown, redrawing the chart if it changed
+static void chart_scale(dash_chart_t *c)
+{
+    int32_t min = INT32_MAX, max = INT32_MIN, lo, hi, span;
+    uint16_t col;
+
+    for (col = 0; col < c->w; col++) {
+        if (chart_index(c, col) >= 0) {
+            if (c->values[col] < min) min = c->values[col];
+            if (c->values[col] > max) max = c->values[col];
+        }
+    }
+    if (min > max) {
+        return;
+    }
+
+    if (c->symmetric) {
+        hi = nice((max > -min ? max : -min) / 4 * 5 + 10);
+        lo = -hi;
+    } else {
+        span = nice((int32_t)(((int64_t)max - min) / 4 * 5) + 10);
+        lo = min / 2 + max / 2 - span / 2;
+        lo -= ((lo % (span / 10)) + span / 10) % (span / 10);
+        hi = lo + span;
+        if (hi < max) {
+            lo += span / 10;
+            hi += span / 10;
+        }
+    }
+
+    if (lo != c->lo || hi != c->hi) {
+        c->lo = lo;
+        c->hi = hi;
+        c->redraw = 0;
+        chart_title(c);
+    }
+    c->small = 0;
+}
+
+static void chart_add(dash_chart_t *c, int32_t v)
+{
+    int64_t quarter = ((int64_t)c->hi - c->lo) / 4;
+    int64_t mid = ((int64_t)c->hi + c->lo) / 2;
+
+    c->values[c->count % c->w] = v;
+    c->count++;
+
+    /* Grow at once, shrink after a whole sweep of small values */
+    if (v <= c->lo || v >= c->hi) {
+        chart_scale(c);
+    } else if (v - mid > -quarter && v - mid < quarter) {
+        if (++c->small >= c->w) {
+            chart_scale(c);
+        }
+    } else {
+        c->small = 0;
+    }
+}
+
+static uint32_t chart_render(const dash_fb_t *fb, dash_chart_t *c, uint32_t budget)
+{
+    uint32_t used = 0;
+
+    if (c->title.dirty && used < budget) {
+        used += label_draw(fb, &c->title);
+    }
+
+    /* Whole redraw after a rescale, or when too far behind */
+    if (c->count - c->drawn > (uint32_t)(c->w - DASH_CHART_GAP) && c->redraw >= c->w) {
+        c->redraw = 0;
+    }
+    if (c->redraw < c->w) {
+        c->drawn = c->count;
+        while (c->redraw < c->w && used < budget) {
+            used += chart_column(fb, c, c->redraw++);
+        }
+        return used;
+    }
+
+    /* Sweep: the new column and a blank one ahead of it */
+    while (c->drawn < c->count && used < budget) {
+        used += chart_column(fb, c, c->drawn % c->w);
+        used += chart_column(fb, c, (c->drawn + DASH_CHART_GAP) % c->w);
+        c->drawn++;
+    }
+
+    return used;
+}
+
+/* ---------- dashboard ---------- */
+
+void dash_init(dash_t *d, const dash_fb_t *fb)
+{
+    int i;
+
+    memset(d, 0, sizeof(*d));
+    d->fb = *fb;
+
+    label_init(&d->state, 12, 12, 300, &Font24, DASH_COLOR_TEXT, DASH_COLOR_PANEL);
+    label_init(&d->master, 328, 16, 460, &Font16, DASH_COLOR_TEXT, DASH_COLOR_PANEL);
+
+    for (i = 0; i < DASH_ROWS; i++) {
+        label_init(&d->names[i], PANEL_X + 12, ROW_Y + i * ROW_H, PANEL_W - 24, &Font12, DASH_COLOR_DIM, DASH_COLOR_BACK);
+        label_init(&d->values[i], PANEL_X + 12, ROW_Y + i * ROW_H + 14, PANEL_W - 24, &Font16, DASH_COLOR_TEXT, DASH_COLOR_BACK);
+        label_set(&d->names[i], "%s", row_names[i]);
+    }
+
+    chart_init(&d->charts[0], CHART_Y, DASH_COLOR_OFFSET, 1, "Offset", "ns");
+    chart_init(&d->charts[1], CHART_Y + CHART_STEP, DASH_COLOR_DELAY, 0, "Path delay", "ns");
+    chart_init(&d->charts[2], CHART_Y + 2 * CHART_STEP, DASH_COLOR_DRIFT, 1, "Frequency", "ppb");
+    for (i = 0; i < 3; i++) {
+        chart_title(&d->charts[i]);
+    }
+}
+
+void dash_invalidate(dash_t *d)
+{
+    int i;
+
+    d->clear_row = 0;
+    d->state.dirty = 1;
+    d->master.dirty = 1;
+    for (i = 0; i < DASH_ROWS; i++) {
+        d->names[i].dirty = 1;
+        d->values[i].dirty = 1;
+    }
+    for (i = 0; i < 3; i++) {
+        d->charts[i].title.dirty = 1;
+        d->charts[i].redraw = 0;
+    }
+}
+
+static uint32_t health_color(uint8_t health)
+{
+    switch (health) {
+    case DASH_HEALTH_OK:     return DASH_COLOR_OK;
+    case DASH_HEALTH_WARN:   return DASH_COLOR_WARN;
+    case DASH_HEALTH_BAD:    return DASH_COLOR_BAD;
+    case DASH_HEALTH_MASTER: return DASH_COLOR_MASTER;
+    default:                 return DASH_COLOR_GRID;
+    }
+}
+
+void dash_update(dash_t *d, const dash_state_t *s)
+{
+    const uint8_t *gm = s->grandmaster;
+    char buf[24];
+
+    label_color(&d->state, DASH_COLOR_TEXT, health_color(s->health));
+    label_set(&d->state, " %s", s->port_state);
+    label_set(&d->master, "GM %02x%02x%02x.%02x%02x.%02x%02x%02x  class %u  domain %u",
+              gm[0], gm[1], gm[2], gm[3], gm[4], gm[5], gm[6], gm[7], s->gm_class, s->domain);
+
+    format_ns(buf, sizeof(buf), s->offset);
+    label_set(&d->values[0], "%s", buf);
+    format_ns(buf, sizeof(buf), s->delay);
+    label_set(&d->values[1], "%s", buf);
+    label_set(&d->values[2], "%ld ppb", (long)s->drift);
+    label_set(&d->values[3], "%lu", (unsigned long)s->updates);
+    label_set(&d->values[4], "%lu", (unsigned long)s->steps);
+    label_set(&d->values[5], "%lu", (unsigned long)s->state_changes);
+    label_set(&d->values[6], "%lu", (unsigned long)s->gaps);
+    label_set(&d->values[7], "%d", s->steps_removed);
+    label_set(&d->values[8], s->utc_valid ? "%d s" : "%d s (not valid)", s->utc_offset);
+
+    /* Offset stands out when it is the problem */
+    label_color(&d->values[0], s->health == DASH_HEALTH_WARN ? DASH_COLOR_WARN : DASH_COLOR_TEXT, DASH_COLOR_BACK);
+
+    if (s->updates != d->updates) {
+        d->updates = s->updates;
+        chart_add(&d->charts[0], s->offset);
+        chart_add(&d->charts[1], s->delay);
+        chart_add(&d->charts[2], s->drift);
+    }
+}
+
+uint32_t dash_render(dash_t *d, uint32_t budget)
+{
+    uint32_t used = 0;
+    int i;
+
+    /* Background first, by bands of rows */
+    while (d->clear_row < d->fb.height && used < budget) {
+        fill(&d->fb, 0, d->clear_row, d->fb.width, 8, d->clear_row < HEADER_H ? DASH_COLOR_PANEL : DASH_COLOR_BACK);
+        d->clear_row += 8;
+        used += 8 * d->fb.width;
+    }
+    if (d->clear_row < d->fb.height) {
+        return used;
+    }
+
+    if (d->state.dirty && used < budget) used += label_draw(&d->fb, &d->state);
+    if (d->master.dirty && used < budget) used += label_draw(&d->fb, &d->master);
+
+    for (i = 0; i < DASH_ROWS && used < budget; i++) {
+        if (d->names[i].dirty) used += label_draw(&d->fb, &d->names[i]);
+        if (d->values[i].dirty) used += label_draw(&d->fb, &d->values[i]);
+    }
+
+    for (i = 0; i < 3 && used < budget; i++) {
+        used += chart_render(&d->fb, &d->charts[i], budget - used);
+    }
+
+    return used;
+}
@@ -0,0 +1,186 @@
+#include <stdint.h>
+#include <string.h>
+#include "app.h"
+#include "cmsis_os.h"
+#include "ptpd.h"
+#include "stm32f769i_discovery_lcd.h"
+#include "dash_draw.h"
+#include "dashboard.h"
+
+#define DASHBOARD_LAYER     0
+#define LOG_LAYER           1
+
+typedef struct _dashb {
+    osThreadId threadid;
+    dash_t dash;
+    PtpDataSets ds;
+    PtpCounters counters;
+    volatile uint8_t shown;
+    volatile uint8_t invalidate;    /* set by dashboard_show, taken by the thread */
+    uint32_t frames;                /* frames that drew something */
+    uint64_t pixels;
+    uint32_t max_pixels;
+    uint32_t max_ms;
+    uint32_t late;                  /* frames longer than DASHBOARD_FRAME_MS */
+} dashb_t;
+
+static dashb_t dashb;
+
+static const char *const state_names[] = {
+    "INITIALIZING", "FAULTY", "DISABLED", "LISTENING", "PRE_MASTER",
+    "MASTER", "PASSIVE", "UNCALIBRATED", "SLAVE"
+};
+
+static uint8_t dashboard_health(const PtpCounters *c)
+{
+    switch (c->portState) {
+    case PTP_SLAVE:
+        if (c->offsetFromMaster > DASHBOARD_OFFSET_LIMIT || c->offsetFromMaster < -DASHBOARD_OFFSET_LIMIT) {
+            return DASH_HEALTH_WARN;
+        }
+        return DASH_HEALTH_OK;
+    case PTP_UNCALIBRATED:
+        return DASH_HEALTH_WARN;
+    case PTP_MASTER:
+    case PTP_PRE_MASTER:
+        return DASH_HEALTH_MASTER;
+    case PTP_FAULTY:
+    case PTP_DISABLED:
+        return DASH_HEALTH_BAD;
+    default:
+        return DASH_HEALTH_IDLE;
+    }
+}
+
+// Snapshot the PTP state, data sets and counters from the same instant
+static void dashboard_snapshot(dash_state_t *s)
+{
+    const PtpCounters *c = &dashb.counters;
+    const PtpDataSets *ds = &dashb.ds;
+
+    taskENTER_CRITICAL();
+    ptpd_get_datasets(&dashb.ds);
+    ptpd_get_counters(&dashb.counters);
+    taskEXIT_CRITICAL();
+
+    s->port_state = c->portState <= PTP_SLAVE ? state_names[c->portState] : "UNKNOWN";
+    s->health = dashboard_health(c);
+    s->offset = c->offsetFromMaster;
+    s->delay = c->meanPathDelay;
+    s->drift = c->observedDrift;
+    s->updates = c->servoUpdates;
+    s->steps = c->clockSteps;
+    s->state_changes = c->stateChanges;
+    s->gaps = c->syncSequenceGaps;
+    memcpy(s->grandmaster, ds->parentDS.grandmasterIdentity, sizeof(s->grandmaster));
+    s->gm_class = ds->parentDS.grandmasterClockQuality.clockClass;
+    s->steps_removed = ds->currentDS.stepsRemoved;
+    s->utc_offset = ds->timePropertiesDS.currentUtcOffset;
+    s->utc_valid = ds->timePropertiesDS.currentUtcOffsetValid;
+    s->domain = ds->defaultDS.domainNumber;
+}
+
+/**
+ * Charts get the last value of every frame, servo updates come at the sync
+ * rate so none is missed below 10 syncs per second. The state is followed
+ * while hidden too, the charts are complete when shown.
+ */
+static void dashboard_thread(void const *argument)
+{
+    dash_state_t state;
+    uint32_t start, elapsed, pixels;
+
+    for (;;) {
+        start = osKernelSysTick();
+
+        dashboard_snapshot(&state);
+        dash_update(&dashb.dash, &state);
+
+        if (dashb.shown) {
+            if (dashb.invalidate) {
+                dashb.invalidate = 0;
+                dash_invalidate(&dashb.dash);
+            }
+
+            pixels = dash_render(&dashb.dash, DASHBOARD_FRAME_PIXELS);
+
+            if (pixels > 0) {
+                elapsed = osKernelSysTick() - start;
+                dashb.frames++;
+                dashb.pixels += pixels;
+                if (pixels > dashb.max_pixels) {
+                    dashb.max_pixels = pixels;
+                }
+                if (elapsed > dashb.max_ms) {
+                    dashb.max_ms = elapsed;
+                }
+                if (elapsed >= DASHBOARD_FRAME_MS) {
+                    dashb.late++;
+                }
+            }
+        }
+
+        elapsed = osKernelSysTick() - start;
+        osDelay(elapsed < DASHBOARD_FRAME_MS ? DASHBOARD_FRAME_MS - elapsed : 1);
+    }
+}
+
+void dashboard_init(void)
+{
+    dash_fb_t fb;
+
+    fb.pixels = (uint32_t *)DASHBOARD_FB_ADDR;
+    fb.width = BSP_LCD_GetXSize();
+    fb.height = BSP_LCD_GetYSize();
+    fb.stride = fb.width;
+
+    if (fb.width != DASH_WIDTH || fb.height != DASH_HEIGHT) {
+        LOG_ERR("DASH: layout is for %ux%u", DASH_WIDTH, DASH_HEIGHT);
+        return;
+    }
+
+    dash_init(&dashb.dash, &fb);
+
+    /* ConfigLayer enables the layer, it stays off until shown */
+    BSP_LCD_LayerDefaultInit(DASHBOARD_LAYER, DASHBOARD_FB_ADDR);
+    BSP_LCD_SetLayerVisible(DASHBOARD_LAYER, DISABLE);
+
+    osThreadDef(DASH, dashboard_thread, osPriorityLow, 0, configMINIMAL_STACK_SIZE * 4);
+    dashb.threadid = osThreadCreate(osThread(DASH), NULL);
+
+    if (dashb.threadid == NULL) {
+        LOG_ERR("DASH: failed to create task");
+    }
+}
+
+void dashboard_show(uint8_t on)
+{
+    if (dashb.threadid == NULL || on == dashb.shown) {
+        return;
+    }
+
+    if (on) {
+        /* Drawn from scratch, the layer was not updated while hidden */
+        dashb.invalidate = 1;
+        dashb.shown = 1;
+        BSP_LCD_SetLayerVisible(DASHBOARD_LAYER, ENABLE);
+        BSP_LCD_SetLayerVisible(LOG_LAYER, DISABLE);
+    } else {
+        dashb.shown = 0;
+        BSP_LCD_SetLayerVisible(LOG_LAYER, ENABLE);
+        BSP_LCD_SetLayerVisible(DASHBOARD_LAYER, DISABLE);
+    }
+}
+
+void dashboard_stats(void)
+{
+    LOG_PRINT("\t%s, frame %ums, budget %u pixels",
+              dashb.threadid == NULL ? "not running" : dashb.shown ? "shown" : "hidden",
+              DASHBOARD_FRAME_MS, DASHBOARD_FRAME_PIXELS);
+    LOG_PRINT("\tframes drawn: %lu, pixels: %lu avg, %lu max",
+              (unsigned long)dashb.frames,
+              (unsigned long)(dashb.frames ? dashb.pixels / dashb.frames : 0),
+              (unsigned long)dashb.max_pixels);
+    LOG_PRINT("\tframe time: %lums max, late: %lu",
+              (unsigned long)dashb.max_ms, (unsigned long)dashb.late);
+}
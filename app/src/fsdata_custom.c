@@ -1,3 +1,4 @@
+/* Generated by tools/makefsdata.py from Fs/, do not edit */
 #include "lwip/apps/fs.h"
 #include "lwip/def.h"
 
@@ -5,212 +6,927 @@
 #define file_NULL (struct fsdata_file *) NULL
 
 
-static const unsigned int dummy_align__STM32F7xx_files_logo_jpg = 0;
-static const unsigned char data__STM32F7xx_files_logo_jpg[] = {
-/* /STM32F7xx_files/logo.jpg (26 chars) */
-0x2f,0x53,0x54,0x4d,0x33,0x32,0x46,0x37,0x78,0x78,0x5f,0x66,0x69,0x6c,0x65,0x73,
-0x2f,0x6c,0x6f,0x67,0x6f,0x2e,0x6a,0x70,0x67,0x00,0x00,0x00,
+static const unsigned int dummy_align__404_html = 0;
+static const unsigned char data__404_html[] = {
+/* /404.html (10 chars) */
+0x2f,0x34,0x30,0x34,0x2e,0x68,0x74,0x6d,0x6c,0x00,0x00,0x00,
 
 /* HTTP header */
-/* "HTTP/1.0 200 OK
-" (17 bytes) */
+/* "HTTP/1.0 404 File not found" (29 bytes) */
+0x48,0x54,0x54,0x50,0x2f,0x31,0x2e,0x30,0x20,0x34,0x30,0x34,0x20,0x46,0x69,0x6c,
+0x65,0x20,0x6e,0x6f,0x74,0x20,0x66,0x6f,0x75,0x6e,0x64,0x0d,0x0a,
+/* "Server: disco-ptp" (19 bytes) */
+0x53,0x65,0x72,0x76,0x65,0x72,0x3a,0x20,0x64,0x69,0x73,0x63,0x6f,0x2d,0x70,0x74,
+0x70,0x0d,0x0a,
+/* "Content-Type: text/html" (25 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x54,0x79,0x70,0x65,0x3a,0x20,0x74,0x65,
+0x78,0x74,0x2f,0x68,0x74,0x6d,0x6c,0x0d,0x0a,
+/* "Content-Length: 1088" (22 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x4c,0x65,0x6e,0x67,0x74,0x68,0x3a,0x20,
+0x31,0x30,0x38,0x38,0x0d,0x0a,
+/* "" (2 bytes) */
+0x0d,0x0a,
+/* raw file data (1088 bytes) */
+0x3c,0x21,0x44,0x4f,0x43,0x54,0x59,0x50,0x45,0x20,0x48,0x54,0x4d,0x4c,0x20,0x50,
+0x55,0x42,0x4c,0x49,0x43,0x20,0x22,0x2d,0x2f,0x2f,0x57,0x33,0x43,0x2f,0x2f,0x44,
+0x54,0x44,0x20,0x48,0x54,0x4d,0x4c,0x20,0x34,0x2e,0x30,0x31,0x20,0x54,0x72,0x61,
+0x6e,0x73,0x69,0x74,0x69,0x6f,0x6e,0x61,0x6c,0x2f,0x2f,0x45,0x4e,0x22,0x3e,0x0a,
+0x3c,0x68,0x74,0x6d,0x6c,0x3e,0x3c,0x68,0x65,0x61,0x64,0x3e,0x3c,0x74,0x69,0x74,
+0x6c,0x65,0x3e,0x53,0x54,0x4d,0x33,0x32,0x46,0x37,0x78,0x78,0x3c,0x2f,0x74,0x69,
+0x74,0x6c,0x65,0x3e,0x3c,0x2f,0x68,0x65,0x61,0x64,0x3e,0x0a,0x3c,0x62,0x6f,0x64,
+0x79,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,
+0x62,0x6c,0x61,0x63,0x6b,0x3b,0x20,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,
+0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x77,0x68,0x69,0x74,0x65,0x3b,0x22,
+0x3e,0x0a,0x3c,0x74,0x61,0x62,0x6c,0x65,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,
+0x31,0x30,0x30,0x25,0x22,0x3e,0x0a,0x3c,0x74,0x62,0x6f,0x64,0x79,0x3e,0x0a,0x3c,
+0x74,0x72,0x20,0x76,0x61,0x6c,0x69,0x67,0x6e,0x3d,0x22,0x74,0x6f,0x70,0x22,0x3e,
+0x0a,0x3c,0x74,0x64,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x38,0x30,0x22,0x3e,
+0x3c,0x62,0x72,0x3e,0x0a,0x3c,0x64,0x69,0x76,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,
+0x22,0x74,0x65,0x78,0x74,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,0x20,0x63,0x65,0x6e,
+0x74,0x65,0x72,0x3b,0x22,0x3e,0x3c,0x69,0x6d,0x67,0x20,0x73,0x74,0x79,0x6c,0x65,
+0x3d,0x22,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x39,0x36,0x70,0x78,0x3b,0x20,0x68,
+0x65,0x69,0x67,0x68,0x74,0x3a,0x20,0x36,0x38,0x70,0x78,0x3b,0x22,0x20,0x61,0x6c,
+0x74,0x3d,0x22,0x53,0x54,0x20,0x6c,0x6f,0x67,0x6f,0x22,0x20,0x73,0x72,0x63,0x3d,
+0x22,0x53,0x54,0x4d,0x33,0x32,0x46,0x37,0x78,0x78,0x5f,0x66,0x69,0x6c,0x65,0x73,
+0x2f,0x6c,0x6f,0x67,0x6f,0x2e,0x6a,0x70,0x67,0x22,0x3e,0x3c,0x2f,0x64,0x69,0x76,
+0x3e,0x0a,0x3c,0x2f,0x74,0x64,0x3e,0x0a,0x3c,0x74,0x64,0x20,0x77,0x69,0x64,0x74,
+0x68,0x3d,0x22,0x35,0x30,0x30,0x22,0x3e,0x0a,0x3c,0x68,0x31,0x3e,0x3c,0x73,0x6d,
+0x61,0x6c,0x6c,0x3e,0x3c,0x73,0x6d,0x61,0x6c,0x6c,0x3e,0x3c,0x73,0x6d,0x61,0x6c,
+0x6c,0x3e,0x3c,0x73,0x6d,0x61,0x6c,0x6c,0x3e,0x3c,0x62,0x69,0x67,0x3e,0x3c,0x62,
+0x69,0x67,0x3e,0x3c,0x62,0x69,0x67,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,
+0x6f,0x6e,0x74,0x2d,0x77,0x65,0x69,0x67,0x68,0x74,0x3a,0x20,0x62,0x6f,0x6c,0x64,
+0x3b,0x22,0x3e,0x3c,0x62,0x69,0x67,0x3e,0x3c,0x73,0x74,0x72,0x6f,0x6e,0x67,0x3e,
+0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,
+0x74,0x2d,0x73,0x74,0x79,0x6c,0x65,0x3a,0x20,0x69,0x74,0x61,0x6c,0x69,0x63,0x3b,
+0x22,0x3e,0x53,0x54,0x4d,0x33,0x32,0x46,0x37,0x78,0x78,0x20,0x57,0x65,0x62,0x73,
+0x65,0x72,0x76,0x65,0x72,0x20,0x44,0x65,0x6d,0x6f,0x3c,0x2f,0x73,0x70,0x61,0x6e,
+0x3e,0x3c,0x2f,0x73,0x74,0x72,0x6f,0x6e,0x67,0x3e,0x3c,0x2f,0x62,0x69,0x67,0x3e,
+0x3c,0x2f,0x62,0x69,0x67,0x3e,0x3c,0x2f,0x62,0x69,0x67,0x3e,0x3c,0x2f,0x62,0x69,
+0x67,0x3e,0x3c,0x2f,0x73,0x6d,0x61,0x6c,0x6c,0x3e,0x3c,0x2f,0x73,0x6d,0x61,0x6c,
+0x6c,0x3e,0x3c,0x2f,0x73,0x6d,0x61,0x6c,0x6c,0x3e,0x3c,0x2f,0x73,0x6d,0x61,0x6c,
+0x6c,0x3e,0x0a,0x3c,0x73,0x6d,0x61,0x6c,0x6c,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,
+0x22,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x20,0x56,0x65,
+0x72,0x64,0x61,0x6e,0x61,0x3b,0x22,0x3e,0x3c,0x73,0x6d,0x61,0x6c,0x6c,0x3e,0x3c,
+0x62,0x69,0x67,0x3e,0x3c,0x62,0x69,0x67,0x3e,0x3c,0x62,0x69,0x67,0x3e,0x3c,0x62,
+0x69,0x67,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x77,
+0x65,0x69,0x67,0x68,0x74,0x3a,0x20,0x62,0x6f,0x6c,0x64,0x3b,0x20,0x63,0x6f,0x6c,
+0x6f,0x72,0x3a,0x20,0x72,0x67,0x62,0x28,0x35,0x31,0x2c,0x20,0x35,0x31,0x2c,0x20,
+0x32,0x35,0x35,0x29,0x3b,0x22,0x3e,0x3c,0x62,0x69,0x67,0x3e,0x3c,0x73,0x74,0x72,
+0x6f,0x6e,0x67,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,
+0x22,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x74,0x79,0x6c,0x65,0x3a,0x20,0x69,0x74,0x61,
+0x6c,0x69,0x63,0x3b,0x22,0x3e,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x73,
+0x74,0x72,0x6f,0x6e,0x67,0x3e,0x3c,0x2f,0x62,0x69,0x67,0x3e,0x3c,0x73,0x70,0x61,
+0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,
+0x72,0x67,0x62,0x28,0x35,0x31,0x2c,0x20,0x35,0x31,0x2c,0x20,0x32,0x35,0x35,0x29,
+0x3b,0x22,0x3e,0x3c,0x62,0x72,0x3e,0x0a,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,
+0x2f,0x62,0x69,0x67,0x3e,0x3c,0x2f,0x62,0x69,0x67,0x3e,0x3c,0x2f,0x62,0x69,0x67,
+0x3e,0x3c,0x2f,0x62,0x69,0x67,0x3e,0x3c,0x2f,0x73,0x6d,0x61,0x6c,0x6c,0x3e,0x3c,
+0x2f,0x73,0x6d,0x61,0x6c,0x6c,0x3e,0x3c,0x2f,0x68,0x31,0x3e,0x0a,0x3c,0x68,0x32,
+0x3e,0x34,0x30,0x34,0x20,0x2d,0x20,0x50,0x61,0x67,0x65,0x20,0x6e,0x6f,0x74,0x20,
+0x66,0x6f,0x75,0x6e,0x64,0x3c,0x2f,0x68,0x32,0x3e,0x0a,0x3c,0x70,0x3e,0x3c,0x73,
+0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,
+0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x20,0x54,0x69,0x6d,0x65,0x73,0x20,0x4e,0x65,
+0x77,0x20,0x52,0x6f,0x6d,0x61,0x6e,0x2c,0x54,0x69,0x6d,0x65,0x73,0x2c,0x73,0x65,
+0x72,0x69,0x66,0x3b,0x22,0x3e,0x20,0x53,0x6f,0x72,0x72,0x79,0x2c,0x0a,0x74,0x68,
+0x65,0x20,0x70,0x61,0x67,0x65,0x20,0x79,0x6f,0x75,0x20,0x61,0x72,0x65,0x20,0x72,
+0x65,0x71,0x75,0x65,0x73,0x74,0x69,0x6e,0x67,0x20,0x77,0x61,0x73,0x20,0x6e,0x6f,
+0x74,0x20,0x66,0x6f,0x75,0x6e,0x64,0x20,0x6f,0x6e,0x20,0x74,0x68,0x69,0x73,0x20,
+0x73,0x65,0x72,0x76,0x65,0x72,0x2e,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x20,0x3c,
+0x2f,0x70,0x3e,0x0a,0x3c,0x2f,0x74,0x64,0x3e,0x0a,0x3c,0x2f,0x74,0x72,0x3e,0x0a,
+0x3c,0x2f,0x74,0x62,0x6f,0x64,0x79,0x3e,0x0a,0x3c,0x2f,0x74,0x61,0x62,0x6c,0x65,
+0x3e,0x0a,0x3c,0x2f,0x62,0x6f,0x64,0x79,0x3e,0x3c,0x2f,0x68,0x74,0x6d,0x6c,0x3e,};
+
+
+static const unsigned int dummy_align__STM32F7xx_html = 0;
+static const unsigned char data__STM32F7xx_html[] = {
+/* /STM32F7xx.html (16 chars) */
+0x2f,0x53,0x54,0x4d,0x33,0x32,0x46,0x37,0x78,0x78,0x2e,0x68,0x74,0x6d,0x6c,0x00,
+
+/* HTTP header */
+/* "HTTP/1.0 200 OK" (17 bytes) */
 0x48,0x54,0x54,0x50,0x2f,0x31,0x2e,0x30,0x20,0x32,0x30,0x30,0x20,0x4f,0x4b,0x0d,
 0x0a,
-/* "Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)
-" (63 bytes) */
-0x53,0x65,0x72,0x76,0x65,0x72,0x3a,0x20,0x6c,0x77,0x49,0x50,0x2f,0x31,0x2e,0x33,
-0x2e,0x31,0x20,0x28,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x73,0x61,0x76,0x61,0x6e,
+/* "Server: disco-ptp" (19 bytes) */
+0x53,0x65,0x72,0x76,0x65,0x72,0x3a,0x20,0x64,0x69,0x73,0x63,0x6f,0x2d,0x70,0x74,
+0x70,0x0d,0x0a,
+/* "Content-Type: text/html" (25 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x54,0x79,0x70,0x65,0x3a,0x20,0x74,0x65,
+0x78,0x74,0x2f,0x68,0x74,0x6d,0x6c,0x0d,0x0a,
+/* "Content-Length: 9193" (22 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x4c,0x65,0x6e,0x67,0x74,0x68,0x3a,0x20,
+0x39,0x31,0x39,0x33,0x0d,0x0a,
+/* "ETag: "8edcb230"" (18 bytes) */
+0x45,0x54,0x61,0x67,0x3a,0x20,0x22,0x38,0x65,0x64,0x63,0x62,0x32,0x33,0x30,0x22,
+0x0d,0x0a,
+/* "Cache-Control: no-cache" (25 bytes) */
+0x43,0x61,0x63,0x68,0x65,0x2d,0x43,0x6f,0x6e,0x74,0x72,0x6f,0x6c,0x3a,0x20,0x6e,
+0x6f,0x2d,0x63,0x61,0x63,0x68,0x65,0x0d,0x0a,
+/* "Vary: Accept-Encoding" (23 bytes) */
+0x56,0x61,0x72,0x79,0x3a,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2d,0x45,0x6e,0x63,
+0x6f,0x64,0x69,0x6e,0x67,0x0d,0x0a,
+/* "" (2 bytes) */
+0x0d,0x0a,
+/* raw file data (9193 bytes) */
+0x3c,0x21,0x44,0x4f,0x43,0x54,0x59,0x50,0x45,0x20,0x48,0x54,0x4d,0x4c,0x20,0x50,
+0x55,0x42,0x4c,0x49,0x43,0x20,0x22,0x2d,0x2f,0x2f,0x57,0x33,0x43,0x2f,0x2f,0x44,
+0x54,0x44,0x20,0x48,0x54,0x4d,0x4c,0x20,0x34,0x2e,0x30,0x31,0x20,0x54,0x72,0x61,
+0x6e,0x73,0x69,0x74,0x69,0x6f,0x6e,0x61,0x6c,0x2f,0x2f,0x45,0x4e,0x22,0x3e,0x0a,
+0x3c,0x68,0x74,0x6d,0x6c,0x20,0x78,0x6d,0x6c,0x6e,0x73,0x3a,0x76,0x3d,0x22,0x75,
+0x72,0x6e,0x3a,0x73,0x63,0x68,0x65,0x6d,0x61,0x73,0x2d,0x6d,0x69,0x63,0x72,0x6f,
+0x73,0x6f,0x66,0x74,0x2d,0x63,0x6f,0x6d,0x3a,0x76,0x6d,0x6c,0x22,0x20,0x78,0x6d,
+0x6c,0x6e,0x73,0x3a,0x6f,0x3d,0x22,0x75,0x72,0x6e,0x3a,0x73,0x63,0x68,0x65,0x6d,
+0x61,0x73,0x2d,0x6d,0x69,0x63,0x72,0x6f,0x73,0x6f,0x66,0x74,0x2d,0x63,0x6f,0x6d,
+0x3a,0x6f,0x66,0x66,0x69,0x63,0x65,0x3a,0x6f,0x66,0x66,0x69,0x63,0x65,0x22,0x20,
+0x78,0x6d,0x6c,0x6e,0x73,0x3a,0x77,0x3d,0x22,0x75,0x72,0x6e,0x3a,0x73,0x63,0x68,
+0x65,0x6d,0x61,0x73,0x2d,0x6d,0x69,0x63,0x72,0x6f,0x73,0x6f,0x66,0x74,0x2d,0x63,
+0x6f,0x6d,0x3a,0x6f,0x66,0x66,0x69,0x63,0x65,0x3a,0x77,0x6f,0x72,0x64,0x22,0x20,
+0x78,0x6d,0x6c,0x6e,0x73,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,0x77,
+0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,0x54,0x52,0x2f,0x52,0x45,0x43,0x2d,
+0x68,0x74,0x6d,0x6c,0x34,0x30,0x22,0x3e,0x3c,0x68,0x65,0x61,0x64,0x3e,0x0a,0x3c,
+0x6d,0x65,0x74,0x61,0x20,0x68,0x74,0x74,0x70,0x2d,0x65,0x71,0x75,0x69,0x76,0x3d,
+0x22,0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x54,0x79,0x70,0x65,0x22,0x20,0x63,
+0x6f,0x6e,0x74,0x65,0x6e,0x74,0x3d,0x22,0x74,0x65,0x78,0x74,0x2f,0x68,0x74,0x6d,
+0x6c,0x3b,0x20,0x63,0x68,0x61,0x72,0x73,0x65,0x74,0x3d,0x69,0x73,0x6f,0x2d,0x38,
+0x38,0x35,0x39,0x2d,0x31,0x22,0x3e,0x0a,0x3c,0x6c,0x69,0x6e,0x6b,0x20,0x72,0x65,
+0x6c,0x3d,0x22,0x46,0x69,0x6c,0x65,0x2d,0x4c,0x69,0x73,0x74,0x22,0x20,0x68,0x72,
+0x65,0x66,0x3d,0x22,0x53,0x54,0x4d,0x33,0x32,0x46,0x37,0x78,0x78,0x5f,0x66,0x69,
+0x6c,0x65,0x73,0x2f,0x66,0x69,0x6c,0x65,0x6c,0x69,0x73,0x74,0x2e,0x78,0x6d,0x6c,
+0x22,0x3e,0x0a,0x3c,0x6c,0x69,0x6e,0x6b,0x20,0x72,0x65,0x6c,0x3d,0x22,0x45,0x64,
+0x69,0x74,0x2d,0x54,0x69,0x6d,0x65,0x2d,0x44,0x61,0x74,0x61,0x22,0x20,0x68,0x72,
+0x65,0x66,0x3d,0x22,0x53,0x54,0x4d,0x33,0x32,0x46,0x37,0x78,0x78,0x5f,0x66,0x69,
+0x6c,0x65,0x73,0x2f,0x65,0x64,0x69,0x74,0x64,0x61,0x74,0x61,0x2e,0x6d,0x73,0x6f,
+0x22,0x3e,0x3c,0x74,0x69,0x74,0x6c,0x65,0x3e,0x53,0x54,0x4d,0x33,0x32,0x46,0x37,
+0x78,0x78,0x3c,0x2f,0x74,0x69,0x74,0x6c,0x65,0x3e,0x0a,0x0a,0x3c,0x2f,0x68,0x65,
+0x61,0x64,0x3e,0x0a,0x3c,0x62,0x6f,0x64,0x79,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,
+0x22,0x22,0x20,0x6c,0x61,0x6e,0x67,0x3d,0x22,0x45,0x4e,0x2d,0x55,0x53,0x22,0x20,
+0x6c,0x69,0x6e,0x6b,0x3d,0x22,0x62,0x6c,0x75,0x65,0x22,0x20,0x76,0x6c,0x69,0x6e,
+0x6b,0x3d,0x22,0x62,0x6c,0x75,0x65,0x22,0x3e,0x0a,0x3c,0x64,0x69,0x76,0x20,0x63,
+0x6c,0x61,0x73,0x73,0x3d,0x22,0x53,0x65,0x63,0x74,0x69,0x6f,0x6e,0x31,0x22,0x3e,
+0x0a,0x3c,0x64,0x69,0x76,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x6d,0x61,0x72,
+0x67,0x69,0x6e,0x2d,0x6c,0x65,0x66,0x74,0x3a,0x20,0x33,0x30,0x70,0x74,0x3b,0x22,
+0x3e,0x0a,0x3c,0x70,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x4d,0x73,0x6f,0x4e,
+0x6f,0x72,0x6d,0x61,0x6c,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x74,0x65,
+0x78,0x74,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,0x20,0x63,0x65,0x6e,0x74,0x65,0x72,
+0x3b,0x22,0x20,0x61,0x6c,0x69,0x67,0x6e,0x3d,0x22,0x63,0x65,0x6e,0x74,0x65,0x72,
+0x22,0x3e,0x3c,0x69,0x6d,0x67,0x20,0x61,0x6c,0x74,0x3d,0x22,0x22,0x20,0x69,0x64,
+0x3d,0x22,0x5f,0x78,0x30,0x30,0x30,0x30,0x5f,0x69,0x31,0x30,0x32,0x35,0x22,0x20,
+0x73,0x72,0x63,0x3d,0x22,0x53,0x54,0x4d,0x33,0x32,0x46,0x37,0x78,0x78,0x5f,0x66,
+0x69,0x6c,0x65,0x73,0x2f,0x53,0x54,0x2e,0x67,0x69,0x66,0x22,0x20,0x73,0x74,0x79,
+0x6c,0x65,0x3d,0x22,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,0x20,0x30,0x70,0x78,0x20,
+0x73,0x6f,0x6c,0x69,0x64,0x20,0x3b,0x20,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x37,
+0x36,0x36,0x70,0x78,0x3b,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x20,0x35,0x38,
+0x70,0x78,0x3b,0x22,0x3e,0x3c,0x62,0x3e,0x3c,0x69,0x3e,0x3c,0x73,0x70,0x61,0x6e,
+0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,
+0x65,0x3a,0x20,0x32,0x34,0x70,0x74,0x3b,0x22,0x3e,0x3c,0x62,0x72,0x3e,0x0a,0x3c,
+0x73,0x74,0x72,0x6f,0x6e,0x67,0x3e,0x53,0x54,0x4d,0x33,0x32,0x46,0x37,0x78,0x78,
+0x20,0x57,0x65,0x62,0x73,0x65,0x72,0x76,0x65,0x72,0x20,0x44,0x65,0x6d,0x6f,0x3c,
+0x2f,0x73,0x74,0x72,0x6f,0x6e,0x67,0x3e,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,
+0x2f,0x69,0x3e,0x3c,0x2f,0x62,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,0x74,0x79,
+0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,
+0x33,0x2e,0x35,0x70,0x74,0x3b,0x22,0x3e,0x20,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,
+0x3c,0x62,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,
+0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,0x38,0x70,0x74,0x3b,
+0x20,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x20,0x56,0x65,
+0x72,0x64,0x61,0x6e,0x61,0x3b,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x72,0x67,
+0x62,0x28,0x35,0x31,0x2c,0x20,0x35,0x31,0x2c,0x20,0x32,0x35,0x35,0x29,0x3b,0x22,
+0x3e,0x3c,0x62,0x72,0x3e,0x0a,0x42,0x61,0x73,0x65,0x64,0x20,0x6f,0x6e,0x20,0x74,
+0x68,0x65,0x20,0x6c,0x77,0x49,0x50,0x20,0x54,0x43,0x50,0x2f,0x49,0x50,0x20,0x73,
+0x74,0x61,0x63,0x6b,0x20,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x62,0x3e,
+0x3c,0x2f,0x70,0x3e,0x0a,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
+0x22,0x4d,0x73,0x6f,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x22,0x20,0x73,0x74,0x79,0x6c,
+0x65,0x3d,0x22,0x74,0x65,0x78,0x74,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,0x20,0x63,
+0x65,0x6e,0x74,0x65,0x72,0x3b,0x22,0x20,0x61,0x6c,0x69,0x67,0x6e,0x3d,0x22,0x63,
+0x65,0x6e,0x74,0x65,0x72,0x22,0x3e,0x0a,0x3c,0x68,0x72,0x20,0x61,0x6c,0x69,0x67,
+0x6e,0x3d,0x22,0x63,0x65,0x6e,0x74,0x65,0x72,0x22,0x20,0x73,0x69,0x7a,0x65,0x3d,
+0x22,0x32,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x31,0x30,0x30,0x25,0x22,
+0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x3c,0x64,0x69,0x76,0x20,0x61,0x6c,0x69,
+0x67,0x6e,0x3d,0x22,0x63,0x65,0x6e,0x74,0x65,0x72,0x22,0x3e,0x3c,0x73,0x70,0x61,
+0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x77,0x65,
+0x69,0x67,0x68,0x74,0x3a,0x20,0x62,0x6f,0x6c,0x64,0x3b,0x22,0x3e,0x3c,0x2f,0x73,
+0x70,0x61,0x6e,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,
+0x22,0x66,0x6f,0x6e,0x74,0x2d,0x77,0x65,0x69,0x67,0x68,0x74,0x3a,0x20,0x62,0x6f,
+0x6c,0x64,0x3b,0x22,0x3e,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x0a,0x3c,0x74,0x61,
+0x62,0x6c,0x65,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x77,0x69,0x64,0x74,0x68,
+0x3a,0x20,0x39,0x36,0x31,0x70,0x78,0x3b,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,
+0x20,0x33,0x30,0x70,0x78,0x3b,0x22,0x20,0x62,0x6f,0x72,0x64,0x65,0x72,0x3d,0x22,
+0x31,0x22,0x20,0x63,0x65,0x6c,0x6c,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3d,0x22,
+0x32,0x22,0x20,0x63,0x65,0x6c,0x6c,0x73,0x70,0x61,0x63,0x69,0x6e,0x67,0x3d,0x22,
+0x32,0x22,0x3e,0x0a,0x3c,0x74,0x62,0x6f,0x64,0x79,0x3e,0x0a,0x3c,0x74,0x72,0x3e,
+0x0a,0x3c,0x74,0x64,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,
+0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x20,0x56,0x65,0x72,0x64,0x61,0x6e,0x61,
+0x3b,0x20,0x66,0x6f,0x6e,0x74,0x2d,0x77,0x65,0x69,0x67,0x68,0x74,0x3a,0x20,0x62,
+0x6f,0x6c,0x64,0x3b,0x20,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x74,0x79,0x6c,0x65,0x3a,
+0x20,0x69,0x74,0x61,0x6c,0x69,0x63,0x3b,0x20,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,
+0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x72,0x67,0x62,0x28,0x35,
+0x31,0x2c,0x20,0x35,0x31,0x2c,0x20,0x32,0x35,0x35,0x29,0x3b,0x20,0x74,0x65,0x78,
+0x74,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,0x20,0x63,0x65,0x6e,0x74,0x65,0x72,0x3b,
+0x22,0x3e,0x3c,0x73,0x6d,0x61,0x6c,0x6c,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,
+0x3d,0x22,0x2f,0x53,0x54,0x4d,0x33,0x32,0x46,0x37,0x78,0x78,0x2e,0x68,0x74,0x6d,
+0x6c,0x22,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,
+0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x77,0x68,0x69,0x74,0x65,0x3b,0x22,0x3e,0x48,
+0x6f,0x6d,0x65,0x0a,0x70,0x61,0x67,0x65,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,
+0x2f,0x61,0x3e,0x3c,0x2f,0x73,0x6d,0x61,0x6c,0x6c,0x3e,0x3c,0x2f,0x74,0x64,0x3e,
+0x0a,0x3c,0x74,0x64,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,
+0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x20,0x56,0x65,0x72,0x64,0x61,0x6e,0x61,
+0x3b,0x20,0x66,0x6f,0x6e,0x74,0x2d,0x77,0x65,0x69,0x67,0x68,0x74,0x3a,0x20,0x62,
+0x6f,0x6c,0x64,0x3b,0x20,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x74,0x79,0x6c,0x65,0x3a,
+0x20,0x69,0x74,0x61,0x6c,0x69,0x63,0x3b,0x20,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,
+0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x72,0x67,0x62,0x28,0x35,
+0x31,0x2c,0x20,0x35,0x31,0x2c,0x20,0x32,0x35,0x35,0x29,0x3b,0x20,0x74,0x65,0x78,
+0x74,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,0x20,0x63,0x65,0x6e,0x74,0x65,0x72,0x3b,
+0x22,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x53,0x54,0x4d,0x33,0x32,
+0x46,0x37,0x78,0x78,0x41,0x44,0x43,0x2e,0x68,0x74,0x6d,0x6c,0x22,0x3e,0x3c,0x73,
+0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,
+0x77,0x65,0x69,0x67,0x68,0x74,0x3a,0x20,0x62,0x6f,0x6c,0x64,0x3b,0x22,0x3e,0x3c,
+0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x61,0x3e,0x3c,0x73,0x6d,0x61,0x6c,0x6c,
+0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x2f,0x53,0x54,0x4d,0x33,0x32,
+0x46,0x37,0x78,0x78,0x54,0x41,0x53,0x4b,0x53,0x2e,0x68,0x74,0x6d,0x6c,0x22,0x3e,
+0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x63,0x6f,0x6c,
+0x6f,0x72,0x3a,0x20,0x77,0x68,0x69,0x74,0x65,0x3b,0x22,0x3e,0x4c,0x69,0x73,0x74,
+0x0a,0x6f,0x66,0x20,0x74,0x61,0x73,0x6b,0x73,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,
+0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x73,0x6d,0x61,0x6c,0x6c,0x3e,0x3c,0x2f,0x74,0x64,
+0x3e,0x0a,0x3c,0x2f,0x74,0x72,0x3e,0x0a,0x3c,0x2f,0x74,0x62,0x6f,0x64,0x79,0x3e,
+0x0a,0x3c,0x2f,0x74,0x61,0x62,0x6c,0x65,0x3e,0x0a,0x3c,0x2f,0x64,0x69,0x76,0x3e,
+0x0a,0x3c,0x64,0x69,0x76,0x20,0x61,0x6c,0x69,0x67,0x6e,0x3d,0x22,0x63,0x65,0x6e,
+0x74,0x65,0x72,0x22,0x3e,0x0a,0x3c,0x74,0x61,0x62,0x6c,0x65,0x20,0x63,0x6c,0x61,
+0x73,0x73,0x3d,0x22,0x4d,0x73,0x6f,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x54,0x61,0x62,
+0x6c,0x65,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x62,0x61,0x63,0x6b,0x67,
+0x72,0x6f,0x75,0x6e,0x64,0x3a,0x20,0x77,0x68,0x69,0x74,0x65,0x20,0x6e,0x6f,0x6e,
+0x65,0x20,0x72,0x65,0x70,0x65,0x61,0x74,0x20,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x20,
+0x30,0x25,0x20,0x35,0x30,0x25,0x3b,0x20,0x2d,0x6d,0x6f,0x7a,0x2d,0x62,0x61,0x63,
+0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6c,0x69,0x70,0x3a,0x20,0x69,0x6e,
+0x69,0x74,0x69,0x61,0x6c,0x3b,0x20,0x2d,0x6d,0x6f,0x7a,0x2d,0x62,0x61,0x63,0x6b,
+0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x6f,0x72,0x69,0x67,0x69,0x6e,0x3a,0x20,0x69,
+0x6e,0x69,0x74,0x69,0x61,0x6c,0x3b,0x20,0x2d,0x6d,0x6f,0x7a,0x2d,0x62,0x61,0x63,
+0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x2d,0x70,
+0x6f,0x6c,0x69,0x63,0x79,0x3a,0x20,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x3b,0x20,
+0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x35,0x37,0x34,0x2e,0x35,0x70,0x74,0x3b,0x22,
+0x20,0x62,0x6f,0x72,0x64,0x65,0x72,0x3d,0x22,0x30,0x22,0x20,0x63,0x65,0x6c,0x6c,
+0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3d,0x22,0x30,0x22,0x20,0x63,0x65,0x6c,0x6c,
+0x73,0x70,0x61,0x63,0x69,0x6e,0x67,0x3d,0x22,0x30,0x22,0x20,0x77,0x69,0x64,0x74,
+0x68,0x3d,0x22,0x37,0x36,0x36,0x22,0x3e,0x0a,0x3c,0x74,0x62,0x6f,0x64,0x79,0x3e,
+0x0a,0x3c,0x74,0x72,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x22,0x3e,0x0a,0x3c,
+0x74,0x64,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x70,0x61,0x64,0x64,0x69,0x6e,
+0x67,0x3a,0x20,0x30,0x63,0x6d,0x3b,0x22,0x20,0x76,0x61,0x6c,0x69,0x67,0x6e,0x3d,
+0x22,0x74,0x6f,0x70,0x22,0x3e,0x0a,0x3c,0x74,0x61,0x62,0x6c,0x65,0x20,0x63,0x6c,
+0x61,0x73,0x73,0x3d,0x22,0x4d,0x73,0x6f,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x54,0x61,
+0x62,0x6c,0x65,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x77,0x69,0x64,0x74,
+0x68,0x3a,0x20,0x31,0x30,0x30,0x25,0x3b,0x22,0x20,0x62,0x6f,0x72,0x64,0x65,0x72,
+0x3d,0x22,0x30,0x22,0x20,0x63,0x65,0x6c,0x6c,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,
+0x3d,0x22,0x30,0x22,0x20,0x63,0x65,0x6c,0x6c,0x73,0x70,0x61,0x63,0x69,0x6e,0x67,
+0x3d,0x22,0x30,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x31,0x30,0x30,0x25,
+0x22,0x3e,0x0a,0x3c,0x74,0x62,0x6f,0x64,0x79,0x3e,0x0a,0x3c,0x74,0x72,0x20,0x73,
+0x74,0x79,0x6c,0x65,0x3d,0x22,0x22,0x3e,0x0a,0x3c,0x74,0x64,0x20,0x73,0x74,0x79,
+0x6c,0x65,0x3d,0x22,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,0x32,0x2e,0x32,
+0x35,0x70,0x74,0x3b,0x22,0x3e,0x0a,0x3c,0x74,0x61,0x62,0x6c,0x65,0x20,0x62,0x6f,
+0x72,0x64,0x65,0x72,0x3d,0x22,0x30,0x22,0x20,0x63,0x65,0x6c,0x6c,0x70,0x61,0x64,
+0x64,0x69,0x6e,0x67,0x3d,0x22,0x33,0x22,0x20,0x63,0x65,0x6c,0x6c,0x73,0x70,0x61,
+0x63,0x69,0x6e,0x67,0x3d,0x22,0x30,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,
+0x31,0x30,0x30,0x25,0x22,0x3e,0x0a,0x3c,0x74,0x62,0x6f,0x64,0x79,0x3e,0x0a,0x3c,
+0x74,0x72,0x3e,0x0a,0x3c,0x74,0x64,0x20,0x76,0x61,0x6c,0x69,0x67,0x6e,0x3d,0x22,
+0x74,0x6f,0x70,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x37,0x32,0x25,0x22,
+0x3e,0x0a,0x3c,0x68,0x31,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,
+0x65,0x3d,0x22,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x72,0x67,0x62,0x28,0x35,0x31,
+0x2c,0x20,0x35,0x31,0x2c,0x20,0x32,0x35,0x35,0x29,0x3b,0x22,0x3e,0x53,0x54,0x4d,
+0x33,0x32,0x0a,0x46,0x2d,0x37,0x20,0x53,0x65,0x72,0x69,0x65,0x73,0x3c,0x2f,0x73,
+0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x68,0x31,0x3e,0x0a,0x3c,0x70,0x20,0x63,0x6c,0x61,
+0x73,0x73,0x3d,0x22,0x4d,0x73,0x6f,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x22,0x3e,0x3c,
+0x73,0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,
+0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,0x30,0x70,0x74,0x3b,0x20,0x66,0x6f,0x6e,
+0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x20,0x56,0x65,0x72,0x64,0x61,0x6e,
+0x61,0x3b,0x22,0x3e,0x54,0x68,0x65,0x20,0x53,0x54,0x4d,0x33,0x32,0x20,0x46,0x37,
+0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x73,0x20,0x61,0x72,0x65,0x20,0x74,0x68,0x65,
+0x20,0x77,0x6f,0x72,0x6c,0x64,0x27,0x73,0x20,0x66,0x69,0x72,0x73,0x74,0x20,0x41,
+0x52,0x4d,0x20,0x43,0x6f,0x72,0x74,0x65,0x78,0x2d,0x4d,0x37,0x20,0x62,0x61,0x73,
+0x65,0x64,0x20,0x33,0x32,0x2d,0x62,0x69,0x74,0x20,0x6d,0x69,0x63,0x72,0x6f,0x63,
+0x6f,0x6e,0x74,0x72,0x6f,0x6c,0x6c,0x65,0x72,0x73,0x2c,0x20,0x73,0x65,0x74,0x74,
+0x69,0x6e,0x67,0x20,0x74,0x68,0x65,0x20,0x62,0x65,0x6e,0x63,0x68,0x6d,0x61,0x72,
+0x6b,0x20,0x69,0x6e,0x20,0x70,0x65,0x72,0x66,0x6f,0x72,0x6d,0x61,0x6e,0x63,0x65,
+0x2e,0x3c,0x62,0x72,0x3e,0x0a,0x3c,0x62,0x72,0x3e,0x0a,0x54,0x61,0x6b,0x69,0x6e,
+0x67,0x20,0x61,0x64,0x76,0x61,0x6e,0x74,0x61,0x67,0x65,0x20,0x6f,0x66,0x20,0x53,
+0x54,0x27,0x73,0x20,0x41,0x52,0x54,0x20,0x41,0x63,0x63,0x65,0x6c,0x65,0x72,0x61,
+0x74,0x6f,0x72,0x20,0x61,0x73,0x20,0x77,0x65,0x6c,0x6c,0x20,0x61,0x73,0x20,0x61,
+0x6e,0x20,0x4c,0x31,0x20,0x63,0x61,0x63,0x68,0x65,0x2c,0x20,0x74,0x68,0x65,0x20,
+0x53,0x54,0x4d,0x33,0x32,0x20,0x46,0x37,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x73,
+0x20,0x64,0x65,0x6c,0x69,0x76,0x65,0x72,0x20,0x74,0x68,0x65,0x20,0x6d,0x61,0x78,
+0x69,0x6d,0x75,0x6d,0x20,0x74,0x68,0x65,0x6f,0x72,0x65,0x74,0x69,0x63,0x61,0x6c,
+0x20,0x70,0x65,0x72,0x66,0x6f,0x72,0x6d,0x61,0x6e,0x63,0x65,0x20,0x6f,0x66,0x20,
+0x74,0x68,0x65,0x20,0x43,0x6f,0x72,0x74,0x65,0x78,0x2d,0x4d,0x37,0x20,0x6e,0x6f,
+0x20,0x6d,0x61,0x74,0x74,0x65,0x72,0x20,0x77,0x68,0x65,0x74,0x68,0x65,0x72,0x20,
+0x63,0x6f,0x64,0x65,0x20,0x69,0x73,0x20,0x65,0x78,0x65,0x63,0x75,0x74,0x65,0x64,
+0x20,0x66,0x72,0x6f,0x6d,0x20,0x65,0x6d,0x62,0x65,0x64,0x64,0x65,0x64,0x20,0x46,
+0x6c,0x61,0x73,0x68,0x20,0x6f,0x72,0x20,0x65,0x78,0x74,0x65,0x72,0x6e,0x61,0x6c,
+0x20,0x4d,0x65,0x6d,0x6f,0x72,0x79,0x3a,0x20,0x31,0x30,0x30,0x30,0x20,0x43,0x6f,
+0x72,0x65,0x4d,0x61,0x72,0x6b,0x2f,0x34,0x32,0x38,0x20,0x44,0x4d,0x49,0x50,0x53,
+0x20,0x61,0x74,0x20,0x32,0x30,0x30,0x20,0x4d,0x48,0x7a,0x20,0x66,0x43,0x50,0x55,
+0x3c,0x62,0x72,0x3e,0x0a,0x3c,0x62,0x72,0x3e,0x0a,0x3c,0x61,0x20,0x73,0x74,0x79,
+0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x77,0x65,0x69,0x67,0x68,0x74,0x3a,
+0x20,0x62,0x6f,0x6c,0x64,0x3b,0x22,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x68,0x74,
+0x74,0x70,0x3a,0x2f,0x2f,0x77,0x77,0x77,0x2e,0x73,0x74,0x2e,0x63,0x6f,0x6d,0x2f,
+0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2f,0x73,0x74,0x5f,0x63,0x6f,0x6d,0x2f,0x65,
+0x6e,0x2f,0x70,0x72,0x6f,0x64,0x75,0x63,0x74,0x73,0x2f,0x6d,0x69,0x63,0x72,0x6f,
+0x63,0x6f,0x6e,0x74,0x72,0x6f,0x6c,0x6c,0x65,0x72,0x73,0x2f,0x73,0x74,0x6d,0x33,
+0x32,0x2d,0x33,0x32,0x2d,0x62,0x69,0x74,0x2d,0x61,0x72,0x6d,0x2d,0x63,0x6f,0x72,
+0x74,0x65,0x78,0x2d,0x6d,0x63,0x75,0x73,0x2f,0x73,0x74,0x6d,0x33,0x32,0x66,0x37,
+0x2d,0x73,0x65,0x72,0x69,0x65,0x73,0x2e,0x68,0x74,0x6d,0x6c,0x22,0x20,0x74,0x61,
+0x72,0x67,0x65,0x74,0x3d,0x22,0x5f,0x62,0x6c,0x61,0x6e,0x6b,0x22,0x3e,0x54,0x68,
+0x65,0x20,0x53,0x54,0x4d,0x33,0x32,0x46,0x37,0x78,0x78,0x20,0x68,0x6f,0x6d,0x65,
+0x20,0x70,0x61,0x67,0x65,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,
+0x3c,0x2f,0x74,0x64,0x3e,0x0a,0x3c,0x74,0x64,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,
+0x22,0x32,0x25,0x22,0x3e,0x3c,0x2f,0x74,0x64,0x3e,0x0a,0x3c,0x74,0x64,0x20,0x61,
+0x6c,0x69,0x67,0x6e,0x3d,0x22,0x72,0x69,0x67,0x68,0x74,0x22,0x20,0x76,0x61,0x6c,
+0x69,0x67,0x6e,0x3d,0x22,0x74,0x6f,0x70,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,
+0x22,0x32,0x36,0x25,0x22,0x3e,0x3c,0x62,0x72,0x3e,0x0a,0x3c,0x62,0x72,0x3e,0x0a,
+0x3c,0x69,0x6d,0x67,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x77,0x69,0x64,0x74,
+0x68,0x3a,0x20,0x34,0x30,0x30,0x70,0x78,0x3b,0x20,0x68,0x65,0x69,0x67,0x68,0x74,
+0x3a,0x20,0x31,0x38,0x30,0x70,0x78,0x3b,0x22,0x20,0x61,0x6c,0x74,0x3d,0x22,0x22,
+0x20,0x73,0x72,0x63,0x3d,0x22,0x53,0x54,0x4d,0x33,0x32,0x46,0x37,0x78,0x78,0x5f,
+0x66,0x69,0x6c,0x65,0x73,0x2f,0x73,0x74,0x6d,0x33,0x32,0x2e,0x6a,0x70,0x67,0x22,
+0x3e,0x3c,0x2f,0x74,0x64,0x3e,0x0a,0x3c,0x2f,0x74,0x72,0x3e,0x0a,0x3c,0x2f,0x74,
+0x62,0x6f,0x64,0x79,0x3e,0x0a,0x3c,0x2f,0x74,0x61,0x62,0x6c,0x65,0x3e,0x0a,0x3c,
+0x2f,0x74,0x64,0x3e,0x0a,0x3c,0x2f,0x74,0x72,0x3e,0x0a,0x3c,0x74,0x72,0x20,0x73,
+0x74,0x79,0x6c,0x65,0x3d,0x22,0x22,0x3e,0x0a,0x3c,0x74,0x64,0x20,0x73,0x74,0x79,
+0x6c,0x65,0x3d,0x22,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,0x32,0x2e,0x32,
+0x35,0x70,0x74,0x3b,0x22,0x3e,0x0a,0x3c,0x70,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
+0x22,0x4d,0x73,0x6f,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x22,0x3e,0x3c,0x6f,0x3a,0x70,
+0x3e,0x26,0x6e,0x62,0x73,0x70,0x3b,0x3c,0x2f,0x6f,0x3a,0x70,0x3e,0x3c,0x2f,0x70,
+0x3e,0x0a,0x3c,0x2f,0x74,0x64,0x3e,0x0a,0x3c,0x2f,0x74,0x72,0x3e,0x0a,0x3c,0x74,
+0x72,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x22,0x3e,0x0a,0x3c,0x74,0x64,0x20,
+0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,
+0x32,0x2e,0x32,0x35,0x70,0x74,0x3b,0x22,0x20,0x76,0x61,0x6c,0x69,0x67,0x6e,0x3d,
+0x22,0x74,0x6f,0x70,0x22,0x3e,0x0a,0x3c,0x74,0x61,0x62,0x6c,0x65,0x20,0x63,0x6c,
+0x61,0x73,0x73,0x3d,0x22,0x4d,0x73,0x6f,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x54,0x61,
+0x62,0x6c,0x65,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x77,0x69,0x64,0x74,
+0x68,0x3a,0x20,0x35,0x30,0x37,0x2e,0x34,0x70,0x74,0x3b,0x22,0x20,0x62,0x6f,0x72,
+0x64,0x65,0x72,0x3d,0x22,0x30,0x22,0x20,0x63,0x65,0x6c,0x6c,0x70,0x61,0x64,0x64,
+0x69,0x6e,0x67,0x3d,0x22,0x30,0x22,0x20,0x63,0x65,0x6c,0x6c,0x73,0x70,0x61,0x63,
+0x69,0x6e,0x67,0x3d,0x22,0x30,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x36,
+0x37,0x37,0x22,0x3e,0x0a,0x3c,0x74,0x62,0x6f,0x64,0x79,0x3e,0x0a,0x3c,0x74,0x72,
+0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x22,0x3e,0x0a,0x3c,0x74,0x64,0x20,0x73,
+0x74,0x79,0x6c,0x65,0x3d,0x22,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,0x32,
+0x2e,0x32,0x35,0x70,0x74,0x3b,0x20,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,
+0x64,0x3a,0x20,0x72,0x67,0x62,0x28,0x35,0x31,0x2c,0x20,0x35,0x31,0x2c,0x20,0x32,
+0x35,0x35,0x29,0x20,0x6e,0x6f,0x6e,0x65,0x20,0x72,0x65,0x70,0x65,0x61,0x74,0x20,
+0x73,0x63,0x72,0x6f,0x6c,0x6c,0x20,0x30,0x25,0x20,0x35,0x30,0x25,0x3b,0x20,0x2d,
+0x6d,0x6f,0x7a,0x2d,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,
+0x6c,0x69,0x70,0x3a,0x20,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x3b,0x20,0x2d,0x6d,
+0x6f,0x7a,0x2d,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x6f,0x72,
+0x69,0x67,0x69,0x6e,0x3a,0x20,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x3b,0x20,0x2d,
+0x6d,0x6f,0x7a,0x2d,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x69,
+0x6e,0x6c,0x69,0x6e,0x65,0x2d,0x70,0x6f,0x6c,0x69,0x63,0x79,0x3a,0x20,0x69,0x6e,
+0x69,0x74,0x69,0x61,0x6c,0x3b,0x20,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x35,0x30,
+0x34,0x2e,0x32,0x70,0x74,0x3b,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x36,
+0x37,0x32,0x22,0x3e,0x0a,0x3c,0x70,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x4d,
+0x73,0x6f,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x22,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,
+0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x77,0x68,
+0x69,0x74,0x65,0x3b,0x22,0x3e,0x26,0x6e,0x62,0x73,0x70,0x3b,0x3c,0x2f,0x73,0x70,
+0x61,0x6e,0x3e,0x3c,0x73,0x74,0x72,0x6f,0x6e,0x67,0x3e,0x3c,0x73,0x70,0x61,0x6e,
+0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,
+0x69,0x6c,0x79,0x3a,0x20,0x56,0x65,0x72,0x64,0x61,0x6e,0x61,0x3b,0x20,0x63,0x6f,
+0x6c,0x6f,0x72,0x3a,0x20,0x77,0x68,0x69,0x74,0x65,0x3b,0x22,0x3e,0x41,0x62,0x6f,
+0x75,0x74,0x20,0x74,0x68,0x69,0x73,0x0a,0x64,0x65,0x6d,0x6f,0x6e,0x73,0x74,0x72,
+0x61,0x74,0x69,0x6f,0x6e,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x73,0x74,
+0x72,0x6f,0x6e,0x67,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,
+0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x20,0x56,
+0x65,0x72,0x64,0x61,0x6e,0x61,0x3b,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x77,
+0x68,0x69,0x74,0x65,0x3b,0x22,0x3e,0x3c,0x6f,0x3a,0x70,0x3e,0x3c,0x2f,0x6f,0x3a,
+0x70,0x3e,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x70,0x3e,0x0a,0x3c,0x2f,
+0x74,0x64,0x3e,0x0a,0x3c,0x74,0x64,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x62,
+0x6f,0x72,0x64,0x65,0x72,0x3a,0x20,0x6d,0x65,0x64,0x69,0x75,0x6d,0x20,0x6e,0x6f,
+0x6e,0x65,0x20,0x3b,0x20,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,0x30,0x63,
+0x6d,0x3b,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x34,0x22,0x3e,0x0a,0x3c,
+0x70,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x4d,0x73,0x6f,0x4e,0x6f,0x72,0x6d,
+0x61,0x6c,0x22,0x3e,0x26,0x6e,0x62,0x73,0x70,0x3b,0x3c,0x2f,0x70,0x3e,0x0a,0x3c,
+0x2f,0x74,0x64,0x3e,0x0a,0x3c,0x2f,0x74,0x72,0x3e,0x0a,0x3c,0x74,0x72,0x20,0x73,
+0x74,0x79,0x6c,0x65,0x3d,0x22,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x20,0x31,0x31,
+0x2e,0x32,0x35,0x70,0x74,0x3b,0x22,0x3e,0x0a,0x3c,0x74,0x64,0x20,0x73,0x74,0x79,
+0x6c,0x65,0x3d,0x22,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,0x32,0x2e,0x32,
+0x35,0x70,0x74,0x3b,0x20,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x35,0x30,0x34,0x2e,
+0x32,0x70,0x74,0x3b,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x20,0x31,0x31,0x2e,
+0x32,0x35,0x70,0x74,0x3b,0x22,0x20,0x76,0x61,0x6c,0x69,0x67,0x6e,0x3d,0x22,0x74,
+0x6f,0x70,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x36,0x37,0x32,0x22,0x3e,
+0x0a,0x3c,0x70,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x4d,0x73,0x6f,0x4e,0x6f,
+0x72,0x6d,0x61,0x6c,0x22,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,
+0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,0x30,
+0x70,0x74,0x3b,0x20,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,
+0x20,0x56,0x65,0x72,0x64,0x61,0x6e,0x61,0x3b,0x22,0x3e,0x54,0x68,0x69,0x73,0x0a,
+0x77,0x65,0x62,0x73,0x65,0x72,0x76,0x65,0x72,0x20,0x69,0x73,0x20,0x61,0x20,0x70,
+0x61,0x72,0x74,0x20,0x6f,0x66,0x20,0x61,0x20,0x64,0x65,0x6d,0x6f,0x6e,0x73,0x74,
+0x72,0x61,0x74,0x69,0x6f,0x6e,0x20,0x70,0x61,0x63,0x6b,0x61,0x67,0x65,0x20,0x64,
+0x65,0x76,0x65,0x6c,0x6f,0x70,0x65,0x64,0x20,0x6f,0x6e,0x20,0x74,0x68,0x65,0x20,
+0x74,0x6f,0x70,0x0a,0x6c,0x65,0x76,0x65,0x6c,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,
+0x20,0x6c,0x77,0x49,0x50,0x20,0x54,0x43,0x50,0x2f,0x49,0x50,0x20,0x73,0x74,0x61,
+0x63,0x6b,0x2e,0x20,0x3c,0x62,0x72,0x3e,0x0a,0x3c,0x62,0x72,0x3e,0x0a,0x54,0x68,
+0x65,0x20,0x70,0x61,0x63,0x6b,0x61,0x67,0x65,0x20,0x63,0x6f,0x6e,0x74,0x61,0x69,
+0x6e,0x73,0x20,0x6e,0x69,0x6e,0x65,0x20,0x61,0x70,0x70,0x6c,0x69,0x63,0x61,0x74,
+0x69,0x6f,0x6e,0x73,0x3a,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x70,0x3e,
+0x0a,0x3c,0x6f,0x6c,0x3e,0x0a,0x3c,0x6c,0x69,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,
+0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,
+0x3a,0x20,0x31,0x30,0x70,0x74,0x3b,0x20,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,
+0x69,0x6c,0x79,0x3a,0x20,0x56,0x65,0x72,0x64,0x61,0x6e,0x61,0x3b,0x22,0x3e,0x41,
+0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x73,0x0a,0x72,0x75,0x6e,0x6e,
+0x69,0x6e,0x67,0x20,0x69,0x6e,0x20,0x73,0x74,0x61,0x6e,0x64,0x61,0x6c,0x6f,0x6e,
+0x65,0x20,0x28,0x77,0x69,0x74,0x68,0x6f,0x75,0x74,0x20,0x61,0x6e,0x20,0x52,0x54,
+0x4f,0x53,0x29,0x3a,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,
+0x0a,0x3c,0x2f,0x6f,0x6c,0x3e,0x0a,0x3c,0x75,0x6c,0x20,0x73,0x74,0x79,0x6c,0x65,
+0x3d,0x22,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x6c,0x65,0x66,0x74,0x3a,0x20,0x34,
+0x30,0x70,0x78,0x3b,0x22,0x3e,0x0a,0x3c,0x6c,0x69,0x3e,0x3c,0x73,0x70,0x61,0x6e,
+0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,
+0x65,0x3a,0x20,0x31,0x30,0x70,0x74,0x3b,0x20,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,
+0x6d,0x69,0x6c,0x79,0x3a,0x20,0x56,0x65,0x72,0x64,0x61,0x6e,0x61,0x3b,0x22,0x3e,
+0x41,0x0a,0x57,0x65,0x62,0x73,0x65,0x72,0x76,0x65,0x72,0x2e,0x26,0x6e,0x62,0x73,
+0x70,0x3b,0x3c,0x6f,0x3a,0x70,0x3e,0x3c,0x2f,0x6f,0x3a,0x70,0x3e,0x3c,0x2f,0x73,
+0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0a,0x3c,0x6c,0x69,0x3e,0x3c,0x73,
+0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,
+0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,0x30,0x70,0x74,0x3b,0x20,0x66,0x6f,0x6e,0x74,
+0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x20,0x56,0x65,0x72,0x64,0x61,0x6e,0x61,
+0x3b,0x22,0x3e,0x41,0x20,0x54,0x46,0x54,0x50,0x20,0x73,0x65,0x72,0x76,0x65,0x72,
+0x2e,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0a,0x3c,0x6c,
+0x69,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,
+0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,0x30,0x70,0x74,0x3b,0x20,
+0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x20,0x56,0x65,0x72,
+0x64,0x61,0x6e,0x61,0x3b,0x22,0x3e,0x41,0x20,0x54,0x43,0x50,0x20,0x65,0x63,0x68,
+0x6f,0x0a,0x63,0x6c,0x69,0x65,0x6e,0x74,0x20,0x61,0x70,0x70,0x6c,0x69,0x63,0x61,
+0x74,0x69,0x6f,0x6e,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,
+0x0a,0x3c,0x6c,0x69,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,
+0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,0x30,0x70,
+0x74,0x3b,0x20,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x20,
+0x56,0x65,0x72,0x64,0x61,0x6e,0x61,0x3b,0x22,0x3e,0x41,0x20,0x54,0x43,0x50,0x20,
+0x65,0x63,0x68,0x6f,0x0a,0x73,0x65,0x72,0x76,0x65,0x72,0x20,0x61,0x70,0x70,0x6c,
+0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,
+0x6c,0x69,0x3e,0x0a,0x3c,0x6c,0x69,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,0x74,
+0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,
+0x31,0x30,0x70,0x74,0x3b,0x20,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,
+0x79,0x3a,0x20,0x56,0x65,0x72,0x64,0x61,0x6e,0x61,0x3b,0x22,0x3e,0x41,0x20,0x55,
+0x44,0x50,0x20,0x65,0x63,0x68,0x6f,0x0a,0x63,0x6c,0x69,0x65,0x6e,0x74,0x20,0x61,
+0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x3c,0x2f,0x73,0x70,0x61,0x6e,
+0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0a,0x3c,0x6c,0x69,0x3e,0x3c,0x73,0x70,0x61,0x6e,
+0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,
+0x65,0x3a,0x20,0x31,0x30,0x70,0x74,0x3b,0x20,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,
+0x6d,0x69,0x6c,0x79,0x3a,0x20,0x56,0x65,0x72,0x64,0x61,0x6e,0x61,0x3b,0x22,0x3e,
+0x41,0x20,0x55,0x44,0x50,0x20,0x65,0x63,0x68,0x6f,0x0a,0x73,0x65,0x72,0x76,0x65,
+0x72,0x20,0x61,0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x26,0x6e,0x62,
+0x73,0x70,0x3b,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0a,
+0x3c,0x2f,0x75,0x6c,0x3e,0x0a,0x3c,0x6f,0x6c,0x20,0x73,0x74,0x61,0x72,0x74,0x3d,
+0x22,0x32,0x22,0x3e,0x0a,0x3c,0x6c,0x69,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,
+0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,
+0x20,0x31,0x30,0x70,0x74,0x3b,0x20,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,
+0x6c,0x79,0x3a,0x20,0x56,0x65,0x72,0x64,0x61,0x6e,0x61,0x3b,0x22,0x3e,0x41,0x70,
+0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x73,0x0a,0x72,0x75,0x6e,0x6e,0x69,
+0x6e,0x67,0x20,0x77,0x69,0x74,0x68,0x20,0x46,0x72,0x65,0x65,0x52,0x54,0x4f,0x53,
+0x20,0x6f,0x70,0x65,0x72,0x61,0x74,0x69,0x6e,0x67,0x20,0x73,0x79,0x73,0x74,0x65,
+0x6d,0x3a,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0a,0x3c,
+0x2f,0x6f,0x6c,0x3e,0x0a,0x3c,0x75,0x6c,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,
+0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x6c,0x65,0x66,0x74,0x3a,0x20,0x34,0x30,0x70,
+0x78,0x3b,0x22,0x3e,0x0a,0x3c,0x6c,0x69,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,
+0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,
+0x20,0x31,0x30,0x70,0x74,0x3b,0x20,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,
+0x6c,0x79,0x3a,0x20,0x56,0x65,0x72,0x64,0x61,0x6e,0x61,0x3b,0x22,0x3e,0x41,0x20,
+0x57,0x65,0x62,0x73,0x65,0x72,0x76,0x65,0x72,0x0a,0x62,0x61,0x73,0x65,0x64,0x20,
+0x6f,0x6e,0x20,0x6e,0x65,0x74,0x63,0x6f,0x6e,0x6e,0x20,0x41,0x50,0x49,0x2e,0x3c,
+0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0a,0x3c,0x6c,0x69,0x3e,
+0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,
+0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,0x30,0x70,0x74,0x3b,0x20,0x66,0x6f,
+0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x20,0x56,0x65,0x72,0x64,0x61,
+0x6e,0x61,0x3b,0x22,0x3e,0x41,0x20,0x57,0x65,0x62,0x73,0x65,0x72,0x76,0x65,0x72,
+0x0a,0x62,0x61,0x73,0x65,0x64,0x20,0x6f,0x6e,0x20,0x73,0x6f,0x63,0x6b,0x65,0x74,
+0x20,0x41,0x50,0x49,0x2e,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x6c,0x69,
+0x3e,0x0a,0x3c,0x6c,0x69,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,
+0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,0x30,
+0x70,0x74,0x3b,0x20,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,
+0x20,0x56,0x65,0x72,0x64,0x61,0x6e,0x61,0x3b,0x22,0x3e,0x41,0x20,0x54,0x43,0x50,
+0x2f,0x55,0x44,0x50,0x0a,0x65,0x63,0x68,0x6f,0x20,0x73,0x65,0x72,0x76,0x65,0x72,
+0x20,0x61,0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x62,0x61,0x73,
+0x65,0x64,0x20,0x6f,0x6e,0x20,0x6e,0x65,0x74,0x63,0x6f,0x6e,0x6e,0x20,0x41,0x50,
+0x49,0x2e,0x26,0x6e,0x62,0x73,0x70,0x3b,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,
+0x2f,0x6c,0x69,0x3e,0x0a,0x3c,0x2f,0x75,0x6c,0x3e,0x0a,0x3c,0x75,0x6c,0x20,0x74,
+0x79,0x70,0x65,0x3d,0x22,0x64,0x69,0x73,0x63,0x22,0x3e,0x0a,0x3c,0x2f,0x75,0x6c,
+0x3e,0x0a,0x3c,0x70,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x4d,0x73,0x6f,0x4e,
+0x6f,0x72,0x6d,0x61,0x6c,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x22,0x3e,
+0x3c,0x6f,0x3a,0x70,0x3e,0x26,0x6e,0x62,0x73,0x70,0x3b,0x3c,0x2f,0x6f,0x3a,0x70,
+0x3e,0x3c,0x2f,0x70,0x3e,0x0a,0x3c,0x2f,0x74,0x64,0x3e,0x0a,0x3c,0x74,0x64,0x20,
+0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,0x20,0x6d,
+0x65,0x64,0x69,0x75,0x6d,0x20,0x6e,0x6f,0x6e,0x65,0x20,0x3b,0x20,0x70,0x61,0x64,
+0x64,0x69,0x6e,0x67,0x3a,0x20,0x30,0x63,0x6d,0x3b,0x22,0x20,0x77,0x69,0x64,0x74,
+0x68,0x3d,0x22,0x34,0x22,0x3e,0x0a,0x3c,0x70,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
+0x22,0x4d,0x73,0x6f,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x22,0x3e,0x26,0x6e,0x62,0x73,
+0x70,0x3b,0x3c,0x2f,0x70,0x3e,0x0a,0x3c,0x2f,0x74,0x64,0x3e,0x0a,0x3c,0x2f,0x74,
+0x72,0x3e,0x0a,0x3c,0x74,0x72,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x22,0x3e,
+0x0a,0x3c,0x74,0x64,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x70,0x61,0x64,0x64,
+0x69,0x6e,0x67,0x3a,0x20,0x32,0x2e,0x32,0x35,0x70,0x74,0x3b,0x20,0x62,0x61,0x63,
+0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x20,0x72,0x67,0x62,0x28,0x35,0x31,0x2c,
+0x20,0x35,0x31,0x2c,0x20,0x32,0x35,0x35,0x29,0x20,0x6e,0x6f,0x6e,0x65,0x20,0x72,
+0x65,0x70,0x65,0x61,0x74,0x20,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x20,0x30,0x25,0x20,
+0x35,0x30,0x25,0x3b,0x20,0x2d,0x6d,0x6f,0x7a,0x2d,0x62,0x61,0x63,0x6b,0x67,0x72,
+0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6c,0x69,0x70,0x3a,0x20,0x69,0x6e,0x69,0x74,0x69,
+0x61,0x6c,0x3b,0x20,0x2d,0x6d,0x6f,0x7a,0x2d,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,
+0x75,0x6e,0x64,0x2d,0x6f,0x72,0x69,0x67,0x69,0x6e,0x3a,0x20,0x69,0x6e,0x69,0x74,
+0x69,0x61,0x6c,0x3b,0x20,0x2d,0x6d,0x6f,0x7a,0x2d,0x62,0x61,0x63,0x6b,0x67,0x72,
+0x6f,0x75,0x6e,0x64,0x2d,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x2d,0x70,0x6f,0x6c,0x69,
+0x63,0x79,0x3a,0x20,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x3b,0x20,0x77,0x69,0x64,
+0x74,0x68,0x3a,0x20,0x35,0x30,0x34,0x2e,0x32,0x70,0x74,0x3b,0x22,0x20,0x77,0x69,
+0x64,0x74,0x68,0x3d,0x22,0x36,0x37,0x32,0x22,0x3e,0x0a,0x3c,0x70,0x20,0x63,0x6c,
+0x61,0x73,0x73,0x3d,0x22,0x4d,0x73,0x6f,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x22,0x3e,
+0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x63,0x6f,0x6c,
+0x6f,0x72,0x3a,0x20,0x77,0x68,0x69,0x74,0x65,0x3b,0x22,0x3e,0x26,0x6e,0x62,0x73,
+0x70,0x3b,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x73,0x74,0x72,0x6f,0x6e,0x67,
+0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,
+0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x20,0x56,0x65,0x72,0x64,0x61,
+0x6e,0x61,0x3b,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x77,0x68,0x69,0x74,0x65,
+0x3b,0x22,0x3e,0x41,0x62,0x6f,0x75,0x74,0x20,0x4c,0x77,0x49,0x50,0x3c,0x2f,0x73,
+0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x73,0x74,0x72,0x6f,0x6e,0x67,0x3e,0x3c,0x73,0x70,
+0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x66,
+0x61,0x6d,0x69,0x6c,0x79,0x3a,0x20,0x56,0x65,0x72,0x64,0x61,0x6e,0x61,0x3b,0x20,
+0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x77,0x68,0x69,0x74,0x65,0x3b,0x22,0x3e,0x3c,
+0x6f,0x3a,0x70,0x3e,0x3c,0x2f,0x6f,0x3a,0x70,0x3e,0x3c,0x2f,0x73,0x70,0x61,0x6e,
+0x3e,0x3c,0x2f,0x70,0x3e,0x0a,0x3c,0x2f,0x74,0x64,0x3e,0x0a,0x3c,0x74,0x64,0x20,
+0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,0x20,0x6d,
+0x65,0x64,0x69,0x75,0x6d,0x20,0x6e,0x6f,0x6e,0x65,0x20,0x3b,0x20,0x70,0x61,0x64,
+0x64,0x69,0x6e,0x67,0x3a,0x20,0x30,0x63,0x6d,0x3b,0x22,0x20,0x77,0x69,0x64,0x74,
+0x68,0x3d,0x22,0x34,0x22,0x3e,0x0a,0x3c,0x70,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
+0x22,0x4d,0x73,0x6f,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x22,0x3e,0x26,0x6e,0x62,0x73,
+0x70,0x3b,0x3c,0x2f,0x70,0x3e,0x0a,0x3c,0x2f,0x74,0x64,0x3e,0x0a,0x3c,0x2f,0x74,
+0x72,0x3e,0x0a,0x3c,0x74,0x72,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x22,0x3e,
+0x0a,0x3c,0x74,0x64,0x20,0x63,0x6f,0x6c,0x73,0x70,0x61,0x6e,0x3d,0x22,0x32,0x22,
+0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,
+0x20,0x32,0x2e,0x32,0x35,0x70,0x74,0x3b,0x20,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,
+0x35,0x30,0x37,0x2e,0x34,0x70,0x74,0x3b,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,
+0x22,0x36,0x37,0x37,0x22,0x3e,0x0a,0x3c,0x70,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
+0x22,0x4d,0x73,0x6f,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x22,0x20,0x73,0x74,0x79,0x6c,
+0x65,0x3d,0x22,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6d,
+0x3a,0x20,0x31,0x32,0x70,0x74,0x3b,0x22,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,
+0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,
+0x20,0x31,0x30,0x70,0x74,0x3b,0x20,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,
+0x6c,0x79,0x3a,0x20,0x56,0x65,0x72,0x64,0x61,0x6e,0x61,0x3b,0x22,0x3e,0x6c,0x77,
+0x49,0x50,0x2c,0x0a,0x70,0x72,0x6f,0x6e,0x6f,0x75,0x6e,0x63,0x65,0x64,0x20,0x6c,
+0x69,0x67,0x68,0x74,0x77,0x65,0x69,0x67,0x68,0x74,0x20,0x49,0x50,0x2c,0x20,0x69,
+0x73,0x20,0x61,0x6e,0x20,0x6f,0x70,0x65,0x6e,0x20,0x73,0x6f,0x75,0x72,0x63,0x65,
+0x20,0x54,0x43,0x50,0x2f,0x49,0x50,0x20,0x73,0x74,0x61,0x63,0x6b,0x20,0x64,0x65,
+0x76,0x65,0x6c,0x6f,0x70,0x65,0x64,0x20,0x62,0x79,0x0a,0x41,0x64,0x61,0x6d,0x20,
+0x44,0x75,0x6e,0x6b,0x65,0x6c,0x73,0x20,0x61,0x74,0x20,0x74,0x68,0x65,0x20,0x53,
+0x77,0x65,0x64,0x69,0x73,0x68,0x20,0x49,0x6e,0x73,0x74,0x69,0x74,0x75,0x74,0x65,
+0x20,0x6f,0x66,0x20,0x43,0x6f,0x6d,0x70,0x75,0x74,0x65,0x72,0x20,0x53,0x63,0x69,
+0x65,0x6e,0x63,0x65,0x20,0x61,0x6e,0x64,0x20,0x69,0x73,0x0a,0x6d,0x61,0x69,0x6e,
+0x74,0x61,0x69,0x6e,0x65,0x64,0x20,0x6e,0x6f,0x77,0x20,0x62,0x79,0x20,0x61,0x20,
+0x77,0x6f,0x72,0x6c,0x64,0x20,0x77,0x69,0x64,0x65,0x20,0x63,0x6f,0x6d,0x6d,0x75,
+0x6e,0x69,0x74,0x79,0x20,0x6f,0x66,0x20,0x64,0x65,0x76,0x65,0x6c,0x6f,0x70,0x65,
+0x72,0x73,0x2e,0x3c,0x62,0x72,0x3e,0x0a,0x3c,0x62,0x72,0x3e,0x0a,0x6c,0x77,0x49,
+0x50,0x20,0x66,0x65,0x61,0x74,0x75,0x72,0x65,0x73,0x3a,0x3c,0x62,0x72,0x3e,0x0a,
+0x3c,0x62,0x72,0x3e,0x0a,0x2d,0x20,0x49,0x50,0x20,0x28,0x49,0x6e,0x74,0x65,0x72,
+0x6e,0x65,0x74,0x20,0x50,0x72,0x6f,0x74,0x6f,0x63,0x6f,0x6c,0x29,0x20,0x69,0x6e,
+0x63,0x6c,0x75,0x64,0x69,0x6e,0x67,0x20,0x70,0x61,0x63,0x6b,0x65,0x74,0x20,0x66,
+0x6f,0x72,0x77,0x61,0x72,0x64,0x69,0x6e,0x67,0x20,0x6f,0x76,0x65,0x72,0x20,0x6d,
+0x75,0x6c,0x74,0x69,0x70,0x6c,0x65,0x0a,0x6e,0x65,0x74,0x77,0x6f,0x72,0x6b,0x20,
+0x69,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,0x73,0x3c,0x62,0x72,0x3e,0x0a,0x2d,
+0x20,0x49,0x43,0x4d,0x50,0x20,0x28,0x49,0x6e,0x74,0x65,0x72,0x6e,0x65,0x74,0x20,
+0x43,0x6f,0x6e,0x74,0x72,0x6f,0x6c,0x20,0x4d,0x65,0x73,0x73,0x61,0x67,0x65,0x20,
+0x50,0x72,0x6f,0x74,0x6f,0x63,0x6f,0x6c,0x29,0x20,0x66,0x6f,0x72,0x20,0x6e,0x65,
+0x74,0x77,0x6f,0x72,0x6b,0x20,0x6d,0x61,0x69,0x6e,0x74,0x65,0x6e,0x61,0x6e,0x63,
+0x65,0x20,0x61,0x6e,0x64,0x0a,0x64,0x65,0x62,0x75,0x67,0x67,0x69,0x6e,0x67,0x3c,
+0x62,0x72,0x3e,0x0a,0x2d,0x20,0x55,0x44,0x50,0x20,0x28,0x55,0x73,0x65,0x72,0x20,
+0x44,0x61,0x74,0x61,0x67,0x72,0x61,0x6d,0x20,0x50,0x72,0x6f,0x74,0x6f,0x63,0x6f,
+0x6c,0x29,0x20,0x69,0x6e,0x63,0x6c,0x75,0x64,0x69,0x6e,0x67,0x20,0x65,0x78,0x70,
+0x65,0x72,0x69,0x6d,0x65,0x6e,0x74,0x61,0x6c,0x20,0x55,0x44,0x50,0x2d,0x6c,0x69,
+0x74,0x65,0x0a,0x65,0x78,0x74,0x65,0x6e,0x73,0x69,0x6f,0x6e,0x73,0x3c,0x62,0x72,
+0x3e,0x0a,0x2d,0x20,0x54,0x43,0x50,0x20,0x28,0x54,0x72,0x61,0x6e,0x73,0x6d,0x69,
+0x73,0x73,0x69,0x6f,0x6e,0x20,0x43,0x6f,0x6e,0x74,0x72,0x6f,0x6c,0x20,0x50,0x72,
+0x6f,0x74,0x6f,0x63,0x6f,0x6c,0x29,0x20,0x77,0x69,0x74,0x68,0x20,0x63,0x6f,0x6e,
+0x67,0x65,0x73,0x74,0x69,0x6f,0x6e,0x20,0x63,0x6f,0x6e,0x74,0x72,0x6f,0x6c,0x2c,
+0x20,0x52,0x54,0x54,0x0a,0x65,0x73,0x74,0x69,0x6d,0x61,0x74,0x69,0x6f,0x6e,0x20,
+0x61,0x6e,0x64,0x20,0x66,0x61,0x73,0x74,0x20,0x72,0x65,0x63,0x6f,0x76,0x65,0x72,
+0x79,0x2f,0x66,0x61,0x73,0x74,0x20,0x72,0x65,0x74,0x72,0x61,0x6e,0x73,0x6d,0x69,
+0x74,0x3c,0x62,0x72,0x3e,0x0a,0x2d,0x20,0x53,0x70,0x65,0x63,0x69,0x61,0x6c,0x69,
+0x7a,0x65,0x64,0x20,0x72,0x61,0x77,0x20,0x41,0x50,0x49,0x20,0x66,0x6f,0x72,0x20,
+0x65,0x6e,0x68,0x61,0x6e,0x63,0x65,0x64,0x20,0x70,0x65,0x72,0x66,0x6f,0x72,0x6d,
+0x61,0x6e,0x63,0x65,0x3c,0x62,0x72,0x3e,0x0a,0x2d,0x20,0x4f,0x70,0x74,0x69,0x6f,
+0x6e,0x61,0x6c,0x20,0x42,0x65,0x72,0x6b,0x65,0x6c,0x65,0x79,0x2d,0x61,0x6c,0x69,
+0x6b,0x65,0x20,0x73,0x6f,0x63,0x6b,0x65,0x74,0x20,0x41,0x50,0x49,0x3c,0x62,0x72,
+0x3e,0x0a,0x2d,0x20,0x44,0x48,0x43,0x50,0x20,0x28,0x44,0x79,0x6e,0x61,0x6d,0x69,
+0x63,0x20,0x48,0x6f,0x73,0x74,0x20,0x43,0x6f,0x6e,0x66,0x69,0x67,0x75,0x72,0x61,
+0x74,0x69,0x6f,0x6e,0x20,0x50,0x72,0x6f,0x74,0x6f,0x63,0x6f,0x6c,0x29,0x3c,0x62,
+0x72,0x3e,0x0a,0x2d,0x20,0x50,0x50,0x50,0x20,0x28,0x50,0x6f,0x69,0x6e,0x74,0x2d,
+0x74,0x6f,0x2d,0x50,0x6f,0x69,0x6e,0x74,0x20,0x50,0x72,0x6f,0x74,0x6f,0x63,0x6f,
+0x6c,0x29,0x3c,0x62,0x72,0x3e,0x0a,0x2d,0x20,0x41,0x52,0x50,0x20,0x28,0x41,0x64,
+0x64,0x72,0x65,0x73,0x73,0x20,0x52,0x65,0x73,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,
+0x20,0x50,0x72,0x6f,0x74,0x6f,0x63,0x6f,0x6c,0x29,0x20,0x66,0x6f,0x72,0x20,0x45,
+0x74,0x68,0x65,0x72,0x6e,0x65,0x74,0x3c,0x62,0x72,0x3e,0x0a,0x3c,0x62,0x72,0x3e,
+0x0a,0x46,0x6f,0x72,0x20,0x6d,0x6f,0x72,0x65,0x20,0x69,0x6e,0x66,0x6f,0x72,0x6d,
+0x61,0x74,0x69,0x6f,0x6e,0x73,0x20,0x79,0x6f,0x75,0x20,0x63,0x61,0x6e,0x20,0x72,
+0x65,0x66,0x65,0x72,0x20,0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x77,0x65,0x62,0x73,
+0x69,0x74,0x65,0x3a,0x20,0x26,0x6e,0x62,0x73,0x70,0x3b,0x3c,0x61,0x20,0x68,0x72,
+0x65,0x66,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x73,0x61,0x76,0x61,0x6e,
 0x6e,0x61,0x68,0x2e,0x6e,0x6f,0x6e,0x67,0x6e,0x75,0x2e,0x6f,0x72,0x67,0x2f,0x70,
-0x72,0x6f,0x6a,0x65,0x63,0x74,0x73,0x2f,0x6c,0x77,0x69,0x70,0x29,0x0d,0x0a,
-/* "Content-type: image/jpeg
+0x72,0x6f,0x6a,0x65,0x63,0x74,0x73,0x2f,0x6c,0x77,0x69,0x70,0x2f,0x22,0x3e,0x68,
+0x74,0x74,0x70,0x3a,0x2f,0x2f,0x73,0x61,0x76,0x61,0x6e,0x6e,0x61,0x68,0x2e,0x6e,
+0x6f,0x6e,0x67,0x6e,0x75,0x2e,0x6f,0x72,0x67,0x2f,0x70,0x72,0x6f,0x6a,0x65,0x63,
+0x74,0x73,0x2f,0x6c,0x77,0x69,0x70,0x2f,0x0a,0x3c,0x2f,0x61,0x3e,0x3c,0x6f,0x3a,
+0x70,0x3e,0x3c,0x2f,0x6f,0x3a,0x70,0x3e,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,
+0x2f,0x70,0x3e,0x0a,0x3c,0x2f,0x74,0x64,0x3e,0x0a,0x3c,0x2f,0x74,0x72,0x3e,0x0a,
+0x3c,0x2f,0x74,0x62,0x6f,0x64,0x79,0x3e,0x0a,0x3c,0x2f,0x74,0x61,0x62,0x6c,0x65,
+0x3e,0x0a,0x3c,0x70,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x4d,0x73,0x6f,0x4e,
+0x6f,0x72,0x6d,0x61,0x6c,0x22,0x3e,0x3c,0x6f,0x3a,0x70,0x3e,0x3c,0x2f,0x6f,0x3a,
+0x70,0x3e,0x3c,0x2f,0x70,0x3e,0x0a,0x3c,0x2f,0x74,0x64,0x3e,0x0a,0x3c,0x2f,0x74,
+0x72,0x3e,0x0a,0x3c,0x2f,0x74,0x62,0x6f,0x64,0x79,0x3e,0x0a,0x3c,0x2f,0x74,0x61,
+0x62,0x6c,0x65,0x3e,0x0a,0x3c,0x2f,0x74,0x64,0x3e,0x0a,0x3c,0x2f,0x74,0x72,0x3e,
+0x0a,0x3c,0x2f,0x74,0x62,0x6f,0x64,0x79,0x3e,0x0a,0x3c,0x2f,0x74,0x61,0x62,0x6c,
+0x65,0x3e,0x0a,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,
+0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x20,0x6e,0x6f,0x6e,0x65,0x3b,0x22,0x3e,
+0x3c,0x6f,0x3a,0x70,0x3e,0x3c,0x2f,0x6f,0x3a,0x70,0x3e,0x3c,0x2f,0x73,0x70,0x61,
+0x6e,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x3c,0x64,0x69,0x76,0x20,0x61,0x6c,
+0x69,0x67,0x6e,0x3d,0x22,0x63,0x65,0x6e,0x74,0x65,0x72,0x22,0x3e,0x0a,0x3c,0x74,
+0x61,0x62,0x6c,0x65,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x4d,0x73,0x6f,0x4e,
+0x6f,0x72,0x6d,0x61,0x6c,0x54,0x61,0x62,0x6c,0x65,0x22,0x20,0x73,0x74,0x79,0x6c,
+0x65,0x3d,0x22,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x20,0x62,
+0x6c,0x61,0x63,0x6b,0x20,0x6e,0x6f,0x6e,0x65,0x20,0x72,0x65,0x70,0x65,0x61,0x74,
+0x20,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x20,0x30,0x25,0x20,0x35,0x30,0x25,0x3b,0x20,
+0x2d,0x6d,0x6f,0x7a,0x2d,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,
+0x63,0x6c,0x69,0x70,0x3a,0x20,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x3b,0x20,0x2d,
+0x6d,0x6f,0x7a,0x2d,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x6f,
+0x72,0x69,0x67,0x69,0x6e,0x3a,0x20,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x3b,0x20,
+0x2d,0x6d,0x6f,0x7a,0x2d,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,
+0x69,0x6e,0x6c,0x69,0x6e,0x65,0x2d,0x70,0x6f,0x6c,0x69,0x63,0x79,0x3a,0x20,0x69,
+0x6e,0x69,0x74,0x69,0x61,0x6c,0x3b,0x20,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x35,
+0x37,0x34,0x2e,0x35,0x70,0x74,0x3b,0x22,0x20,0x62,0x6f,0x72,0x64,0x65,0x72,0x3d,
+0x22,0x30,0x22,0x20,0x63,0x65,0x6c,0x6c,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3d,
+0x22,0x30,0x22,0x20,0x63,0x65,0x6c,0x6c,0x73,0x70,0x61,0x63,0x69,0x6e,0x67,0x3d,
+0x22,0x30,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x37,0x36,0x36,0x22,0x3e,
+0x0a,0x3c,0x74,0x62,0x6f,0x64,0x79,0x3e,0x0a,0x3c,0x74,0x72,0x20,0x73,0x74,0x79,
+0x6c,0x65,0x3d,0x22,0x22,0x3e,0x0a,0x3c,0x74,0x64,0x20,0x73,0x74,0x79,0x6c,0x65,
+0x3d,0x22,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,0x30,0x63,0x6d,0x3b,0x20,
+0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x31,0x30,0x30,0x25,0x3b,0x22,0x20,0x77,0x69,
+0x64,0x74,0x68,0x3d,0x22,0x31,0x30,0x30,0x25,0x22,0x3e,0x0a,0x3c,0x70,0x20,0x63,
+0x6c,0x61,0x73,0x73,0x3d,0x22,0x4d,0x73,0x6f,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x22,
+0x3e,0x3c,0x69,0x6d,0x67,0x20,0x69,0x64,0x3d,0x22,0x5f,0x78,0x30,0x30,0x30,0x30,
+0x5f,0x69,0x31,0x30,0x32,0x38,0x22,0x20,0x73,0x72,0x63,0x3d,0x22,0x69,0x6e,0x63,
+0x68,0x74,0x6d,0x6c,0x2d,0x70,0x61,0x67,0x65,0x73,0x2d,0x73,0x74,0x6d,0x33,0x32,
+0x5f,0x63,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x69,0x76,0x69,0x74,0x79,0x5f,0x66,0x69,
+0x6c,0x65,0x73,0x2f,0x70,0x69,0x78,0x65,0x6c,0x2e,0x67,0x69,0x66,0x22,0x20,0x62,
+0x6f,0x72,0x64,0x65,0x72,0x3d,0x22,0x30,0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,
+0x3d,0x22,0x31,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x31,0x22,0x3e,0x3c,
+0x2f,0x70,0x3e,0x0a,0x3c,0x2f,0x74,0x64,0x3e,0x0a,0x3c,0x2f,0x74,0x72,0x3e,0x0a,
+0x3c,0x2f,0x74,0x62,0x6f,0x64,0x79,0x3e,0x0a,0x3c,0x2f,0x74,0x61,0x62,0x6c,0x65,
+0x3e,0x0a,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x3c,0x70,0x20,0x63,0x6c,0x61,0x73,
+0x73,0x3d,0x22,0x4d,0x73,0x6f,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x22,0x20,0x73,0x74,
+0x79,0x6c,0x65,0x3d,0x22,0x74,0x65,0x78,0x74,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,
+0x20,0x63,0x65,0x6e,0x74,0x65,0x72,0x3b,0x22,0x20,0x61,0x6c,0x69,0x67,0x6e,0x3d,
+0x22,0x63,0x65,0x6e,0x74,0x65,0x72,0x22,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,
+0x74,0x79,0x6c,0x65,0x3d,0x22,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x20,0x6e,
+0x6f,0x6e,0x65,0x3b,0x22,0x3e,0x3c,0x6f,0x3a,0x70,0x3e,0x26,0x6e,0x62,0x73,0x70,
+0x3b,0x3c,0x2f,0x6f,0x3a,0x70,0x3e,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,
+0x70,0x3e,0x0a,0x3c,0x64,0x69,0x76,0x20,0x61,0x6c,0x69,0x67,0x6e,0x3d,0x22,0x63,
+0x65,0x6e,0x74,0x65,0x72,0x22,0x3e,0x0a,0x3c,0x74,0x61,0x62,0x6c,0x65,0x20,0x63,
+0x6c,0x61,0x73,0x73,0x3d,0x22,0x4d,0x73,0x6f,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x54,
+0x61,0x62,0x6c,0x65,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x77,0x69,0x64,
+0x74,0x68,0x3a,0x20,0x35,0x37,0x34,0x2e,0x35,0x70,0x74,0x3b,0x22,0x20,0x62,0x6f,
+0x72,0x64,0x65,0x72,0x3d,0x22,0x30,0x22,0x20,0x63,0x65,0x6c,0x6c,0x70,0x61,0x64,
+0x64,0x69,0x6e,0x67,0x3d,0x22,0x30,0x22,0x20,0x63,0x65,0x6c,0x6c,0x73,0x70,0x61,
+0x63,0x69,0x6e,0x67,0x3d,0x22,0x30,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,
+0x37,0x36,0x36,0x22,0x3e,0x0a,0x3c,0x74,0x62,0x6f,0x64,0x79,0x3e,0x0a,0x3c,0x74,
+0x72,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x22,0x3e,0x0a,0x3c,0x74,0x64,0x20,
+0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,
+0x30,0x63,0x6d,0x3b,0x20,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x31,0x30,0x30,0x25,
+0x3b,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x31,0x30,0x30,0x25,0x22,0x3e,
+0x0a,0x3c,0x64,0x69,0x76,0x20,0x69,0x64,0x3d,0x22,0x66,0x6f,0x6f,0x74,0x65,0x72,
+0x22,0x3e,0x0a,0x3c,0x70,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x65,0x67,
+0x61,0x6c,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x74,0x65,0x78,0x74,0x2d,
+0x61,0x6c,0x69,0x67,0x6e,0x3a,0x20,0x63,0x65,0x6e,0x74,0x65,0x72,0x3b,0x22,0x20,
+0x61,0x6c,0x69,0x67,0x6e,0x3d,0x22,0x63,0x65,0x6e,0x74,0x65,0x72,0x22,0x3e,0x41,
+0x6c,0x6c,0x20,0x72,0x69,0x67,0x68,0x74,0x73,0x20,0x72,0x65,0x73,0x65,0x72,0x76,
+0x65,0x64,0x20,0xa9,0x32,0x30,0x31,0x36,0x0a,0x53,0x54,0x4d,0x69,0x63,0x72,0x6f,
+0x65,0x6c,0x65,0x63,0x74,0x72,0x6f,0x6e,0x69,0x63,0x73,0x26,0x6e,0x62,0x73,0x70,
+0x3b,0x3c,0x2f,0x70,0x3e,0x0a,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x3c,0x2f,0x74,
+0x64,0x3e,0x0a,0x3c,0x2f,0x74,0x72,0x3e,0x0a,0x3c,0x2f,0x74,0x62,0x6f,0x64,0x79,
+0x3e,0x0a,0x3c,0x2f,0x74,0x61,0x62,0x6c,0x65,0x3e,0x0a,0x3c,0x2f,0x64,0x69,0x76,
+0x3e,0x0a,0x3c,0x70,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x4d,0x73,0x6f,0x4e,
+0x6f,0x72,0x6d,0x61,0x6c,0x22,0x3e,0x3c,0x6f,0x3a,0x70,0x3e,0x26,0x6e,0x62,0x73,
+0x70,0x3b,0x3c,0x2f,0x6f,0x3a,0x70,0x3e,0x3c,0x2f,0x70,0x3e,0x0a,0x3c,0x2f,0x64,
+0x69,0x76,0x3e,0x0a,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x3c,0x2f,0x62,0x6f,0x64,
+0x79,0x3e,0x3c,0x2f,0x68,0x74,0x6d,0x6c,0x3e,};
 
-" (28 bytes) */
-0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x74,0x79,0x70,0x65,0x3a,0x20,0x69,0x6d,
-0x61,0x67,0x65,0x2f,0x6a,0x70,0x65,0x67,0x0d,0x0a,0x0d,0x0a,
-/* raw file data (2554 bytes) */
-0xff,0xd8,0xff,0xe0,0x00,0x10,0x4a,0x46,0x49,0x46,0x00,0x01,0x01,0x01,0x00,0x48,
-0x00,0x48,0x00,0x00,0xff,0xfe,0x00,0x3c,0x43,0x52,0x45,0x41,0x54,0x4f,0x52,0x3a,
-0x20,0x67,0x64,0x2d,0x6a,0x70,0x65,0x67,0x20,0x76,0x31,0x2e,0x30,0x20,0x28,0x75,
-0x73,0x69,0x6e,0x67,0x20,0x49,0x4a,0x47,0x20,0x4a,0x50,0x45,0x47,0x20,0x76,0x36,
-0x32,0x29,0x2c,0x20,0x71,0x75,0x61,0x6c,0x69,0x74,0x79,0x20,0x3d,0x20,0x31,0x30,
-0x30,0x0a,0xff,0xdb,0x00,0x43,0x00,0x06,0x04,0x05,0x06,0x05,0x04,0x06,0x06,0x05,
-0x06,0x07,0x07,0x06,0x08,0x0a,0x10,0x0a,0x0a,0x09,0x09,0x0a,0x14,0x0e,0x0f,0x0c,
-0x10,0x17,0x14,0x18,0x18,0x17,0x14,0x16,0x16,0x1a,0x1d,0x25,0x1f,0x1a,0x1b,0x23,
-0x1c,0x16,0x16,0x20,0x2c,0x20,0x23,0x26,0x27,0x29,0x2a,0x29,0x19,0x1f,0x2d,0x30,
-0x2d,0x28,0x30,0x25,0x28,0x29,0x28,0xff,0xdb,0x00,0x43,0x01,0x07,0x07,0x07,0x0a,
-0x08,0x0a,0x13,0x0a,0x0a,0x13,0x28,0x1a,0x16,0x1a,0x28,0x28,0x28,0x28,0x28,0x28,
-0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,
-0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,
-0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0xff,0xc0,0x00,0x11,
-0x08,0x00,0x44,0x00,0x60,0x03,0x01,0x22,0x00,0x02,0x11,0x01,0x03,0x11,0x01,0xff,
-0xc4,0x00,0x1c,0x00,0x00,0x02,0x02,0x03,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x07,0x06,0x08,0x02,0x03,0x04,0x05,0x01,0xff,0xc4,0x00,
-0x3c,0x10,0x00,0x01,0x03,0x03,0x03,0x00,0x06,0x06,0x08,0x05,0x05,0x01,0x00,0x00,
-0x00,0x00,0x01,0x02,0x03,0x04,0x00,0x05,0x11,0x06,0x12,0x21,0x07,0x13,0x31,0x41,
-0x51,0x81,0x15,0x22,0x61,0x71,0x91,0xd1,0x14,0x32,0x42,0x52,0x55,0x92,0x93,0x94,
-0x08,0x23,0x43,0x82,0xa1,0x24,0x33,0x72,0x73,0x83,0xf1,0xff,0xc4,0x00,0x1a,0x01,
-0x00,0x02,0x03,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x04,0x01,0x02,0x03,0x05,0x06,0xff,0xc4,0x00,0x2b,0x11,0x00,0x01,0x03,0x02,
-0x04,0x03,0x08,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x03,
-0x04,0x11,0x12,0x13,0x21,0x31,0x05,0x41,0xf0,0x14,0x42,0x43,0x51,0x53,0x81,0xa1,
-0xd1,0x52,0x61,0xe1,0xff,0xda,0x00,0x0c,0x03,0x01,0x00,0x02,0x11,0x03,0x11,0x00,
-0x3f,0x00,0xb5,0x34,0x51,0x45,0x08,0x51,0x9d,0x77,0xac,0x21,0x69,0x1b,0x6a,0x1f,
-0x92,0x92,0xf4,0xa7,0x89,0x4c,0x78,0xe9,0x38,0x2b,0x23,0xb4,0x93,0xdc,0x91,0x91,
-0x93,0xed,0x14,0x9a,0x97,0xd2,0xae,0xa7,0x96,0xf9,0x5b,0x32,0x19,0x8a,0xde,0x78,
-0x6d,0xa6,0x52,0x40,0xf3,0x56,0x4d,0x79,0x5d,0x2c,0xdf,0x7d,0x3b,0xae,0x25,0xa9,
-0xb5,0xee,0x8d,0x13,0xfd,0x2b,0x38,0xec,0xc2,0x4f,0xac,0x7c,0xd4,0x4f,0x96,0x29,
-0x8d,0xd1,0xa7,0x46,0x90,0x05,0xaa,0x3d,0xd3,0x51,0x47,0x12,0xe4,0xc8,0x48,0x71,
-0xb8,0xce,0x72,0xdb,0x69,0x3d,0x9b,0x93,0xf6,0x89,0x1c,0xf3,0xc0,0xf0,0xae,0x8b,
-0x19,0x1c,0x11,0x87,0xc8,0x2e,0x4a,0xe6,0x48,0xf9,0x6a,0x24,0x2c,0x8c,0xd8,0x05,
-0x0c,0x6f,0xa4,0xad,0x4a,0x7e,0xb5,0xd9,0x23,0xff,0x00,0x26,0xfe,0x55,0xd4,0xd7,
-0x48,0x9a,0x85,0x5d,0xb7,0x74,0xfe,0x9b,0x7f,0x2a,0x77,0xa3,0x4f,0xd9,0x90,0x90,
-0x94,0x5a,0x2d,0xc9,0x48,0xec,0x02,0x32,0x00,0x1f,0xe2,0xbe,0xfa,0x06,0xcf,0xf8,
-0x4d,0xbf,0xf6,0xc8,0xf9,0x55,0x7b,0x54,0x5e,0x98,0x53,0xd8,0xe6,0xf5,0x4f,0x5e,
-0xe9,0x34,0xd6,0xbe,0xbe,0xab,0xb6,0xee,0x3f,0x23,0x7f,0x2a,0xe9,0x1a,0xe6,0xf2,
-0x46,0x7d,0x30,0x3f,0x23,0x7f,0x2a,0x6e,0x7a,0x02,0xcf,0xf8,0x4d,0xbf,0xf6,0xc8,
-0xf9,0x51,0xe8,0x1b,0x3f,0xe1,0x56,0xff,0x00,0xdb,0x23,0xe5,0x55,0x35,0x31,0xfe,
-0x0a,0xc2,0x92,0x5f,0x50,0xa4,0xeb,0x9a,0xf6,0xf8,0x9e,0xcb,0xb2,0x7f,0x23,0x7f,
-0x2a,0xe5,0x73,0xa4,0x4d,0x40,0x9e,0xcb,0xa2,0x3f,0x4d,0xbf,0x95,0x3b,0x7d,0x03,
-0x68,0xfc,0x2a,0xdf,0xfb,0x74,0x7c,0xa8,0xf4,0x0d,0xa3,0xf0,0xa8,0x1f,0xb7,0x47,
-0xca,0xa4,0x54,0xc4,0x3c,0x30,0xa0,0xd1,0xca,0x7c,0x43,0xd7,0xba,0x44,0xb9,0xd2,
-0x56,0xa4,0x4f,0x65,0xc9,0x1f,0xa4,0x8f,0x95,0x4c,0x7a,0x28,0xd4,0xda,0x83,0x52,
-0xde,0xa4,0x09,0xf3,0x12,0xe4,0x18,0xcd,0xee,0x58,0x0d,0xa4,0x65,0x4a,0xe1,0x23,
-0x20,0x7b,0x09,0xf2,0xa6,0x2f,0xa0,0xad,0x1f,0x85,0x40,0xfd,0xba,0x3e,0x55,0xd5,
-0x12,0x14,0x58,0x49,0x52,0x61,0xc6,0x62,0x3a,0x54,0x72,0x43,0x4d,0x84,0x67,0xdf,
-0x8a,0xac,0x95,0x11,0xb9,0xa4,0x35,0x80,0x2b,0xc5,0x4b,0x23,0x1c,0x1c,0xe9,0x09,
-0x0b,0xa2,0xa3,0xfa,0xfa,0xf6,0x34,0xfe,0x93,0xb8,0x4f,0x0a,0xda,0xea,0x5b,0x28,
-0x6b,0xfe,0x67,0x81,0xf3,0xf2,0xa9,0x05,0x57,0x5f,0xe2,0x3f,0x57,0xf5,0x97,0xa8,
-0xda,0x7a,0x32,0x82,0x9a,0x8a,0x90,0xec,0x8c,0x1f,0xea,0x28,0x64,0x0f,0x24,0xe0,
-0xf9,0xd6,0x30,0x47,0x8d,0xe0,0x2d,0xea,0x65,0xcb,0x61,0x29,0x6d,0x11,0x7d,0x64,
-0xa4,0x17,0x0f,0x0a,0x58,0xdc,0x4f,0xbe,0xae,0x74,0x65,0xb6,0xb8,0xcd,0x29,0x9c,
-0x75,0x4a,0x40,0x28,0xc7,0x66,0x31,0xc5,0x51,0xf6,0x26,0xb6,0x7e,0xb6,0x53,0xef,
-0xa7,0x8f,0x44,0xfd,0x28,0xb0,0xc3,0x4c,0x59,0xaf,0xef,0xa1,0x2c,0x8c,0x21,0x89,
-0x4a,0x3f,0x53,0xc1,0x2b,0xf6,0x7b,0x7b,0xbd,0xdd,0x8f,0x55,0x44,0xe9,0x1a,0x08,
-0xe4,0xb9,0xf4,0x93,0x32,0x37,0x10,0x4e,0xeb,0x8b,0x5f,0x5d,0xf5,0x9e,0x9f,0xd4,
-0x72,0x5b,0x97,0x72,0x94,0xdc,0x57,0x9c,0x52,0xe3,0x38,0xd2,0xb0,0xda,0xd1,0x9e,
-0x00,0xf0,0x20,0x60,0x11,0xff,0x00,0xda,0xf0,0x9b,0xd6,0xda,0x8c,0xf6,0xde,0x66,
-0x7e,0xa1,0xab,0x1b,0x7c,0xb4,0x40,0xbf,0xdb,0x1c,0x85,0x71,0x65,0x2f,0xc7,0x70,
-0x64,0x1e,0xf4,0x9e,0xe5,0x24,0xf7,0x1f,0x6d,0x57,0x5d,0x73,0xa3,0x66,0xe9,0x39,
-0xbe,0xb9,0x2f,0xc0,0x70,0xff,0x00,0x29,0xf0,0x3b,0x7d,0x8a,0xf0,0x35,0x34,0xb2,
-0xc6,0xf1,0x85,0xc0,0x5d,0x56,0xb2,0x19,0x23,0x38,0xda,0x4d,0x96,0xf6,0xf5,0x9e,
-0xa0,0x3d,0xb7,0x79,0x9f,0xa8,0x6b,0x71,0xd6,0x77,0xe4,0xa0,0x9f,0x4a,0xcc,0x51,
-0xee,0x01,0x64,0x92,0x7c,0x05,0x43,0x90,0xed,0x4e,0xba,0x27,0xb2,0x1b,0xd6,0xa8,
-0x65,0xf7,0x51,0x98,0x90,0x48,0x7d,0x79,0xec,0x2a,0x1f,0x50,0x7c,0x70,0x7c,0xa9,
-0xc9,0x04,0x4c,0x61,0x71,0x68,0xd1,0x23,0x11,0x95,0xef,0x0c,0x0e,0x3a,0xfe,0xd3,
-0xda,0xc4,0xcc,0x98,0xf6,0x78,0x6d,0x4f,0x75,0x4e,0xcb,0x4b,0x43,0xad,0x5a,0x8e,
-0x49,0x5f,0x69,0xe7,0xdf,0xc5,0x24,0xb5,0xa6,0xb8,0xb9,0xca,0xd4,0x93,0x7d,0x19,
-0x70,0x91,0x1e,0x13,0x2e,0x16,0x5a,0x4b,0x2e,0x14,0x85,0x04,0xf0,0x55,0xc7,0x6e,
-0x4e,0x70,0x7c,0x31,0x4d,0xbd,0x7f,0x7b,0x4d,0x83,0x4a,0x4f,0x9a,0x5c,0xd8,0xee,
-0xc2,0xdb,0x47,0xbf,0x7a,0xb8,0x18,0xf7,0x76,0xf9,0x55,0x57,0x76,0xe6,0xda,0x46,
-0x1b,0x4a,0x95,0x8f,0x2a,0x46,0x82,0x0c,0x64,0xc8,0xe1,0x74,0xff,0x00,0x13,0xa9,
-0x11,0x06,0xc4,0xd3,0x64,0xce,0xd0,0xb7,0xdd,0x43,0x7b,0xd5,0x30,0x60,0x9b,0xb4,
-0xc5,0x32,0x55,0xbd,0xdc,0xb8,0x4f,0xa8,0x9e,0x4f,0xcb,0xce,0x9f,0x74,0xa1,0xfe,
-0x1f,0x6d,0x0e,0x7a,0x3e,0x75,0xfa,0x52,0x02,0x4c,0x95,0x7d,0x1e,0x38,0xc7,0x63,
-0x69,0x3e,0xb2,0xbc,0xd5,0xc7,0xf6,0x53,0x7a,0x97,0xac,0x70,0x32,0x96,0xb4,0x6c,
-0x9b,0xa0,0x69,0xc9,0x0e,0x71,0xbd,0xf5,0x5c,0x97,0x69,0xcd,0x5a,0xed,0x72,0xe7,
-0xc8,0xcf,0x53,0x19,0xa5,0x3c,0xb0,0x3b,0x48,0x48,0xce,0x07,0xc2,0xa8,0xdd,0xee,
-0x44,0xfb,0xbd,0xea,0x6d,0xca,0x5b,0x4e,0xa9,0xf9,0x4f,0x29,0xe5,0x9d,0xa7,0xb4,
-0x9c,0xe0,0x7b,0x05,0x5e,0xfa,0x2b,0x38,0x66,0x11,0x5f,0x4b,0xad,0x2a,0x29,0xcc,
-0xd6,0xd6,0xd6,0x54,0x25,0x0c,0x3e,0x3f,0xa2,0xe7,0xe5,0x35,0xbd,0x0d,0x3a,0x3b,
-0x5a,0x5f,0xe5,0x35,0x7b,0xe8,0xa6,0x45,0x75,0xbb,0xbf,0x29,0x43,0xc3,0x01,0xef,
-0x7c,0x7f,0x52,0x07,0xa0,0x2d,0x69,0x75,0x37,0x16,0xb4,0xd4,0xe6,0xde,0x95,0x09,
-0x48,0x51,0x61,0xd2,0x09,0x54,0x7d,0xa0,0x9d,0xa4,0xfd,0xce,0x30,0x3c,0x09,0x03,
-0xb3,0x80,0xcd,0xe9,0x7a,0x2b,0x52,0xba,0x3a,0xbd,0x17,0x47,0x2c,0xb2,0x5e,0x41,
-0xef,0x0a,0x4f,0x3c,0x7f,0x91,0xe7,0x53,0x1a,0x49,0xf4,0xff,0x00,0xae,0xa2,0x35,
-0x68,0x73,0x4d,0xdb,0x1e,0x4b,0xd2,0xdf,0x50,0xfa,0x52,0x9b,0x39,0x0d,0x20,0x1c,
-0xed,0x27,0xef,0x12,0x07,0x1d,0xc3,0xdf,0x58,0xb5,0xc6,0x59,0x83,0x98,0x2c,0xb6,
-0x73,0x04,0x14,0xe5,0x8f,0x75,0xfa,0xd9,0x21,0x43,0xaa,0xfb,0xc7,0xe3,0x56,0x8f,
-0xa0,0xcb,0x29,0xb5,0xe8,0x58,0xf2,0x5e,0x46,0xd9,0x17,0x03,0xf4,0x93,0x91,0xce,
-0xc3,0xf5,0x3f,0xc7,0x3f,0xdd,0x55,0xc3,0x41,0x58,0xdc,0xd4,0xba,0xae,0xdd,0x6b,
-0x48,0x57,0x56,0xeb,0x80,0xba,0xa1,0xf6,0x5b,0x1c,0xa8,0xfc,0x01,0xf3,0xc5,0x5c,
-0x3b,0xa4,0xd8,0xb6,0x3b,0x24,0x99,0x8e,0x80,0xdc,0x58,0x6c,0x15,0xed,0x4f,0x18,
-0x4a,0x47,0x00,0x7c,0x30,0x29,0xba,0xf9,0x89,0x02,0x31,0xcd,0x23,0xc3,0x29,0x83,
-0x5c,0x66,0x77,0x24,0x87,0xfe,0x21,0xb5,0x37,0xd2,0xef,0xcc,0xd8,0xa3,0xaf,0xf9,
-0x30,0x92,0x16,0xfe,0x3b,0xdd,0x50,0xc8,0x1e,0x49,0xc7,0xe6,0x34,0xae,0xb2,0x42,
-0x72,0xed,0x78,0x87,0x6f,0x60,0x12,0xe4,0x87,0x52,0xd8,0xf3,0x35,0xcf,0x74,0x9f,
-0x2a,0xf5,0x79,0x95,0x31,0xd4,0xa9,0xc9,0x52,0xde,0x53,0x84,0x24,0x12,0x4a,0x94,
-0x73,0x80,0x29,0xdb,0xd0,0x6f,0x47,0x33,0xe0,0x5c,0x93,0xa8,0x6f,0xec,0x2a,0x3a,
-0x90,0x82,0x22,0x46,0x58,0xc2,0xf2,0x46,0x0a,0xd4,0x3b,0xb8,0xc8,0x00,0xf3,0xce,
-0x78,0xc0,0xcb,0x19,0x8d,0xa6,0x84,0x0e,0xae,0x94,0x30,0xba,0xb2,0xa0,0xbb,0x91,
-0x3f,0x09,0xcd,0x66,0xb7,0x31,0x68,0xb4,0xc4,0x81,0x15,0x21,0x2c,0xc7,0x6c,0x36,
-0x9f,0x6e,0x3b,0xfc,0xfb,0x6b,0xb6,0x8a,0x2b,0x86,0x49,0x26,0xe5,0x7a,0x60,0x03,
-0x45,0x82,0xd7,0xd7,0x35,0x85,0x1e,0xb5,0x18,0x4a,0xb6,0xab,0xd6,0x1c,0x1f,0x03,
-0xed,0xac,0xb7,0xa7,0x7e,0xcd,0xc3,0x7e,0x33,0xb7,0x3c,0xe3,0xc6,0xa3,0x33,0x9f,
-0x6d,0xa5,0xde,0x54,0xdb,0xc8,0x6d,0x48,0x92,0xc1,0x38,0xdb,0xc9,0xc2,0x33,0x90,
-0x7c,0xfe,0x15,0xae,0x4c,0x85,0xc4,0x95,0x78,0x7e,0x34,0x82,0xb7,0x14,0xfb,0x2d,
-0x95,0x12,0x83,0xd5,0x20,0x84,0xe4,0x8c,0x8e,0x31,0x92,0x39,0xe0,0x77,0xf7,0xd6,
-0xc2,0x0b,0xed,0xd6,0xdf,0x69,0x63,0x53,0x87,0x71,0xd6,0xbf,0x4a,0x59,0x45,0x78,
-0x10,0x2e,0x9f,0x45,0x44,0xe7,0x2e,0x32,0x47,0xd1,0x23,0x84,0x1e,0xb5,0xc5,0xa1,
-0x4a,0x41,0x39,0xc8,0x25,0x03,0x1f,0x77,0x1d,0xfc,0xfb,0xab,0xc6,0xbb,0x5c,0x4c,
-0x8d,0x41,0x75,0x62,0x6e,0xa3,0x72,0xc7,0x1e,0x13,0x2d,0xbb,0x18,0x21,0x4d,0x20,
-0x3a,0x95,0x27,0x2a,0x79,0x45,0xc4,0x9d,0xc0,0x2b,0x29,0xc0,0xe0,0x6d,0x39,0xed,
-0x15,0x43,0x11,0x06,0xcb,0x66,0x4a,0xd7,0x8b,0x85,0x38,0xae,0x43,0x6d,0x82,0x4e,
-0x4c,0x28,0xd9,0xff,0x00,0xa9,0x3f,0x2a,0x5f,0xe8,0xdd,0x5a,0xf2,0xad,0xe8,0x91,
-0x7f,0xba,0xb4,0x94,0x39,0x60,0x89,0x35,0x0e,0x3c,0x12,0xd0,0x5b,0x85,0x4f,0xf5,
-0xab,0x03,0x8e,0xe0,0xd6,0x47,0x76,0x47,0x8f,0x3e,0x7d,0xb7,0x50,0xcc,0x9f,0xa6,
-0xe5,0xcf,0xbb,0x6a,0x87,0x2d,0x33,0x21,0xc0,0x8e,0xf3,0x2d,0x80,0xd2,0x43,0x9b,
-0xa3,0x36,0xe7,0x5c,0xa4,0xa9,0x24,0xac,0x29,0xc5,0x2d,0x38,0x4e,0x07,0xab,0x81,
-0x85,0x64,0xd4,0xe5,0xb8,0x15,0x38,0x81,0x4d,0x46,0x22,0x46,0x8e,0xa2,0xa6,0x23,
-0xb2,0xd2,0x88,0xc1,0x28,0x40,0x49,0xc7,0x95,0x6d,0x71,0x08,0x71,0x0a,0x43,0x89,
-0x0a,0x42,0x86,0x0a,0x54,0x32,0x0d,0x29,0x23,0x5c,0xaf,0xf3,0x34,0xed,0xd2,0xee,
-0x9d,0x41,0x31,0x99,0x11,0x9d,0x82,0xc3,0x2d,0xa5,0xa6,0x8b,0x60,0x3b,0x1a,0x2a,
-0x9c,0x51,0x05,0x1c,0x92,0x5e,0x59,0x1c,0xf0,0x71,0xdd,0x90,0x7a,0xf5,0x15,0xe6,
-0xf3,0x64,0xb8,0x3d,0x67,0x66,0x7c,0x99,0x11,0x4c,0x98,0xc1,0x53,0x1e,0x5b,0x48,
-0x75,0x94,0x3a,0xdb,0xc7,0x66,0xf5,0x27,0x60,0xca,0xda,0x48,0x0a,0x50,0xfb,0x64,
-0x0e,0x76,0xe0,0xca,0x3e,0x68,0xc4,0x3c,0x93,0x29,0x98,0x71,0x58,0x56,0xe6,0x23,
-0x32,0xda,0xbc,0x50,0x80,0x0f,0xf8,0xad,0xab,0x71,0x08,0x52,0x12,0xb5,0xa5,0x2a,
-0x59,0xda,0x90,0x4e,0x0a,0x8e,0x09,0xc0,0xf1,0xe0,0x13,0xe5,0x4a,0xdb,0x75,0xd2,
-0xf7,0x72,0x9d,0x06,0xd9,0xe9,0x67,0xd8,0x8a,0xab,0xa2,0xa3,0x99,0x0d,0x38,0xcb,
-0xcf,0x29,0x02,0x2b,0x8e,0x29,0xa2,0xe0,0x46,0xc2,0x42,0x92,0x9f,0x58,0x0c,0x80,
-0x70,0x79,0x19,0xac,0xe4,0x37,0x3a,0x75,0xef,0x4f,0xc7,0x93,0x76,0x9a,0xa5,0xc0,
-0xd4,0x0f,0xc4,0x4b,0xa9,0x0d,0x85,0x38,0x91,0x09,0xe7,0x12,0x55,0xea,0x63,0x70,
-0x07,0x66,0x46,0x32,0x32,0x71,0x9e,0x41,0x96,0x79,0x94,0x62,0xf2,0x09,0xa5,0x58,
-0xb8,0xe2,0x1b,0x00,0xb8,0xa4,0xa4,0x12,0x12,0x37,0x1c,0x64,0x93,0x80,0x29,0x47,
-0x60,0xd5,0x17,0xe9,0x52,0x2d,0x12,0x9c,0x79,0x6a,0x99,0x32,0x57,0x55,0x22,0x02,
-0xe4,0xb2,0x50,0x91,0xce,0xf6,0xd2,0xd2,0x53,0xd6,0x21,0x4d,0x80,0x79,0x27,0xec,
-0x9d,0xdc,0x1e,0x09,0x37,0x03,0x3a,0xd7,0xa5,0x67,0x4a,0xd4,0xcb,0x7a,0xe1,0x36,
-0xe7,0x08,0xbf,0x6d,0x3d,0x5e,0xc4,0xaf,0xad,0x49,0x53,0x69,0x40,0x4e,0xf4,0x16,
-0xc8,0xc7,0x27,0x3c,0x10,0xac,0x93,0x46,0x51,0xbe,0xa8,0xc6,0x9b,0x0a,0x8c,0xc2,
-0xb7,0x6e,0x61,0xa3,0xb8,0xe5,0x59,0x40,0xe4,0xfb,0x6b,0x24,0xb2,0xd2,0x4a,0x8a,
-0x5a,0x6d,0x25,0x63,0xd6,0xc2,0x40,0xcf,0xbe,0x8a,0x2b,0x3b,0x95,0x6c,0x21,0x7c,
-0x11,0xd9,0x0c,0x96,0x43,0x2d,0x86,0x8f,0xd8,0x09,0x1b,0x7e,0x15,0x8c,0x98,0x71,
-0xa5,0x29,0xa5,0x49,0x8e,0xcb,0xca,0x68,0xee,0x6c,0xb8,0x80,0xa2,0x83,0xe2,0x33,
-0xd8,0x68,0xa2,0x8b,0x94,0x58,0x2c,0x5d,0x81,0x0d,0xe4,0xb2,0x97,0xa2,0xc7,0x71,
-0x2c,0x9d,0xcd,0x05,0x36,0x0e,0xc3,0xe2,0x9e,0x38,0xf2,0xaf,0x02,0xf5,0xa3,0x20,
-0x5d,0x26,0xa9,0xf3,0x26,0x5c,0x50,0xe2,0x03,0x6e,0x34,0xc1,0x6f,0x6a,0x80,0x1b,
-0x78,0xdc,0x82,0x5b,0x3b,0x78,0xcb,0x65,0x27,0x00,0x73,0xc0,0xa2,0x8a,0xbc,0x67,
-0x55,0x0e,0xd9,0x48,0x18,0x87,0x19,0x88,0xe9,0x61,0xa6,0x1a,0x43,0x20,0x24,0x04,
-0x04,0x8c,0x7a,0xa0,0x01,0xf0,0x00,0x0f,0x21,0x59,0xbb,0x1d,0x97,0x52,0xe2,0x5d,
-0x65,0xb5,0xa5,0xd4,0xed,0x58,0x52,0x41,0x0a,0x1e,0x07,0xc4,0x72,0x68,0xa2,0xb3,
-0x56,0x5f,0x19,0x8b,0x1d,0x96,0xda,0x6d,0x96,0x1a,0x6d,0xb6,0xbf,0xdb,0x4a,0x10,
-0x00,0x47,0x77,0x03,0xbb,0xb4,0xd6,0x5d,0x4b,0x5b,0x82,0xba,0xa4,0x6e,0x0a,0xdf,
-0x9d,0xa3,0x3b,0xb1,0x8c,0xfb,0xf1,0xc6,0x68,0xa2,0x84,0x2c,0x11,0x0e,0x32,0x25,
-0x2e,0x4a,0x23,0xb2,0x99,0x2b,0x1b,0x56,0xe8,0x40,0x0b,0x50,0xf0,0x27,0xb4,0xd6,
-0x22,0x04,0x31,0x25,0x72,0x04,0x48,0xe2,0x42,0xf0,0x54,0xef,0x56,0x37,0x2b,0x1d,
-0x99,0x3d,0xa7,0x18,0xa2,0x8a,0x2e,0x85,0xff,0xd9,};
 
-static const unsigned int dummy_align__STM32F7xx_files_ST_gif = 1;
+static const unsigned int dummy_align__STM32F7xx_html_gz = 0;
+static const unsigned char data__STM32F7xx_html_gz[] = {
+/* /STM32F7xx.html.gz (19 chars) */
+0x2f,0x53,0x54,0x4d,0x33,0x32,0x46,0x37,0x78,0x78,0x2e,0x68,0x74,0x6d,0x6c,0x2e,
+0x67,0x7a,0x00,0x00,
+
+/* HTTP header */
+/* "HTTP/1.0 200 OK" (17 bytes) */
+0x48,0x54,0x54,0x50,0x2f,0x31,0x2e,0x30,0x20,0x32,0x30,0x30,0x20,0x4f,0x4b,0x0d,
+0x0a,
+/* "Server: disco-ptp" (19 bytes) */
+0x53,0x65,0x72,0x76,0x65,0x72,0x3a,0x20,0x64,0x69,0x73,0x63,0x6f,0x2d,0x70,0x74,
+0x70,0x0d,0x0a,
+/* "Content-Type: text/html" (25 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x54,0x79,0x70,0x65,0x3a,0x20,0x74,0x65,
+0x78,0x74,0x2f,0x68,0x74,0x6d,0x6c,0x0d,0x0a,
+/* "Content-Length: 2557" (22 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x4c,0x65,0x6e,0x67,0x74,0x68,0x3a,0x20,
+0x32,0x35,0x35,0x37,0x0d,0x0a,
+/* "ETag: "8edcb230-gz"" (21 bytes) */
+0x45,0x54,0x61,0x67,0x3a,0x20,0x22,0x38,0x65,0x64,0x63,0x62,0x32,0x33,0x30,0x2d,
+0x67,0x7a,0x22,0x0d,0x0a,
+/* "Cache-Control: no-cache" (25 bytes) */
+0x43,0x61,0x63,0x68,0x65,0x2d,0x43,0x6f,0x6e,0x74,0x72,0x6f,0x6c,0x3a,0x20,0x6e,
+0x6f,0x2d,0x63,0x61,0x63,0x68,0x65,0x0d,0x0a,
+/* "Content-Encoding: gzip" (24 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x45,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,
+0x3a,0x20,0x67,0x7a,0x69,0x70,0x0d,0x0a,
+/* "Vary: Accept-Encoding" (23 bytes) */
+0x56,0x61,0x72,0x79,0x3a,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2d,0x45,0x6e,0x63,
+0x6f,0x64,0x69,0x6e,0x67,0x0d,0x0a,
+/* "" (2 bytes) */
+0x0d,0x0a,
+/* raw file data (2557 bytes) */
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xed,0x5a,0x6d,0x6f,0xdb,0x38,
+0x12,0xfe,0xee,0x5f,0xc1,0x13,0xd0,0xbb,0x16,0xa8,0x2c,0xdb,0x49,0x9a,0xac,0xe3,
+0x04,0x48,0x9d,0x06,0x2d,0xae,0xd9,0x0d,0x62,0xf7,0x16,0xf7,0xa9,0xa0,0x25,0xda,
+0xe6,0x86,0x12,0x75,0x24,0x1d,0xc7,0xfd,0x47,0xf7,0x2f,0xef,0x19,0x8a,0x7e,0xb7,
+0xd3,0x34,0xdb,0x5d,0x14,0x77,0x57,0x20,0xb6,0x25,0x91,0xf3,0x3e,0xcf,0x0c,0x47,
+0xed,0xfc,0xe5,0xf2,0x97,0x6e,0xff,0x9f,0x37,0xef,0xd8,0xfb,0xfe,0xf5,0x47,0x76,
+0xf3,0xe9,0xed,0xc7,0x0f,0x5d,0x16,0xc5,0x49,0xf2,0xeb,0x41,0x37,0x49,0x2e,0xfb,
+0x97,0xd5,0x83,0xc3,0x7a,0xa3,0xc9,0xfa,0x86,0x17,0x56,0x3a,0xa9,0x0b,0xae,0x92,
+0xe4,0xdd,0xcf,0xd1,0x79,0xad,0x33,0x76,0xb9,0x62,0x0f,0xb9,0x2a,0x6c,0xfb,0xfe,
+0x2c,0x9a,0x98,0xa2,0x6d,0xd3,0xb1,0xc8,0xb9,0x8d,0x73,0x99,0x1a,0x6d,0xf5,0xd0,
+0xc5,0xa9,0xce,0xdb,0xf7,0xb9,0x8a,0xc2,0x3a,0xfd,0xd8,0x3a,0x3d,0x1c,0xca,0x54,
+0x84,0xaf,0xf9,0x8e,0xe9,0x13,0x76,0x4c,0xb5,0xc9,0xc2,0xfa,0xb3,0x68,0xec,0x5c,
+0xd9,0x4e,0x92,0xe9,0x74,0x5a,0x9f,0x1e,0xd4,0xb5,0x19,0x25,0xfd,0xdb,0xe4,0xf6,
+0x5d,0x37,0x26,0x71,0x0f,0x1b,0xd1,0x79,0x67,0x2c,0x78,0x06,0xf1,0x73,0xe1,0x38,
+0xa3,0xd5,0xb1,0xf8,0xd7,0x44,0x42,0x83,0xae,0x2e,0x9c,0x28,0x5c,0xdc,0x9f,0x95,
+0x60,0x9f,0x56,0x57,0x67,0x91,0x13,0x0f,0x2e,0xa1,0xcd,0xa7,0x2c,0x1d,0x73,0x63,
+0x85,0x3b,0x93,0x56,0xc7,0x27,0x27,0x47,0x3f,0xc5,0x4d,0xb2,0x83,0x92,0xc5,0x1d,
+0x33,0x42,0x9d,0x45,0x57,0x52,0x89,0xf8,0xa3,0xb4,0x2e,0x62,0x63,0x23,0x86,0x67,
+0x51,0xaf,0x7f,0x7d,0xd0,0xba,0x3a,0x7e,0x78,0xf8,0x3c,0xc4,0x23,0x9b,0xd0,0xa7,
+0xc2,0xf3,0x3a,0x84,0x5d,0xdf,0xfa,0x2e,0x93,0xe0,0x2c,0x73,0x11,0x5f,0x72,0xc7,
+0xf7,0xed,0x17,0x58,0x95,0xe1,0x79,0x3d,0xb7,0x1a,0x9a,0x38,0xe9,0x94,0x38,0x5f,
+0x2c,0xea,0x24,0xd5,0x8d,0x5a,0xad,0x93,0x04,0x25,0x07,0x3a,0x9b,0x31,0xeb,0x66,
+0x4a,0x9c,0x45,0x11,0x53,0xbc,0x18,0x81,0xd5,0xcf,0xf1,0xa7,0x1e,0x2e,0xc0,0xfb,
+0x2c,0x1a,0xa8,0x09,0x94,0xbd,0x5f,0xb9,0xc0,0xae,0x4c,0xde,0xb3,0x54,0x71,0x0b,
+0x73,0xf6,0x44,0x4a,0x5e,0x6f,0xce,0x6f,0x07,0x5a,0x39,0x37,0x23,0x59,0xc4,0x4a,
+0x0c,0x5d,0x9b,0x1d,0x34,0x4a,0x77,0x4a,0x0b,0xca,0xf9,0xae,0x6b,0xab,0x7f,0xd6,
+0x26,0xe7,0x70,0x7c,0xd8,0x40,0x56,0x8c,0xb9,0x92,0xa3,0xa2,0xcd,0x52,0xd8,0x55,
+0x98,0xd3,0x88,0xf9,0xeb,0xb3,0xa8,0xba,0x86,0x3e,0x32,0x1f,0xe1,0x9e,0x23,0x51,
+0x65,0x76,0x16,0x7d,0x7e,0x68,0xe0,0xdf,0x67,0xd9,0x6c,0xb4,0x8e,0x40,0xc8,0xa4,
+0xdb,0x06,0xe9,0xf5,0xeb,0x23,0x39,0x5c,0x70,0x19,0x20,0x12,0x84,0x69,0xb3,0x46,
+0xf9,0xc0,0xac,0x56,0x32,0x63,0xa7,0x6c,0x2a,0x33,0x37,0x6e,0xb3,0xe3,0x37,0x6f,
+0xca,0x87,0x53,0x36,0x16,0x72,0x34,0x86,0xcc,0x47,0x27,0xb8,0x02,0xcb,0x01,0xb8,
+0x9e,0x77,0x6c,0xc9,0x8b,0x39,0x8d,0x21,0x1c,0x1f,0x5b,0xf9,0x45,0xb4,0x59,0xeb,
+0xd0,0x2b,0xd6,0x19,0x18,0x28,0x67,0x9d,0xd1,0xc5,0x68,0x69,0x6d,0xf6,0xab,0x18,
+0x58,0x61,0xee,0x85,0x61,0x97,0x22,0xd7,0x9d,0x24,0x2c,0xc0,0x0f,0x50,0xc3,0x17,
+0xe8,0x26,0x83,0xbd,0xb4,0x9b,0x07,0xf5,0x23,0x4f,0x9d,0xcd,0x37,0x3c,0xb2,0xf6,
+0x04,0x2b,0x99,0xbf,0x31,0xe4,0xb9,0x54,0xb3,0x36,0xfb,0x87,0x30,0x19,0x2f,0x38,
+0x62,0x52,0x2b,0x0d,0x8d,0xcd,0x68,0xf0,0xf2,0xa8,0xf9,0x9a,0xd1,0x5f,0xeb,0xe8,
+0xe8,0xd5,0x5c,0xec,0xb7,0xdc,0x8a,0x8c,0xe9,0x82,0xb9,0xb1,0x60,0x6a,0xfa,0xe1,
+0x86,0xf5,0xbb,0x37,0x09,0xbe,0xac,0xe3,0xe9,0xdd,0x82,0x37,0x09,0x9a,0x94,0xeb,
+0xae,0x7f,0x9e,0x13,0x81,0x0b,0x66,0xe3,0x1e,0x23,0x2d,0xce,0xa2,0x56,0x54,0xf9,
+0xe2,0x2c,0x6a,0x36,0x1a,0x2f,0x20,0x5f,0x02,0x66,0x81,0xe5,0x66,0x24,0x6c,0x19,
+0x62,0x1a,0xfc,0x36,0xd0,0x2a,0x23,0xdd,0x82,0xdc,0x4f,0x5c,0x57,0xeb,0x38,0x3e,
+0x50,0x62,0xbe,0x32,0x84,0xc4,0x4f,0x6f,0x9a,0xab,0x21,0x81,0x30,0x46,0x48,0xb0,
+0x2a,0x86,0x20,0x24,0x30,0x40,0x28,0x55,0xf2,0x2c,0x93,0x94,0x36,0xad,0xea,0x1a,
+0xf4,0xd2,0x70,0x4d,0x64,0x29,0xc1,0xe8,0x9b,0x22,0xc4,0x65,0x6b,0xa2,0x6c,0xb9,
+0x6a,0x5b,0xc0,0xea,0x96,0xdf,0xd4,0x66,0xd2,0xc1,0x0a,0xe9,0x29,0x1b,0xc0,0x31,
+0x23,0xa3,0x27,0x45,0x16,0xef,0x73,0x2e,0xdb,0xe5,0x09,0x58,0x03,0xce,0x52,0xe7,
+0x1d,0x1e,0xd0,0x23,0x59,0xc4,0x6a,0x9d,0xf0,0x6b,0xc3,0xac,0x81,0xf6,0x74,0x2c,
+0x9d,0xc0,0xe6,0xf7,0x3a,0x17,0xb5,0x92,0x8f,0xc4,0x22,0x24,0x38,0x59,0xaf,0xa2,
+0x98,0xb8,0xec,0x47,0xd0,0x8f,0x6f,0xc2,0xe2,0xc5,0x65,0x77,0x97,0x6a,0x8f,0x45,
+0x0c,0xa9,0xb5,0xd7,0x4e,0xfd,0x8b,0xde,0xdf,0x7b,0x4f,0x30,0x16,0x61,0x7c,0x4d,
+0x0f,0x99,0xe3,0xf6,0xce,0xee,0x37,0x58,0xe2,0xc3,0x22,0x99,0x07,0x49,0xe2,0x83,
+0x90,0x7e,0xec,0x0d,0xfc,0x79,0xa0,0x6e,0xa6,0x60,0x9f,0xee,0x2e,0x61,0x6e,0x61,
+0xc1,0x20,0x12,0x2b,0x74,0x21,0x50,0x48,0x4a,0xc1,0x1d,0xb3,0x28,0x91,0x4a,0xb1,
+0xc6,0x0b,0x76,0xd4,0x78,0x71,0xca,0xe2,0x5c,0x7f,0x89,0x57,0x6d,0xae,0x64,0x09,
+0x67,0x14,0xa8,0xe6,0x5c,0x6d,0x3f,0xd6,0x46,0x02,0xd9,0x1f,0x59,0x20,0x0b,0x14,
+0x0b,0x11,0x97,0x80,0xd7,0x74,0xb6,0xb2,0x2e,0x24,0xd5,0xd1,0xf1,0x61,0x05,0x6c,
+0x8b,0x44,0x6a,0x6c,0x24,0x52,0x63,0x23,0x91,0x1a,0x0b,0x5c,0x00,0x46,0xaf,0x27,
+0xd5,0xa2,0x74,0xad,0x45,0x5f,0xa0,0x04,0x98,0x4f,0x73,0xf0,0xb9,0x0f,0x36,0x74,
+0xba,0x7c,0xaa,0x01,0x83,0xac,0x84,0x43,0xcf,0x12,0xb4,0x02,0xb0,0x6f,0x90,0xb4,
+0x55,0x6f,0x1d,0x85,0x22,0x59,0xc9,0xb7,0x8f,0xe7,0xc1,0x37,0xf0,0xac,0x58,0xad,
+0xaa,0xbf,0x30,0x64,0xcb,0x2f,0x1d,0x37,0x77,0x46,0xf1,0x8e,0x5a,0xe1,0x33,0xa0,
+0x76,0x15,0x1f,0xb3,0x9e,0x30,0x52,0x2c,0x63,0x1a,0x24,0x76,0xd6,0xf5,0xfd,0xb5,
+0xaa,0xb1,0xb7,0x56,0x45,0xe7,0x7d,0x14,0x21,0xcf,0x8a,0x5d,0x1d,0xb3,0x4c,0xdc,
+0xa3,0x7b,0xb3,0x8c,0x1b,0xe1,0xab,0x13,0xda,0x38,0x95,0xfd,0xcd,0xb2,0xa1,0x34,
+0xd6,0xb1,0x8b,0xdb,0x6b,0xd6,0xd5,0x06,0x40,0x10,0x5f,0x1f,0x03,0x33,0xa8,0x8c,
+0x1d,0xb4,0xe2,0x81,0x74,0xcc,0x37,0x81,0xd4,0x9f,0x51,0x9c,0x0b,0x63,0x5f,0x33,
+0x34,0x65,0x0e,0xe6,0xf2,0x64,0x06,0xa2,0x48,0xc7,0xe8,0x4f,0xee,0x10,0x9a,0xac,
+0x14,0x66,0x48,0x02,0x17,0xa9,0xa8,0x57,0x65,0x9c,0x3e,0xfa,0xfc,0x8e,0x56,0xf3,
+0xec,0x9e,0x17,0x0e,0x90,0xc7,0x90,0xca,0xbd,0x3e,0x58,0x5f,0xdc,0xf6,0xd9,0x45,
+0x0a,0x07,0x08,0xc3,0x9d,0x46,0x1d,0xb3,0x6c,0x0a,0x6f,0xd0,0x37,0x94,0xfd,0xd8,
+0x64,0x29,0x47,0x23,0xfa,0xda,0xf3,0xd9,0xd2,0x23,0x43,0x6b,0x47,0xdd,0x00,0x3d,
+0xcc,0xf9,0x83,0xcc,0x27,0x39,0xfd,0xd6,0x46,0x38,0x99,0x72,0xb5,0x2a,0x0b,0x31,
+0xa4,0x65,0x4b,0x05,0x0b,0x8d,0x3d,0x0e,0x18,0x80,0x84,0x16,0x78,0x64,0x50,0xd8,
+0x33,0xc1,0xa4,0x65,0xe2,0x41,0xa4,0x13,0x07,0xed,0x87,0x46,0xe7,0x4c,0xe4,0x03,
+0x91,0x65,0xb8,0xba,0x82,0x47,0xc6,0x0c,0x32,0x02,0x29,0x85,0x41,0x5b,0xce,0xae,
+0xd1,0x85,0x98,0x99,0x8f,0xea,0x06,0x51,0x16,0xd7,0x30,0x42,0x72,0xd8,0x3a,0x61,
+0x97,0xd7,0x1f,0x6e,0x7a,0x0c,0xd0,0xd0,0xc2,0x93,0xeb,0xf7,0x5f,0xd8,0xb0,0x7b,
+0xf3,0x69,0x69,0x0e,0x00,0xe1,0x7e,0xe0,0x0c,0x18,0xb9,0xd2,0x56,0xa3,0x7d,0x45,
+0xf3,0x9d,0x84,0x06,0x19,0x6d,0xcf,0x67,0xba,0x14,0x45,0x52,0x1a,0x9d,0x4d,0x52,
+0x67,0x93,0x4d,0x07,0x61,0x4d,0x0e,0xdf,0x55,0xee,0x8b,0xb9,0xc9,0x01,0xfc,0x5e,
+0xf1,0x3c,0x9d,0x84,0x87,0xc3,0xe3,0xd8,0xfa,0xc8,0xab,0xd0,0x17,0xc8,0x6a,0x46,
+0xe8,0xb4,0xa3,0xcf,0x03,0x34,0xad,0x77,0x2b,0x91,0xe3,0x5b,0xaf,0x31,0x8a,0x15,
+0xab,0x8a,0x15,0x5f,0x22,0xfb,0xbc,0x48,0x85,0x24,0x68,0xf9,0x1e,0x63,0x7e,0x33,
+0x64,0x89,0x21,0xdd,0xa2,0x9d,0x49,0xd3,0x7a,0xf3,0x62,0xde,0xeb,0xf9,0x0f,0xea,
+0x46,0xd7,0xf1,0xe2,0xb0,0xd1,0x58,0x6d,0x18,0x9a,0x27,0x55,0xc7,0x10,0x5a,0xd6,
+0x9d,0x0d,0xaa,0x57,0xae,0xfe,0x5b,0x39,0x8a,0xbe,0x5a,0x14,0x56,0x9e,0x7e,0x0b,
+0x9e,0xec,0x4c,0x4e,0xdd,0x2e,0xcf,0xff,0x5a,0x0c,0x6c,0x79,0xda,0x49,0xe8,0x77,
+0xd5,0xdc,0x3d,0x8b,0xc5,0xef,0xc0,0xd7,0xa3,0xc6,0x71,0xfd,0xf0,0x99,0xb5,0xe0,
+0xcd,0xf1,0xf1,0x73,0x10,0x96,0xad,0xd6,0xc6,0x4d,0xa0,0xfb,0x91,0xca,0x64,0xe3,
+0xb0,0xde,0xf2,0xa6,0x59,0xe8,0xdb,0x8a,0x9e,0x02,0xb5,0x1b,0x9d,0xc8,0xdc,0xc9,
+0xa1,0x1d,0x0e,0x47,0x90,0x2d,0x6c,0xde,0x77,0x6c,0x98,0x93,0xb9,0x18,0xe8,0x89,
+0x03,0x24,0x49,0x5b,0xcb,0x00,0x23,0x05,0x08,0x71,0x3a,0xf7,0x2d,0x72,0xeb,0xd9,
+0x94,0x3b,0x55,0xf8,0x55,0x9f,0x81,0xd8,0x32,0x16,0x97,0x8e,0x9c,0x1f,0xdd,0x72,
+0x9c,0x71,0x01,0x9c,0xde,0x53,0xa7,0x6c,0xa3,0xd4,0x07,0x5b,0x1d,0xee,0xb3,0xd4,
+0xdc,0x1a,0xfb,0x83,0x7d,0x91,0xbb,0xcd,0x95,0x8a,0xbc,0x3f,0x9a,0x36,0xbc,0xc5,
+0xb6,0xb6,0xef,0x44,0x92,0xa7,0xfa,0xf2,0xe9,0x65,0x13,0x7e,0x99,0x2e,0x8e,0x9b,
+0x28,0x0a,0x1c,0x96,0x31,0x8e,0xca,0x08,0x67,0x6b,0x0e,0xc3,0xfd,0xf4,0x8e,0x4a,
+0x1a,0xaa,0x92,0x50,0xba,0x5c,0x1e,0xfe,0x20,0x60,0x4d,0xd1,0xcd,0x79,0xf1,0xd9,
+0x3a,0x0d,0xd6,0xd9,0x4a,0x89,0x1c,0x8b,0x05,0x29,0x42,0x72,0x2e,0x0b,0xcb,0x0a,
+0x44,0x34,0xe3,0x65,0x89,0x90,0xf6,0xcc,0x6c,0x7b,0xcd,0xa5,0x5a,0xf9,0x91,0xc6,
+0xf3,0x74,0xbc,0x58,0x21,0x5b,0x33,0x93,0xa2,0xa0,0x0a,0x2d,0x89,0x0c,0x2f,0x32,
+0xae,0x28,0x1c,0x5e,0x4e,0xa5,0x1b,0x53,0x9c,0x82,0xfa,0x6d,0xff,0x97,0xde,0xab,
+0x25,0x7b,0x70,0x85,0xaf,0xbd,0x00,0x13,0xb5,0x73,0x48,0x71,0xe8,0xb1,0xfa,0xf7,
+0x08,0x58,0x5b,0x1c,0xf8,0xeb,0x21,0xce,0x76,0x84,0xb6,0x17,0xe4,0xd9,0x2c,0x58,
+0xff,0xaa,0x0f,0x67,0x54,0x4c,0xbe,0x1b,0xcd,0xee,0x0d,0x13,0xe9,0x58,0xd7,0x00,
+0x69,0x28,0xd8,0xab,0x0e,0xfc,0xee,0x2c,0x42,0x84,0xfe,0x01,0x2c,0x3e,0x5d,0xfe,
+0xe1,0x5a,0x2c,0x58,0x6c,0x6b,0xb1,0x0e,0xb3,0x21,0xdc,0x26,0xca,0x07,0x3d,0x85,
+0xa8,0x71,0x61,0x20,0xf0,0x5d,0xc3,0x9f,0xe2,0x9d,0x5d,0x19,0x21,0x28,0xda,0x19,
+0x92,0x99,0x72,0x1c,0xf7,0xed,0xcc,0x3a,0x91,0xff,0xb9,0xd1,0xbf,0x1c,0x77,0xd5,
+0x06,0xf3,0x99,0x52,0x21,0x1c,0xb0,0xa1,0x60,0x17,0x37,0x1f,0xbe,0x5b,0xb4,0xee,
+0x60,0x63,0x75,0x7a,0x27,0xdc,0x77,0xe5,0x42,0xb0,0x07,0x77,0xd7,0xc8,0xdd,0x6c,
+0xdb,0xdd,0x6c,0xa7,0x8a,0xfb,0x83,0x00,0x56,0x77,0xb3,0x12,0x12,0x64,0xd2,0xa6,
+0xd1,0xe2,0xf6,0x23,0xf3,0xd0,0xaf,0xf4,0x68,0x7f,0x7a,0x5d,0xfc,0x7f,0x57,0xf5,
+0x87,0x75,0x55,0x1f,0x51,0x67,0xff,0xeb,0xfa,0xa8,0x10,0x2f,0x10,0x92,0x64,0xf1,
+0xd3,0xd1,0xaf,0xf6,0x50,0xf3,0xc3,0xc0,0x7a,0x87,0xff,0x48,0x92,0x04,0x08,0x1b,
+0x68,0xe7,0x74,0x8e,0x9c,0x6e,0x55,0xe3,0xf8,0xe7,0xa4,0x3c,0x35,0x3b,0xaf,0x6b,
+0x38,0xa1,0x16,0x88,0xa3,0x14,0xb9,0xad,0xa8,0x91,0xab,0x8e,0xba,0x0c,0x8f,0x7c,
+0x53,0x55,0x10,0xc6,0x12,0xde,0x4c,0x0c,0xce,0xe8,0x6b,0x83,0xf2,0x65,0x3b,0x35,
+0x98,0xd5,0x2e,0x32,0x9e,0xb3,0xcb,0x49,0x71,0x27,0x94,0xa5,0x63,0xb5,0x1f,0x07,
+0x4c,0x61,0x70,0x9c,0xc8,0x3f,0xa0,0x15,0x93,0x0e,0x07,0x76,0x6a,0xb3,0xba,0x3a,
+0x2f,0x27,0x74,0xa8,0xef,0xa5,0x28,0x5a,0xa0,0x89,0x5e,0x06,0x9c,0x6a,0x39,0xda,
+0x29,0x6a,0xa9,0x40,0xae,0xd0,0x53,0x90,0x44,0x1b,0xe7,0xc7,0x1f,0x64,0x1b,0x6a,
+0xb8,0xf2,0x7c,0x82,0xd0,0x9e,0x11,0x8d,0x39,0x67,0x63,0x57,0x26,0x18,0xbe,0x77,
+0x1b,0x22,0xe1,0x26,0x46,0xa0,0x0b,0x5b,0xdc,0x8f,0xa1,0x0b,0x7b,0xf9,0x81,0x86,
+0x89,0x40,0x2e,0x76,0x63,0xb4,0xc3,0x41,0x5c,0xbd,0x42,0xa6,0xa4,0x6a,0x42,0x7e,
+0xf1,0x5d,0x1d,0x1e,0x0d,0xb5,0x99,0x72,0xe3,0xef,0x68,0x42,0xbf,0x7c,0xa2,0x9c,
+0x2c,0x95,0xa8,0x61,0x1f,0x44,0xa1,0xe9,0x09,0x88,0x0c,0x79,0x2a,0xec,0x9c,0x72,
+0xf7,0x7a,0x95,0x76,0xb7,0x3a,0xdf,0xb3,0x6b,0x61,0x2d,0x75,0x89,0x4b,0x5e,0x20,
+0xcd,0xe6,0x54,0xbc,0xa6,0xa2,0xe0,0x41,0x79,0x9c,0x2e,0x06,0x93,0x11,0x9c,0x3a,
+0x0a,0x44,0xa9,0xe6,0xbe,0xfc,0x64,0xe9,0x25,0x0a,0x77,0x7c,0x64,0x60,0xd8,0x5d,
+0x42,0x8b,0x07,0x18,0x40,0xe6,0x28,0xfc,0x5c,0xd1,0x9e,0x58,0x21,0x2b,0x6a,0x34,
+0xfa,0x28,0x2c,0x95,0xcc,0x40,0x8d,0xfa,0x90,0x97,0xfe,0x5d,0x65,0x2e,0x2d,0x3d,
+0x58,0x48,0xb9,0x24,0xea,0x8b,0x2a,0x30,0x7d,0x24,0xac,0x87,0xfa,0x30,0xa7,0x78,
+0x8d,0x96,0xb2,0x5f,0xa3,0x7b,0x79,0x55,0x02,0xc8,0x55,0x43,0x6e,0x1d,0x90,0x2d,
+0x25,0x0b,0xcd,0x92,0x70,0xe5,0x2a,0xfa,0x2e,0xf0,0xec,0x95,0x22,0x05,0x06,0x21,
+0x04,0x33,0x66,0xf8,0x94,0x2a,0x85,0xb7,0x80,0x28,0xc6,0xdc,0x47,0xda,0xca,0xdc,
+0x27,0x6c,0xf9,0xa5,0xac,0xde,0xa4,0xb2,0xb7,0xc2,0x20,0x86,0xc4,0x8c,0x46,0xdd,
+0x77,0x62,0xa5,0xd0,0x85,0x85,0x97,0xef,0x49,0xa1,0xcb,0x59,0x81,0x78,0x4e,0xd9,
+0x7b,0x6d,0xbd,0xd9,0x87,0x72,0x34,0x09,0xdd,0xfe,0x42,0xad,0xb0,0xe1,0xe6,0x06,
+0xeb,0x6f,0x34,0x6c,0x1e,0x3b,0x1d,0xfb,0x1f,0x5b,0x6b,0x2e,0x6e,0xb1,0xe6,0x22,
+0xcb,0x10,0x39,0x96,0xdd,0x0a,0xab,0xd5,0x64,0x9d,0x96,0x17,0xff,0x1d,0x0d,0xa1,
+0xe0,0xc5,0x65,0x6c,0x5d,0xe1,0x6e,0xae,0x8d,0x80,0x5b,0xbc,0x3e,0xbe,0x57,0x61,
+0x33,0x3d,0x61,0x29,0x32,0xc7,0x88,0x21,0xcd,0xbe,0x74,0x35,0xca,0x43,0x11,0x87,
+0x83,0xda,0x2c,0x00,0x09,0x5f,0x9f,0x22,0x59,0x7e,0xcf,0x8b,0x82,0x8f,0xeb,0x40,
+0xa7,0x51,0x31,0xf1,0x6f,0x69,0x91,0x9a,0xbf,0x09,0x1a,0x1e,0xa9,0xa9,0x2c,0x93,
+0xe8,0xfc,0xc9,0x4b,0x6b,0x7e,0x06,0xf4,0x28,0x3a,0xee,0x1b,0xb9,0xec,0x1d,0x9d,
+0xec,0x1b,0x9a,0x3c,0x3e,0xb5,0xd9,0x7e,0xba,0x8a,0x54,0x40,0x87,0x52,0x71,0x80,
+0x12,0x41,0xf2,0x1e,0x40,0xff,0x8e,0xef,0x05,0x06,0x8a,0x60,0xeb,0x7f,0xf7,0xbd,
+0x00,0x5b,0x9f,0xf1,0x6f,0x0c,0xd1,0x77,0x7a,0x9e,0x06,0x7e,0x1b,0xef,0x9d,0x4f,
+0xc2,0x58,0x0f,0x48,0x44,0x73,0xc9,0x98,0x66,0x8e,0x36,0xf6,0x43,0xbd,0xcf,0xd4,
+0x17,0xd2,0xdb,0xf1,0x7b,0x00,0x75,0x98,0xf6,0x95,0xf2,0x41,0xa8,0xea,0x8d,0xf4,
+0x8a,0x96,0xd5,0xd0,0xc0,0xbf,0x51,0x9c,0x8b,0x11,0x3d,0x2d,0xb8,0xaa,0x78,0xf8,
+0xbd,0xaf,0xd5,0xbf,0x1a,0x85,0xeb,0x5d,0xe8,0x4a,0xfa,0x3c,0x3b,0x12,0x7f,0x48,
+0xa7,0x93,0x36,0xe4,0xdf,0xa1,0xd6,0x41,0x95,0x85,0x65,0x95,0x18,0x7d,0xa3,0x55,
+0x2f,0x90,0x4a,0x7e,0x98,0x6c,0x91,0x5f,0xfe,0x04,0x91,0xb1,0x7f,0xb7,0x1a,0xcd,
+0x37,0xb5,0x5e,0xff,0x9a,0xe6,0xdf,0xc0,0xf5,0x94,0x9a,0x3d,0x99,0xda,0xb5,0x76,
+0xaa,0xf2,0xe9,0x73,0x1d,0xbf,0xf7,0xd8,0x10,0xc8,0x86,0x2f,0x4f,0xb0,0xe3,0xff,
+0xdb,0xca,0xf9,0x7f,0x00,0x30,0xb2,0xdc,0x8e,0xe9,0x23,0x00,0x00,};
+
+
+static const unsigned int dummy_align__STM32F7xx_files_ST_gif = 0;
 static const unsigned char data__STM32F7xx_files_ST_gif[] = {
 /* /STM32F7xx_files/ST.gif (24 chars) */
 0x2f,0x53,0x54,0x4d,0x33,0x32,0x46,0x37,0x78,0x78,0x5f,0x66,0x69,0x6c,0x65,0x73,
 0x2f,0x53,0x54,0x2e,0x67,0x69,0x66,0x00,
 
 /* HTTP header */
-/* "HTTP/1.0 200 OK
-" (17 bytes) */
+/* "HTTP/1.0 200 OK" (17 bytes) */
 0x48,0x54,0x54,0x50,0x2f,0x31,0x2e,0x30,0x20,0x32,0x30,0x30,0x20,0x4f,0x4b,0x0d,
 0x0a,
-/* "Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)
-" (63 bytes) */
-0x53,0x65,0x72,0x76,0x65,0x72,0x3a,0x20,0x6c,0x77,0x49,0x50,0x2f,0x31,0x2e,0x33,
-0x2e,0x31,0x20,0x28,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x73,0x61,0x76,0x61,0x6e,
-0x6e,0x61,0x68,0x2e,0x6e,0x6f,0x6e,0x67,0x6e,0x75,0x2e,0x6f,0x72,0x67,0x2f,0x70,
-0x72,0x6f,0x6a,0x65,0x63,0x74,0x73,0x2f,0x6c,0x77,0x69,0x70,0x29,0x0d,0x0a,
-/* "Content-type: image/gif
-
-" (27 bytes) */
-0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x74,0x79,0x70,0x65,0x3a,0x20,0x69,0x6d,
-0x61,0x67,0x65,0x2f,0x67,0x69,0x66,0x0d,0x0a,0x0d,0x0a,
+/* "Server: disco-ptp" (19 bytes) */
+0x53,0x65,0x72,0x76,0x65,0x72,0x3a,0x20,0x64,0x69,0x73,0x63,0x6f,0x2d,0x70,0x74,
+0x70,0x0d,0x0a,
+/* "Content-Type: image/gif" (25 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x54,0x79,0x70,0x65,0x3a,0x20,0x69,0x6d,
+0x61,0x67,0x65,0x2f,0x67,0x69,0x66,0x0d,0x0a,
+/* "Content-Length: 4852" (22 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x4c,0x65,0x6e,0x67,0x74,0x68,0x3a,0x20,
+0x34,0x38,0x35,0x32,0x0d,0x0a,
+/* "ETag: "a14f8076"" (18 bytes) */
+0x45,0x54,0x61,0x67,0x3a,0x20,0x22,0x61,0x31,0x34,0x66,0x38,0x30,0x37,0x36,0x22,
+0x0d,0x0a,
+/* "Cache-Control: max-age=86400" (30 bytes) */
+0x43,0x61,0x63,0x68,0x65,0x2d,0x43,0x6f,0x6e,0x74,0x72,0x6f,0x6c,0x3a,0x20,0x6d,
+0x61,0x78,0x2d,0x61,0x67,0x65,0x3d,0x38,0x36,0x34,0x30,0x30,0x0d,0x0a,
+/* "" (2 bytes) */
+0x0d,0x0a,
 /* raw file data (4852 bytes) */
 0x47,0x49,0x46,0x38,0x39,0x61,0xfe,0x02,0x3a,0x00,0xf7,0x00,0x00,0x14,0x46,0x54,
 0x6b,0xa2,0xb3,0x0c,0x72,0x94,0x54,0x73,0x8c,0xac,0xd3,0xdc,0x15,0x56,0x7c,0x33,
@@ -517,28 +1233,224 @@ static const unsigned char data__STM32F7xx_files_ST_gif[] = {
 0xca,0x80,0x03,0x45,0x5c,0xa2,0x5a,0xfc,0x14,0x3c,0x2a,0xa0,0xea,0xa9,0xa3,0x7f,
 0x12,0x10,0x00,0x3b,};
 
-static const unsigned int dummy_align__STM32F7xx_files_stm32_jpg = 2;
+
+static const unsigned int dummy_align__STM32F7xx_files_logo_jpg = 0;
+static const unsigned char data__STM32F7xx_files_logo_jpg[] = {
+/* /STM32F7xx_files/logo.jpg (26 chars) */
+0x2f,0x53,0x54,0x4d,0x33,0x32,0x46,0x37,0x78,0x78,0x5f,0x66,0x69,0x6c,0x65,0x73,
+0x2f,0x6c,0x6f,0x67,0x6f,0x2e,0x6a,0x70,0x67,0x00,0x00,0x00,
+
+/* HTTP header */
+/* "HTTP/1.0 200 OK" (17 bytes) */
+0x48,0x54,0x54,0x50,0x2f,0x31,0x2e,0x30,0x20,0x32,0x30,0x30,0x20,0x4f,0x4b,0x0d,
+0x0a,
+/* "Server: disco-ptp" (19 bytes) */
+0x53,0x65,0x72,0x76,0x65,0x72,0x3a,0x20,0x64,0x69,0x73,0x63,0x6f,0x2d,0x70,0x74,
+0x70,0x0d,0x0a,
+/* "Content-Type: image/jpeg" (26 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x54,0x79,0x70,0x65,0x3a,0x20,0x69,0x6d,
+0x61,0x67,0x65,0x2f,0x6a,0x70,0x65,0x67,0x0d,0x0a,
+/* "Content-Length: 2554" (22 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x4c,0x65,0x6e,0x67,0x74,0x68,0x3a,0x20,
+0x32,0x35,0x35,0x34,0x0d,0x0a,
+/* "ETag: "e96f0dca"" (18 bytes) */
+0x45,0x54,0x61,0x67,0x3a,0x20,0x22,0x65,0x39,0x36,0x66,0x30,0x64,0x63,0x61,0x22,
+0x0d,0x0a,
+/* "Cache-Control: max-age=86400" (30 bytes) */
+0x43,0x61,0x63,0x68,0x65,0x2d,0x43,0x6f,0x6e,0x74,0x72,0x6f,0x6c,0x3a,0x20,0x6d,
+0x61,0x78,0x2d,0x61,0x67,0x65,0x3d,0x38,0x36,0x34,0x30,0x30,0x0d,0x0a,
+/* "" (2 bytes) */
+0x0d,0x0a,
+/* raw file data (2554 bytes) */
+0xff,0xd8,0xff,0xe0,0x00,0x10,0x4a,0x46,0x49,0x46,0x00,0x01,0x01,0x01,0x00,0x48,
+0x00,0x48,0x00,0x00,0xff,0xfe,0x00,0x3c,0x43,0x52,0x45,0x41,0x54,0x4f,0x52,0x3a,
+0x20,0x67,0x64,0x2d,0x6a,0x70,0x65,0x67,0x20,0x76,0x31,0x2e,0x30,0x20,0x28,0x75,
+0x73,0x69,0x6e,0x67,0x20,0x49,0x4a,0x47,0x20,0x4a,0x50,0x45,0x47,0x20,0x76,0x36,
+0x32,0x29,0x2c,0x20,0x71,0x75,0x61,0x6c,0x69,0x74,0x79,0x20,0x3d,0x20,0x31,0x30,
+0x30,0x0a,0xff,0xdb,0x00,0x43,0x00,0x06,0x04,0x05,0x06,0x05,0x04,0x06,0x06,0x05,
+0x06,0x07,0x07,0x06,0x08,0x0a,0x10,0x0a,0x0a,0x09,0x09,0x0a,0x14,0x0e,0x0f,0x0c,
+0x10,0x17,0x14,0x18,0x18,0x17,0x14,0x16,0x16,0x1a,0x1d,0x25,0x1f,0x1a,0x1b,0x23,
+0x1c,0x16,0x16,0x20,0x2c,0x20,0x23,0x26,0x27,0x29,0x2a,0x29,0x19,0x1f,0x2d,0x30,
+0x2d,0x28,0x30,0x25,0x28,0x29,0x28,0xff,0xdb,0x00,0x43,0x01,0x07,0x07,0x07,0x0a,
+0x08,0x0a,0x13,0x0a,0x0a,0x13,0x28,0x1a,0x16,0x1a,0x28,0x28,0x28,0x28,0x28,0x28,
+0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,
+0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,
+0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0xff,0xc0,0x00,0x11,
+0x08,0x00,0x44,0x00,0x60,0x03,0x01,0x22,0x00,0x02,0x11,0x01,0x03,0x11,0x01,0xff,
+0xc4,0x00,0x1c,0x00,0x00,0x02,0x02,0x03,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x07,0x06,0x08,0x02,0x03,0x04,0x05,0x01,0xff,0xc4,0x00,
+0x3c,0x10,0x00,0x01,0x03,0x03,0x03,0x00,0x06,0x06,0x08,0x05,0x05,0x01,0x00,0x00,
+0x00,0x00,0x01,0x02,0x03,0x04,0x00,0x05,0x11,0x06,0x12,0x21,0x07,0x13,0x31,0x41,
+0x51,0x81,0x15,0x22,0x61,0x71,0x91,0xd1,0x14,0x32,0x42,0x52,0x55,0x92,0x93,0x94,
+0x08,0x23,0x43,0x82,0xa1,0x24,0x33,0x72,0x73,0x83,0xf1,0xff,0xc4,0x00,0x1a,0x01,
+0x00,0x02,0x03,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x04,0x01,0x02,0x03,0x05,0x06,0xff,0xc4,0x00,0x2b,0x11,0x00,0x01,0x03,0x02,
+0x04,0x03,0x08,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x03,
+0x04,0x11,0x12,0x13,0x21,0x31,0x05,0x41,0xf0,0x14,0x42,0x43,0x51,0x53,0x81,0xa1,
+0xd1,0x52,0x61,0xe1,0xff,0xda,0x00,0x0c,0x03,0x01,0x00,0x02,0x11,0x03,0x11,0x00,
+0x3f,0x00,0xb5,0x34,0x51,0x45,0x08,0x51,0x9d,0x77,0xac,0x21,0x69,0x1b,0x6a,0x1f,
+0x92,0x92,0xf4,0xa7,0x89,0x4c,0x78,0xe9,0x38,0x2b,0x23,0xb4,0x93,0xdc,0x91,0x91,
+0x93,0xed,0x14,0x9a,0x97,0xd2,0xae,0xa7,0x96,0xf9,0x5b,0x32,0x19,0x8a,0xde,0x78,
+0x6d,0xa6,0x52,0x40,0xf3,0x56,0x4d,0x79,0x5d,0x2c,0xdf,0x7d,0x3b,0xae,0x25,0xa9,
+0xb5,0xee,0x8d,0x13,0xfd,0x2b,0x38,0xec,0xc2,0x4f,0xac,0x7c,0xd4,0x4f,0x96,0x29,
+0x8d,0xd1,0xa7,0x46,0x90,0x05,0xaa,0x3d,0xd3,0x51,0x47,0x12,0xe4,0xc8,0x48,0x71,
+0xb8,0xce,0x72,0xdb,0x69,0x3d,0x9b,0x93,0xf6,0x89,0x1c,0xf3,0xc0,0xf0,0xae,0x8b,
+0x19,0x1c,0x11,0x87,0xc8,0x2e,0x4a,0xe6,0x48,0xf9,0x6a,0x24,0x2c,0x8c,0xd8,0x05,
+0x0c,0x6f,0xa4,0xad,0x4a,0x7e,0xb5,0xd9,0x23,0xff,0x00,0x26,0xfe,0x55,0xd4,0xd7,
+0x48,0x9a,0x85,0x5d,0xb7,0x74,0xfe,0x9b,0x7f,0x2a,0x77,0xa3,0x4f,0xd9,0x90,0x90,
+0x94,0x5a,0x2d,0xc9,0x48,0xec,0x02,0x32,0x00,0x1f,0xe2,0xbe,0xfa,0x06,0xcf,0xf8,
+0x4d,0xbf,0xf6,0xc8,0xf9,0x55,0x7b,0x54,0x5e,0x98,0x53,0xd8,0xe6,0xf5,0x4f,0x5e,
+0xe9,0x34,0xd6,0xbe,0xbe,0xab,0xb6,0xee,0x3f,0x23,0x7f,0x2a,0xe9,0x1a,0xe6,0xf2,
+0x46,0x7d,0x30,0x3f,0x23,0x7f,0x2a,0x6e,0x7a,0x02,0xcf,0xf8,0x4d,0xbf,0xf6,0xc8,
+0xf9,0x51,0xe8,0x1b,0x3f,0xe1,0x56,0xff,0x00,0xdb,0x23,0xe5,0x55,0x35,0x31,0xfe,
+0x0a,0xc2,0x92,0x5f,0x50,0xa4,0xeb,0x9a,0xf6,0xf8,0x9e,0xcb,0xb2,0x7f,0x23,0x7f,
+0x2a,0xe5,0x73,0xa4,0x4d,0x40,0x9e,0xcb,0xa2,0x3f,0x4d,0xbf,0x95,0x3b,0x7d,0x03,
+0x68,0xfc,0x2a,0xdf,0xfb,0x74,0x7c,0xa8,0xf4,0x0d,0xa3,0xf0,0xa8,0x1f,0xb7,0x47,
+0xca,0xa4,0x54,0xc4,0x3c,0x30,0xa0,0xd1,0xca,0x7c,0x43,0xd7,0xba,0x44,0xb9,0xd2,
+0x56,0xa4,0x4f,0x65,0xc9,0x1f,0xa4,0x8f,0x95,0x4c,0x7a,0x28,0xd4,0xda,0x83,0x52,
+0xde,0xa4,0x09,0xf3,0x12,0xe4,0x18,0xcd,0xee,0x58,0x0d,0xa4,0x65,0x4a,0xe1,0x23,
+0x20,0x7b,0x09,0xf2,0xa6,0x2f,0xa0,0xad,0x1f,0x85,0x40,0xfd,0xba,0x3e,0x55,0xd5,
+0x12,0x14,0x58,0x49,0x52,0x61,0xc6,0x62,0x3a,0x54,0x72,0x43,0x4d,0x84,0x67,0xdf,
+0x8a,0xac,0x95,0x11,0xb9,0xa4,0x35,0x80,0x2b,0xc5,0x4b,0x23,0x1c,0x1c,0xe9,0x09,
+0x0b,0xa2,0xa3,0xfa,0xfa,0xf6,0x34,0xfe,0x93,0xb8,0x4f,0x0a,0xda,0xea,0x5b,0x28,
+0x6b,0xfe,0x67,0x81,0xf3,0xf2,0xa9,0x05,0x57,0x5f,0xe2,0x3f,0x57,0xf5,0x97,0xa8,
+0xda,0x7a,0x32,0x82,0x9a,0x8a,0x90,0xec,0x8c,0x1f,0xea,0x28,0x64,0x0f,0x24,0xe0,
+0xf9,0xd6,0x30,0x47,0x8d,0xe0,0x2d,0xea,0x65,0xcb,0x61,0x29,0x6d,0x11,0x7d,0x64,
+0xa4,0x17,0x0f,0x0a,0x58,0xdc,0x4f,0xbe,0xae,0x74,0x65,0xb6,0xb8,0xcd,0x29,0x9c,
+0x75,0x4a,0x40,0x28,0xc7,0x66,0x31,0xc5,0x51,0xf6,0x26,0xb6,0x7e,0xb6,0x53,0xef,
+0xa7,0x8f,0x44,0xfd,0x28,0xb0,0xc3,0x4c,0x59,0xaf,0xef,0xa1,0x2c,0x8c,0x21,0x89,
+0x4a,0x3f,0x53,0xc1,0x2b,0xf6,0x7b,0x7b,0xbd,0xdd,0x8f,0x55,0x44,0xe9,0x1a,0x08,
+0xe4,0xb9,0xf4,0x93,0x32,0x37,0x10,0x4e,0xeb,0x8b,0x5f,0x5d,0xf5,0x9e,0x9f,0xd4,
+0x72,0x5b,0x97,0x72,0x94,0xdc,0x57,0x9c,0x52,0xe3,0x38,0xd2,0xb0,0xda,0xd1,0x9e,
+0x00,0xf0,0x20,0x60,0x11,0xff,0x00,0xda,0xf0,0x9b,0xd6,0xda,0x8c,0xf6,0xde,0x66,
+0x7e,0xa1,0xab,0x1b,0x7c,0xb4,0x40,0xbf,0xdb,0x1c,0x85,0x71,0x65,0x2f,0xc7,0x70,
+0x64,0x1e,0xf4,0x9e,0xe5,0x24,0xf7,0x1f,0x6d,0x57,0x5d,0x73,0xa3,0x66,0xe9,0x39,
+0xbe,0xb9,0x2f,0xc0,0x70,0xff,0x00,0x29,0xf0,0x3b,0x7d,0x8a,0xf0,0x35,0x34,0xb2,
+0xc6,0xf1,0x85,0xc0,0x5d,0x56,0xb2,0x19,0x23,0x38,0xda,0x4d,0x96,0xf6,0xf5,0x9e,
+0xa0,0x3d,0xb7,0x79,0x9f,0xa8,0x6b,0x71,0xd6,0x77,0xe4,0xa0,0x9f,0x4a,0xcc,0x51,
+0xee,0x01,0x64,0x92,0x7c,0x05,0x43,0x90,0xed,0x4e,0xba,0x27,0xb2,0x1b,0xd6,0xa8,
+0x65,0xf7,0x51,0x98,0x90,0x48,0x7d,0x79,0xec,0x2a,0x1f,0x50,0x7c,0x70,0x7c,0xa9,
+0xc9,0x04,0x4c,0x61,0x71,0x68,0xd1,0x23,0x11,0x95,0xef,0x0c,0x0e,0x3a,0xfe,0xd3,
+0xda,0xc4,0xcc,0x98,0xf6,0x78,0x6d,0x4f,0x75,0x4e,0xcb,0x4b,0x43,0xad,0x5a,0x8e,
+0x49,0x5f,0x69,0xe7,0xdf,0xc5,0x24,0xb5,0xa6,0xb8,0xb9,0xca,0xd4,0x93,0x7d,0x19,
+0x70,0x91,0x1e,0x13,0x2e,0x16,0x5a,0x4b,0x2e,0x14,0x85,0x04,0xf0,0x55,0xc7,0x6e,
+0x4e,0x70,0x7c,0x31,0x4d,0xbd,0x7f,0x7b,0x4d,0x83,0x4a,0x4f,0x9a,0x5c,0xd8,0xee,
+0xc2,0xdb,0x47,0xbf,0x7a,0xb8,0x18,0xf7,0x76,0xf9,0x55,0x57,0x76,0xe6,0xda,0x46,
+0x1b,0x4a,0x95,0x8f,0x2a,0x46,0x82,0x0c,0x64,0xc8,0xe1,0x74,0xff,0x00,0x13,0xa9,
+0x11,0x06,0xc4,0xd3,0x64,0xce,0xd0,0xb7,0xdd,0x43,0x7b,0xd5,0x30,0x60,0x9b,0xb4,
+0xc5,0x32,0x55,0xbd,0xdc,0xb8,0x4f,0xa8,0x9e,0x4f,0xcb,0xce,0x9f,0x74,0xa1,0xfe,
+0x1f,0x6d,0x0e,0x7a,0x3e,0x75,0xfa,0x52,0x02,0x4c,0x95,0x7d,0x1e,0x38,0xc7,0x63,
+0x69,0x3e,0xb2,0xbc,0xd5,0xc7,0xf6,0x53,0x7a,0x97,0xac,0x70,0x32,0x96,0xb4,0x6c,
+0x9b,0xa0,0x69,0xc9,0x0e,0x71,0xbd,0xf5,0x5c,0x97,0x69,0xcd,0x5a,0xed,0x72,0xe7,
+0xc8,0xcf,0x53,0x19,0xa5,0x3c,0xb0,0x3b,0x48,0x48,0xce,0x07,0xc2,0xa8,0xdd,0xee,
+0x44,0xfb,0xbd,0xea,0x6d,0xca,0x5b,0x4e,0xa9,0xf9,0x4f,0x29,0xe5,0x9d,0xa7,0xb4,
+0x9c,0xe0,0x7b,0x05,0x5e,0xfa,0x2b,0x38,0x66,0x11,0x5f,0x4b,0xad,0x2a,0x29,0xcc,
+0xd6,0xd6,0xd6,0x54,0x25,0x0c,0x3e,0x3f,0xa2,0xe7,0xe5,0x35,0xbd,0x0d,0x3a,0x3b,
+0x5a,0x5f,0xe5,0x35,0x7b,0xe8,0xa6,0x45,0x75,0xbb,0xbf,0x29,0x43,0xc3,0x01,0xef,
+0x7c,0x7f,0x52,0x07,0xa0,0x2d,0x69,0x75,0x37,0x16,0xb4,0xd4,0xe6,0xde,0x95,0x09,
+0x48,0x51,0x61,0xd2,0x09,0x54,0x7d,0xa0,0x9d,0xa4,0xfd,0xce,0x30,0x3c,0x09,0x03,
+0xb3,0x80,0xcd,0xe9,0x7a,0x2b,0x52,0xba,0x3a,0xbd,0x17,0x47,0x2c,0xb2,0x5e,0x41,
+0xef,0x0a,0x4f,0x3c,0x7f,0x91,0xe7,0x53,0x1a,0x49,0xf4,0xff,0x00,0xae,0xa2,0x35,
+0x68,0x73,0x4d,0xdb,0x1e,0x4b,0xd2,0xdf,0x50,0xfa,0x52,0x9b,0x39,0x0d,0x20,0x1c,
+0xed,0x27,0xef,0x12,0x07,0x1d,0xc3,0xdf,0x58,0xb5,0xc6,0x59,0x83,0x98,0x2c,0xb6,
+0x73,0x04,0x14,0xe5,0x8f,0x75,0xfa,0xd9,0x21,0x43,0xaa,0xfb,0xc7,0xe3,0x56,0x8f,
+0xa0,0xcb,0x29,0xb5,0xe8,0x58,0xf2,0x5e,0x46,0xd9,0x17,0x03,0xf4,0x93,0x91,0xce,
+0xc3,0xf5,0x3f,0xc7,0x3f,0xdd,0x55,0xc3,0x41,0x58,0xdc,0xd4,0xba,0xae,0xdd,0x6b,
+0x48,0x57,0x56,0xeb,0x80,0xba,0xa1,0xf6,0x5b,0x1c,0xa8,0xfc,0x01,0xf3,0xc5,0x5c,
+0x3b,0xa4,0xd8,0xb6,0x3b,0x24,0x99,0x8e,0x80,0xdc,0x58,0x6c,0x15,0xed,0x4f,0x18,
+0x4a,0x47,0x00,0x7c,0x30,0x29,0xba,0xf9,0x89,0x02,0x31,0xcd,0x23,0xc3,0x29,0x83,
+0x5c,0x66,0x77,0x24,0x87,0xfe,0x21,0xb5,0x37,0xd2,0xef,0xcc,0xd8,0xa3,0xaf,0xf9,
+0x30,0x92,0x16,0xfe,0x3b,0xdd,0x50,0xc8,0x1e,0x49,0xc7,0xe6,0x34,0xae,0xb2,0x42,
+0x72,0xed,0x78,0x87,0x6f,0x60,0x12,0xe4,0x87,0x52,0xd8,0xf3,0x35,0xcf,0x74,0x9f,
+0x2a,0xf5,0x79,0x95,0x31,0xd4,0xa9,0xc9,0x52,0xde,0x53,0x84,0x24,0x12,0x4a,0x94,
+0x73,0x80,0x29,0xdb,0xd0,0x6f,0x47,0x33,0xe0,0x5c,0x93,0xa8,0x6f,0xec,0x2a,0x3a,
+0x90,0x82,0x22,0x46,0x58,0xc2,0xf2,0x46,0x0a,0xd4,0x3b,0xb8,0xc8,0x00,0xf3,0xce,
+0x78,0xc0,0xcb,0x19,0x8d,0xa6,0x84,0x0e,0xae,0x94,0x30,0xba,0xb2,0xa0,0xbb,0x91,
+0x3f,0x09,0xcd,0x66,0xb7,0x31,0x68,0xb4,0xc4,0x81,0x15,0x21,0x2c,0xc7,0x6c,0x36,
+0x9f,0x6e,0x3b,0xfc,0xfb,0x6b,0xb6,0x8a,0x2b,0x86,0x49,0x26,0xe5,0x7a,0x60,0x03,
+0x45,0x82,0xd7,0xd7,0x35,0x85,0x1e,0xb5,0x18,0x4a,0xb6,0xab,0xd6,0x1c,0x1f,0x03,
+0xed,0xac,0xb7,0xa7,0x7e,0xcd,0xc3,0x7e,0x33,0xb7,0x3c,0xe3,0xc6,0xa3,0x33,0x9f,
+0x6d,0xa5,0xde,0x54,0xdb,0xc8,0x6d,0x48,0x92,0xc1,0x38,0xdb,0xc9,0xc2,0x33,0x90,
+0x7c,0xfe,0x15,0xae,0x4c,0x85,0xc4,0x95,0x78,0x7e,0x34,0x82,0xb7,0x14,0xfb,0x2d,
+0x95,0x12,0x83,0xd5,0x20,0x84,0xe4,0x8c,0x8e,0x31,0x92,0x39,0xe0,0x77,0xf7,0xd6,
+0xc2,0x0b,0xed,0xd6,0xdf,0x69,0x63,0x53,0x87,0x71,0xd6,0xbf,0x4a,0x59,0x45,0x78,
+0x10,0x2e,0x9f,0x45,0x44,0xe7,0x2e,0x32,0x47,0xd1,0x23,0x84,0x1e,0xb5,0xc5,0xa1,
+0x4a,0x41,0x39,0xc8,0x25,0x03,0x1f,0x77,0x1d,0xfc,0xfb,0xab,0xc6,0xbb,0x5c,0x4c,
+0x8d,0x41,0x75,0x62,0x6e,0xa3,0x72,0xc7,0x1e,0x13,0x2d,0xbb,0x18,0x21,0x4d,0x20,
+0x3a,0x95,0x27,0x2a,0x79,0x45,0xc4,0x9d,0xc0,0x2b,0x29,0xc0,0xe0,0x6d,0x39,0xed,
+0x15,0x43,0x11,0x06,0xcb,0x66,0x4a,0xd7,0x8b,0x85,0x38,0xae,0x43,0x6d,0x82,0x4e,
+0x4c,0x28,0xd9,0xff,0x00,0xa9,0x3f,0x2a,0x5f,0xe8,0xdd,0x5a,0xf2,0xad,0xe8,0x91,
+0x7f,0xba,0xb4,0x94,0x39,0x60,0x89,0x35,0x0e,0x3c,0x12,0xd0,0x5b,0x85,0x4f,0xf5,
+0xab,0x03,0x8e,0xe0,0xd6,0x47,0x76,0x47,0x8f,0x3e,0x7d,0xb7,0x50,0xcc,0x9f,0xa6,
+0xe5,0xcf,0xbb,0x6a,0x87,0x2d,0x33,0x21,0xc0,0x8e,0xf3,0x2d,0x80,0xd2,0x43,0x9b,
+0xa3,0x36,0xe7,0x5c,0xa4,0xa9,0x24,0xac,0x29,0xc5,0x2d,0x38,0x4e,0x07,0xab,0x81,
+0x85,0x64,0xd4,0xe5,0xb8,0x15,0x38,0x81,0x4d,0x46,0x22,0x46,0x8e,0xa2,0xa6,0x23,
+0xb2,0xd2,0x88,0xc1,0x28,0x40,0x49,0xc7,0x95,0x6d,0x71,0x08,0x71,0x0a,0x43,0x89,
+0x0a,0x42,0x86,0x0a,0x54,0x32,0x0d,0x29,0x23,0x5c,0xaf,0xf3,0x34,0xed,0xd2,0xee,
+0x9d,0x41,0x31,0x99,0x11,0x9d,0x82,0xc3,0x2d,0xa5,0xa6,0x8b,0x60,0x3b,0x1a,0x2a,
+0x9c,0x51,0x05,0x1c,0x92,0x5e,0x59,0x1c,0xf0,0x71,0xdd,0x90,0x7a,0xf5,0x15,0xe6,
+0xf3,0x64,0xb8,0x3d,0x67,0x66,0x7c,0x99,0x11,0x4c,0x98,0xc1,0x53,0x1e,0x5b,0x48,
+0x75,0x94,0x3a,0xdb,0xc7,0x66,0xf5,0x27,0x60,0xca,0xda,0x48,0x0a,0x50,0xfb,0x64,
+0x0e,0x76,0xe0,0xca,0x3e,0x68,0xc4,0x3c,0x93,0x29,0x98,0x71,0x58,0x56,0xe6,0x23,
+0x32,0xda,0xbc,0x50,0x80,0x0f,0xf8,0xad,0xab,0x71,0x08,0x52,0x12,0xb5,0xa5,0x2a,
+0x59,0xda,0x90,0x4e,0x0a,0x8e,0x09,0xc0,0xf1,0xe0,0x13,0xe5,0x4a,0xdb,0x75,0xd2,
+0xf7,0x72,0x9d,0x06,0xd9,0xe9,0x67,0xd8,0x8a,0xab,0xa2,0xa3,0x99,0x0d,0x38,0xcb,
+0xcf,0x29,0x02,0x2b,0x8e,0x29,0xa2,0xe0,0x46,0xc2,0x42,0x92,0x9f,0x58,0x0c,0x80,
+0x70,0x79,0x19,0xac,0xe4,0x37,0x3a,0x75,0xef,0x4f,0xc7,0x93,0x76,0x9a,0xa5,0xc0,
+0xd4,0x0f,0xc4,0x4b,0xa9,0x0d,0x85,0x38,0x91,0x09,0xe7,0x12,0x55,0xea,0x63,0x70,
+0x07,0x66,0x46,0x32,0x32,0x71,0x9e,0x41,0x96,0x79,0x94,0x62,0xf2,0x09,0xa5,0x58,
+0xb8,0xe2,0x1b,0x00,0xb8,0xa4,0xa4,0x12,0x12,0x37,0x1c,0x64,0x93,0x80,0x29,0x47,
+0x60,0xd5,0x17,0xe9,0x52,0x2d,0x12,0x9c,0x79,0x6a,0x99,0x32,0x57,0x55,0x22,0x02,
+0xe4,0xb2,0x50,0x91,0xce,0xf6,0xd2,0xd2,0x53,0xd6,0x21,0x4d,0x80,0x79,0x27,0xec,
+0x9d,0xdc,0x1e,0x09,0x37,0x03,0x3a,0xd7,0xa5,0x67,0x4a,0xd4,0xcb,0x7a,0xe1,0x36,
+0xe7,0x08,0xbf,0x6d,0x3d,0x5e,0xc4,0xaf,0xad,0x49,0x53,0x69,0x40,0x4e,0xf4,0x16,
+0xc8,0xc7,0x27,0x3c,0x10,0xac,0x93,0x46,0x51,0xbe,0xa8,0xc6,0x9b,0x0a,0x8c,0xc2,
+0xb7,0x6e,0x61,0xa3,0xb8,0xe5,0x59,0x40,0xe4,0xfb,0x6b,0x24,0xb2,0xd2,0x4a,0x8a,
+0x5a,0x6d,0x25,0x63,0xd6,0xc2,0x40,0xcf,0xbe,0x8a,0x2b,0x3b,0x95,0x6c,0x21,0x7c,
+0x11,0xd9,0x0c,0x96,0x43,0x2d,0x86,0x8f,0xd8,0x09,0x1b,0x7e,0x15,0x8c,0x98,0x71,
+0xa5,0x29,0xa5,0x49,0x8e,0xcb,0xca,0x68,0xee,0x6c,0xb8,0x80,0xa2,0x83,0xe2,0x33,
+0xd8,0x68,0xa2,0x8b,0x94,0x58,0x2c,0x5d,0x81,0x0d,0xe4,0xb2,0x97,0xa2,0xc7,0x71,
+0x2c,0x9d,0xcd,0x05,0x36,0x0e,0xc3,0xe2,0x9e,0x38,0xf2,0xaf,0x02,0xf5,0xa3,0x20,
+0x5d,0x26,0xa9,0xf3,0x26,0x5c,0x50,0xe2,0x03,0x6e,0x34,0xc1,0x6f,0x6a,0x80,0x1b,
+0x78,0xdc,0x82,0x5b,0x3b,0x78,0xcb,0x65,0x27,0x00,0x73,0xc0,0xa2,0x8a,0xbc,0x67,
+0x55,0x0e,0xd9,0x48,0x18,0x87,0x19,0x88,0xe9,0x61,0xa6,0x1a,0x43,0x20,0x24,0x04,
+0x04,0x8c,0x7a,0xa0,0x01,0xf0,0x00,0x0f,0x21,0x59,0xbb,0x1d,0x97,0x52,0xe2,0x5d,
+0x65,0xb5,0xa5,0xd4,0xed,0x58,0x52,0x41,0x0a,0x1e,0x07,0xc4,0x72,0x68,0xa2,0xb3,
+0x56,0x5f,0x19,0x8b,0x1d,0x96,0xda,0x6d,0x96,0x1a,0x6d,0xb6,0xbf,0xdb,0x4a,0x10,
+0x00,0x47,0x77,0x03,0xbb,0xb4,0xd6,0x5d,0x4b,0x5b,0x82,0xba,0xa4,0x6e,0x0a,0xdf,
+0x9d,0xa3,0x3b,0xb1,0x8c,0xfb,0xf1,0xc6,0x68,0xa2,0x84,0x2c,0x11,0x0e,0x32,0x25,
+0x2e,0x4a,0x23,0xb2,0x99,0x2b,0x1b,0x56,0xe8,0x40,0x0b,0x50,0xf0,0x27,0xb4,0xd6,
+0x22,0x04,0x31,0x25,0x72,0x04,0x48,0xe2,0x42,0xf0,0x54,0xef,0x56,0x37,0x2b,0x1d,
+0x99,0x3d,0xa7,0x18,0xa2,0x8a,0x2e,0x85,0xff,0xd9,};
+
+
+static const unsigned int dummy_align__STM32F7xx_files_stm32_jpg = 0;
 static const unsigned char data__STM32F7xx_files_stm32_jpg[] = {
 /* /STM32F7xx_files/stm32.jpg (27 chars) */
 0x2f,0x53,0x54,0x4d,0x33,0x32,0x46,0x37,0x78,0x78,0x5f,0x66,0x69,0x6c,0x65,0x73,
 0x2f,0x73,0x74,0x6d,0x33,0x32,0x2e,0x6a,0x70,0x67,0x00,0x00,
 
 /* HTTP header */
-/* "HTTP/1.0 200 OK
-" (17 bytes) */
+/* "HTTP/1.0 200 OK" (17 bytes) */
 0x48,0x54,0x54,0x50,0x2f,0x31,0x2e,0x30,0x20,0x32,0x30,0x30,0x20,0x4f,0x4b,0x0d,
 0x0a,
-/* "Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)
-" (63 bytes) */
-0x53,0x65,0x72,0x76,0x65,0x72,0x3a,0x20,0x6c,0x77,0x49,0x50,0x2f,0x31,0x2e,0x33,
-0x2e,0x31,0x20,0x28,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x73,0x61,0x76,0x61,0x6e,
-0x6e,0x61,0x68,0x2e,0x6e,0x6f,0x6e,0x67,0x6e,0x75,0x2e,0x6f,0x72,0x67,0x2f,0x70,
-0x72,0x6f,0x6a,0x65,0x63,0x74,0x73,0x2f,0x6c,0x77,0x69,0x70,0x29,0x0d,0x0a,
-/* "Content-type: image/jpeg
-
-" (28 bytes) */
-0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x74,0x79,0x70,0x65,0x3a,0x20,0x69,0x6d,
-0x61,0x67,0x65,0x2f,0x6a,0x70,0x65,0x67,0x0d,0x0a,0x0d,0x0a,
+/* "Server: disco-ptp" (19 bytes) */
+0x53,0x65,0x72,0x76,0x65,0x72,0x3a,0x20,0x64,0x69,0x73,0x63,0x6f,0x2d,0x70,0x74,
+0x70,0x0d,0x0a,
+/* "Content-Type: image/jpeg" (26 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x54,0x79,0x70,0x65,0x3a,0x20,0x69,0x6d,
+0x61,0x67,0x65,0x2f,0x6a,0x70,0x65,0x67,0x0d,0x0a,
+/* "Content-Length: 17389" (23 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x4c,0x65,0x6e,0x67,0x74,0x68,0x3a,0x20,
+0x31,0x37,0x33,0x38,0x39,0x0d,0x0a,
+/* "ETag: "f68435e3"" (18 bytes) */
+0x45,0x54,0x61,0x67,0x3a,0x20,0x22,0x66,0x36,0x38,0x34,0x33,0x35,0x65,0x33,0x22,
+0x0d,0x0a,
+/* "Cache-Control: max-age=86400" (30 bytes) */
+0x43,0x61,0x63,0x68,0x65,0x2d,0x43,0x6f,0x6e,0x74,0x72,0x6f,0x6c,0x3a,0x20,0x6d,
+0x61,0x78,0x2d,0x61,0x67,0x65,0x3d,0x38,0x36,0x34,0x30,0x30,0x0d,0x0a,
+/* "" (2 bytes) */
+0x0d,0x0a,
 /* raw file data (17389 bytes) */
 0xff,0xd8,0xff,0xe0,0x00,0x10,0x4a,0x46,0x49,0x46,0x00,0x01,0x01,0x00,0x00,0x01,
 0x00,0x01,0x00,0x00,0xff,0xfe,0x00,0x3e,0x43,0x52,0x45,0x41,0x54,0x4f,0x52,0x3a,
@@ -1628,752 +2540,54 @@ static const unsigned char data__STM32F7xx_files_stm32_jpg[] = {
 0x22,0x54,0x21,0x00,0x21,0x08,0x40,0x08,0x42,0x10,0x02,0x07,0x34,0x21,0x00,0x21,
 0x08,0x40,0x08,0x42,0x10,0x00,0xe6,0x84,0x21,0x0a,0x9f,0xff,0xd9,};
 
-static const unsigned int dummy_align__404_html = 3;
-static const unsigned char data__404_html[] = {
-/* /404.html (10 chars) */
-0x2f,0x34,0x30,0x34,0x2e,0x68,0x74,0x6d,0x6c,0x00,0x00,0x00,
-
-/* HTTP header */
-/* "HTTP/1.0 404 File not found
-" (29 bytes) */
-0x48,0x54,0x54,0x50,0x2f,0x31,0x2e,0x30,0x20,0x34,0x30,0x34,0x20,0x46,0x69,0x6c,
-0x65,0x20,0x6e,0x6f,0x74,0x20,0x66,0x6f,0x75,0x6e,0x64,0x0d,0x0a,
-/* "Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)
-" (63 bytes) */
-0x53,0x65,0x72,0x76,0x65,0x72,0x3a,0x20,0x6c,0x77,0x49,0x50,0x2f,0x31,0x2e,0x33,
-0x2e,0x31,0x20,0x28,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x73,0x61,0x76,0x61,0x6e,
-0x6e,0x61,0x68,0x2e,0x6e,0x6f,0x6e,0x67,0x6e,0x75,0x2e,0x6f,0x72,0x67,0x2f,0x70,
-0x72,0x6f,0x6a,0x65,0x63,0x74,0x73,0x2f,0x6c,0x77,0x69,0x70,0x29,0x0d,0x0a,
-/* "Content-type: text/html
-
-" (27 bytes) */
-0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x74,0x79,0x70,0x65,0x3a,0x20,0x74,0x65,
-0x78,0x74,0x2f,0x68,0x74,0x6d,0x6c,0x0d,0x0a,0x0d,0x0a,
-/* raw file data (1107 bytes) */
-0x3c,0x21,0x44,0x4f,0x43,0x54,0x59,0x50,0x45,0x20,0x48,0x54,0x4d,0x4c,0x20,0x50,
-0x55,0x42,0x4c,0x49,0x43,0x20,0x22,0x2d,0x2f,0x2f,0x57,0x33,0x43,0x2f,0x2f,0x44,
-0x54,0x44,0x20,0x48,0x54,0x4d,0x4c,0x20,0x34,0x2e,0x30,0x31,0x20,0x54,0x72,0x61,
-0x6e,0x73,0x69,0x74,0x69,0x6f,0x6e,0x61,0x6c,0x2f,0x2f,0x45,0x4e,0x22,0x3e,0x0a,
-0x3c,0x68,0x74,0x6d,0x6c,0x3e,0x3c,0x68,0x65,0x61,0x64,0x3e,0x3c,0x74,0x69,0x74,
-0x6c,0x65,0x3e,0x53,0x54,0x4d,0x33,0x32,0x46,0x37,0x78,0x78,0x3c,0x2f,0x74,0x69,
-0x74,0x6c,0x65,0x3e,0x3c,0x2f,0x68,0x65,0x61,0x64,0x3e,0x0d,0x0a,0x3c,0x62,0x6f,
-0x64,0x79,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x63,0x6f,0x6c,0x6f,0x72,0x3a,
-0x20,0x62,0x6c,0x61,0x63,0x6b,0x3b,0x20,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,
-0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x77,0x68,0x69,0x74,0x65,0x3b,
-0x22,0x3e,0x0d,0x0a,0x3c,0x74,0x61,0x62,0x6c,0x65,0x20,0x77,0x69,0x64,0x74,0x68,
-0x3d,0x22,0x31,0x30,0x30,0x25,0x22,0x3e,0x0d,0x0a,0x3c,0x74,0x62,0x6f,0x64,0x79,
-0x3e,0x0d,0x0a,0x3c,0x74,0x72,0x20,0x76,0x61,0x6c,0x69,0x67,0x6e,0x3d,0x22,0x74,
-0x6f,0x70,0x22,0x3e,0x0d,0x0a,0x3c,0x74,0x64,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,
-0x22,0x38,0x30,0x22,0x3e,0x3c,0x62,0x72,0x3e,0x0d,0x0a,0x3c,0x64,0x69,0x76,0x20,
-0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x74,0x65,0x78,0x74,0x2d,0x61,0x6c,0x69,0x67,
-0x6e,0x3a,0x20,0x63,0x65,0x6e,0x74,0x65,0x72,0x3b,0x22,0x3e,0x3c,0x69,0x6d,0x67,
-0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x39,
-0x36,0x70,0x78,0x3b,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x20,0x36,0x38,0x70,
-0x78,0x3b,0x22,0x20,0x61,0x6c,0x74,0x3d,0x22,0x53,0x54,0x20,0x6c,0x6f,0x67,0x6f,
-0x22,0x20,0x73,0x72,0x63,0x3d,0x22,0x53,0x54,0x4d,0x33,0x32,0x46,0x37,0x78,0x78,
-0x5f,0x66,0x69,0x6c,0x65,0x73,0x2f,0x6c,0x6f,0x67,0x6f,0x2e,0x6a,0x70,0x67,0x22,
-0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,0x3c,0x2f,0x74,0x64,0x3e,0x0d,0x0a,
-0x3c,0x74,0x64,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x35,0x30,0x30,0x22,0x3e,
-0x0d,0x0a,0x3c,0x68,0x31,0x3e,0x3c,0x73,0x6d,0x61,0x6c,0x6c,0x3e,0x3c,0x73,0x6d,
-0x61,0x6c,0x6c,0x3e,0x3c,0x73,0x6d,0x61,0x6c,0x6c,0x3e,0x3c,0x73,0x6d,0x61,0x6c,
-0x6c,0x3e,0x3c,0x62,0x69,0x67,0x3e,0x3c,0x62,0x69,0x67,0x3e,0x3c,0x62,0x69,0x67,
-0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x77,0x65,0x69,
-0x67,0x68,0x74,0x3a,0x20,0x62,0x6f,0x6c,0x64,0x3b,0x22,0x3e,0x3c,0x62,0x69,0x67,
-0x3e,0x3c,0x73,0x74,0x72,0x6f,0x6e,0x67,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,
-0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x74,0x79,0x6c,0x65,
-0x3a,0x20,0x69,0x74,0x61,0x6c,0x69,0x63,0x3b,0x22,0x3e,0x53,0x54,0x4d,0x33,0x32,
-0x46,0x37,0x78,0x78,0x20,0x57,0x65,0x62,0x73,0x65,0x72,0x76,0x65,0x72,0x20,0x44,
-0x65,0x6d,0x6f,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x73,0x74,0x72,0x6f,
-0x6e,0x67,0x3e,0x3c,0x2f,0x62,0x69,0x67,0x3e,0x3c,0x2f,0x62,0x69,0x67,0x3e,0x3c,
-0x2f,0x62,0x69,0x67,0x3e,0x3c,0x2f,0x62,0x69,0x67,0x3e,0x3c,0x2f,0x73,0x6d,0x61,
-0x6c,0x6c,0x3e,0x3c,0x2f,0x73,0x6d,0x61,0x6c,0x6c,0x3e,0x3c,0x2f,0x73,0x6d,0x61,
-0x6c,0x6c,0x3e,0x3c,0x2f,0x73,0x6d,0x61,0x6c,0x6c,0x3e,0x0d,0x0a,0x3c,0x73,0x6d,
-0x61,0x6c,0x6c,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,
-0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x20,0x56,0x65,0x72,0x64,0x61,0x6e,0x61,0x3b,
-0x22,0x3e,0x3c,0x73,0x6d,0x61,0x6c,0x6c,0x3e,0x3c,0x62,0x69,0x67,0x3e,0x3c,0x62,
-0x69,0x67,0x3e,0x3c,0x62,0x69,0x67,0x3e,0x3c,0x62,0x69,0x67,0x20,0x73,0x74,0x79,
-0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x77,0x65,0x69,0x67,0x68,0x74,0x3a,
-0x20,0x62,0x6f,0x6c,0x64,0x3b,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x72,0x67,
-0x62,0x28,0x35,0x31,0x2c,0x20,0x35,0x31,0x2c,0x20,0x32,0x35,0x35,0x29,0x3b,0x22,
-0x3e,0x3c,0x62,0x69,0x67,0x3e,0x3c,0x73,0x74,0x72,0x6f,0x6e,0x67,0x3e,0x3c,0x73,
-0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,
-0x73,0x74,0x79,0x6c,0x65,0x3a,0x20,0x69,0x74,0x61,0x6c,0x69,0x63,0x3b,0x22,0x3e,
-0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x73,0x74,0x72,0x6f,0x6e,0x67,0x3e,
-0x3c,0x2f,0x62,0x69,0x67,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,
-0x65,0x3d,0x22,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x72,0x67,0x62,0x28,0x35,0x31,
-0x2c,0x20,0x35,0x31,0x2c,0x20,0x32,0x35,0x35,0x29,0x3b,0x22,0x3e,0x3c,0x62,0x72,
-0x3e,0x0d,0x0a,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x62,0x69,0x67,0x3e,
-0x3c,0x2f,0x62,0x69,0x67,0x3e,0x3c,0x2f,0x62,0x69,0x67,0x3e,0x3c,0x2f,0x62,0x69,
-0x67,0x3e,0x3c,0x2f,0x73,0x6d,0x61,0x6c,0x6c,0x3e,0x3c,0x2f,0x73,0x6d,0x61,0x6c,
-0x6c,0x3e,0x3c,0x2f,0x68,0x31,0x3e,0x0d,0x0a,0x3c,0x68,0x32,0x3e,0x34,0x30,0x34,
-0x20,0x2d,0x20,0x50,0x61,0x67,0x65,0x20,0x6e,0x6f,0x74,0x20,0x66,0x6f,0x75,0x6e,
-0x64,0x3c,0x2f,0x68,0x32,0x3e,0x0d,0x0a,0x3c,0x70,0x3e,0x3c,0x73,0x70,0x61,0x6e,
-0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,
-0x69,0x6c,0x79,0x3a,0x20,0x54,0x69,0x6d,0x65,0x73,0x20,0x4e,0x65,0x77,0x20,0x52,
-0x6f,0x6d,0x61,0x6e,0x2c,0x54,0x69,0x6d,0x65,0x73,0x2c,0x73,0x65,0x72,0x69,0x66,
-0x3b,0x22,0x3e,0x20,0x53,0x6f,0x72,0x72,0x79,0x2c,0x0d,0x0a,0x74,0x68,0x65,0x20,
-0x70,0x61,0x67,0x65,0x20,0x79,0x6f,0x75,0x20,0x61,0x72,0x65,0x20,0x72,0x65,0x71,
-0x75,0x65,0x73,0x74,0x69,0x6e,0x67,0x20,0x77,0x61,0x73,0x20,0x6e,0x6f,0x74,0x20,
-0x66,0x6f,0x75,0x6e,0x64,0x20,0x6f,0x6e,0x20,0x74,0x68,0x69,0x73,0x20,0x73,0x65,
-0x72,0x76,0x65,0x72,0x2e,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x20,0x3c,0x2f,0x70,
-0x3e,0x0d,0x0a,0x3c,0x2f,0x74,0x64,0x3e,0x0d,0x0a,0x3c,0x2f,0x74,0x72,0x3e,0x0d,
-0x0a,0x3c,0x2f,0x74,0x62,0x6f,0x64,0x79,0x3e,0x0d,0x0a,0x3c,0x2f,0x74,0x61,0x62,
-0x6c,0x65,0x3e,0x0d,0x0a,0x3c,0x2f,0x62,0x6f,0x64,0x79,0x3e,0x3c,0x2f,0x68,0x74,
-0x6d,0x6c,0x3e,};
-
-static const unsigned int dummy_align__STM32F7xx_html = 4;
-static const unsigned char data__STM32F7xx_html[] = {
-/* /STM32F7xx.html (16 chars) */
-0x2f,0x53,0x54,0x4d,0x33,0x32,0x46,0x37,0x78,0x78,0x2e,0x68,0x74,0x6d,0x6c,0x00,
-
-
-/* HTTP header */
-/* "HTTP/1.0 200 OK
-" (17 bytes) */
-0x48,0x54,0x54,0x50,0x2f,0x31,0x2e,0x30,0x20,0x32,0x30,0x30,0x20,0x4f,0x4b,0x0d,
-0x0a,
-/* "Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)
-" (63 bytes) */
-0x53,0x65,0x72,0x76,0x65,0x72,0x3a,0x20,0x6c,0x77,0x49,0x50,0x2f,0x31,0x2e,0x33,
-0x2e,0x31,0x20,0x28,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x73,0x61,0x76,0x61,0x6e,
-0x6e,0x61,0x68,0x2e,0x6e,0x6f,0x6e,0x67,0x6e,0x75,0x2e,0x6f,0x72,0x67,0x2f,0x70,
-0x72,0x6f,0x6a,0x65,0x63,0x74,0x73,0x2f,0x6c,0x77,0x69,0x70,0x29,0x0d,0x0a,
-/* "Content-type: text/html
-
-" (27 bytes) */
-0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x74,0x79,0x70,0x65,0x3a,0x20,0x74,0x65,
-0x78,0x74,0x2f,0x68,0x74,0x6d,0x6c,0x0d,0x0a,0x0d,0x0a,
-/* raw file data (9384 bytes) */
-0x3c,0x21,0x44,0x4f,0x43,0x54,0x59,0x50,0x45,0x20,0x48,0x54,0x4d,0x4c,0x20,0x50,
-0x55,0x42,0x4c,0x49,0x43,0x20,0x22,0x2d,0x2f,0x2f,0x57,0x33,0x43,0x2f,0x2f,0x44,
-0x54,0x44,0x20,0x48,0x54,0x4d,0x4c,0x20,0x34,0x2e,0x30,0x31,0x20,0x54,0x72,0x61,
-0x6e,0x73,0x69,0x74,0x69,0x6f,0x6e,0x61,0x6c,0x2f,0x2f,0x45,0x4e,0x22,0x3e,0x0a,
-0x3c,0x68,0x74,0x6d,0x6c,0x20,0x78,0x6d,0x6c,0x6e,0x73,0x3a,0x76,0x3d,0x22,0x75,
-0x72,0x6e,0x3a,0x73,0x63,0x68,0x65,0x6d,0x61,0x73,0x2d,0x6d,0x69,0x63,0x72,0x6f,
-0x73,0x6f,0x66,0x74,0x2d,0x63,0x6f,0x6d,0x3a,0x76,0x6d,0x6c,0x22,0x20,0x78,0x6d,
-0x6c,0x6e,0x73,0x3a,0x6f,0x3d,0x22,0x75,0x72,0x6e,0x3a,0x73,0x63,0x68,0x65,0x6d,
-0x61,0x73,0x2d,0x6d,0x69,0x63,0x72,0x6f,0x73,0x6f,0x66,0x74,0x2d,0x63,0x6f,0x6d,
-0x3a,0x6f,0x66,0x66,0x69,0x63,0x65,0x3a,0x6f,0x66,0x66,0x69,0x63,0x65,0x22,0x20,
-0x78,0x6d,0x6c,0x6e,0x73,0x3a,0x77,0x3d,0x22,0x75,0x72,0x6e,0x3a,0x73,0x63,0x68,
-0x65,0x6d,0x61,0x73,0x2d,0x6d,0x69,0x63,0x72,0x6f,0x73,0x6f,0x66,0x74,0x2d,0x63,
-0x6f,0x6d,0x3a,0x6f,0x66,0x66,0x69,0x63,0x65,0x3a,0x77,0x6f,0x72,0x64,0x22,0x20,
-0x78,0x6d,0x6c,0x6e,0x73,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,0x77,
-0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,0x54,0x52,0x2f,0x52,0x45,0x43,0x2d,
-0x68,0x74,0x6d,0x6c,0x34,0x30,0x22,0x3e,0x3c,0x68,0x65,0x61,0x64,0x3e,0x0d,0x0a,
-0x3c,0x6d,0x65,0x74,0x61,0x20,0x68,0x74,0x74,0x70,0x2d,0x65,0x71,0x75,0x69,0x76,
-0x3d,0x22,0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x54,0x79,0x70,0x65,0x22,0x20,
-0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x3d,0x22,0x74,0x65,0x78,0x74,0x2f,0x68,0x74,
-0x6d,0x6c,0x3b,0x20,0x63,0x68,0x61,0x72,0x73,0x65,0x74,0x3d,0x69,0x73,0x6f,0x2d,
-0x38,0x38,0x35,0x39,0x2d,0x31,0x22,0x3e,0x0d,0x0a,0x3c,0x6c,0x69,0x6e,0x6b,0x20,
-0x72,0x65,0x6c,0x3d,0x22,0x46,0x69,0x6c,0x65,0x2d,0x4c,0x69,0x73,0x74,0x22,0x20,
-0x68,0x72,0x65,0x66,0x3d,0x22,0x53,0x54,0x4d,0x33,0x32,0x46,0x37,0x78,0x78,0x5f,
-0x66,0x69,0x6c,0x65,0x73,0x2f,0x66,0x69,0x6c,0x65,0x6c,0x69,0x73,0x74,0x2e,0x78,
-0x6d,0x6c,0x22,0x3e,0x0d,0x0a,0x3c,0x6c,0x69,0x6e,0x6b,0x20,0x72,0x65,0x6c,0x3d,
-0x22,0x45,0x64,0x69,0x74,0x2d,0x54,0x69,0x6d,0x65,0x2d,0x44,0x61,0x74,0x61,0x22,
-0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x53,0x54,0x4d,0x33,0x32,0x46,0x37,0x78,0x78,
-0x5f,0x66,0x69,0x6c,0x65,0x73,0x2f,0x65,0x64,0x69,0x74,0x64,0x61,0x74,0x61,0x2e,
-0x6d,0x73,0x6f,0x22,0x3e,0x3c,0x74,0x69,0x74,0x6c,0x65,0x3e,0x53,0x54,0x4d,0x33,
-0x32,0x46,0x37,0x78,0x78,0x3c,0x2f,0x74,0x69,0x74,0x6c,0x65,0x3e,0x0d,0x0a,0x0d,
-0x0a,0x3c,0x2f,0x68,0x65,0x61,0x64,0x3e,0x0d,0x0a,0x3c,0x62,0x6f,0x64,0x79,0x20,
-0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x22,0x20,0x6c,0x61,0x6e,0x67,0x3d,0x22,0x45,
-0x4e,0x2d,0x55,0x53,0x22,0x20,0x6c,0x69,0x6e,0x6b,0x3d,0x22,0x62,0x6c,0x75,0x65,
-0x22,0x20,0x76,0x6c,0x69,0x6e,0x6b,0x3d,0x22,0x62,0x6c,0x75,0x65,0x22,0x3e,0x0d,
-0x0a,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x53,0x65,0x63,
-0x74,0x69,0x6f,0x6e,0x31,0x22,0x3e,0x0d,0x0a,0x3c,0x64,0x69,0x76,0x20,0x73,0x74,
-0x79,0x6c,0x65,0x3d,0x22,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x6c,0x65,0x66,0x74,
-0x3a,0x20,0x33,0x30,0x70,0x74,0x3b,0x22,0x3e,0x0d,0x0a,0x3c,0x70,0x20,0x63,0x6c,
-0x61,0x73,0x73,0x3d,0x22,0x4d,0x73,0x6f,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x22,0x20,
-0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x74,0x65,0x78,0x74,0x2d,0x61,0x6c,0x69,0x67,
-0x6e,0x3a,0x20,0x63,0x65,0x6e,0x74,0x65,0x72,0x3b,0x22,0x20,0x61,0x6c,0x69,0x67,
-0x6e,0x3d,0x22,0x63,0x65,0x6e,0x74,0x65,0x72,0x22,0x3e,0x3c,0x69,0x6d,0x67,0x20,
-0x61,0x6c,0x74,0x3d,0x22,0x22,0x20,0x69,0x64,0x3d,0x22,0x5f,0x78,0x30,0x30,0x30,
-0x30,0x5f,0x69,0x31,0x30,0x32,0x35,0x22,0x20,0x73,0x72,0x63,0x3d,0x22,0x53,0x54,
-0x4d,0x33,0x32,0x46,0x37,0x78,0x78,0x5f,0x66,0x69,0x6c,0x65,0x73,0x2f,0x53,0x54,
-0x2e,0x67,0x69,0x66,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x62,0x6f,0x72,
-0x64,0x65,0x72,0x3a,0x20,0x30,0x70,0x78,0x20,0x73,0x6f,0x6c,0x69,0x64,0x20,0x3b,
-0x20,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x37,0x36,0x36,0x70,0x78,0x3b,0x20,0x68,
-0x65,0x69,0x67,0x68,0x74,0x3a,0x20,0x35,0x38,0x70,0x78,0x3b,0x22,0x3e,0x3c,0x62,
-0x3e,0x3c,0x69,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,
-0x22,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x32,0x34,0x70,0x74,
-0x3b,0x22,0x3e,0x3c,0x62,0x72,0x3e,0x0d,0x0a,0x3c,0x73,0x74,0x72,0x6f,0x6e,0x67,
-0x3e,0x53,0x54,0x4d,0x33,0x32,0x46,0x37,0x78,0x78,0x20,0x57,0x65,0x62,0x73,0x65,
-0x72,0x76,0x65,0x72,0x20,0x44,0x65,0x6d,0x6f,0x3c,0x2f,0x73,0x74,0x72,0x6f,0x6e,
-0x67,0x3e,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x69,0x3e,0x3c,0x2f,0x62,
-0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,
-0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,0x33,0x2e,0x35,0x70,0x74,0x3b,
-0x22,0x3e,0x20,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x62,0x3e,0x3c,0x73,0x70,
-0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x73,
-0x69,0x7a,0x65,0x3a,0x20,0x31,0x38,0x70,0x74,0x3b,0x20,0x66,0x6f,0x6e,0x74,0x2d,
-0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x20,0x56,0x65,0x72,0x64,0x61,0x6e,0x61,0x3b,
-0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x72,0x67,0x62,0x28,0x35,0x31,0x2c,0x20,
-0x35,0x31,0x2c,0x20,0x32,0x35,0x35,0x29,0x3b,0x22,0x3e,0x3c,0x62,0x72,0x3e,0x0d,
-0x0a,0x42,0x61,0x73,0x65,0x64,0x20,0x6f,0x6e,0x20,0x74,0x68,0x65,0x20,0x6c,0x77,
-0x49,0x50,0x20,0x54,0x43,0x50,0x2f,0x49,0x50,0x20,0x73,0x74,0x61,0x63,0x6b,0x20,
-0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x62,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,
-0x0a,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x4d,0x73,0x6f,
-0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x74,
-0x65,0x78,0x74,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,0x20,0x63,0x65,0x6e,0x74,0x65,
-0x72,0x3b,0x22,0x20,0x61,0x6c,0x69,0x67,0x6e,0x3d,0x22,0x63,0x65,0x6e,0x74,0x65,
-0x72,0x22,0x3e,0x0d,0x0a,0x3c,0x68,0x72,0x20,0x61,0x6c,0x69,0x67,0x6e,0x3d,0x22,
-0x63,0x65,0x6e,0x74,0x65,0x72,0x22,0x20,0x73,0x69,0x7a,0x65,0x3d,0x22,0x32,0x22,
-0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x31,0x30,0x30,0x25,0x22,0x3e,0x3c,0x2f,
-0x64,0x69,0x76,0x3e,0x0d,0x0a,0x3c,0x64,0x69,0x76,0x20,0x61,0x6c,0x69,0x67,0x6e,
-0x3d,0x22,0x63,0x65,0x6e,0x74,0x65,0x72,0x22,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,
-0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x77,0x65,0x69,0x67,
-0x68,0x74,0x3a,0x20,0x62,0x6f,0x6c,0x64,0x3b,0x22,0x3e,0x3c,0x2f,0x73,0x70,0x61,
-0x6e,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,
-0x6f,0x6e,0x74,0x2d,0x77,0x65,0x69,0x67,0x68,0x74,0x3a,0x20,0x62,0x6f,0x6c,0x64,
-0x3b,0x22,0x3e,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x0d,0x0a,0x3c,0x74,0x61,0x62,
-0x6c,0x65,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x77,0x69,0x64,0x74,0x68,0x3a,
-0x20,0x39,0x36,0x31,0x70,0x78,0x3b,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x20,
-0x33,0x30,0x70,0x78,0x3b,0x22,0x20,0x62,0x6f,0x72,0x64,0x65,0x72,0x3d,0x22,0x31,
-0x22,0x20,0x63,0x65,0x6c,0x6c,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3d,0x22,0x32,
-0x22,0x20,0x63,0x65,0x6c,0x6c,0x73,0x70,0x61,0x63,0x69,0x6e,0x67,0x3d,0x22,0x32,
-0x22,0x3e,0x0d,0x0a,0x3c,0x74,0x62,0x6f,0x64,0x79,0x3e,0x0d,0x0a,0x3c,0x74,0x72,
-0x3e,0x0d,0x0a,0x3c,0x74,0x64,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,
-0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x20,0x56,0x65,0x72,0x64,0x61,
-0x6e,0x61,0x3b,0x20,0x66,0x6f,0x6e,0x74,0x2d,0x77,0x65,0x69,0x67,0x68,0x74,0x3a,
-0x20,0x62,0x6f,0x6c,0x64,0x3b,0x20,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x74,0x79,0x6c,
-0x65,0x3a,0x20,0x69,0x74,0x61,0x6c,0x69,0x63,0x3b,0x20,0x62,0x61,0x63,0x6b,0x67,
-0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x72,0x67,0x62,
-0x28,0x35,0x31,0x2c,0x20,0x35,0x31,0x2c,0x20,0x32,0x35,0x35,0x29,0x3b,0x20,0x74,
-0x65,0x78,0x74,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,0x20,0x63,0x65,0x6e,0x74,0x65,
-0x72,0x3b,0x22,0x3e,0x3c,0x73,0x6d,0x61,0x6c,0x6c,0x3e,0x3c,0x61,0x20,0x68,0x72,
-0x65,0x66,0x3d,0x22,0x2f,0x53,0x54,0x4d,0x33,0x32,0x46,0x37,0x78,0x78,0x2e,0x68,
-0x74,0x6d,0x6c,0x22,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,
-0x3d,0x22,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x77,0x68,0x69,0x74,0x65,0x3b,0x22,
-0x3e,0x48,0x6f,0x6d,0x65,0x0d,0x0a,0x70,0x61,0x67,0x65,0x3c,0x2f,0x73,0x70,0x61,
-0x6e,0x3e,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x73,0x6d,0x61,0x6c,0x6c,0x3e,0x3c,0x2f,
-0x74,0x64,0x3e,0x0d,0x0a,0x3c,0x74,0x64,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,
-0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x20,0x56,0x65,0x72,
-0x64,0x61,0x6e,0x61,0x3b,0x20,0x66,0x6f,0x6e,0x74,0x2d,0x77,0x65,0x69,0x67,0x68,
-0x74,0x3a,0x20,0x62,0x6f,0x6c,0x64,0x3b,0x20,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x74,
-0x79,0x6c,0x65,0x3a,0x20,0x69,0x74,0x61,0x6c,0x69,0x63,0x3b,0x20,0x62,0x61,0x63,
-0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x72,
-0x67,0x62,0x28,0x35,0x31,0x2c,0x20,0x35,0x31,0x2c,0x20,0x32,0x35,0x35,0x29,0x3b,
-0x20,0x74,0x65,0x78,0x74,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,0x20,0x63,0x65,0x6e,
-0x74,0x65,0x72,0x3b,0x22,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x53,
-0x54,0x4d,0x33,0x32,0x46,0x37,0x78,0x78,0x41,0x44,0x43,0x2e,0x68,0x74,0x6d,0x6c,
-0x22,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,
-0x6f,0x6e,0x74,0x2d,0x77,0x65,0x69,0x67,0x68,0x74,0x3a,0x20,0x62,0x6f,0x6c,0x64,
-0x3b,0x22,0x3e,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x61,0x3e,0x3c,0x73,
-0x6d,0x61,0x6c,0x6c,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x2f,0x53,
-0x54,0x4d,0x33,0x32,0x46,0x37,0x78,0x78,0x54,0x41,0x53,0x4b,0x53,0x2e,0x68,0x74,
-0x6d,0x6c,0x22,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,
-0x22,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x77,0x68,0x69,0x74,0x65,0x3b,0x22,0x3e,
-0x4c,0x69,0x73,0x74,0x0d,0x0a,0x6f,0x66,0x20,0x74,0x61,0x73,0x6b,0x73,0x3c,0x2f,
-0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x73,0x6d,0x61,0x6c,0x6c,
-0x3e,0x3c,0x2f,0x74,0x64,0x3e,0x0d,0x0a,0x3c,0x2f,0x74,0x72,0x3e,0x0d,0x0a,0x3c,
-0x2f,0x74,0x62,0x6f,0x64,0x79,0x3e,0x0d,0x0a,0x3c,0x2f,0x74,0x61,0x62,0x6c,0x65,
-0x3e,0x0d,0x0a,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,0x3c,0x64,0x69,0x76,0x20,
-0x61,0x6c,0x69,0x67,0x6e,0x3d,0x22,0x63,0x65,0x6e,0x74,0x65,0x72,0x22,0x3e,0x0d,
-0x0a,0x3c,0x74,0x61,0x62,0x6c,0x65,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x4d,
-0x73,0x6f,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x54,0x61,0x62,0x6c,0x65,0x22,0x20,0x73,
-0x74,0x79,0x6c,0x65,0x3d,0x22,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,
-0x3a,0x20,0x77,0x68,0x69,0x74,0x65,0x20,0x6e,0x6f,0x6e,0x65,0x20,0x72,0x65,0x70,
-0x65,0x61,0x74,0x20,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x20,0x30,0x25,0x20,0x35,0x30,
-0x25,0x3b,0x20,0x2d,0x6d,0x6f,0x7a,0x2d,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,
-0x6e,0x64,0x2d,0x63,0x6c,0x69,0x70,0x3a,0x20,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,
-0x3b,0x20,0x2d,0x6d,0x6f,0x7a,0x2d,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,
-0x64,0x2d,0x6f,0x72,0x69,0x67,0x69,0x6e,0x3a,0x20,0x69,0x6e,0x69,0x74,0x69,0x61,
-0x6c,0x3b,0x20,0x2d,0x6d,0x6f,0x7a,0x2d,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,
-0x6e,0x64,0x2d,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x2d,0x70,0x6f,0x6c,0x69,0x63,0x79,
-0x3a,0x20,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x3b,0x20,0x77,0x69,0x64,0x74,0x68,
-0x3a,0x20,0x35,0x37,0x34,0x2e,0x35,0x70,0x74,0x3b,0x22,0x20,0x62,0x6f,0x72,0x64,
-0x65,0x72,0x3d,0x22,0x30,0x22,0x20,0x63,0x65,0x6c,0x6c,0x70,0x61,0x64,0x64,0x69,
-0x6e,0x67,0x3d,0x22,0x30,0x22,0x20,0x63,0x65,0x6c,0x6c,0x73,0x70,0x61,0x63,0x69,
-0x6e,0x67,0x3d,0x22,0x30,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x37,0x36,
-0x36,0x22,0x3e,0x0d,0x0a,0x3c,0x74,0x62,0x6f,0x64,0x79,0x3e,0x0d,0x0a,0x3c,0x74,
-0x72,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x22,0x3e,0x0d,0x0a,0x3c,0x74,0x64,
-0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,
-0x20,0x30,0x63,0x6d,0x3b,0x22,0x20,0x76,0x61,0x6c,0x69,0x67,0x6e,0x3d,0x22,0x74,
-0x6f,0x70,0x22,0x3e,0x0d,0x0a,0x3c,0x74,0x61,0x62,0x6c,0x65,0x20,0x63,0x6c,0x61,
-0x73,0x73,0x3d,0x22,0x4d,0x73,0x6f,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x54,0x61,0x62,
-0x6c,0x65,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x77,0x69,0x64,0x74,0x68,
-0x3a,0x20,0x31,0x30,0x30,0x25,0x3b,0x22,0x20,0x62,0x6f,0x72,0x64,0x65,0x72,0x3d,
-0x22,0x30,0x22,0x20,0x63,0x65,0x6c,0x6c,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3d,
-0x22,0x30,0x22,0x20,0x63,0x65,0x6c,0x6c,0x73,0x70,0x61,0x63,0x69,0x6e,0x67,0x3d,
-0x22,0x30,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x31,0x30,0x30,0x25,0x22,
-0x3e,0x0d,0x0a,0x3c,0x74,0x62,0x6f,0x64,0x79,0x3e,0x0d,0x0a,0x3c,0x74,0x72,0x20,
-0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x22,0x3e,0x0d,0x0a,0x3c,0x74,0x64,0x20,0x73,
-0x74,0x79,0x6c,0x65,0x3d,0x22,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,0x32,
-0x2e,0x32,0x35,0x70,0x74,0x3b,0x22,0x3e,0x0d,0x0a,0x3c,0x74,0x61,0x62,0x6c,0x65,
-0x20,0x62,0x6f,0x72,0x64,0x65,0x72,0x3d,0x22,0x30,0x22,0x20,0x63,0x65,0x6c,0x6c,
-0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3d,0x22,0x33,0x22,0x20,0x63,0x65,0x6c,0x6c,
-0x73,0x70,0x61,0x63,0x69,0x6e,0x67,0x3d,0x22,0x30,0x22,0x20,0x77,0x69,0x64,0x74,
-0x68,0x3d,0x22,0x31,0x30,0x30,0x25,0x22,0x3e,0x0d,0x0a,0x3c,0x74,0x62,0x6f,0x64,
-0x79,0x3e,0x0d,0x0a,0x3c,0x74,0x72,0x3e,0x0d,0x0a,0x3c,0x74,0x64,0x20,0x76,0x61,
-0x6c,0x69,0x67,0x6e,0x3d,0x22,0x74,0x6f,0x70,0x22,0x20,0x77,0x69,0x64,0x74,0x68,
-0x3d,0x22,0x37,0x32,0x25,0x22,0x3e,0x0d,0x0a,0x3c,0x68,0x31,0x3e,0x3c,0x73,0x70,
-0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x63,0x6f,0x6c,0x6f,0x72,0x3a,
-0x20,0x72,0x67,0x62,0x28,0x35,0x31,0x2c,0x20,0x35,0x31,0x2c,0x20,0x32,0x35,0x35,
-0x29,0x3b,0x22,0x3e,0x53,0x54,0x4d,0x33,0x32,0x0d,0x0a,0x46,0x2d,0x37,0x20,0x53,
-0x65,0x72,0x69,0x65,0x73,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x68,0x31,
-0x3e,0x0d,0x0a,0x3c,0x70,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x4d,0x73,0x6f,
-0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x22,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,0x74,
-0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,
-0x31,0x30,0x70,0x74,0x3b,0x20,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,
-0x79,0x3a,0x20,0x56,0x65,0x72,0x64,0x61,0x6e,0x61,0x3b,0x22,0x3e,0x54,0x68,0x65,
-0x20,0x53,0x54,0x4d,0x33,0x32,0x20,0x46,0x37,0x20,0x64,0x65,0x76,0x69,0x63,0x65,
-0x73,0x20,0x61,0x72,0x65,0x20,0x74,0x68,0x65,0x20,0x77,0x6f,0x72,0x6c,0x64,0x27,
-0x73,0x20,0x66,0x69,0x72,0x73,0x74,0x20,0x41,0x52,0x4d,0x20,0x43,0x6f,0x72,0x74,
-0x65,0x78,0x2d,0x4d,0x37,0x20,0x62,0x61,0x73,0x65,0x64,0x20,0x33,0x32,0x2d,0x62,
-0x69,0x74,0x20,0x6d,0x69,0x63,0x72,0x6f,0x63,0x6f,0x6e,0x74,0x72,0x6f,0x6c,0x6c,
-0x65,0x72,0x73,0x2c,0x20,0x73,0x65,0x74,0x74,0x69,0x6e,0x67,0x20,0x74,0x68,0x65,
-0x20,0x62,0x65,0x6e,0x63,0x68,0x6d,0x61,0x72,0x6b,0x20,0x69,0x6e,0x20,0x70,0x65,
-0x72,0x66,0x6f,0x72,0x6d,0x61,0x6e,0x63,0x65,0x2e,0x3c,0x62,0x72,0x3e,0x0a,0x3c,
-0x62,0x72,0x3e,0x0a,0x54,0x61,0x6b,0x69,0x6e,0x67,0x20,0x61,0x64,0x76,0x61,0x6e,
-0x74,0x61,0x67,0x65,0x20,0x6f,0x66,0x20,0x53,0x54,0x27,0x73,0x20,0x41,0x52,0x54,
-0x20,0x41,0x63,0x63,0x65,0x6c,0x65,0x72,0x61,0x74,0x6f,0x72,0x20,0x61,0x73,0x20,
-0x77,0x65,0x6c,0x6c,0x20,0x61,0x73,0x20,0x61,0x6e,0x20,0x4c,0x31,0x20,0x63,0x61,
-0x63,0x68,0x65,0x2c,0x20,0x74,0x68,0x65,0x20,0x53,0x54,0x4d,0x33,0x32,0x20,0x46,
-0x37,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x73,0x20,0x64,0x65,0x6c,0x69,0x76,0x65,
-0x72,0x20,0x74,0x68,0x65,0x20,0x6d,0x61,0x78,0x69,0x6d,0x75,0x6d,0x20,0x74,0x68,
-0x65,0x6f,0x72,0x65,0x74,0x69,0x63,0x61,0x6c,0x20,0x70,0x65,0x72,0x66,0x6f,0x72,
-0x6d,0x61,0x6e,0x63,0x65,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x43,0x6f,0x72,
-0x74,0x65,0x78,0x2d,0x4d,0x37,0x20,0x6e,0x6f,0x20,0x6d,0x61,0x74,0x74,0x65,0x72,
-0x20,0x77,0x68,0x65,0x74,0x68,0x65,0x72,0x20,0x63,0x6f,0x64,0x65,0x20,0x69,0x73,
-0x20,0x65,0x78,0x65,0x63,0x75,0x74,0x65,0x64,0x20,0x66,0x72,0x6f,0x6d,0x20,0x65,
-0x6d,0x62,0x65,0x64,0x64,0x65,0x64,0x20,0x46,0x6c,0x61,0x73,0x68,0x20,0x6f,0x72,
-0x20,0x65,0x78,0x74,0x65,0x72,0x6e,0x61,0x6c,0x20,0x4d,0x65,0x6d,0x6f,0x72,0x79,
-0x3a,0x20,0x31,0x30,0x30,0x30,0x20,0x43,0x6f,0x72,0x65,0x4d,0x61,0x72,0x6b,0x2f,
-0x34,0x32,0x38,0x20,0x44,0x4d,0x49,0x50,0x53,0x20,0x61,0x74,0x20,0x32,0x30,0x30,
-0x20,0x4d,0x48,0x7a,0x20,0x66,0x43,0x50,0x55,0x3c,0x62,0x72,0x3e,0x0d,0x0a,0x3c,
-0x62,0x72,0x3e,0x0d,0x0a,0x3c,0x61,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,
-0x6f,0x6e,0x74,0x2d,0x77,0x65,0x69,0x67,0x68,0x74,0x3a,0x20,0x62,0x6f,0x6c,0x64,
-0x3b,0x22,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,
-0x77,0x77,0x77,0x2e,0x73,0x74,0x2e,0x63,0x6f,0x6d,0x2f,0x63,0x6f,0x6e,0x74,0x65,
-0x6e,0x74,0x2f,0x73,0x74,0x5f,0x63,0x6f,0x6d,0x2f,0x65,0x6e,0x2f,0x70,0x72,0x6f,
-0x64,0x75,0x63,0x74,0x73,0x2f,0x6d,0x69,0x63,0x72,0x6f,0x63,0x6f,0x6e,0x74,0x72,
-0x6f,0x6c,0x6c,0x65,0x72,0x73,0x2f,0x73,0x74,0x6d,0x33,0x32,0x2d,0x33,0x32,0x2d,
-0x62,0x69,0x74,0x2d,0x61,0x72,0x6d,0x2d,0x63,0x6f,0x72,0x74,0x65,0x78,0x2d,0x6d,
-0x63,0x75,0x73,0x2f,0x73,0x74,0x6d,0x33,0x32,0x66,0x37,0x2d,0x73,0x65,0x72,0x69,
-0x65,0x73,0x2e,0x68,0x74,0x6d,0x6c,0x22,0x20,0x74,0x61,0x72,0x67,0x65,0x74,0x3d,
-0x22,0x5f,0x62,0x6c,0x61,0x6e,0x6b,0x22,0x3e,0x54,0x68,0x65,0x20,0x53,0x54,0x4d,
-0x33,0x32,0x46,0x37,0x78,0x78,0x20,0x68,0x6f,0x6d,0x65,0x20,0x70,0x61,0x67,0x65,
-0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x74,0x64,0x3e,
-0x0d,0x0a,0x3c,0x74,0x64,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x32,0x25,0x22,
-0x3e,0x3c,0x2f,0x74,0x64,0x3e,0x0d,0x0a,0x3c,0x74,0x64,0x20,0x61,0x6c,0x69,0x67,
-0x6e,0x3d,0x22,0x72,0x69,0x67,0x68,0x74,0x22,0x20,0x76,0x61,0x6c,0x69,0x67,0x6e,
-0x3d,0x22,0x74,0x6f,0x70,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x32,0x36,
-0x25,0x22,0x3e,0x3c,0x62,0x72,0x3e,0x0d,0x0a,0x3c,0x62,0x72,0x3e,0x0d,0x0a,0x3c,
-0x69,0x6d,0x67,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x77,0x69,0x64,0x74,0x68,
-0x3a,0x20,0x34,0x30,0x30,0x70,0x78,0x3b,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,
-0x20,0x31,0x38,0x30,0x70,0x78,0x3b,0x22,0x20,0x61,0x6c,0x74,0x3d,0x22,0x22,0x20,
-0x73,0x72,0x63,0x3d,0x22,0x53,0x54,0x4d,0x33,0x32,0x46,0x37,0x78,0x78,0x5f,0x66,
-0x69,0x6c,0x65,0x73,0x2f,0x73,0x74,0x6d,0x33,0x32,0x2e,0x6a,0x70,0x67,0x22,0x3e,
-0x3c,0x2f,0x74,0x64,0x3e,0x0d,0x0a,0x3c,0x2f,0x74,0x72,0x3e,0x0d,0x0a,0x3c,0x2f,
-0x74,0x62,0x6f,0x64,0x79,0x3e,0x0d,0x0a,0x3c,0x2f,0x74,0x61,0x62,0x6c,0x65,0x3e,
-0x0d,0x0a,0x3c,0x2f,0x74,0x64,0x3e,0x0d,0x0a,0x3c,0x2f,0x74,0x72,0x3e,0x0d,0x0a,
-0x3c,0x74,0x72,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x22,0x3e,0x0d,0x0a,0x3c,
-0x74,0x64,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x70,0x61,0x64,0x64,0x69,0x6e,
-0x67,0x3a,0x20,0x32,0x2e,0x32,0x35,0x70,0x74,0x3b,0x22,0x3e,0x0d,0x0a,0x3c,0x70,
-0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x4d,0x73,0x6f,0x4e,0x6f,0x72,0x6d,0x61,
-0x6c,0x22,0x3e,0x3c,0x6f,0x3a,0x70,0x3e,0x26,0x6e,0x62,0x73,0x70,0x3b,0x3c,0x2f,
-0x6f,0x3a,0x70,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x3c,0x2f,0x74,0x64,0x3e,0x0d,
-0x0a,0x3c,0x2f,0x74,0x72,0x3e,0x0d,0x0a,0x3c,0x74,0x72,0x20,0x73,0x74,0x79,0x6c,
-0x65,0x3d,0x22,0x22,0x3e,0x0d,0x0a,0x3c,0x74,0x64,0x20,0x73,0x74,0x79,0x6c,0x65,
-0x3d,0x22,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,0x32,0x2e,0x32,0x35,0x70,
-0x74,0x3b,0x22,0x20,0x76,0x61,0x6c,0x69,0x67,0x6e,0x3d,0x22,0x74,0x6f,0x70,0x22,
-0x3e,0x0d,0x0a,0x3c,0x74,0x61,0x62,0x6c,0x65,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
-0x22,0x4d,0x73,0x6f,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x54,0x61,0x62,0x6c,0x65,0x22,
-0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x35,
-0x30,0x37,0x2e,0x34,0x70,0x74,0x3b,0x22,0x20,0x62,0x6f,0x72,0x64,0x65,0x72,0x3d,
-0x22,0x30,0x22,0x20,0x63,0x65,0x6c,0x6c,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3d,
-0x22,0x30,0x22,0x20,0x63,0x65,0x6c,0x6c,0x73,0x70,0x61,0x63,0x69,0x6e,0x67,0x3d,
-0x22,0x30,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x36,0x37,0x37,0x22,0x3e,
-0x0d,0x0a,0x3c,0x74,0x62,0x6f,0x64,0x79,0x3e,0x0d,0x0a,0x3c,0x74,0x72,0x20,0x73,
-0x74,0x79,0x6c,0x65,0x3d,0x22,0x22,0x3e,0x0d,0x0a,0x3c,0x74,0x64,0x20,0x73,0x74,
-0x79,0x6c,0x65,0x3d,0x22,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,0x32,0x2e,
-0x32,0x35,0x70,0x74,0x3b,0x20,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,
-0x3a,0x20,0x72,0x67,0x62,0x28,0x35,0x31,0x2c,0x20,0x35,0x31,0x2c,0x20,0x32,0x35,
-0x35,0x29,0x20,0x6e,0x6f,0x6e,0x65,0x20,0x72,0x65,0x70,0x65,0x61,0x74,0x20,0x73,
-0x63,0x72,0x6f,0x6c,0x6c,0x20,0x30,0x25,0x20,0x35,0x30,0x25,0x3b,0x20,0x2d,0x6d,
-0x6f,0x7a,0x2d,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6c,
-0x69,0x70,0x3a,0x20,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x3b,0x20,0x2d,0x6d,0x6f,
-0x7a,0x2d,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x6f,0x72,0x69,
-0x67,0x69,0x6e,0x3a,0x20,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x3b,0x20,0x2d,0x6d,
-0x6f,0x7a,0x2d,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x69,0x6e,
-0x6c,0x69,0x6e,0x65,0x2d,0x70,0x6f,0x6c,0x69,0x63,0x79,0x3a,0x20,0x69,0x6e,0x69,
-0x74,0x69,0x61,0x6c,0x3b,0x20,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x35,0x30,0x34,
-0x2e,0x32,0x70,0x74,0x3b,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x36,0x37,
-0x32,0x22,0x3e,0x0d,0x0a,0x3c,0x70,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x4d,
-0x73,0x6f,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x22,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,
-0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x77,0x68,
-0x69,0x74,0x65,0x3b,0x22,0x3e,0x26,0x6e,0x62,0x73,0x70,0x3b,0x3c,0x2f,0x73,0x70,
-0x61,0x6e,0x3e,0x3c,0x73,0x74,0x72,0x6f,0x6e,0x67,0x3e,0x3c,0x73,0x70,0x61,0x6e,
-0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,
-0x69,0x6c,0x79,0x3a,0x20,0x56,0x65,0x72,0x64,0x61,0x6e,0x61,0x3b,0x20,0x63,0x6f,
-0x6c,0x6f,0x72,0x3a,0x20,0x77,0x68,0x69,0x74,0x65,0x3b,0x22,0x3e,0x41,0x62,0x6f,
-0x75,0x74,0x20,0x74,0x68,0x69,0x73,0x0d,0x0a,0x64,0x65,0x6d,0x6f,0x6e,0x73,0x74,
-0x72,0x61,0x74,0x69,0x6f,0x6e,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x73,
-0x74,0x72,0x6f,0x6e,0x67,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,
-0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x20,
-0x56,0x65,0x72,0x64,0x61,0x6e,0x61,0x3b,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,
-0x77,0x68,0x69,0x74,0x65,0x3b,0x22,0x3e,0x3c,0x6f,0x3a,0x70,0x3e,0x3c,0x2f,0x6f,
-0x3a,0x70,0x3e,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,
-0x3c,0x2f,0x74,0x64,0x3e,0x0d,0x0a,0x3c,0x74,0x64,0x20,0x73,0x74,0x79,0x6c,0x65,
-0x3d,0x22,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,0x20,0x6d,0x65,0x64,0x69,0x75,0x6d,
-0x20,0x6e,0x6f,0x6e,0x65,0x20,0x3b,0x20,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,
-0x20,0x30,0x63,0x6d,0x3b,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x34,0x22,
-0x3e,0x0d,0x0a,0x3c,0x70,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x4d,0x73,0x6f,
-0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x22,0x3e,0x26,0x6e,0x62,0x73,0x70,0x3b,0x3c,0x2f,
-0x70,0x3e,0x0d,0x0a,0x3c,0x2f,0x74,0x64,0x3e,0x0d,0x0a,0x3c,0x2f,0x74,0x72,0x3e,
-0x0d,0x0a,0x3c,0x74,0x72,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x68,0x65,0x69,
-0x67,0x68,0x74,0x3a,0x20,0x31,0x31,0x2e,0x32,0x35,0x70,0x74,0x3b,0x22,0x3e,0x0d,
-0x0a,0x3c,0x74,0x64,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x70,0x61,0x64,0x64,
-0x69,0x6e,0x67,0x3a,0x20,0x32,0x2e,0x32,0x35,0x70,0x74,0x3b,0x20,0x77,0x69,0x64,
-0x74,0x68,0x3a,0x20,0x35,0x30,0x34,0x2e,0x32,0x70,0x74,0x3b,0x20,0x68,0x65,0x69,
-0x67,0x68,0x74,0x3a,0x20,0x31,0x31,0x2e,0x32,0x35,0x70,0x74,0x3b,0x22,0x20,0x76,
-0x61,0x6c,0x69,0x67,0x6e,0x3d,0x22,0x74,0x6f,0x70,0x22,0x20,0x77,0x69,0x64,0x74,
-0x68,0x3d,0x22,0x36,0x37,0x32,0x22,0x3e,0x0d,0x0a,0x3c,0x70,0x20,0x63,0x6c,0x61,
-0x73,0x73,0x3d,0x22,0x4d,0x73,0x6f,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x22,0x3e,0x3c,
-0x73,0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,
-0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,0x30,0x70,0x74,0x3b,0x20,0x66,0x6f,0x6e,
-0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x20,0x56,0x65,0x72,0x64,0x61,0x6e,
-0x61,0x3b,0x22,0x3e,0x54,0x68,0x69,0x73,0x0d,0x0a,0x77,0x65,0x62,0x73,0x65,0x72,
-0x76,0x65,0x72,0x20,0x69,0x73,0x20,0x61,0x20,0x70,0x61,0x72,0x74,0x20,0x6f,0x66,
-0x20,0x61,0x20,0x64,0x65,0x6d,0x6f,0x6e,0x73,0x74,0x72,0x61,0x74,0x69,0x6f,0x6e,
-0x20,0x70,0x61,0x63,0x6b,0x61,0x67,0x65,0x20,0x64,0x65,0x76,0x65,0x6c,0x6f,0x70,
-0x65,0x64,0x20,0x6f,0x6e,0x20,0x74,0x68,0x65,0x20,0x74,0x6f,0x70,0x0d,0x0a,0x6c,
-0x65,0x76,0x65,0x6c,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x6c,0x77,0x49,0x50,
-0x20,0x54,0x43,0x50,0x2f,0x49,0x50,0x20,0x73,0x74,0x61,0x63,0x6b,0x2e,0x20,0x3c,
-0x62,0x72,0x3e,0x0d,0x0a,0x3c,0x62,0x72,0x3e,0x0d,0x0a,0x54,0x68,0x65,0x20,0x70,
-0x61,0x63,0x6b,0x61,0x67,0x65,0x20,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x73,0x20,
-0x6e,0x69,0x6e,0x65,0x20,0x61,0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,
-0x73,0x3a,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x3c,
-0x6f,0x6c,0x3e,0x0d,0x0a,0x3c,0x6c,0x69,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,
-0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,
-0x20,0x31,0x30,0x70,0x74,0x3b,0x20,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,
-0x6c,0x79,0x3a,0x20,0x56,0x65,0x72,0x64,0x61,0x6e,0x61,0x3b,0x22,0x3e,0x41,0x70,
-0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x73,0x0d,0x0a,0x72,0x75,0x6e,0x6e,
-0x69,0x6e,0x67,0x20,0x69,0x6e,0x20,0x73,0x74,0x61,0x6e,0x64,0x61,0x6c,0x6f,0x6e,
-0x65,0x20,0x28,0x77,0x69,0x74,0x68,0x6f,0x75,0x74,0x20,0x61,0x6e,0x20,0x52,0x54,
-0x4f,0x53,0x29,0x3a,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,
-0x0d,0x0a,0x3c,0x2f,0x6f,0x6c,0x3e,0x0d,0x0a,0x3c,0x75,0x6c,0x20,0x73,0x74,0x79,
-0x6c,0x65,0x3d,0x22,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x6c,0x65,0x66,0x74,0x3a,
-0x20,0x34,0x30,0x70,0x78,0x3b,0x22,0x3e,0x0d,0x0a,0x3c,0x6c,0x69,0x3e,0x3c,0x73,
-0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,
-0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,0x30,0x70,0x74,0x3b,0x20,0x66,0x6f,0x6e,0x74,
-0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x20,0x56,0x65,0x72,0x64,0x61,0x6e,0x61,
-0x3b,0x22,0x3e,0x41,0x0d,0x0a,0x57,0x65,0x62,0x73,0x65,0x72,0x76,0x65,0x72,0x2e,
-0x26,0x6e,0x62,0x73,0x70,0x3b,0x3c,0x6f,0x3a,0x70,0x3e,0x3c,0x2f,0x6f,0x3a,0x70,
-0x3e,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0d,0x0a,0x3c,
-0x6c,0x69,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,
-0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,0x30,0x70,0x74,0x3b,
-0x20,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x20,0x56,0x65,
-0x72,0x64,0x61,0x6e,0x61,0x3b,0x22,0x3e,0x41,0x20,0x54,0x46,0x54,0x50,0x20,0x73,
-0x65,0x72,0x76,0x65,0x72,0x2e,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x6c,
-0x69,0x3e,0x0d,0x0a,0x3c,0x6c,0x69,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,0x74,
-0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,
-0x31,0x30,0x70,0x74,0x3b,0x20,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,
-0x79,0x3a,0x20,0x56,0x65,0x72,0x64,0x61,0x6e,0x61,0x3b,0x22,0x3e,0x41,0x20,0x54,
-0x43,0x50,0x20,0x65,0x63,0x68,0x6f,0x0d,0x0a,0x63,0x6c,0x69,0x65,0x6e,0x74,0x20,
-0x61,0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x3c,0x2f,0x73,0x70,0x61,
-0x6e,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0d,0x0a,0x3c,0x6c,0x69,0x3e,0x3c,0x73,0x70,
-0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x73,
-0x69,0x7a,0x65,0x3a,0x20,0x31,0x30,0x70,0x74,0x3b,0x20,0x66,0x6f,0x6e,0x74,0x2d,
-0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x20,0x56,0x65,0x72,0x64,0x61,0x6e,0x61,0x3b,
-0x22,0x3e,0x41,0x20,0x54,0x43,0x50,0x20,0x65,0x63,0x68,0x6f,0x0d,0x0a,0x73,0x65,
-0x72,0x76,0x65,0x72,0x20,0x61,0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,
-0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0d,0x0a,0x3c,0x6c,
-0x69,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,
-0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,0x30,0x70,0x74,0x3b,0x20,
-0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x20,0x56,0x65,0x72,
-0x64,0x61,0x6e,0x61,0x3b,0x22,0x3e,0x41,0x20,0x55,0x44,0x50,0x20,0x65,0x63,0x68,
-0x6f,0x0d,0x0a,0x63,0x6c,0x69,0x65,0x6e,0x74,0x20,0x61,0x70,0x70,0x6c,0x69,0x63,
-0x61,0x74,0x69,0x6f,0x6e,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x6c,0x69,
-0x3e,0x0d,0x0a,0x3c,0x6c,0x69,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,0x74,0x79,
-0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,
-0x30,0x70,0x74,0x3b,0x20,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,
-0x3a,0x20,0x56,0x65,0x72,0x64,0x61,0x6e,0x61,0x3b,0x22,0x3e,0x41,0x20,0x55,0x44,
-0x50,0x20,0x65,0x63,0x68,0x6f,0x0d,0x0a,0x73,0x65,0x72,0x76,0x65,0x72,0x20,0x61,
-0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x26,0x6e,0x62,0x73,0x70,0x3b,
-0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0d,0x0a,0x3c,0x2f,
-0x75,0x6c,0x3e,0x0d,0x0a,0x3c,0x6f,0x6c,0x20,0x73,0x74,0x61,0x72,0x74,0x3d,0x22,
-0x32,0x22,0x3e,0x0d,0x0a,0x3c,0x6c,0x69,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,
-0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,
-0x20,0x31,0x30,0x70,0x74,0x3b,0x20,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,
-0x6c,0x79,0x3a,0x20,0x56,0x65,0x72,0x64,0x61,0x6e,0x61,0x3b,0x22,0x3e,0x41,0x70,
-0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x73,0x0d,0x0a,0x72,0x75,0x6e,0x6e,
-0x69,0x6e,0x67,0x20,0x77,0x69,0x74,0x68,0x20,0x46,0x72,0x65,0x65,0x52,0x54,0x4f,
-0x53,0x20,0x6f,0x70,0x65,0x72,0x61,0x74,0x69,0x6e,0x67,0x20,0x73,0x79,0x73,0x74,
-0x65,0x6d,0x3a,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0d,
-0x0a,0x3c,0x2f,0x6f,0x6c,0x3e,0x0d,0x0a,0x3c,0x75,0x6c,0x20,0x73,0x74,0x79,0x6c,
-0x65,0x3d,0x22,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x6c,0x65,0x66,0x74,0x3a,0x20,
-0x34,0x30,0x70,0x78,0x3b,0x22,0x3e,0x0d,0x0a,0x3c,0x6c,0x69,0x3e,0x3c,0x73,0x70,
-0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x73,
-0x69,0x7a,0x65,0x3a,0x20,0x31,0x30,0x70,0x74,0x3b,0x20,0x66,0x6f,0x6e,0x74,0x2d,
-0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x20,0x56,0x65,0x72,0x64,0x61,0x6e,0x61,0x3b,
-0x22,0x3e,0x41,0x20,0x57,0x65,0x62,0x73,0x65,0x72,0x76,0x65,0x72,0x0d,0x0a,0x62,
-0x61,0x73,0x65,0x64,0x20,0x6f,0x6e,0x20,0x6e,0x65,0x74,0x63,0x6f,0x6e,0x6e,0x20,
-0x41,0x50,0x49,0x2e,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,
-0x0d,0x0a,0x3c,0x6c,0x69,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,
-0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,0x30,
-0x70,0x74,0x3b,0x20,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,
-0x20,0x56,0x65,0x72,0x64,0x61,0x6e,0x61,0x3b,0x22,0x3e,0x41,0x20,0x57,0x65,0x62,
-0x73,0x65,0x72,0x76,0x65,0x72,0x0d,0x0a,0x62,0x61,0x73,0x65,0x64,0x20,0x6f,0x6e,
-0x20,0x73,0x6f,0x63,0x6b,0x65,0x74,0x20,0x41,0x50,0x49,0x2e,0x3c,0x2f,0x73,0x70,
-0x61,0x6e,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0d,0x0a,0x3c,0x6c,0x69,0x3e,0x3c,0x73,
-0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,
-0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,0x30,0x70,0x74,0x3b,0x20,0x66,0x6f,0x6e,0x74,
-0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x20,0x56,0x65,0x72,0x64,0x61,0x6e,0x61,
-0x3b,0x22,0x3e,0x41,0x20,0x54,0x43,0x50,0x2f,0x55,0x44,0x50,0x0d,0x0a,0x65,0x63,
-0x68,0x6f,0x20,0x73,0x65,0x72,0x76,0x65,0x72,0x20,0x61,0x70,0x70,0x6c,0x69,0x63,
-0x61,0x74,0x69,0x6f,0x6e,0x20,0x62,0x61,0x73,0x65,0x64,0x20,0x6f,0x6e,0x20,0x6e,
-0x65,0x74,0x63,0x6f,0x6e,0x6e,0x20,0x41,0x50,0x49,0x2e,0x26,0x6e,0x62,0x73,0x70,
-0x3b,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0d,0x0a,0x3c,
-0x2f,0x75,0x6c,0x3e,0x0d,0x0a,0x3c,0x75,0x6c,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,
-0x64,0x69,0x73,0x63,0x22,0x3e,0x0d,0x0a,0x3c,0x2f,0x75,0x6c,0x3e,0x0d,0x0a,0x3c,
-0x70,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x4d,0x73,0x6f,0x4e,0x6f,0x72,0x6d,
-0x61,0x6c,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x22,0x3e,0x3c,0x6f,0x3a,
-0x70,0x3e,0x26,0x6e,0x62,0x73,0x70,0x3b,0x3c,0x2f,0x6f,0x3a,0x70,0x3e,0x3c,0x2f,
-0x70,0x3e,0x0d,0x0a,0x3c,0x2f,0x74,0x64,0x3e,0x0d,0x0a,0x3c,0x74,0x64,0x20,0x73,
-0x74,0x79,0x6c,0x65,0x3d,0x22,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,0x20,0x6d,0x65,
-0x64,0x69,0x75,0x6d,0x20,0x6e,0x6f,0x6e,0x65,0x20,0x3b,0x20,0x70,0x61,0x64,0x64,
-0x69,0x6e,0x67,0x3a,0x20,0x30,0x63,0x6d,0x3b,0x22,0x20,0x77,0x69,0x64,0x74,0x68,
-0x3d,0x22,0x34,0x22,0x3e,0x0d,0x0a,0x3c,0x70,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
-0x22,0x4d,0x73,0x6f,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x22,0x3e,0x26,0x6e,0x62,0x73,
-0x70,0x3b,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x3c,0x2f,0x74,0x64,0x3e,0x0d,0x0a,0x3c,
-0x2f,0x74,0x72,0x3e,0x0d,0x0a,0x3c,0x74,0x72,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,
-0x22,0x22,0x3e,0x0d,0x0a,0x3c,0x74,0x64,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,
-0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,0x32,0x2e,0x32,0x35,0x70,0x74,0x3b,
-0x20,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x20,0x72,0x67,0x62,
-0x28,0x35,0x31,0x2c,0x20,0x35,0x31,0x2c,0x20,0x32,0x35,0x35,0x29,0x20,0x6e,0x6f,
-0x6e,0x65,0x20,0x72,0x65,0x70,0x65,0x61,0x74,0x20,0x73,0x63,0x72,0x6f,0x6c,0x6c,
-0x20,0x30,0x25,0x20,0x35,0x30,0x25,0x3b,0x20,0x2d,0x6d,0x6f,0x7a,0x2d,0x62,0x61,
-0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6c,0x69,0x70,0x3a,0x20,0x69,
-0x6e,0x69,0x74,0x69,0x61,0x6c,0x3b,0x20,0x2d,0x6d,0x6f,0x7a,0x2d,0x62,0x61,0x63,
-0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x6f,0x72,0x69,0x67,0x69,0x6e,0x3a,0x20,
-0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x3b,0x20,0x2d,0x6d,0x6f,0x7a,0x2d,0x62,0x61,
-0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x2d,
-0x70,0x6f,0x6c,0x69,0x63,0x79,0x3a,0x20,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x3b,
-0x20,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x35,0x30,0x34,0x2e,0x32,0x70,0x74,0x3b,
-0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x36,0x37,0x32,0x22,0x3e,0x0d,0x0a,
-0x3c,0x70,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x4d,0x73,0x6f,0x4e,0x6f,0x72,
-0x6d,0x61,0x6c,0x22,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,
-0x3d,0x22,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x77,0x68,0x69,0x74,0x65,0x3b,0x22,
-0x3e,0x26,0x6e,0x62,0x73,0x70,0x3b,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x73,
-0x74,0x72,0x6f,0x6e,0x67,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,
-0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x20,
-0x56,0x65,0x72,0x64,0x61,0x6e,0x61,0x3b,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,
-0x77,0x68,0x69,0x74,0x65,0x3b,0x22,0x3e,0x41,0x62,0x6f,0x75,0x74,0x20,0x4c,0x77,
-0x49,0x50,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x73,0x74,0x72,0x6f,0x6e,
-0x67,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,
-0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x20,0x56,0x65,0x72,0x64,
-0x61,0x6e,0x61,0x3b,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x77,0x68,0x69,0x74,
-0x65,0x3b,0x22,0x3e,0x3c,0x6f,0x3a,0x70,0x3e,0x3c,0x2f,0x6f,0x3a,0x70,0x3e,0x3c,
-0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x3c,0x2f,0x74,0x64,
-0x3e,0x0d,0x0a,0x3c,0x74,0x64,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x62,0x6f,
-0x72,0x64,0x65,0x72,0x3a,0x20,0x6d,0x65,0x64,0x69,0x75,0x6d,0x20,0x6e,0x6f,0x6e,
-0x65,0x20,0x3b,0x20,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,0x30,0x63,0x6d,
-0x3b,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x34,0x22,0x3e,0x0d,0x0a,0x3c,
-0x70,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x4d,0x73,0x6f,0x4e,0x6f,0x72,0x6d,
-0x61,0x6c,0x22,0x3e,0x26,0x6e,0x62,0x73,0x70,0x3b,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,
-0x3c,0x2f,0x74,0x64,0x3e,0x0d,0x0a,0x3c,0x2f,0x74,0x72,0x3e,0x0d,0x0a,0x3c,0x74,
-0x72,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x22,0x3e,0x0d,0x0a,0x3c,0x74,0x64,
-0x20,0x63,0x6f,0x6c,0x73,0x70,0x61,0x6e,0x3d,0x22,0x32,0x22,0x20,0x73,0x74,0x79,
-0x6c,0x65,0x3d,0x22,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,0x32,0x2e,0x32,
-0x35,0x70,0x74,0x3b,0x20,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x35,0x30,0x37,0x2e,
-0x34,0x70,0x74,0x3b,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x36,0x37,0x37,
-0x22,0x3e,0x0d,0x0a,0x3c,0x70,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x4d,0x73,
-0x6f,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,
-0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,0x20,0x31,
-0x32,0x70,0x74,0x3b,0x22,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,
-0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,0x30,
-0x70,0x74,0x3b,0x20,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,
-0x20,0x56,0x65,0x72,0x64,0x61,0x6e,0x61,0x3b,0x22,0x3e,0x6c,0x77,0x49,0x50,0x2c,
-0x0d,0x0a,0x70,0x72,0x6f,0x6e,0x6f,0x75,0x6e,0x63,0x65,0x64,0x20,0x6c,0x69,0x67,
-0x68,0x74,0x77,0x65,0x69,0x67,0x68,0x74,0x20,0x49,0x50,0x2c,0x20,0x69,0x73,0x20,
-0x61,0x6e,0x20,0x6f,0x70,0x65,0x6e,0x20,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x54,
-0x43,0x50,0x2f,0x49,0x50,0x20,0x73,0x74,0x61,0x63,0x6b,0x20,0x64,0x65,0x76,0x65,
-0x6c,0x6f,0x70,0x65,0x64,0x20,0x62,0x79,0x0d,0x0a,0x41,0x64,0x61,0x6d,0x20,0x44,
-0x75,0x6e,0x6b,0x65,0x6c,0x73,0x20,0x61,0x74,0x20,0x74,0x68,0x65,0x20,0x53,0x77,
-0x65,0x64,0x69,0x73,0x68,0x20,0x49,0x6e,0x73,0x74,0x69,0x74,0x75,0x74,0x65,0x20,
-0x6f,0x66,0x20,0x43,0x6f,0x6d,0x70,0x75,0x74,0x65,0x72,0x20,0x53,0x63,0x69,0x65,
-0x6e,0x63,0x65,0x20,0x61,0x6e,0x64,0x20,0x69,0x73,0x0d,0x0a,0x6d,0x61,0x69,0x6e,
-0x74,0x61,0x69,0x6e,0x65,0x64,0x20,0x6e,0x6f,0x77,0x20,0x62,0x79,0x20,0x61,0x20,
-0x77,0x6f,0x72,0x6c,0x64,0x20,0x77,0x69,0x64,0x65,0x20,0x63,0x6f,0x6d,0x6d,0x75,
-0x6e,0x69,0x74,0x79,0x20,0x6f,0x66,0x20,0x64,0x65,0x76,0x65,0x6c,0x6f,0x70,0x65,
-0x72,0x73,0x2e,0x3c,0x62,0x72,0x3e,0x0d,0x0a,0x3c,0x62,0x72,0x3e,0x0d,0x0a,0x6c,
-0x77,0x49,0x50,0x20,0x66,0x65,0x61,0x74,0x75,0x72,0x65,0x73,0x3a,0x3c,0x62,0x72,
-0x3e,0x0d,0x0a,0x3c,0x62,0x72,0x3e,0x0d,0x0a,0x2d,0x20,0x49,0x50,0x20,0x28,0x49,
-0x6e,0x74,0x65,0x72,0x6e,0x65,0x74,0x20,0x50,0x72,0x6f,0x74,0x6f,0x63,0x6f,0x6c,
-0x29,0x20,0x69,0x6e,0x63,0x6c,0x75,0x64,0x69,0x6e,0x67,0x20,0x70,0x61,0x63,0x6b,
-0x65,0x74,0x20,0x66,0x6f,0x72,0x77,0x61,0x72,0x64,0x69,0x6e,0x67,0x20,0x6f,0x76,
-0x65,0x72,0x20,0x6d,0x75,0x6c,0x74,0x69,0x70,0x6c,0x65,0x0d,0x0a,0x6e,0x65,0x74,
-0x77,0x6f,0x72,0x6b,0x20,0x69,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,0x73,0x3c,
-0x62,0x72,0x3e,0x0d,0x0a,0x2d,0x20,0x49,0x43,0x4d,0x50,0x20,0x28,0x49,0x6e,0x74,
-0x65,0x72,0x6e,0x65,0x74,0x20,0x43,0x6f,0x6e,0x74,0x72,0x6f,0x6c,0x20,0x4d,0x65,
-0x73,0x73,0x61,0x67,0x65,0x20,0x50,0x72,0x6f,0x74,0x6f,0x63,0x6f,0x6c,0x29,0x20,
-0x66,0x6f,0x72,0x20,0x6e,0x65,0x74,0x77,0x6f,0x72,0x6b,0x20,0x6d,0x61,0x69,0x6e,
-0x74,0x65,0x6e,0x61,0x6e,0x63,0x65,0x20,0x61,0x6e,0x64,0x0d,0x0a,0x64,0x65,0x62,
-0x75,0x67,0x67,0x69,0x6e,0x67,0x3c,0x62,0x72,0x3e,0x0d,0x0a,0x2d,0x20,0x55,0x44,
-0x50,0x20,0x28,0x55,0x73,0x65,0x72,0x20,0x44,0x61,0x74,0x61,0x67,0x72,0x61,0x6d,
-0x20,0x50,0x72,0x6f,0x74,0x6f,0x63,0x6f,0x6c,0x29,0x20,0x69,0x6e,0x63,0x6c,0x75,
-0x64,0x69,0x6e,0x67,0x20,0x65,0x78,0x70,0x65,0x72,0x69,0x6d,0x65,0x6e,0x74,0x61,
-0x6c,0x20,0x55,0x44,0x50,0x2d,0x6c,0x69,0x74,0x65,0x0d,0x0a,0x65,0x78,0x74,0x65,
-0x6e,0x73,0x69,0x6f,0x6e,0x73,0x3c,0x62,0x72,0x3e,0x0d,0x0a,0x2d,0x20,0x54,0x43,
-0x50,0x20,0x28,0x54,0x72,0x61,0x6e,0x73,0x6d,0x69,0x73,0x73,0x69,0x6f,0x6e,0x20,
-0x43,0x6f,0x6e,0x74,0x72,0x6f,0x6c,0x20,0x50,0x72,0x6f,0x74,0x6f,0x63,0x6f,0x6c,
-0x29,0x20,0x77,0x69,0x74,0x68,0x20,0x63,0x6f,0x6e,0x67,0x65,0x73,0x74,0x69,0x6f,
-0x6e,0x20,0x63,0x6f,0x6e,0x74,0x72,0x6f,0x6c,0x2c,0x20,0x52,0x54,0x54,0x0d,0x0a,
-0x65,0x73,0x74,0x69,0x6d,0x61,0x74,0x69,0x6f,0x6e,0x20,0x61,0x6e,0x64,0x20,0x66,
-0x61,0x73,0x74,0x20,0x72,0x65,0x63,0x6f,0x76,0x65,0x72,0x79,0x2f,0x66,0x61,0x73,
-0x74,0x20,0x72,0x65,0x74,0x72,0x61,0x6e,0x73,0x6d,0x69,0x74,0x3c,0x62,0x72,0x3e,
-0x0d,0x0a,0x2d,0x20,0x53,0x70,0x65,0x63,0x69,0x61,0x6c,0x69,0x7a,0x65,0x64,0x20,
-0x72,0x61,0x77,0x20,0x41,0x50,0x49,0x20,0x66,0x6f,0x72,0x20,0x65,0x6e,0x68,0x61,
-0x6e,0x63,0x65,0x64,0x20,0x70,0x65,0x72,0x66,0x6f,0x72,0x6d,0x61,0x6e,0x63,0x65,
-0x3c,0x62,0x72,0x3e,0x0d,0x0a,0x2d,0x20,0x4f,0x70,0x74,0x69,0x6f,0x6e,0x61,0x6c,
-0x20,0x42,0x65,0x72,0x6b,0x65,0x6c,0x65,0x79,0x2d,0x61,0x6c,0x69,0x6b,0x65,0x20,
-0x73,0x6f,0x63,0x6b,0x65,0x74,0x20,0x41,0x50,0x49,0x3c,0x62,0x72,0x3e,0x0d,0x0a,
-0x2d,0x20,0x44,0x48,0x43,0x50,0x20,0x28,0x44,0x79,0x6e,0x61,0x6d,0x69,0x63,0x20,
-0x48,0x6f,0x73,0x74,0x20,0x43,0x6f,0x6e,0x66,0x69,0x67,0x75,0x72,0x61,0x74,0x69,
-0x6f,0x6e,0x20,0x50,0x72,0x6f,0x74,0x6f,0x63,0x6f,0x6c,0x29,0x3c,0x62,0x72,0x3e,
-0x0d,0x0a,0x2d,0x20,0x50,0x50,0x50,0x20,0x28,0x50,0x6f,0x69,0x6e,0x74,0x2d,0x74,
-0x6f,0x2d,0x50,0x6f,0x69,0x6e,0x74,0x20,0x50,0x72,0x6f,0x74,0x6f,0x63,0x6f,0x6c,
-0x29,0x3c,0x62,0x72,0x3e,0x0d,0x0a,0x2d,0x20,0x41,0x52,0x50,0x20,0x28,0x41,0x64,
-0x64,0x72,0x65,0x73,0x73,0x20,0x52,0x65,0x73,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,
-0x20,0x50,0x72,0x6f,0x74,0x6f,0x63,0x6f,0x6c,0x29,0x20,0x66,0x6f,0x72,0x20,0x45,
-0x74,0x68,0x65,0x72,0x6e,0x65,0x74,0x3c,0x62,0x72,0x3e,0x0d,0x0a,0x3c,0x62,0x72,
-0x3e,0x0d,0x0a,0x46,0x6f,0x72,0x20,0x6d,0x6f,0x72,0x65,0x20,0x69,0x6e,0x66,0x6f,
-0x72,0x6d,0x61,0x74,0x69,0x6f,0x6e,0x73,0x20,0x79,0x6f,0x75,0x20,0x63,0x61,0x6e,
-0x20,0x72,0x65,0x66,0x65,0x72,0x20,0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x77,0x65,
-0x62,0x73,0x69,0x74,0x65,0x3a,0x20,0x26,0x6e,0x62,0x73,0x70,0x3b,0x3c,0x61,0x20,
-0x68,0x72,0x65,0x66,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x73,0x61,0x76,
-0x61,0x6e,0x6e,0x61,0x68,0x2e,0x6e,0x6f,0x6e,0x67,0x6e,0x75,0x2e,0x6f,0x72,0x67,
-0x2f,0x70,0x72,0x6f,0x6a,0x65,0x63,0x74,0x73,0x2f,0x6c,0x77,0x69,0x70,0x2f,0x22,
-0x3e,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x73,0x61,0x76,0x61,0x6e,0x6e,0x61,0x68,
-0x2e,0x6e,0x6f,0x6e,0x67,0x6e,0x75,0x2e,0x6f,0x72,0x67,0x2f,0x70,0x72,0x6f,0x6a,
-0x65,0x63,0x74,0x73,0x2f,0x6c,0x77,0x69,0x70,0x2f,0x0d,0x0a,0x3c,0x2f,0x61,0x3e,
-0x3c,0x6f,0x3a,0x70,0x3e,0x3c,0x2f,0x6f,0x3a,0x70,0x3e,0x3c,0x2f,0x73,0x70,0x61,
-0x6e,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x3c,0x2f,0x74,0x64,0x3e,0x0d,0x0a,0x3c,
-0x2f,0x74,0x72,0x3e,0x0d,0x0a,0x3c,0x2f,0x74,0x62,0x6f,0x64,0x79,0x3e,0x0d,0x0a,
-0x3c,0x2f,0x74,0x61,0x62,0x6c,0x65,0x3e,0x0d,0x0a,0x3c,0x70,0x20,0x63,0x6c,0x61,
-0x73,0x73,0x3d,0x22,0x4d,0x73,0x6f,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x22,0x3e,0x3c,
-0x6f,0x3a,0x70,0x3e,0x3c,0x2f,0x6f,0x3a,0x70,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,
-0x3c,0x2f,0x74,0x64,0x3e,0x0d,0x0a,0x3c,0x2f,0x74,0x72,0x3e,0x0d,0x0a,0x3c,0x2f,
-0x74,0x62,0x6f,0x64,0x79,0x3e,0x0d,0x0a,0x3c,0x2f,0x74,0x61,0x62,0x6c,0x65,0x3e,
-0x0d,0x0a,0x3c,0x2f,0x74,0x64,0x3e,0x0d,0x0a,0x3c,0x2f,0x74,0x72,0x3e,0x0d,0x0a,
-0x3c,0x2f,0x74,0x62,0x6f,0x64,0x79,0x3e,0x0d,0x0a,0x3c,0x2f,0x74,0x61,0x62,0x6c,
-0x65,0x3e,0x0d,0x0a,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,
-0x22,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x20,0x6e,0x6f,0x6e,0x65,0x3b,0x22,
-0x3e,0x3c,0x6f,0x3a,0x70,0x3e,0x3c,0x2f,0x6f,0x3a,0x70,0x3e,0x3c,0x2f,0x73,0x70,
-0x61,0x6e,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,0x3c,0x64,0x69,0x76,0x20,
-0x61,0x6c,0x69,0x67,0x6e,0x3d,0x22,0x63,0x65,0x6e,0x74,0x65,0x72,0x22,0x3e,0x0d,
-0x0a,0x3c,0x74,0x61,0x62,0x6c,0x65,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x4d,
-0x73,0x6f,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x54,0x61,0x62,0x6c,0x65,0x22,0x20,0x73,
-0x74,0x79,0x6c,0x65,0x3d,0x22,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,
-0x3a,0x20,0x62,0x6c,0x61,0x63,0x6b,0x20,0x6e,0x6f,0x6e,0x65,0x20,0x72,0x65,0x70,
-0x65,0x61,0x74,0x20,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x20,0x30,0x25,0x20,0x35,0x30,
-0x25,0x3b,0x20,0x2d,0x6d,0x6f,0x7a,0x2d,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,
-0x6e,0x64,0x2d,0x63,0x6c,0x69,0x70,0x3a,0x20,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,
-0x3b,0x20,0x2d,0x6d,0x6f,0x7a,0x2d,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,
-0x64,0x2d,0x6f,0x72,0x69,0x67,0x69,0x6e,0x3a,0x20,0x69,0x6e,0x69,0x74,0x69,0x61,
-0x6c,0x3b,0x20,0x2d,0x6d,0x6f,0x7a,0x2d,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,
-0x6e,0x64,0x2d,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x2d,0x70,0x6f,0x6c,0x69,0x63,0x79,
-0x3a,0x20,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x3b,0x20,0x77,0x69,0x64,0x74,0x68,
-0x3a,0x20,0x35,0x37,0x34,0x2e,0x35,0x70,0x74,0x3b,0x22,0x20,0x62,0x6f,0x72,0x64,
-0x65,0x72,0x3d,0x22,0x30,0x22,0x20,0x63,0x65,0x6c,0x6c,0x70,0x61,0x64,0x64,0x69,
-0x6e,0x67,0x3d,0x22,0x30,0x22,0x20,0x63,0x65,0x6c,0x6c,0x73,0x70,0x61,0x63,0x69,
-0x6e,0x67,0x3d,0x22,0x30,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x37,0x36,
-0x36,0x22,0x3e,0x0d,0x0a,0x3c,0x74,0x62,0x6f,0x64,0x79,0x3e,0x0d,0x0a,0x3c,0x74,
-0x72,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x22,0x3e,0x0d,0x0a,0x3c,0x74,0x64,
-0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,
-0x20,0x30,0x63,0x6d,0x3b,0x20,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x31,0x30,0x30,
-0x25,0x3b,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x31,0x30,0x30,0x25,0x22,
-0x3e,0x0d,0x0a,0x3c,0x70,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x4d,0x73,0x6f,
-0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x22,0x3e,0x3c,0x69,0x6d,0x67,0x20,0x69,0x64,0x3d,
-0x22,0x5f,0x78,0x30,0x30,0x30,0x30,0x5f,0x69,0x31,0x30,0x32,0x38,0x22,0x20,0x73,
-0x72,0x63,0x3d,0x22,0x69,0x6e,0x63,0x68,0x74,0x6d,0x6c,0x2d,0x70,0x61,0x67,0x65,
-0x73,0x2d,0x73,0x74,0x6d,0x33,0x32,0x5f,0x63,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x69,
-0x76,0x69,0x74,0x79,0x5f,0x66,0x69,0x6c,0x65,0x73,0x2f,0x70,0x69,0x78,0x65,0x6c,
-0x2e,0x67,0x69,0x66,0x22,0x20,0x62,0x6f,0x72,0x64,0x65,0x72,0x3d,0x22,0x30,0x22,
-0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x31,0x22,0x20,0x77,0x69,0x64,0x74,
-0x68,0x3d,0x22,0x31,0x22,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x3c,0x2f,0x74,0x64,
-0x3e,0x0d,0x0a,0x3c,0x2f,0x74,0x72,0x3e,0x0d,0x0a,0x3c,0x2f,0x74,0x62,0x6f,0x64,
-0x79,0x3e,0x0d,0x0a,0x3c,0x2f,0x74,0x61,0x62,0x6c,0x65,0x3e,0x0d,0x0a,0x3c,0x2f,
-0x64,0x69,0x76,0x3e,0x0d,0x0a,0x3c,0x70,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
-0x4d,0x73,0x6f,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,
-0x3d,0x22,0x74,0x65,0x78,0x74,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,0x20,0x63,0x65,
-0x6e,0x74,0x65,0x72,0x3b,0x22,0x20,0x61,0x6c,0x69,0x67,0x6e,0x3d,0x22,0x63,0x65,
-0x6e,0x74,0x65,0x72,0x22,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,
-0x65,0x3d,0x22,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x20,0x6e,0x6f,0x6e,0x65,
-0x3b,0x22,0x3e,0x3c,0x6f,0x3a,0x70,0x3e,0x26,0x6e,0x62,0x73,0x70,0x3b,0x3c,0x2f,
-0x6f,0x3a,0x70,0x3e,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,
-0x0a,0x3c,0x64,0x69,0x76,0x20,0x61,0x6c,0x69,0x67,0x6e,0x3d,0x22,0x63,0x65,0x6e,
-0x74,0x65,0x72,0x22,0x3e,0x0d,0x0a,0x3c,0x74,0x61,0x62,0x6c,0x65,0x20,0x63,0x6c,
-0x61,0x73,0x73,0x3d,0x22,0x4d,0x73,0x6f,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x54,0x61,
-0x62,0x6c,0x65,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x77,0x69,0x64,0x74,
-0x68,0x3a,0x20,0x35,0x37,0x34,0x2e,0x35,0x70,0x74,0x3b,0x22,0x20,0x62,0x6f,0x72,
-0x64,0x65,0x72,0x3d,0x22,0x30,0x22,0x20,0x63,0x65,0x6c,0x6c,0x70,0x61,0x64,0x64,
-0x69,0x6e,0x67,0x3d,0x22,0x30,0x22,0x20,0x63,0x65,0x6c,0x6c,0x73,0x70,0x61,0x63,
-0x69,0x6e,0x67,0x3d,0x22,0x30,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x37,
-0x36,0x36,0x22,0x3e,0x0d,0x0a,0x3c,0x74,0x62,0x6f,0x64,0x79,0x3e,0x0d,0x0a,0x3c,
-0x74,0x72,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x22,0x3e,0x0d,0x0a,0x3c,0x74,
-0x64,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,
-0x3a,0x20,0x30,0x63,0x6d,0x3b,0x20,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x31,0x30,
-0x30,0x25,0x3b,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x31,0x30,0x30,0x25,
-0x22,0x3e,0x0d,0x0a,0x3c,0x64,0x69,0x76,0x20,0x69,0x64,0x3d,0x22,0x66,0x6f,0x6f,
-0x74,0x65,0x72,0x22,0x3e,0x0d,0x0a,0x3c,0x70,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
-0x22,0x6c,0x65,0x67,0x61,0x6c,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x74,
-0x65,0x78,0x74,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,0x20,0x63,0x65,0x6e,0x74,0x65,
-0x72,0x3b,0x22,0x20,0x61,0x6c,0x69,0x67,0x6e,0x3d,0x22,0x63,0x65,0x6e,0x74,0x65,
-0x72,0x22,0x3e,0x41,0x6c,0x6c,0x20,0x72,0x69,0x67,0x68,0x74,0x73,0x20,0x72,0x65,
-0x73,0x65,0x72,0x76,0x65,0x64,0x20,0xa9,0x32,0x30,0x31,0x36,0x0d,0x0a,0x53,0x54,
-0x4d,0x69,0x63,0x72,0x6f,0x65,0x6c,0x65,0x63,0x74,0x72,0x6f,0x6e,0x69,0x63,0x73,
-0x26,0x6e,0x62,0x73,0x70,0x3b,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x3c,0x2f,0x64,0x69,
-0x76,0x3e,0x0d,0x0a,0x3c,0x2f,0x74,0x64,0x3e,0x0d,0x0a,0x3c,0x2f,0x74,0x72,0x3e,
-0x0d,0x0a,0x3c,0x2f,0x74,0x62,0x6f,0x64,0x79,0x3e,0x0d,0x0a,0x3c,0x2f,0x74,0x61,
-0x62,0x6c,0x65,0x3e,0x0d,0x0a,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,0x3c,0x70,
-0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x4d,0x73,0x6f,0x4e,0x6f,0x72,0x6d,0x61,
-0x6c,0x22,0x3e,0x3c,0x6f,0x3a,0x70,0x3e,0x26,0x6e,0x62,0x73,0x70,0x3b,0x3c,0x2f,
-0x6f,0x3a,0x70,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x3c,0x2f,0x64,0x69,0x76,0x3e,
-0x0d,0x0a,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,0x3c,0x2f,0x62,0x6f,0x64,0x79,
-0x3e,0x3c,0x2f,0x68,0x74,0x6d,0x6c,0x3e,};
 
+const struct fsdata_file file__404_html[] = { {
+file_NULL,
+data__404_html,
+data__404_html + 12,
+sizeof(data__404_html) - 12,
+3,
+}};
 
+const struct fsdata_file file__STM32F7xx_html[] = { {
+file__404_html,
+data__STM32F7xx_html,
+data__STM32F7xx_html + 16,
+sizeof(data__STM32F7xx_html) - 16,
+3,
+}};
 
-const struct fsdata_file file__STM32F7xx_files_logo_jpg[] = { {
-file_NULL,
-data__STM32F7xx_files_logo_jpg,
-data__STM32F7xx_files_logo_jpg + 28,
-sizeof(data__STM32F7xx_files_logo_jpg) - 28,
-1,
+const struct fsdata_file file__STM32F7xx_html_gz[] = { {
+file__STM32F7xx_html,
+data__STM32F7xx_html_gz,
+data__STM32F7xx_html_gz + 20,
+sizeof(data__STM32F7xx_html_gz) - 20,
+3,
 }};
 
 const struct fsdata_file file__STM32F7xx_files_ST_gif[] = { {
-file__STM32F7xx_files_logo_jpg,
+file__STM32F7xx_html_gz,
 data__STM32F7xx_files_ST_gif,
 data__STM32F7xx_files_ST_gif + 24,
 sizeof(data__STM32F7xx_files_ST_gif) - 24,
-1,
+3,
 }};
 
-const struct fsdata_file file__STM32F7xx_files_stm32_jpg[] = { {
+const struct fsdata_file file__STM32F7xx_files_logo_jpg[] = { {
 file__STM32F7xx_files_ST_gif,
+data__STM32F7xx_files_logo_jpg,
+data__STM32F7xx_files_logo_jpg + 28,
+sizeof(data__STM32F7xx_files_logo_jpg) - 28,
+3,
+}};
+
+const struct fsdata_file file__STM32F7xx_files_stm32_jpg[] = { {
+file__STM32F7xx_files_logo_jpg,
 data__STM32F7xx_files_stm32_jpg,
 data__STM32F7xx_files_stm32_jpg + 28,
 sizeof(data__STM32F7xx_files_stm32_jpg) - 28,
-1,
-}};
-
-const struct fsdata_file file__404_html[] = { {
-file__STM32F7xx_files_stm32_jpg,
-data__404_html,
-data__404_html + 12,
-sizeof(data__404_html) - 12,
-1,
+3,
 }};
 
-const struct fsdata_file file__STM32F7xx_html[] = { {
-file__404_html,
-data__STM32F7xx_html,
-data__STM32F7xx_html + 16,
-sizeof(data__STM32F7xx_html) - 16,
-1,
-}};
-
-#define FS_ROOT file__STM32F7xx_html
-#define FS_NUMFILES 5
-
+#define FS_ROOT file__STM32F7xx_files_stm32_jpg
+#define FS_NUMFILES 6
@@ -0,0 +1,299 @@
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include "app.h"
+#include "main.h"
+#include "cmsis_os.h"
+#include "ethernetif.h"
+#include "pps_capture.h"
+#include "ptpd.h"
+#include "nmea.h"
+#include "gnss_servo.h"
+#include "time_source.h"
+#include "gnss.h"
+
+#define GNSS_QUEUE_SIZE     128
+#define GNSS_MSG_PPS        0x100   /* queue marker, values below are received bytes */
+#define GNSS_POLL_MS        100
+#define GNSS_PPS_TIMEOUT_MS 1500    /* no PPS within this time counts as a missed sample */
+#define GNSS_NMEA_WINDOW_MS 1000    /* NMEA time refers to a PPS edge at most this old */
+
+typedef struct _gnss {
+    UART_HandleTypeDef huart;
+    osMessageQId queue;
+    osThreadId threadid;
+    nmea_parser_t nmea;
+    nmea_time_t time;
+    gnss_servo_t servo;
+    pps_edge_t isr_edge;        /* written by the capture interrupt */
+    pps_edge_t edge;            /* last edge processed */
+    uint32_t edge_tick;
+    uint32_t edges;
+    uint32_t steps;
+    int32_t sec_delta;          /* pending whole second correction */
+    uint8_t tod_ok;             /* PHC seconds agree with NMEA */
+    uint8_t locked;             /* reached lock since the last loss of holdover */
+} gnss_t;
+
+static gnss_t gnss;
+
+// Report the servo state to the source manager
+static void gnss_update_source(void)
+{
+    time_source_status_t status = {0};
+    uint8_t pps = gnss.edges != 0 && osKernelSysTick() - gnss.edge_tick < GNSS_PPS_TIMEOUT_MS;
+
+    status.clock_class = 6;
+    status.error = abs(gnss.servo.offset);
+    status.jitter = abs(gnss.servo.offset);
+
+    switch (gnss.servo.state) {
+        case GNSS_SERVO_LOCKED:
+            gnss.locked = 1;
+            status.state = gnss.tod_ok ? TIME_SOURCE_LOCKED : TIME_SOURCE_ACQUIRING;
+            break;
+
+        case GNSS_SERVO_HOLDOVER:
+            if (gnss.locked) {
+                status.state = TIME_SOURCE_HOLDOVER;
+                status.clock_class = gnss.servo.holdover < GNSS_HOLDOVER_SPEC ? 7 : 52;
+                status.error += gnss.servo.holdover * TIME_SOURCE_HOLDOVER_DRIFT;
+            }
+            break;
+
+        default:
+            gnss.locked = 0;
+            if (pps && gnss.time.valid) {
+                status.state = TIME_SOURCE_ACQUIRING;
+            }
+            break;
+    }
+
+    time_source_report(TIME_SOURCE_GNSS, &status);
+}
+
+static void gnss_step(int32_t sec, int32_t nsec)
+{
+    struct ptptime_t offset;
+
+    offset.tv_sec = sec;
+    offset.tv_nsec = nsec;
+    ethernetif_ptp_update_offset(&offset);
+    gnss.steps++;
+}
+
+// Servo sample of a PPS edge, while the GNSS source owns the PHC
+static void gnss_pps(void)
+{
+    taskENTER_CRITICAL();
+    gnss.edge = gnss.isr_edge;
+    taskEXIT_CRITICAL();
+
+    gnss.edge_tick = osKernelSysTick();
+    gnss.edges++;
+
+    /* Another reference owns the PHC */
+    if (!gnss.time.valid || !time_source_may_discipline(TIME_SOURCE_GNSS)) {
+        gnss_update_source();
+        return;
+    }
+
+    if (gnss_servo_sample(&gnss.servo, gnss.edge.offset) == GNSS_SERVO_STEP) {
+        gnss_step(0, -gnss.edge.offset);
+    }
+
+    ethernetif_ptp_adj_freq(gnss.servo.freq);
+    gnss_update_source();
+}
+
+// NMEA time of day labels the preceding PPS edge
+static void gnss_time_of_day(void)
+{
+    int32_t delta;
+
+    if (!gnss.time.valid || osKernelSysTick() - gnss.edge_tick > GNSS_NMEA_WINDOW_MS) {
+        return;
+    }
+
+    delta = (int32_t)(gnss.time.utc + TIME_SOURCE_UTC_OFFSET - gnss.edge.sec);
+
+    if (delta == 0) {
+        gnss.sec_delta = 0;
+        gnss.tod_ok = 1;
+        return;
+    }
+
+    /* Step only when two consecutive sentences agree, and never the
+     * seconds of a PHC another reference owns */
+    if (!time_source_may_discipline(TIME_SOURCE_GNSS)) {
+        gnss.sec_delta = 0;
+    } else if (delta == gnss.sec_delta) {
+        LOG_INF("GNSS: stepping PHC %ld s", (long)delta);
+        gnss_step(delta, 0);
+        gnss.edge.sec += delta;
+        gnss.sec_delta = 0;
+    } else {
+        gnss.sec_delta = delta;
+    }
+
+    gnss.tod_ok = 0;
+    gnss_update_source();
+}
+
+static void gnss_thread(const void *arg)
+{
+    uint32_t deadline = osKernelSysTick() + GNSS_PPS_TIMEOUT_MS;
+
+    for (;;) {
+        osEvent event = osMessageGet(gnss.queue, GNSS_POLL_MS);
+
+        if (event.status == osEventMessage) {
+            if (event.value.v == GNSS_MSG_PPS) {
+                /* Edges keep arriving while another reference owns the PHC, no holdover then */
+                gnss_pps();
+                deadline = osKernelSysTick() + GNSS_PPS_TIMEOUT_MS;
+            } else if (nmea_feed(&gnss.nmea, (char)event.value.v, &gnss.time)) {
+                gnss_time_of_day();
+            }
+        }
+
+        if ((int32_t)(osKernelSysTick() - deadline) >= 0) {
+            uint8_t state = gnss.servo.state;
+
+            deadline += 1000;
+            gnss_servo_tick(&gnss.servo);
+
+            if (state != GNSS_SERVO_HOLDOVER && gnss.servo.state == GNSS_SERVO_HOLDOVER &&
+                time_source_may_discipline(TIME_SOURCE_GNSS)) {
+                ethernetif_ptp_adj_freq(gnss.servo.freq);
+            }
+
+            gnss_update_source();
+        }
+    }
+}
+
+static void gnss_pps_cb(uint8_t input, const pps_edge_t *edge)
+{
+    gnss.isr_edge = *edge;
+    osMessagePut(gnss.queue, GNSS_MSG_PPS, 0);
+}
+
+void USART6_IRQHandler(void)
+{
+    uint32_t isrflags = GNSS_UART->ISR;
+
+    if (isrflags & (USART_ISR_PE | USART_ISR_FE | USART_ISR_ORE | USART_ISR_NE)) {
+        GNSS_UART->ICR = USART_ICR_PECF | USART_ICR_FECF | USART_ICR_ORECF | USART_ICR_NCF;
+    }
+
+    if (isrflags & USART_ISR_RXNE) {
+        osMessagePut(gnss.queue, GNSS_UART->RDR & 0xFF, 0);
+    }
+}
+
+static osStatus gnss_uart_init(void)
+{
+    gnss.huart.Instance = GNSS_UART;
+    gnss.huart.Init.BaudRate = GNSS_UART_BAUDRATE;
+    gnss.huart.Init.WordLength = UART_WORDLENGTH_8B;
+    gnss.huart.Init.StopBits = UART_STOPBITS_1;
+    gnss.huart.Init.Parity = UART_PARITY_NONE;
+    gnss.huart.Init.Mode = UART_MODE_RX;
+    gnss.huart.Init.HwFlowCtl = UART_HWCONTROL_NONE;
+    gnss.huart.Init.OverSampling = UART_OVERSAMPLING_16;
+    gnss.huart.Init.OneBitSampling = UART_ONE_BIT_SAMPLE_DISABLE;
+    gnss.huart.AdvancedInit.AdvFeatureInit = UART_ADVFEATURE_NO_INIT;
+
+    if (HAL_UART_Init(&gnss.huart) != HAL_OK) {
+        return osErrorOS;
+    }
+
+    HAL_NVIC_SetPriority(GNSS_UART_IRQ, 8, 0);
+    HAL_NVIC_EnableIRQ(GNSS_UART_IRQ);
+    SET_BIT(gnss.huart.Instance->CR1, USART_CR1_RXNEIE);
+
+    return osOK;
+}
+
+// Public: start GNSS discipline
+osStatus gnss_start(void)
+{
+    if (gnss.threadid != NULL) {
+        return osOK;
+    }
+
+    if (gnss.queue == NULL) {
+        osMessageQDef_t queue_def = {0};
+
+        queue_def.queue_sz = GNSS_QUEUE_SIZE;
+        queue_def.item_sz = sizeof(uint32_t);
+
+        gnss.queue = osMessageCreate(&queue_def, NULL);
+
+        if (gnss.queue == NULL) {
+            LOG_ERR("GNSS: failed to create queue");
+            return osErrorOS;
+        }
+    }
+
+    memset(&gnss.nmea, 0, sizeof(gnss.nmea));
+    memset(&gnss.time, 0, sizeof(gnss.time));
+    gnss_servo_init(&gnss.servo);
+    gnss.tod_ok = 0;
+    gnss.sec_delta = 0;
+    gnss.locked = 0;
+
+    if (gnss_uart_init() != osOK) {
+        LOG_ERR("GNSS: failed to init uart");
+        return osErrorOS;
+    }
+
+    /* PHC PPS at 1 Hz is the capture reference */
+    ethernetif_ptp_set_pps_output(0);
+    pps_capture_init();
+    pps_capture_set_callback(PPS_INPUT_GNSS, gnss_pps_cb);
+
+    osThreadDef(GNSS, gnss_thread, osPriorityAboveNormal, 0, configMINIMAL_STACK_SIZE * 2);
+    gnss.threadid = osThreadCreate(osThread(GNSS), NULL);
+
+    if (gnss.threadid == NULL) {
+        LOG_ERR("GNSS: failed to create task");
+        return osErrorOS;
+    }
+
+    LOG_INF("GNSS: started");
+    return osOK;
+}
+
+void gnss_stop(void)
+{
+    if (gnss.threadid == NULL) {
+        return;
+    }
+
+    pps_capture_set_callback(PPS_INPUT_GNSS, NULL);
+    HAL_NVIC_DisableIRQ(GNSS_UART_IRQ);
+    HAL_UART_DeInit(&gnss.huart);
+
+    osThreadTerminate(gnss.threadid);
+    gnss.threadid = NULL;
+
+    /* Keep the learned frequency, but stop claiming traceability */
+    gnss.servo.state = GNSS_SERVO_UNLOCKED;
+    gnss.edges = 0;
+    gnss_update_source();
+    LOG_INF("GNSS: stopped");
+}
+
+void gnss_stats(void)
+{
+    LOG_PRINT("\tstate: %s%s", gnss_servo_state_name(gnss.servo.state), gnss.threadid ? "" : " (stopped)");
+    LOG_PRINT("\tfix: %s, time of day %s", gnss.time.valid ? "yes" : "no", gnss.tod_ok ? "ok" : "unknown");
+    LOG_PRINT("\tutc: %lu", (unsigned long)gnss.time.utc);
+    LOG_PRINT("\toffset: %ld nsec", (long)gnss.servo.offset);
+    LOG_PRINT("\tfreq: %ld ppb", (long)gnss.servo.freq);
+    LOG_PRINT("\tholdover: %lu s", (unsigned long)gnss.servo.holdover);
+    LOG_PRINT("\tpps: %lu, steps: %lu, nmea errors: %lu",
+              (unsigned long)gnss.edges, (unsigned long)gnss.steps, (unsigned long)gnss.nmea.errors);
+}
@@ -0,0 +1,115 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include "gnss_servo.h"
+
+#define GNSS_SERVO_KP               0.7f
+#define GNSS_SERVO_KI               0.3f
+#define GNSS_SERVO_STEP_THRESHOLD   100000      /* 100 us */
+#define GNSS_SERVO_LOCK_THRESHOLD   500
+#define GNSS_SERVO_LOCK_SAMPLES     16
+#define GNSS_SERVO_MISSED_MAX       3
+#define GNSS_SERVO_HOLDOVER_TIMEOUT (24 * 3600)
+#define GNSS_SERVO_FREQ_MAX         500000      /* ADJ_FREQ_MAX */
+
+static float clamp(float v, int32_t max)
+{
+    if (v > max) return max;
+    if (v < -max) return -max;
+    return v;
+}
+
+void gnss_servo_init(gnss_servo_t *servo)
+{
+    servo->kp = GNSS_SERVO_KP;
+    servo->ki = GNSS_SERVO_KI;
+    servo->step_threshold = GNSS_SERVO_STEP_THRESHOLD;
+    servo->lock_threshold = GNSS_SERVO_LOCK_THRESHOLD;
+    servo->lock_samples = GNSS_SERVO_LOCK_SAMPLES;
+    servo->missed_max = GNSS_SERVO_MISSED_MAX;
+    servo->holdover_timeout = GNSS_SERVO_HOLDOVER_TIMEOUT;
+    servo->freq_max = GNSS_SERVO_FREQ_MAX;
+
+    servo->state = GNSS_SERVO_UNLOCKED;
+    servo->integral = 0;
+    servo->freq = 0;
+    servo->offset = 0;
+    servo->good = 0;
+    servo->missed = 0;
+    servo->holdover = 0;
+}
+
+int gnss_servo_sample(gnss_servo_t *servo, int32_t offset)
+{
+    servo->offset = offset;
+    servo->missed = 0;
+    servo->holdover = 0;
+
+    if (abs(offset) > servo->step_threshold) {
+        /* Keep the frequency estimate, only phase is off */
+        servo->state = GNSS_SERVO_LOCKING;
+        servo->good = 0;
+        servo->freq = (int32_t)clamp(-servo->integral, servo->freq_max);
+        return GNSS_SERVO_STEP;
+    }
+
+    servo->integral = clamp(servo->integral + servo->ki * offset, servo->freq_max);
+    servo->freq = (int32_t)clamp(-(servo->kp * offset + servo->integral), servo->freq_max);
+
+    if (abs(offset) <= servo->lock_threshold) {
+        if (servo->good < servo->lock_samples) {
+            servo->good++;
+        }
+    } else {
+        servo->good = 0;
+    }
+
+    if (servo->good >= servo->lock_samples) {
+        servo->state = GNSS_SERVO_LOCKED;
+    } else if (servo->good == 0) {
+        servo->state = GNSS_SERVO_LOCKING;
+    }
+
+    return GNSS_SERVO_ADJUST;
+}
+
+void gnss_servo_tick(gnss_servo_t *servo)
+{
+    switch (servo->state) {
+        case GNSS_SERVO_LOCKED:
+            if (++servo->missed >= servo->missed_max) {
+                /* Free run on the learned frequency */
+                servo->state = GNSS_SERVO_HOLDOVER;
+                servo->freq = (int32_t)clamp(-servo->integral, servo->freq_max);
+                servo->holdover = servo->missed;
+                servo->good = 0;
+            }
+            break;
+
+        case GNSS_SERVO_HOLDOVER:
+            if (++servo->holdover >= servo->holdover_timeout) {
+                servo->state = GNSS_SERVO_UNLOCKED;
+            }
+            break;
+
+        case GNSS_SERVO_LOCKING:
+            if (++servo->missed >= servo->missed_max) {
+                servo->state = GNSS_SERVO_UNLOCKED;
+                servo->good = 0;
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+const char *gnss_servo_state_name(uint8_t state)
+{
+    switch (state) {
+        case GNSS_SERVO_UNLOCKED:   return "unlocked";
+        case GNSS_SERVO_LOCKING:    return "locking";
+        case GNSS_SERVO_LOCKED:     return "locked";
+        case GNSS_SERVO_HOLDOVER:   return "holdover";
+        default:                    return "?";
+    }
+}
@@ -0,0 +1,382 @@
+#include <stdint.h>
+#include <string.h>
+#include "app.h"
+#include "cmsis_os.h"
+#include "ptpd.h"
+#include "history.h"
+
+/* Largest encoded update: time, offset, delay, drift and state */
+#define HISTORY_UPDATE_MAX  (10 + 5 + 5 + 5 + 1)
+
+typedef struct _hist {
+    uint16_t cur;               /* block being written */
+    uint32_t seq;               /* of the block being written */
+    uint8_t open;
+    ServoSample last;
+    int64_t interval;           /* ns between the last two updates */
+    volatile uint8_t clear_pending;
+    uint32_t updates;
+    uint64_t bytes;
+} hist_t;
+
+static hist_t hist;
+
+static history_block_t *history_block(uint16_t index)
+{
+    return (history_block_t *)(HISTORY_ADDR + (uint32_t)index * HISTORY_BLOCK);
+}
+
+static uint64_t zigzag(int64_t v)
+{
+    return ((uint64_t)v << 1) ^ (uint64_t)(v >> 63);
+}
+
+static int64_t unzigzag(uint64_t v)
+{
+    return (int64_t)(v >> 1) ^ -(int64_t)(v & 1);
+}
+
+static uint8_t *put_varint(uint8_t *p, uint64_t v)
+{
+    while (v >= 0x80) {
+        *p++ = (uint8_t)v | 0x80;
+        v >>= 7;
+    }
+    *p++ = (uint8_t)v;
+
+    return p;
+}
+
+// NULL if the varint runs past the end
+static const uint8_t *get_varint(const uint8_t *p, const uint8_t *end, uint64_t *v)
+{
+    uint8_t shift = 0;
+
+    *v = 0;
+    while (p < end && shift < 64) {
+        *v |= (uint64_t)(*p & 0x7F) << shift;
+        if (!(*p++ & 0x80)) {
+            return p;
+        }
+        shift += 7;
+    }
+
+    return NULL;
+}
+
+static int64_t history_interval(const ServoSample *from, const ServoSample *to)
+{
+    return (int64_t)(int32_t)(to->seconds - from->seconds) * 1000000000LL +
+           ((int64_t)to->nanoseconds - from->nanoseconds);
+}
+
+static void history_reset(void)
+{
+    uint16_t i;
+
+    for (i = 0; i < HISTORY_BLOCKS; i++) {
+        history_block(i)->seq = 0;
+    }
+
+    hist.cur = HISTORY_BLOCKS - 1;
+    hist.seq = 0;
+    hist.open = 0;
+    hist.updates = 0;
+    hist.bytes = 0;
+}
+
+static void history_open_block(const ServoSample *sample)
+{
+    history_block_t *blk;
+
+    hist.cur = (hist.cur + 1) % HISTORY_BLOCKS;
+    blk = history_block(hist.cur);
+
+    /* Readers drop a block reopened while they copy it */
+    __atomic_store_n(&blk->seq, 0, __ATOMIC_RELEASE);
+
+    blk->fill = 1 << 16;
+    blk->first_sec = sample->seconds;
+    blk->first_nsec = sample->nanoseconds;
+    blk->offset = sample->offsetFromMaster;
+    blk->delay = sample->meanPathDelay;
+    blk->drift = sample->observedDrift;
+    blk->state = sample->portState;
+    blk->last_sec = sample->seconds;
+
+    __atomic_store_n(&blk->seq, ++hist.seq, __ATOMIC_RELEASE);
+
+    hist.open = 1;
+    hist.interval = 0;
+    hist.bytes += sizeof(history_block_t);
+}
+
+// PTP thread
+static void history_update(const ServoSample *sample)
+{
+    history_block_t *blk = history_block(hist.cur);
+    uint8_t *data, *p;
+    uint32_t fill;
+    int64_t interval;
+    uint8_t changed;
+
+    if (hist.clear_pending) {
+        history_reset();
+        hist.clear_pending = 0;
+    }
+
+    hist.updates++;
+
+    fill = blk->fill;
+    if (!hist.open || (fill & 0xFFFF) + HISTORY_UPDATE_MAX > HISTORY_DATA) {
+        history_open_block(sample);
+        hist.last = *sample;
+        return;
+    }
+
+    interval = history_interval(&hist.last, sample);
+    changed = sample->portState != hist.last.portState;
+
+    data = (uint8_t *)(blk + 1);
+    p = data + (fill & 0xFFFF);
+    p = put_varint(p, zigzag(interval - hist.interval) << 1 | changed);
+    p = put_varint(p, zigzag((int64_t)sample->offsetFromMaster - hist.last.offsetFromMaster));
+    p = put_varint(p, zigzag((int64_t)sample->meanPathDelay - hist.last.meanPathDelay));
+    p = put_varint(p, zigzag((int64_t)sample->observedDrift - hist.last.observedDrift));
+    if (changed) {
+        *p++ = sample->portState;
+    }
+
+    hist.bytes += p - data - (fill & 0xFFFF);
+    blk->last_sec = sample->seconds;
+
+    /* Count and length at once, readers never see one without the other */
+    __atomic_store_n(&blk->fill, (((fill >> 16) + 1) << 16) | (uint32_t)(p - data), __ATOMIC_RELEASE);
+
+    hist.interval = interval;
+    hist.last = *sample;
+}
+
+/* ---------- queries ---------- */
+
+void history_query_open(history_query_t *q, uint32_t from, uint32_t to)
+{
+    taskENTER_CRITICAL();
+    q->index = (hist.cur + 1) % HISTORY_BLOCKS;
+    q->newest = hist.seq;
+    taskEXIT_CRITICAL();
+
+    q->from = from;
+    q->to = to;
+    q->visited = 0;
+    q->remaining = 0;
+    q->pending = 0;
+    q->held = 0;
+}
+
+// Copy the next block overlapping the range, 0 when none is left
+static uint8_t history_load(history_query_t *q)
+{
+    const history_block_t *blk;
+    uint32_t seq, fill;
+
+    while (q->visited < HISTORY_BLOCKS) {
+        blk = history_block(q->index);
+        q->index = (q->index + 1) % HISTORY_BLOCKS;
+        q->visited++;
+
+        /* Unused, being opened, or reused since the query started */
+        seq = __atomic_load_n(&blk->seq, __ATOMIC_ACQUIRE);
+        if (seq == 0 || seq > q->newest) {
+            continue;
+        }
+
+        if (blk->last_sec < q->from || blk->first_sec > q->to) {
+            continue;
+        }
+
+        fill = __atomic_load_n(&blk->fill, __ATOMIC_ACQUIRE);
+        memcpy(&q->copy.header, blk, sizeof(history_block_t));
+        memcpy(q->copy.raw + sizeof(history_block_t), blk + 1, fill & 0xFFFF);
+
+        if (__atomic_load_n(&blk->seq, __ATOMIC_ACQUIRE) != seq) {
+            continue;
+        }
+
+        q->copy.header.seq = seq;
+        q->copy.header.fill = fill;
+
+        q->last.seconds = q->copy.header.first_sec;
+        q->last.nanoseconds = q->copy.header.first_nsec;
+        q->last.offsetFromMaster = q->copy.header.offset;
+        q->last.meanPathDelay = q->copy.header.delay;
+        q->last.observedDrift = q->copy.header.drift;
+        q->last.portState = q->copy.header.state;
+        q->interval = 0;
+        q->pos = q->copy.raw + sizeof(history_block_t);
+        q->remaining = (fill >> 16) - 1;
+        q->pending = 1;
+
+        return 1;
+    }
+
+    return 0;
+}
+
+// Decode the update following q->last, 0 on a damaged block
+static uint8_t history_decode(history_query_t *q)
+{
+    const uint8_t *end = q->copy.raw + sizeof(history_block_t) + (q->copy.header.fill & 0xFFFF);
+    const uint8_t *p = q->pos;
+    uint64_t head, offset, delay, drift;
+    int64_t ns;
+
+    if ((p = get_varint(p, end, &head)) == NULL ||
+        (p = get_varint(p, end, &offset)) == NULL ||
+        (p = get_varint(p, end, &delay)) == NULL ||
+        (p = get_varint(p, end, &drift)) == NULL ||
+        ((head & 1) && p >= end)) {
+        return 0;
+    }
+
+    q->interval += unzigzag(head >> 1);
+    ns = q->last.nanoseconds + q->interval;
+    q->last.seconds += (int32_t)(ns / 1000000000LL) - (ns % 1000000000LL < 0);
+    q->last.nanoseconds = (uint32_t)((ns % 1000000000LL + 1000000000LL) % 1000000000LL);
+    q->last.offsetFromMaster += (int32_t)unzigzag(offset);
+    q->last.meanPathDelay += (int32_t)unzigzag(delay);
+    q->last.observedDrift += (int32_t)unzigzag(drift);
+    if (head & 1) {
+        q->last.portState = *p++;
+    }
+
+    q->pos = p;
+
+    return 1;
+}
+
+uint8_t history_query_next(history_query_t *q, ServoSample *sample)
+{
+    for (;;) {
+        if (q->pending) {
+            q->pending = 0;
+        } else if (q->remaining > 0) {
+            q->remaining--;
+            if (!history_decode(q)) {
+                q->remaining = 0;
+                continue;
+            }
+        } else if (!history_load(q)) {
+            return 0;
+        } else {
+            continue;
+        }
+
+        if (q->last.seconds >= q->from && q->last.seconds <= q->to) {
+            *sample = q->last;
+            return 1;
+        }
+    }
+}
+
+uint8_t history_query_bucket(history_query_t *q, uint32_t step, history_bucket_t *bucket)
+{
+    ServoSample s;
+    int64_t offset_sum = 0, delay_sum = 0;
+
+    if (q->held) {
+        s = q->next;
+        q->held = 0;
+    } else if (!history_query_next(q, &s)) {
+        return 0;
+    }
+
+    if (step == 0) {
+        step = 1;
+    }
+
+    bucket->sec = s.seconds - s.seconds % step;
+    bucket->count = 0;
+    bucket->offset_min = INT32_MAX;
+    bucket->offset_max = INT32_MIN;
+
+    do {
+        /* Out of the bucket, kept for the next one */
+        if (s.seconds < bucket->sec || s.seconds - bucket->sec >= step) {
+            q->next = s;
+            q->held = 1;
+            break;
+        }
+
+        bucket->count++;
+        offset_sum += s.offsetFromMaster;
+        delay_sum += s.meanPathDelay;
+        if (s.offsetFromMaster < bucket->offset_min) bucket->offset_min = s.offsetFromMaster;
+        if (s.offsetFromMaster > bucket->offset_max) bucket->offset_max = s.offsetFromMaster;
+        bucket->drift = s.observedDrift;
+        bucket->state = s.portState;
+    } while (history_query_next(q, &s));
+
+    bucket->offset_mean = (int32_t)(offset_sum / bucket->count);
+    bucket->delay_mean = (int32_t)(delay_sum / bucket->count);
+
+    return 1;
+}
+
+const uint8_t *history_query_block(history_query_t *q)
+{
+    if (!history_load(q)) {
+        return NULL;
+    }
+
+    q->remaining = 0;
+    q->pending = 0;
+
+    return q->copy.raw;
+}
+
+/* ---------- control ---------- */
+
+void history_init(void)
+{
+    /* SDRAM holds garbage after power up */
+    history_reset();
+
+    if (!ptpd_add_sample_callback(history_update)) {
+        LOG_ERR("History: no servo update slot");
+    }
+}
+
+void history_clear(void)
+{
+    hist.clear_pending = 1;
+}
+
+void history_stats(void)
+{
+    history_block_t oldest, newest;
+    uint32_t blocks, updates;
+    uint64_t bytes;
+    uint16_t cur;
+
+    taskENTER_CRITICAL();
+    cur = hist.cur;
+    blocks = hist.seq < HISTORY_BLOCKS ? hist.seq : HISTORY_BLOCKS;
+    updates = hist.updates;
+    bytes = hist.bytes;
+    newest = *history_block(cur);
+    oldest = *history_block(blocks < HISTORY_BLOCKS ? 0 : (cur + 1) % HISTORY_BLOCKS);
+    taskEXIT_CRITICAL();
+
+    LOG_PRINT("\tblocks: %lu of %lu, updates: %lu", (unsigned long)blocks, HISTORY_BLOCKS, (unsigned long)updates);
+
+    if (blocks == 0) {
+        return;
+    }
+
+    /* Raw update is 21 bytes, seconds to state */
+    LOG_PRINT("\tbytes per update: %lu.%02lu, since last clear",
+              (unsigned long)(bytes / updates), (unsigned long)(bytes * 100 / updates % 100));
+    LOG_PRINT("\tspan: %lu to %lu, %lu s", (unsigned long)oldest.first_sec, (unsigned long)newest.last_sec,
+              (unsigned long)(newest.last_sec - oldest.first_sec));
+}
@@ -0,0 +1,163 @@
+#include <stdint.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "app.h"
+#include "cmsis_os.h"
+#include "ptpd.h"
+#include "metrics.h"
+#include "http_api.h"
+
+#define JSON_BOOL(b)    ((b) ? "true" : "false")
+
+typedef struct _httpa {
+    ServoSample samples[HTTP_API_SAMPLES];
+    uint32_t head;              /* written by the PTP thread only */
+    PtpDataSets ds;
+    metrics_snapshot_t snap;
+} httpa_t;
+
+static httpa_t httpa;
+
+// PTP thread
+static void http_api_update(const ServoSample *sample)
+{
+    uint32_t head = httpa.head;
+
+    httpa.samples[head & (HTTP_API_SAMPLES - 1)] = *sample;
+    __atomic_store_n(&httpa.head, head + 1, __ATOMIC_RELEASE);
+}
+
+void http_api_init(void)
+{
+    if (!ptpd_add_sample_callback(http_api_update)) {
+        LOG_ERR("HTTP: no servo update slot");
+    }
+}
+
+uint32_t http_api_head(void)
+{
+    return __atomic_load_n(&httpa.head, __ATOMIC_ACQUIRE);
+}
+
+uint8_t http_api_sample(uint32_t seq, ServoSample *sample)
+{
+    uint32_t head = http_api_head();
+
+    if (head - seq - 1 >= HTTP_API_SAMPLES) {
+        return 0;
+    }
+
+    *sample = httpa.samples[seq & (HTTP_API_SAMPLES - 1)];
+
+    /* The writer may have lapped the copy */
+    return http_api_head() - seq <= HTTP_API_SAMPLES;
+}
+
+// Append to buf, the length stays at size - 1 once full
+static int json_add(char *buf, int n, int size, const char *fmt, ...)
+{
+    va_list ap;
+    int m;
+
+    if (n >= size - 1) {
+        return n;
+    }
+
+    va_start(ap, fmt);
+    m = vsnprintf(buf + n, size - n, fmt, ap);
+    va_end(ap);
+
+    return (m < 0 || m >= size - n) ? size - 1 : n + m;
+}
+
+static int json_time(char *buf, int n, int size, const char *name, const TimeInternal *t)
+{
+    uint8_t neg = t->seconds < 0 || t->nanoseconds < 0;
+
+    return json_add(buf, n, size, "\"%s\":%s%ld.%09ld", name, neg ? "-" : "",
+                    labs((long)t->seconds), labs((long)t->nanoseconds));
+}
+
+static int json_identity(char *buf, int n, int size, const char *name, const ClockIdentity id)
+{
+    return json_add(buf, n, size, "\"%s\":\"%02x%02x%02x%02x%02x%02x%02x%02x\"", name,
+                    id[0], id[1], id[2], id[3], id[4], id[5], id[6], id[7]);
+}
+
+int http_api_status(char *buf, int size)
+{
+    const DefaultDS *dds = &httpa.ds.defaultDS;
+    const CurrentDS *cds = &httpa.ds.currentDS;
+    const ParentDS *pds = &httpa.ds.parentDS;
+    const TimePropertiesDS *tds = &httpa.ds.timePropertiesDS;
+    const PortDS *ports = &httpa.ds.portDS;
+    uint16_t i;
+    int n;
+
+    ptpd_get_datasets(&httpa.ds);
+    metrics_snapshot(&httpa.snap);
+
+    n = json_add(buf, 0, size, "{\"time\":%lu,\"default\":{", (unsigned long)httpa.snap.time);
+    n = json_identity(buf, n, size, "clockIdentity", dds->clockIdentity);
+    n = json_add(buf, n, size,
+                 ",\"numberPorts\":%d,\"clockClass\":%u,\"clockAccuracy\":%u,\"offsetScaledLogVariance\":%d,"
+                 "\"priority1\":%u,\"priority2\":%u,\"domainNumber\":%u,\"slaveOnly\":%s,\"twoStep\":%s},",
+                 dds->numberPorts, dds->clockQuality.clockClass, dds->clockQuality.clockAccuracy,
+                 dds->clockQuality.offsetScaledLogVariance, dds->priority1, dds->priority2,
+                 dds->domainNumber, JSON_BOOL(dds->slaveOnly), JSON_BOOL(dds->twoStepFlag));
+
+    n = json_add(buf, n, size, "\"current\":{\"stepsRemoved\":%d,", cds->stepsRemoved);
+    n = json_time(buf, n, size, "offsetFromMaster", &cds->offsetFromMaster);
+    n = json_add(buf, n, size, ",");
+    n = json_time(buf, n, size, "meanPathDelay", &cds->meanPathDelay);
+
+    n = json_add(buf, n, size, "},\"parent\":{");
+    n = json_identity(buf, n, size, "parentIdentity", pds->parentPortIdentity.clockIdentity);
+    n = json_add(buf, n, size, ",\"parentPort\":%d,", pds->parentPortIdentity.portNumber);
+    n = json_identity(buf, n, size, "grandmasterIdentity", pds->grandmasterIdentity);
+    n = json_add(buf, n, size,
+                 ",\"grandmasterClockClass\":%u,\"grandmasterClockAccuracy\":%u,"
+                 "\"grandmasterOffsetScaledLogVariance\":%d,\"grandmasterPriority1\":%u,\"grandmasterPriority2\":%u},",
+                 pds->grandmasterClockQuality.clockClass, pds->grandmasterClockQuality.clockAccuracy,
+                 pds->grandmasterClockQuality.offsetScaledLogVariance,
+                 pds->grandmasterPriority1, pds->grandmasterPriority2);
+
+    n = json_add(buf, n, size,
+                 "\"timeProperties\":{\"currentUtcOffset\":%d,\"currentUtcOffsetValid\":%s,\"leap59\":%s,"
+                 "\"leap61\":%s,\"timeTraceable\":%s,\"frequencyTraceable\":%s,\"ptpTimescale\":%s,\"timeSource\":%u},",
+                 tds->currentUtcOffset, JSON_BOOL(tds->currentUtcOffsetValid), JSON_BOOL(tds->leap59),
+                 JSON_BOOL(tds->leap61), JSON_BOOL(tds->timeTraceable), JSON_BOOL(tds->frequencyTraceable),
+                 JSON_BOOL(tds->ptpTimescale), tds->timeSource);
+
+    n = json_add(buf, n, size,
+                 "\"port\":{\"portNumber\":%d,\"portState\":%u,\"logMinDelayReqInterval\":%d,"
+                 "\"logAnnounceInterval\":%d,\"announceReceiptTimeout\":%u,\"logSyncInterval\":%d,"
+                 "\"delayMechanism\":%u,\"versionNumber\":%u},",
+                 ports->portIdentity.portNumber, ports->portState, ports->logMinDelayReqInterval,
+                 ports->logAnnounceInterval, ports->announceReceiptTimeout, ports->logSyncInterval,
+                 ports->delayMechanism, ports->versionNumber);
+
+    n = json_add(buf, n, size, "\"metrics\":{");
+    for (i = 0; i < METRIC_COUNT; i++) {
+        if (metrics_type(i) == METRIC_GAUGE) {
+            n = json_add(buf, n, size, "%s\"%s\":%ld", i ? "," : "", metrics_name(i),
+                         (long)(int32_t)httpa.snap.value[i]);
+        } else {
+            n = json_add(buf, n, size, "%s\"%s\":%lu", i ? "," : "", metrics_name(i),
+                         (unsigned long)httpa.snap.value[i]);
+        }
+    }
+
+    return json_add(buf, n, size, "}}\n");
+}
+
+int http_api_event(uint32_t seq, const ServoSample *sample, char *buf, int size)
+{
+    return json_add(buf, 0, size,
+                    "id: %lu\nevent: sample\ndata: {\"t\":%lu.%09lu,\"offset\":%ld,\"delay\":%ld,"
+                    "\"drift\":%ld,\"state\":%u}\n\n",
+                    (unsigned long)seq, (unsigned long)sample->seconds, (unsigned long)sample->nanoseconds,
+                    (long)sample->offsetFromMaster, (long)sample->meanPathDelay,
+                    (long)sample->observedDrift, sample->portState);
+}
@@ -47,21 +47,84 @@
 #include "lwip/api.h"
 #include "lwip/inet.h"
 #include "lwip/sockets.h"
+#include "lwip/sys.h"
+#include "lwip/priv/sockets_priv.h"
 #include "lwip/apps/fs.h"
 #include "string.h"
 #include "httpserver-socket.h"
 #include "cmsis_os.h"
+#include "ptpd.h"
+#include "metrics.h"
+#include "http_api.h"
+#ifdef ENABLE_CAPTURE
+#include "capture.h"
+#endif
+#ifdef ENABLE_HISTORY
+#include "history.h"
+#endif
 
+#include <stddef.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <strings.h>
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
 #define WEBSERVER_THREAD_PRIO    ( osPriorityAboveNormal )
+#define HTTP_MAX_CLIENTS         4      /* connections served at once, see MEMP_NUM_NETCONN */
+#define HTTP_CLIENT_BUFFER       1024   /* request kept, then the response being sent */
+#define HTTP_LINE_MAX            160    /* longest line of the text pages */
+#define HTTP_TASKS_MAX           24     /* tasks listed by the dynamic page */
+#define HTTP_POLL_MS             20     /* longest delay of a servo update event */
+#define HTTP_REQUEST_TIMEOUT     5000   /* ms from accept to a complete request */
+#define HTTP_SEND_TIMEOUT        2000   /* ms a response may make no progress */
+
+typedef struct HttpClient HttpClient;
+
+/* Next part of a response into buf or data: 1 if some was added, 0 once the
+   response is complete, -1 to be called again later */
+typedef int (*HttpFill)(HttpClient *c);
+
+struct HttpClient
+{
+  int fd;                               /* -1 when free */
+  uint8_t sending;                      /* request read, response being sent */
+  uint8_t nocopy;                       /* data stays valid until acknowledged */
+  uint16_t len;                         /* bytes in buf */
+  uint16_t pos;                         /* bytes of buf already sent */
+  uint32_t deadline;                    /* ms, request complete or response progressing by then */
+  HttpFill fill;                        /* NULL while reading the request */
+  uint32_t next;                        /* next line, record or servo update to send */
+  const uint8_t *data;                  /* sent after buf from its own storage */
+  uint32_t remain;                      /* bytes of data not sent */
+  uint32_t from;                        /* history query of the request */
+  uint32_t to;
+  uint32_t step;
+  char buf[HTTP_CLIENT_BUFFER];
+};
 
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 u32_t nPageHits = 0;
-portCHAR PAGE_BODY[512];
+static HttpClient clients[HTTP_MAX_CLIENTS];
+static TaskStatus_t tasks[HTTP_TASKS_MAX];
+
+/* Responses of a shared state are sent to one client at a time, the others
+   wait for it */
+static HttpClient *statusClient;
+static char json[HTTP_API_STATUS_SIZE];
+static HttpClient *metricsClient;
+static metrics_snapshot_t snap;
+#ifdef ENABLE_CAPTURE
+static HttpClient *captureClient;
+static capture_export_t *captureExport;
+#endif
+#ifdef ENABLE_HISTORY
+static HttpClient *historyClient;
+static history_query_t query;
+#endif
+
+static const char TEXT_HEADER[] = "HTTP/1.0 200 OK\r\nContent-Type: text/plain\r\n\r\n";
 
 /* Format of dynamic web page: the page header */
 static const unsigned char PAGE_START[] = {
@@ -167,84 +230,542 @@ static const unsigned char PAGE_START[] = {
 0x61,0x67,0x65,0x20,0x68,0x69,0x74,0x73,0x3a,0x0d,0x0a,0x00};
 
 /* Private function prototypes -----------------------------------------------*/
+static int DynWebPage(HttpClient *c);
+static int AuditPage(HttpClient *c);
+static int SlavesPage(HttpClient *c);
+static int MetricsPage(HttpClient *c);
+static int StatusPage(HttpClient *c);
+static int EventsPage(HttpClient *c);
+#ifdef ENABLE_CAPTURE
+static int CapturePage(HttpClient *c);
+#endif
+#ifdef ENABLE_HISTORY
+static int HistoryPage(HttpClient *c);
+static int HistoryBinPage(HttpClient *c);
+#endif
+
 /* Private functions ---------------------------------------------------------*/
 
 /**
-  * @brief serve tcp connection  
-  * @param conn: connection socket 
-  * @retval None
+  * @brief  find a string in a buffer that need not be terminated
+  * @param  buf buffer
+  * @param  len buffer length
+  * @param  token string to find
+  * @param  n token length
+  * @retval first match, NULL if none
   */
-void http_server_serve(int conn) 
+static const char *HttpFind(const char *buf, int len, const char *token, int n)
+{
+  int i;
+
+  for (i = 0; i + n <= len; i++)
+  {
+    if (memcmp(buf + i, token, n) == 0)
+      return buf + i;
+  }
+
+  return NULL;
+}
+
+/**
+  * @brief  find a request header
+  * @param  request terminated request
+  * @param  name header name with its colon
+  * @param  len value length
+  * @retval value, NULL if missing
+  */
+static const char *HttpHeader(const char *request, const char *name, int *len)
+{
+  const char *line = strstr(request, "\r\n");
+  const char *end;
+  size_t n = strlen(name);
+
+  while (line != NULL && line[2] != '\r' && line[2] != '\0')
+  {
+    line += 2;
+    if (strncasecmp(line, name, n) == 0)
+    {
+      line += n;
+      while (*line == ' ')
+        line++;
+      end = strstr(line, "\r\n");
+      *len = end != NULL ? end - line : (int)strlen(line);
+      return line;
+    }
+    line = strstr(line, "\r\n");
+  }
+
+  return NULL;
+}
+
+/**
+  * @brief  send constant data without copying it, it stays in flash until
+  *         acknowledged.
+  *         The socket API always copies into the send buffer, only a netconn
+  *         write can reference the data. The netconn of the socket is taken
+  *         from lwip_socket_dbg_get_socket(), declared in the private
+  *         sockets header but part of the lwIP 2.1 API; the server keeps
+  *         sockets for select() over every client.
+  * @param  conn connection socket
+  * @param  data persistent data
+  * @param  len data length
+  * @retval bytes queued, 0 if the connection takes none now, -1 if it failed
+  */
+static int HttpWriteStatic(int conn, const void *data, size_t len)
+{
+  struct lwip_sock *sock = lwip_socket_dbg_get_socket(conn);
+  size_t written = 0;
+  err_t err;
+
+  if (sock == NULL || sock->conn == NULL)
+    return -1;
+
+  err = netconn_write_partly(sock->conn, data, len, NETCONN_NOCOPY | NETCONN_DONTBLOCK, &written);
+  if (err == ERR_WOULDBLOCK)
+    return 0;
+  if (err != ERR_OK)
+    return -1;
+
+  return written;
+}
+
+/**
+  * @brief  send without blocking
+  * @param  c client
+  * @param  data bytes to send
+  * @param  len byte count
+  * @param  nocopy data stays valid until acknowledged
+  * @retval bytes queued, 0 if the connection takes none now, -1 if it failed
+  */
+static int HttpWrite(HttpClient *c, const void *data, size_t len, uint8_t nocopy)
 {
-  int buflen = 1500;
   int ret;
+
+  if (nocopy)
+    return HttpWriteStatic(c->fd, data, len);
+
+  ret = write(c->fd, data, len);
+  if (ret < 0)
+    return errno == EWOULDBLOCK || errno == EAGAIN ? 0 : -1;
+
+  return ret;
+}
+
+/**
+  * @brief  put a complete response in the client buffer
+  * @param  c client
+  * @param  text terminated response
+  * @retval None
+  */
+static void HttpReply(HttpClient *c, const char *text)
+{
+  strncpy(c->buf, text, sizeof(c->buf));
+  c->len = strlen(text) < sizeof(c->buf) ? strlen(text) : sizeof(c->buf);
+  c->pos = 0;
+}
+
+/**
+  * @brief  release a client slot and the shared state it was sending
+  * @param  c client
+  * @retval None
+  */
+static void HttpClose(HttpClient *c)
+{
+  close(c->fd);
+  c->fd = -1;
+  c->fill = NULL;
+
+  if (statusClient == c)
+    statusClient = NULL;
+  if (metricsClient == c)
+    metricsClient = NULL;
+#ifdef ENABLE_CAPTURE
+  if (captureClient == c)
+  {
+    capture_export_close(captureExport);
+    captureClient = NULL;
+  }
+#endif
+#ifdef ENABLE_HISTORY
+  if (historyClient == c)
+    historyClient = NULL;
+#endif
+}
+
+/**
+  * @brief  take a shared state for a client
+  * @param  owner client sending the shared state
+  * @param  c client
+  * @retval 1 if the client owns it, 0 if another one does
+  */
+static uint8_t HttpTake(HttpClient **owner, HttpClient *c)
+{
+  if (*owner != NULL && *owner != c)
+    return 0;
+
+  *owner = c;
+  return 1;
+}
+
+/**
+  * @brief  start sending a file of the flash file system, its header
+  *         included. The gzip variant is taken when the client accepts it,
+  *         a matching ETag is answered with 304.
+  * @param  c client, the request in its buffer
+  * @param  name file name
+  * @retval None
+  */
+static void HttpSendFile(HttpClient *c, const char *name)
+{
   struct fs_file file;
-  unsigned char recv_buffer[1500];
-				
-  /* Read in the request */
-  ret = read(conn, recv_buffer, buflen); 
-  if(ret < 0) return;
+  char gzname[64];
+  char reply[96];
+  const char *value, *etag, *end;
+  int len, hdrlen;
+
+  value = HttpHeader(c->buf, "Accept-Encoding:", &len);
+  snprintf(gzname, sizeof(gzname), "%s.gz", name);
+
+  if (value == NULL || HttpFind(value, len, "gzip", 4) == NULL || fs_open(&file, gzname) != ERR_OK)
+  {
+    if (fs_open(&file, name) != ERR_OK && fs_open(&file, "/404.html") != ERR_OK)
+      return;
+  }
+
+  /* ETag of the stored header, up to the end of its line */
+  end = HttpFind(file.data, file.len, "\r\n\r\n", 4);
+  hdrlen = end != NULL ? end - file.data : 0;
+  etag = HttpFind(file.data, hdrlen, "\r\nETag: ", 8);
+  if (etag != NULL)
+  {
+    etag += 8;
+    end = HttpFind(etag, file.data + hdrlen - etag + 2, "\r\n", 2);
+    value = HttpHeader(c->buf, "If-None-Match:", &len);
+
+    if (value != NULL && HttpFind(value, len, etag, end - etag) != NULL)
+    {
+      snprintf(reply, sizeof(reply), "HTTP/1.0 304 Not Modified\r\nETag: %.*s\r\n\r\n",
+               (int)(end - etag), etag);
+      HttpReply(c, reply);
+      fs_close(&file);
+      return;
+    }
+  }
+
+  /* Files are in flash, sent from there */
+  c->data = (const uint8_t *)file.data;
+  c->remain = file.len;
+  c->nocopy = 1;
+  fs_close(&file);
+}
+
+#ifdef ENABLE_HISTORY
+/**
+  * @brief  Get an unsigned query parameter of the request line.
+  * @param  request terminated request
+  * @param  name parameter name
+  * @param  def value if missing
+  * @retval parameter value
+  */
+static uint32_t HttpQueryParam(const char *request, const char *name, uint32_t def)
+{
+  const char *end = strchr(request + 4, ' ');
+  const char *p = strchr(request, '?');
+  size_t len = strlen(name);
+
+  while (p != NULL && (end == NULL || p < end))
+  {
+    p++;
+    if (strncmp(p, name, len) == 0 && p[len] == '=')
+      return strtoul(p + len + 1, NULL, 10);
+    p = strchr(p, '&');
+  }
+
+  return def;
+}
+#endif
+
+/**
+  * @brief  start the response to a request, it is sent by HttpSend
+  * @param  c client, the terminated request in its buffer
+  * @retval None
+  */
+static void http_server_serve(HttpClient *c)
+{
+  static const char events[] = "HTTP/1.0 200 OK\r\nContent-Type: text/event-stream\r\n"
+    "Cache-Control: no-cache\r\nAccess-Control-Allow-Origin: *\r\n\r\nretry: 1000\n\n";
+  char *recv_buffer = c->buf;
+  HttpFill fill = NULL;
+
+  metrics_inc(METRIC_HTTP_REQUESTS);
+  c->next = 0;
 
   /* Check if request to get ST.gif */
-  if (strncmp((char *)recv_buffer,"GET /STM32F7xx_files/ST.gif",27)==0)
+  if (strncmp(recv_buffer,"GET /STM32F7xx_files/ST.gif",27)==0)
   {
-    fs_open(&file, "/STM32F7xx_files/ST.gif"); 
-    write(conn, (const unsigned char*)(file.data), (size_t)file.len);
-    fs_close(&file);
+    HttpSendFile(c, "/STM32F7xx_files/ST.gif");
   }
   /* Check if request to get stm32.jpeg */
-  else if (strncmp((char *)recv_buffer,"GET /STM32F7xx_files/stm32.jpg",30)==0)
+  else if (strncmp(recv_buffer,"GET /STM32F7xx_files/stm32.jpg",30)==0)
   {
-    fs_open(&file, "/STM32F7xx_files/stm32.jpg"); 
-    write(conn, (const unsigned char*)(file.data), (size_t)file.len);
-    fs_close(&file);
+    HttpSendFile(c, "/STM32F7xx_files/stm32.jpg");
   }
   /* Check if request to get ST logo.jpeg */
-  else if (strncmp((char *)recv_buffer,"GET /STM32F7xx_files/logo.jpg", 29) == 0)
+  else if (strncmp(recv_buffer,"GET /STM32F7xx_files/logo.jpg", 29) == 0)
+  {
+    HttpSendFile(c, "/STM32F7xx_files/logo.jpg");
+  }
+  else if(strncmp(recv_buffer, "GET /audit", 10) == 0)
+  {
+    /* PTP audit table as plain text */
+    fill = AuditPage;
+  }
+  else if(strncmp(recv_buffer, "GET /slaves", 11) == 0)
+  {
+    /* PTP slave table as plain text */
+    fill = SlavesPage;
+  }
+  else if(strncmp(recv_buffer, "GET /api/status", 15) == 0)
+  {
+    /* PTP data sets and metrics as JSON */
+    fill = StatusPage;
+  }
+  else if(strncmp(recv_buffer, "GET /api/events", 15) == 0)
+  {
+    /* Servo updates as server-sent events, until the client leaves. The
+       header is the first event, the stream starts at the next update */
+    HttpReply(c, events);
+    c->next = http_api_head();
+    fill = EventsPage;
+  }
+  else if(strncmp(recv_buffer, "GET /metrics", 12) == 0)
   {
-    fs_open(&file, "/STM32F7xx_files/logo.jpg"); 
-    write(conn, (const unsigned char*)(file.data), (size_t)file.len);
-    fs_close(&file);
+    /* Metrics registry in the Prometheus text format */
+    fill = MetricsPage;
   }
-  else if(strncmp((char *)recv_buffer, "GET /STM32F7xxTASKS.html", 24) == 0)
+#ifdef ENABLE_CAPTURE
+  else if(strncmp(recv_buffer, "GET /capture.pcapng", 19) == 0)
+  {
+    /* Capture ring as pcapng, the capture is stopped */
+    fill = CapturePage;
+  }
+#endif
+#ifdef ENABLE_HISTORY
+  else if(strncmp(recv_buffer, "GET /history.bin", 16) == 0)
+  {
+    /* Servo history blocks as stored, see tools/history_decode.py */
+    c->from = HttpQueryParam(recv_buffer, "from", 0);
+    c->to = HttpQueryParam(recv_buffer, "to", UINT32_MAX);
+    fill = HistoryBinPage;
+  }
+  else if(strncmp(recv_buffer, "GET /history", 12) == 0)
+  {
+    /* Servo history as CSV, ?from=&to= PHC seconds, &step= to downsample */
+    c->from = HttpQueryParam(recv_buffer, "from", 0);
+    c->to = HttpQueryParam(recv_buffer, "to", UINT32_MAX);
+    c->step = HttpQueryParam(recv_buffer, "step", 0);
+    fill = HistoryPage;
+  }
+#endif
+  else if(strncmp(recv_buffer, "GET /STM32F7xxTASKS.html", 24) == 0)
   {
     /* Load dynamic page */
-    DynWebPage(conn);
+    fill = DynWebPage;
   }
-  else if((strncmp((char *)recv_buffer, "GET /STM32F7xx.html", 19) == 0)||(strncmp((char *)recv_buffer, "GET / ", 6) == 0))
+  else if((strncmp(recv_buffer, "GET /STM32F7xx.html", 19) == 0)||(strncmp(recv_buffer, "GET / ", 6) == 0))
   {
     /* Load STM32F7xxpage */
-    fs_open(&file, "/STM32F7xx.html"); 
-    write(conn, (const unsigned char*)(file.data), (size_t)file.len);
-    fs_close(&file);
+    HttpSendFile(c, "/STM32F7xx.html");
   }
   else
   {
     /* Load 404 page */
-    fs_open(&file, "/404.html");
-    write(conn, (const unsigned char*)(file.data), (size_t)file.len);
-    fs_close(&file);
+    HttpSendFile(c, "/404.html");
+  }
+
+  /* Pages are generated from their first part once the buffer is sent */
+  c->fill = fill;
+}
+
+/**
+  * @brief  take a new connection, refused when every slot is busy
+  * @param  sock listening socket
+  * @retval None
+  */
+static void HttpAccept(int sock)
+{
+  static const char busy[] = "HTTP/1.0 503 Service Unavailable\r\n\r\n";
+  struct sockaddr_in remotehost;
+  socklen_t size = sizeof(remotehost);
+  int conn, i;
+
+  conn = accept(sock, (struct sockaddr *)&remotehost, &size);
+  if (conn < 0)
+    return;
+
+  /* Nothing blocks the thread, a client is bounded by its deadline */
+  fcntl(conn, F_SETFL, O_NONBLOCK);
+
+  for (i = 0; i < HTTP_MAX_CLIENTS; i++)
+  {
+    if (clients[i].fd < 0)
+    {
+      memset(&clients[i], 0, offsetof(HttpClient, buf));
+      clients[i].fd = conn;
+      clients[i].deadline = sys_now() + HTTP_REQUEST_TIMEOUT;
+      return;
+    }
   }
-  /* Close connection socket */
+
+  write(conn, busy, strlen(busy));
   close(conn);
 }
 
 /**
-  * @brief  http server thread 
-  * @param arg: pointer on argument(not used here) 
+  * @brief  close the clients past their deadline: requests not complete in
+  *         time, responses the client stopped taking
+  * @retval None
+  */
+static void HttpExpire(void)
+{
+  uint32_t now = sys_now();
+  int i;
+
+  for (i = 0; i < HTTP_MAX_CLIENTS; i++)
+  {
+    if (clients[i].fd >= 0 && (int32_t)(now - clients[i].deadline) >= 0)
+    {
+      metrics_inc(METRIC_HTTP_TIMEOUTS);
+      HttpClose(&clients[i]);
+    }
+  }
+}
+
+/**
+  * @brief  read more of a request, start the response once complete
+  * @param  c client
+  * @retval None
+  */
+static void HttpRead(HttpClient *c)
+{
+  char discard[16];
+  int ret;
+
+  /* Responses only read to see the client leave */
+  if (c->sending)
+  {
+    ret = read(c->fd, discard, sizeof(discard));
+    if (ret == 0 || (ret < 0 && errno != EWOULDBLOCK && errno != EAGAIN))
+      HttpClose(c);
+    return;
+  }
+
+  ret = read(c->fd, c->buf + c->len, sizeof(c->buf) - 1 - c->len);
+  if (ret == 0 || (ret < 0 && errno != EWOULDBLOCK && errno != EAGAIN))
+  {
+    HttpClose(c);
+    return;
+  }
+  if (ret < 0)
+    return;
+
+  c->len += ret;
+  c->buf[c->len] = '\0';
+
+  /* Only the request line is used, headers past the buffer are dropped */
+  if (strstr(c->buf, "\r\n\r\n") == NULL && c->len < sizeof(c->buf) - 1)
+    return;
+
+  c->len = 0;
+  c->pos = 0;
+  http_server_serve(c);
+
+  c->sending = 1;
+  c->deadline = sys_now() + HTTP_SEND_TIMEOUT;
+}
+
+/**
+  * @brief  send as much of the response as the connection takes without
+  *         blocking, close once it is complete
+  * @param  c client
+  * @retval None
+  */
+static void HttpSend(HttpClient *c)
+{
+  int ret;
+
+  while (1)
+  {
+    if (c->pos < c->len)
+      ret = HttpWrite(c, c->buf + c->pos, c->len - c->pos, 0);
+    else if (c->remain > 0)
+      ret = HttpWrite(c, c->data, c->remain, c->nocopy);
+    else
+    {
+      c->len = 0;
+      c->pos = 0;
+      ret = c->fill != NULL ? c->fill(c) : 0;
+      if (ret > 0)
+        continue;
+
+      if (ret == 0)
+        HttpClose(c);
+      else
+        c->deadline = sys_now() + HTTP_SEND_TIMEOUT;  /* waiting, not stalled */
+      return;
+    }
+
+    if (ret < 0)
+    {
+      HttpClose(c);
+      return;
+    }
+    if (ret == 0)
+      return;
+
+    c->deadline = sys_now() + HTTP_SEND_TIMEOUT;
+    if (c->pos < c->len)
+    {
+      c->pos += ret;
+    }
+    else
+    {
+      c->data += ret;
+      c->remain -= ret;
+    }
+  }
+}
+
+/**
+  * @brief  check if a client has response bytes waiting for the connection
+  * @param  c client
+  * @retval 1 if so
+  */
+static uint8_t HttpPending(const HttpClient *c)
+{
+  return c->sending && (c->pos < c->len || c->remain > 0);
+}
+
+/**
+  * @brief  http server thread, every client is served from here without
+  *         blocking the others while it sends its request or reads a
+  *         response
+  * @param arg: pointer on argument(not used here)
   * @retval None
   */
 static void http_server_socket_thread(void *arg)
 {
-  int sock, newconn, size;
-  struct sockaddr_in address, remotehost;
+  int sock, maxfd, ready, i;
+  struct sockaddr_in address;
+  struct timeval poll;
+  fd_set readset, writeset;
 
  /* create a TCP socket */
-  if ((sock = socket(AF_INET, SOCK_STREAM, 0)) < 0) 
+  if ((sock = socket(AF_INET, SOCK_STREAM, 0)) < 0)
   {
     return;
   }
-  
+
   /* bind to port 80 at any interface */
   address.sin_family = AF_INET;
   address.sin_port = htons(80);
@@ -254,56 +775,413 @@ static void http_server_socket_thread(void *arg)
   {
     return;
   }
-  
+
   /* listen for incoming connections (TCP listen backlog = 5) */
   listen(sock, 5);
-  
-  size = sizeof(remotehost);
-  
-  while (1) 
+
+  for (i = 0; i < HTTP_MAX_CLIENTS; i++)
+    clients[i].fd = -1;
+
+  while (1)
   {
-    newconn = accept(sock, (struct sockaddr *)&remotehost, (socklen_t *)&size);
-    http_server_serve(newconn);
+    FD_ZERO(&readset);
+    FD_ZERO(&writeset);
+    FD_SET(sock, &readset);
+    maxfd = sock;
+
+    for (i = 0; i < HTTP_MAX_CLIENTS; i++)
+    {
+      if (clients[i].fd >= 0)
+      {
+        FD_SET(clients[i].fd, &readset);
+        if (HttpPending(&clients[i]))
+          FD_SET(clients[i].fd, &writeset);
+        if (clients[i].fd > maxfd)
+          maxfd = clients[i].fd;
+      }
+    }
+
+    /* Woken by a request or room to send, else often enough for the
+       event streams and the deadlines */
+    poll.tv_sec = 0;
+    poll.tv_usec = HTTP_POLL_MS * 1000;
+    ready = select(maxfd + 1, &readset, &writeset, NULL, &poll);
+
+    for (i = 0; i < HTTP_MAX_CLIENTS; i++)
+    {
+      if (clients[i].fd >= 0 && ready > 0 && FD_ISSET(clients[i].fd, &readset))
+        HttpRead(&clients[i]);
+
+      /* Responses waiting on a shared state or an update are tried every pass */
+      if (clients[i].fd >= 0 && clients[i].sending)
+        HttpSend(&clients[i]);
+    }
+
+    /* Slots of stalled clients are free for the new ones */
+    HttpExpire();
+
+    if (ready > 0 && FD_ISSET(sock, &readset))
+      HttpAccept(sock);
   }
 }
 
 /**
-  * @brief  Initialize the HTTP server (start its thread) 
+  * @brief  Initialize the HTTP server (start its thread)
   * @param  none
   * @retval None
   */
 void http_server_socket_init()
 {
+  http_api_init();
   sys_thread_new("HTTP", http_server_socket_thread, NULL, DEFAULT_THREAD_STACKSIZE * 2, WEBSERVER_THREAD_PRIO);
 }
 
 /**
-  * @brief  Create and send a dynamic Web Page. This page contains the list of 
-  *         running tasks and the number of page hits. 
-  * @param  conn connection socket
-  * @retval None
+  * @brief  Dynamic Web Page with the list of running tasks and the number
+  *         of page hits. The page header is sent from flash.
+  * @param  c client
+  * @retval 1 if a part was added, 0 once complete
   */
-void DynWebPage(int conn)
+static int DynWebPage(HttpClient *c)
 {
-  portCHAR pagehits[10];
-
-  memset(PAGE_BODY, 0,512);
-
-  /* Update the hit count */
-  nPageHits++;
-  sprintf( pagehits, "%d", (int)nPageHits );
-  strcat(PAGE_BODY, pagehits);
-  strcat((char *) PAGE_BODY, "<pre><br>Name          State  Priority  Stack   Num" );
-  strcat((char *) PAGE_BODY, "<br>---------------------------------------------<br>"); 
-    
-  /* The list of tasks and their status */
-  osThreadList((unsigned char *)(PAGE_BODY + strlen(PAGE_BODY)));
-  strcat((char *) PAGE_BODY, "<br><br>---------------------------------------------"); 
-  strcat((char *) PAGE_BODY, "<br>B : Blocked, R : Ready, D : Deleted, S : Suspended<br>");
-  
-  /* Send the dynamically generated page */
-  write(conn, PAGE_START, strlen((char*)PAGE_START));
-  write(conn, PAGE_BODY, strlen(PAGE_BODY));
+  switch (c->next++)
+  {
+  case 0:
+    c->data = PAGE_START;
+    c->remain = strlen((char*)PAGE_START);
+    c->nocopy = 1;
+    return 1;
+
+  case 1:
+  {
+    static const char state[] = { 'X', 'R', 'B', 'S', 'D' };   /* by eTaskState */
+    UBaseType_t count, i;
+
+    /* Update the hit count */
+    nPageHits++;
+    c->len = snprintf(c->buf, sizeof(c->buf), "%d<pre><br>Name          State  Priority  Stack   Num"
+                      "<br>---------------------------------------------<br>", (int)nPageHits);
+
+    /* The list of tasks and their status, each line bounded by the buffer
+       with room left for the count of those that do not fit */
+    count = uxTaskGetSystemState(tasks, HTTP_TASKS_MAX, NULL);
+    for (i = 0; i < count && c->len + 2 * HTTP_LINE_MAX < sizeof(c->buf); i++)
+    {
+      const TaskStatus_t *t = &tasks[i];
+
+      c->len += snprintf(c->buf + c->len, HTTP_LINE_MAX, "%-13.*s %c      %-9u %-7u %u<br>",
+                         configMAX_TASK_NAME_LEN, t->pcTaskName,
+                         t->eCurrentState < sizeof(state) ? state[t->eCurrentState] : '?',
+                         (unsigned)t->uxCurrentPriority, (unsigned)t->usStackHighWaterMark,
+                         (unsigned)t->xTaskNumber);
+    }
+    if (i < count || count == 0)
+      c->len += snprintf(c->buf + c->len, HTTP_LINE_MAX, "%u tasks not listed<br>",
+                         (unsigned)(count == 0 ? uxTaskGetNumberOfTasks() : count - i));
+    return 1;
+  }
+
+  case 2:
+    c->len = snprintf(c->buf, sizeof(c->buf), "<br>---------------------------------------------"
+                      "<br>X : Running, B : Blocked, R : Ready, D : Deleted, S : Suspended<br>");
+    return 1;
+
+  default:
+    return 0;
+  }
+}
+
+/**
+  * @brief  PTP audit table, one master per line.
+  * @param  c client
+  * @retval 1 if lines were added, 0 once complete
+  */
+static int AuditPage(HttpClient *c)
+{
+  if (c->next == 0)
+  {
+    c->len = snprintf(c->buf, sizeof(c->buf), "%s%s\n", TEXT_HEADER, ptpd_audit_header());
+    c->next = 1;
+  }
+
+  for (; c->next <= DEFAULT_AUDIT_RECORDS && c->len + HTTP_LINE_MAX < sizeof(c->buf); c->next++)
+  {
+    if (ptpd_audit_format(c->next - 1, c->buf + c->len, HTTP_LINE_MAX - 1))
+    {
+      c->len += strlen(c->buf + c->len);
+      c->buf[c->len++] = '\n';
+    }
+  }
+
+  return c->len > 0;
+}
+
+/**
+  * @brief  PTP slave table, most recently seen first.
+  * @param  c client
+  * @retval 1 if lines were added, 0 once complete
+  */
+static int SlavesPage(HttpClient *c)
+{
+  if (c->next == 0)
+  {
+    c->len = snprintf(c->buf, sizeof(c->buf), "%s%s\n", TEXT_HEADER, ptpd_slaves_header());
+    c->next = 1;
+  }
+
+  while (c->next != UINT32_MAX && c->len + HTTP_LINE_MAX < sizeof(c->buf))
+  {
+    if (!ptpd_slaves_format(c->next - 1, c->buf + c->len, HTTP_LINE_MAX - 1))
+    {
+      c->next = UINT32_MAX;
+      break;
+    }
+    c->len += strlen(c->buf + c->len);
+    c->buf[c->len++] = '\n';
+    c->next++;
+  }
+
+  return c->len > 0;
+}
+
+/**
+  * @brief  Snapshot of the metrics registry, one value per line.
+  * @param  c client
+  * @retval 1 if lines were added, 0 once complete, -1 while another
+  *         client sends its snapshot
+  */
+static int MetricsPage(HttpClient *c)
+{
+  static const char header[] = "HTTP/1.0 200 OK\r\nContent-Type: text/plain; version=0.0.4\r\n\r\n";
+
+  if (c->next == 0)
+  {
+    if (!HttpTake(&metricsClient, c))
+      return -1;
+
+    metrics_snapshot(&snap);
+    strcpy(c->buf, header);
+    c->len = strlen(header);
+    c->next = 1;
+  }
+
+  while (c->next != UINT32_MAX && c->len + HTTP_LINE_MAX < sizeof(c->buf))
+  {
+    if (!metrics_format(&snap, c->next - 1, c->buf + c->len, HTTP_LINE_MAX - 1))
+    {
+      c->next = UINT32_MAX;
+      break;
+    }
+    c->len += strlen(c->buf + c->len);
+    c->buf[c->len++] = '\n';
+    c->next++;
+  }
+
+  if (c->len == 0)
+    metricsClient = NULL;
+
+  return c->len > 0;
+}
+
+/**
+  * @brief  PTP data sets and a snapshot of the metrics as JSON.
+  * @param  c client
+  * @retval 1 if a part was added, 0 once complete, -1 while another client
+  *         sends its document
+  */
+static int StatusPage(HttpClient *c)
+{
+  static const char header[] = "HTTP/1.0 200 OK\r\nContent-Type: application/json\r\n"
+    "Access-Control-Allow-Origin: *\r\n\r\n";
+
+  switch (c->next)
+  {
+  case 0:
+    if (!HttpTake(&statusClient, c))
+      return -1;
+
+    strcpy(c->buf, header);
+    c->len = strlen(header);
+    c->data = (const uint8_t *)json;
+    c->remain = http_api_status(json, sizeof(json));
+    c->nocopy = 0;
+    c->next = 1;
+    return 1;
+
+  default:
+    statusClient = NULL;
+    return 0;
+  }
+}
+
+/**
+  * @brief  Next servo update event the stream has not seen.
+  * @param  c client
+  * @retval 1 if an event was added, -1 until the next update
+  */
+static int EventsPage(HttpClient *c)
+{
+  ServoSample sample;
+  uint32_t head = http_api_head();
+
+  while (c->next != head)
+  {
+    /* Fell behind, resume at the oldest update kept */
+    if (head - c->next > HTTP_API_SAMPLES)
+      c->next = head - HTTP_API_SAMPLES;
+
+    if (http_api_sample(c->next, &sample))
+    {
+      c->len = http_api_event(c->next, &sample, c->buf, sizeof(c->buf));
+      c->next++;
+      return 1;
+    }
+    c->next++;
+  }
+
+  return -1;
+}
+
+#ifdef ENABLE_CAPTURE
+/**
+  * @brief  Capture ring as a pcapng file.
+  * @param  c client
+  * @retval 1 if a part was added, 0 once complete, -1 while another export
+  *         is in progress
+  */
+static int CapturePage(HttpClient *c)
+{
+  static const char header[] = "HTTP/1.0 200 OK\r\nContent-Type: application/octet-stream\r\n"
+    "Content-Disposition: attachment; filename=\"" CAPTURE_FILE_NAME "\"\r\n\r\n";
+  int n;
+
+  switch (c->next)
+  {
+  case 0:
+    if (captureClient != NULL)
+      return -1;
+
+    captureExport = capture_export_open();
+    if (captureExport == NULL)
+      return -1;
+
+    captureClient = c;
+    strcpy(c->buf, header);
+    c->len = strlen(header);
+    c->next = 1;
+    return 1;
+
+  case 1:
+    /* A short read is the end of the file */
+    n = capture_export_read(captureExport, c->buf, sizeof(c->buf));
+    if (n < (int)sizeof(c->buf))
+      c->next = 2;
+    c->len = n > 0 ? n : 0;
+    if (c->len > 0)
+      return 1;
+    /* fall through */
+
+  default:
+    capture_export_close(captureExport);
+    captureClient = NULL;
+    return 0;
+  }
+}
+#endif
+
+#ifdef ENABLE_HISTORY
+/**
+  * @brief  Servo history between two PHC seconds as CSV, one line per
+  *         update or per step seconds.
+  * @param  c client
+  * @retval 1 if lines were added, 0 once complete, -1 while another client
+  *         reads the history
+  */
+static int HistoryPage(HttpClient *c)
+{
+  history_bucket_t bucket;
+  ServoSample sample;
+
+  if (c->next == 0)
+  {
+    if (!HttpTake(&historyClient, c))
+      return -1;
+
+    history_query_open(&query, c->from, c->to);
+    c->len = snprintf(c->buf, sizeof(c->buf), "%s%s", TEXT_HEADER, c->step == 0 ?
+                      "seconds,nanoseconds,offset,delay,drift,state\n" :
+                      "seconds,count,offset_min,offset_mean,offset_max,delay,drift,state\n");
+    c->next = 1;
+  }
+
+  while (c->next == 1 && c->len + HTTP_LINE_MAX < sizeof(c->buf))
+  {
+    if (c->step == 0)
+    {
+      if (!history_query_next(&query, &sample))
+        c->next = 2;
+      else
+        c->len += snprintf(c->buf + c->len, sizeof(c->buf) - c->len, "%lu,%09lu,%ld,%ld,%ld,%u\n",
+                           (unsigned long)sample.seconds, (unsigned long)sample.nanoseconds,
+                           (long)sample.offsetFromMaster, (long)sample.meanPathDelay,
+                           (long)sample.observedDrift, sample.portState);
+    }
+    else
+    {
+      if (!history_query_bucket(&query, c->step, &bucket))
+        c->next = 2;
+      else
+        c->len += snprintf(c->buf + c->len, sizeof(c->buf) - c->len, "%lu,%lu,%ld,%ld,%ld,%ld,%ld,%u\n",
+                           (unsigned long)bucket.sec, (unsigned long)bucket.count,
+                           (long)bucket.offset_min, (long)bucket.offset_mean, (long)bucket.offset_max,
+                           (long)bucket.delay_mean, (long)bucket.drift, bucket.state);
+    }
+  }
+
+  if (c->len == 0)
+    historyClient = NULL;
+
+  return c->len > 0;
+}
+
+/**
+  * @brief  Servo history blocks overlapping ?from=&to= as stored, each sent
+  *         from the copy of the query.
+  * @param  c client
+  * @retval 1 if a part was added, 0 once complete, -1 while another client
+  *         reads the history
+  */
+static int HistoryBinPage(HttpClient *c)
+{
+  static const char header[] = "HTTP/1.0 200 OK\r\nContent-Type: application/octet-stream\r\n"
+    "Content-Disposition: attachment; filename=\"history.bin\"\r\n\r\n";
+  const uint8_t *block;
+
+  if (c->next == 0)
+  {
+    if (!HttpTake(&historyClient, c))
+      return -1;
+
+    history_query_open(&query, c->from, c->to);
+    strcpy(c->buf, header);
+    c->len = strlen(header);
+    c->next = 1;
+    return 1;
+  }
+
+  /* The copy is reused for the next block, the socket copies it */
+  block = history_query_block(&query);
+  if (block == NULL)
+  {
+    historyClient = NULL;
+    return 0;
+  }
+
+  c->data = block;
+  c->remain = HISTORY_BLOCK;
+  c->nocopy = 0;
+  return 1;
 }
+#endif
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
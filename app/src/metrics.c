@@ -0,0 +1,239 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "app.h"
+#include "cmsis_os.h"
+#include "lwip/sys.h"
+#include "lwip/stats.h"
+#include "ethernetif.h"
+#include "cpu_utils.h"
+#include "ptpd.h"
+#include "metrics.h"
+
+typedef struct metric_def {
+    const char *name;
+    uint8_t type;
+} metric_def_t;
+
+static const metric_def_t metric_defs[METRIC_COUNT] = {
+    [METRIC_PTP_PORT_STATE]             = { "ptp_port_state", METRIC_GAUGE },
+    [METRIC_PTP_STATE_CHANGES]          = { "ptp_state_changes", METRIC_COUNTER },
+    [METRIC_PTP_SYNC_GAPS]              = { "ptp_sync_sequence_gaps", METRIC_COUNTER },
+    [METRIC_PTP_MISSED_FOLLOW_UPS]      = { "ptp_missed_follow_ups", METRIC_COUNTER },
+    [METRIC_PTP_ORPHAN_FOLLOW_UPS]      = { "ptp_orphan_follow_ups", METRIC_COUNTER },
+    [METRIC_PTP_LATE_DELAY_RESPS]       = { "ptp_late_delay_resps", METRIC_COUNTER },
+    [METRIC_PTP_EXPIRED_DELAY_REQS]     = { "ptp_expired_delay_reqs", METRIC_COUNTER },
+    [METRIC_PTP_SERVO_UPDATES]          = { "ptp_servo_updates", METRIC_COUNTER },
+    [METRIC_PTP_CLOCK_STEPS]            = { "ptp_clock_steps", METRIC_COUNTER },
+    [METRIC_PTP_STANDBY_SWITCHES]       = { "ptp_standby_switches", METRIC_COUNTER },
+    [METRIC_PTP_RX_DROP_SHORT]          = { "ptp_rx_drop_short", METRIC_COUNTER },
+    [METRIC_PTP_RX_DROP_DOMAIN]         = { "ptp_rx_drop_domain", METRIC_COUNTER },
+    [METRIC_PTP_RX_DROP_NOT_ACCEPTABLE] = { "ptp_rx_drop_not_acceptable", METRIC_COUNTER },
+    [METRIC_PTP_RX_DROP_RATE]           = { "ptp_rx_drop_rate", METRIC_COUNTER },
+    [METRIC_PTP_RX_DROP_QUEUE_FULL]     = { "ptp_rx_drop_queue_full", METRIC_COUNTER },
+    [METRIC_PTP_TX_BUSY]                = { "ptp_tx_drop_busy", METRIC_COUNTER },
+    [METRIC_PTP_OFFSET]                 = { "ptp_offset_ns", METRIC_GAUGE },
+    [METRIC_PTP_PATH_DELAY]             = { "ptp_path_delay_ns", METRIC_GAUGE },
+    [METRIC_PTP_DRIFT]                  = { "ptp_drift_ppb", METRIC_GAUGE },
+    [METRIC_LINK_RX]                    = { "lwip_link_rx", METRIC_COUNTER },
+    [METRIC_LINK_TX]                    = { "lwip_link_tx", METRIC_COUNTER },
+    [METRIC_LINK_DROP]                  = { "lwip_link_drop", METRIC_COUNTER },
+    [METRIC_IP_DROP]                    = { "lwip_ip_drop", METRIC_COUNTER },
+    [METRIC_UDP_RX]                     = { "lwip_udp_rx", METRIC_COUNTER },
+    [METRIC_UDP_DROP]                   = { "lwip_udp_drop", METRIC_COUNTER },
+    [METRIC_MEM_ERRORS]                 = { "lwip_mem_errors", METRIC_COUNTER },
+    [METRIC_ETH_RX_UNICAST]             = { "eth_rx_unicast", METRIC_COUNTER },
+    [METRIC_ETH_RX_CRC_ERRORS]          = { "eth_rx_crc_errors", METRIC_COUNTER },
+    [METRIC_ETH_RX_ALIGN_ERRORS]        = { "eth_rx_align_errors", METRIC_COUNTER },
+    [METRIC_ETH_TX_GOOD]                = { "eth_tx_good", METRIC_COUNTER },
+    [METRIC_ETH_TX_COLLISIONS]          = { "eth_tx_collisions", METRIC_COUNTER },
+    [METRIC_CPU_USAGE]                  = { "rtos_cpu_usage_percent", METRIC_GAUGE },
+    [METRIC_HEAP_FREE]                  = { "rtos_heap_free", METRIC_GAUGE },
+    [METRIC_HEAP_MIN_FREE]              = { "rtos_heap_min_free", METRIC_GAUGE },
+    [METRIC_TASKS]                      = { "rtos_tasks", METRIC_GAUGE },
+    [METRIC_HTTP_REQUESTS]              = { "http_requests", METRIC_COUNTER },
+    [METRIC_HTTP_TIMEOUTS]              = { "http_timeouts", METRIC_COUNTER },
+};
+
+static const char *const hist_names[METRIC_HIST_COUNT] = {
+    [METRIC_HIST_PTP_OFFSET] = "ptp_offset_abs_ns",
+};
+
+/* Upper bounds of the buckets, the last one takes the rest */
+static const uint32_t hist_bounds[METRIC_HIST_COUNT][METRIC_HIST_BUCKETS - 1] = {
+    [METRIC_HIST_PTP_OFFSET] = { 50, 100, 250, 500, 1000, 10000, 100000 },
+};
+
+static uint32_t metric_values[METRIC_COUNT];
+static uint32_t metric_hist[METRIC_HIST_COUNT][METRIC_HIST_BUCKETS];
+static uint32_t metric_hist_sum[METRIC_HIST_COUNT];
+
+void metrics_inc(uint16_t id)
+{
+    if (id < METRIC_COUNT) {
+        __atomic_fetch_add(&metric_values[id], 1, __ATOMIC_RELAXED);
+    }
+}
+
+void metrics_add(uint16_t id, uint32_t n)
+{
+    if (id < METRIC_COUNT) {
+        __atomic_fetch_add(&metric_values[id], n, __ATOMIC_RELAXED);
+    }
+}
+
+void metrics_set(uint16_t id, int32_t value)
+{
+    if (id < METRIC_COUNT) {
+        __atomic_store_n(&metric_values[id], (uint32_t)value, __ATOMIC_RELAXED);
+    }
+}
+
+void metrics_observe(uint16_t hist, uint32_t value)
+{
+    uint8_t i;
+
+    if (hist >= METRIC_HIST_COUNT) {
+        return;
+    }
+
+    for (i = 0; i < METRIC_HIST_BUCKETS - 1; i++) {
+        if (value <= hist_bounds[hist][i]) {
+            break;
+        }
+    }
+
+    /* The sum wraps like the counters, a snapshot may catch it one
+     * observation behind the buckets */
+    __atomic_fetch_add(&metric_hist[hist][i], 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&metric_hist_sum[hist], value, __ATOMIC_RELAXED);
+}
+
+// Counters kept by the modules themselves, copied in on each snapshot
+static void metrics_collect(void)
+{
+    PtpCounters ptp;
+    ethernetif_mmc_t mmc;
+
+    ptpd_get_counters(&ptp);
+    metrics_set(METRIC_PTP_PORT_STATE, ptp.portState);
+    metrics_set(METRIC_PTP_STATE_CHANGES, ptp.stateChanges);
+    metrics_set(METRIC_PTP_SYNC_GAPS, ptp.syncSequenceGaps);
+    metrics_set(METRIC_PTP_MISSED_FOLLOW_UPS, ptp.orphanSyncs);
+    metrics_set(METRIC_PTP_ORPHAN_FOLLOW_UPS, ptp.orphanFollowUps);
+    metrics_set(METRIC_PTP_LATE_DELAY_RESPS, ptp.lateDelayResps);
+    metrics_set(METRIC_PTP_EXPIRED_DELAY_REQS, ptp.expiredDelayReqs);
+    metrics_set(METRIC_PTP_SERVO_UPDATES, ptp.servoUpdates);
+    metrics_set(METRIC_PTP_CLOCK_STEPS, ptp.clockSteps);
+    metrics_set(METRIC_PTP_STANDBY_SWITCHES, ptp.standbySwitches);
+    metrics_set(METRIC_PTP_RX_DROP_SHORT, ptp.rxDropped[RX_DROP_SHORT]);
+    metrics_set(METRIC_PTP_RX_DROP_DOMAIN, ptp.rxDropped[RX_DROP_DOMAIN]);
+    metrics_set(METRIC_PTP_RX_DROP_NOT_ACCEPTABLE, ptp.rxDropped[RX_DROP_NOT_ACCEPTABLE]);
+    metrics_set(METRIC_PTP_RX_DROP_RATE, ptp.rxDropped[RX_DROP_RATE]);
+    metrics_set(METRIC_PTP_RX_DROP_QUEUE_FULL, ptp.rxDropped[RX_DROP_QUEUE_FULL]);
+    metrics_set(METRIC_PTP_TX_BUSY, ptp.txBusy);
+    metrics_set(METRIC_PTP_OFFSET, ptp.offsetFromMaster);
+    metrics_set(METRIC_PTP_PATH_DELAY, ptp.meanPathDelay);
+    metrics_set(METRIC_PTP_DRIFT, ptp.observedDrift);
+
+#if LWIP_STATS
+    metrics_set(METRIC_LINK_RX, lwip_stats.link.recv);
+    metrics_set(METRIC_LINK_TX, lwip_stats.link.xmit);
+    metrics_set(METRIC_LINK_DROP, lwip_stats.link.drop);
+    metrics_set(METRIC_IP_DROP, lwip_stats.ip.drop);
+    metrics_set(METRIC_UDP_RX, lwip_stats.udp.recv);
+    metrics_set(METRIC_UDP_DROP, lwip_stats.udp.drop);
+    metrics_set(METRIC_MEM_ERRORS, lwip_stats.mem.err);
+#endif
+
+    ethernetif_get_mmc(&mmc);
+    metrics_set(METRIC_ETH_RX_UNICAST, mmc.rx_unicast);
+    metrics_set(METRIC_ETH_RX_CRC_ERRORS, mmc.rx_crc_errors);
+    metrics_set(METRIC_ETH_RX_ALIGN_ERRORS, mmc.rx_align_errors);
+    metrics_set(METRIC_ETH_TX_GOOD, mmc.tx_good);
+    metrics_set(METRIC_ETH_TX_COLLISIONS, mmc.tx_single_collisions + mmc.tx_multiple_collisions);
+
+    metrics_set(METRIC_CPU_USAGE, osGetCPUUsage());
+    metrics_set(METRIC_HEAP_FREE, xPortGetFreeHeapSize());
+    metrics_set(METRIC_HEAP_MIN_FREE, xPortGetMinimumEverFreeHeapSize());
+    metrics_set(METRIC_TASKS, uxTaskGetNumberOfTasks());
+}
+
+void metrics_snapshot(metrics_snapshot_t *snap)
+{
+    metrics_collect();
+
+    taskENTER_CRITICAL();
+    memcpy(snap->value, metric_values, sizeof(snap->value));
+    memcpy(snap->hist, metric_hist, sizeof(snap->hist));
+    memcpy(snap->hist_sum, metric_hist_sum, sizeof(snap->hist_sum));
+    taskEXIT_CRITICAL();
+
+    snap->time = sys_now();
+}
+
+const char *metrics_name(uint16_t id)
+{
+    return id < METRIC_COUNT ? metric_defs[id].name : "?";
+}
+
+uint8_t metrics_type(uint16_t id)
+{
+    return id < METRIC_COUNT ? metric_defs[id].type : METRIC_COUNTER;
+}
+
+uint8_t metrics_format(const metrics_snapshot_t *snap, uint16_t line, char *buf, size_t len)
+{
+    uint16_t hist, bucket;
+    uint32_t total;
+    uint8_t i;
+
+    if (line < METRIC_COUNT) {
+        if (metric_defs[line].type == METRIC_GAUGE) {
+            snprintf(buf, len, "%s %ld", metric_defs[line].name, (long)(int32_t)snap->value[line]);
+        } else {
+            snprintf(buf, len, "%s %lu", metric_defs[line].name, (unsigned long)snap->value[line]);
+        }
+        return 1;
+    }
+
+    /* One line per bucket, cumulative, then the sum and the count */
+    line -= METRIC_COUNT;
+    hist = line / (METRIC_HIST_BUCKETS + 2);
+    bucket = line % (METRIC_HIST_BUCKETS + 2);
+
+    if (hist >= METRIC_HIST_COUNT) {
+        return 0;
+    }
+
+    total = 0;
+    for (i = 0; i <= bucket && i < METRIC_HIST_BUCKETS; i++) {
+        total += snap->hist[hist][i];
+    }
+
+    if (bucket < METRIC_HIST_BUCKETS - 1) {
+        snprintf(buf, len, "%s_bucket{le=\"%lu\"} %lu", hist_names[hist],
+                 (unsigned long)hist_bounds[hist][bucket], (unsigned long)total);
+    } else if (bucket == METRIC_HIST_BUCKETS - 1) {
+        snprintf(buf, len, "%s_bucket{le=\"+Inf\"} %lu", hist_names[hist], (unsigned long)total);
+    } else if (bucket == METRIC_HIST_BUCKETS) {
+        snprintf(buf, len, "%s_sum %lu", hist_names[hist], (unsigned long)snap->hist_sum[hist]);
+    } else {
+        snprintf(buf, len, "%s_count %lu", hist_names[hist], (unsigned long)total);
+    }
+
+    return 1;
+}
+
+void metrics_stats(void)
+{
+    static metrics_snapshot_t snap;
+    char line[96];
+    uint16_t i;
+
+    metrics_snapshot(&snap);
+
+    for (i = 0; metrics_format(&snap, i, line, sizeof(line)); i++) {
+        LOG_PRINT("\t%s", line);
+    }
+}
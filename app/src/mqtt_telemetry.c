@@ -0,0 +1,286 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "lwip/sys.h"
+#include "lwip/tcpip.h"
+#include "lwip/timeouts.h"
+#include "lwip/apps/mqtt.h"
+#include "app.h"
+#include "cmsis_os.h"
+#include "ptpd.h"
+#include "pps_stats.h"
+#include "mqtt_telemetry.h"
+
+typedef struct _mqttt {
+    mqtt_client_t *client;
+    ip_addr_t broker;
+    uint16_t port;
+    char topic[MQTT_TELEMETRY_TOPIC_LEN];
+    volatile uint8_t running;
+    uint8_t connecting;
+    uint32_t backoff;           /* ms, wait before the next attempt */
+    uint32_t retry;             /* ms, sys_now() of the next attempt */
+    /* Servo updates, written by the PTP thread and read by the lwIP thread */
+    ServoSample samples[MQTT_TELEMETRY_SAMPLES];
+    uint32_t head;
+    uint32_t tail;
+    char payload[MQTT_TELEMETRY_PAYLOAD];
+    uint32_t dropped;
+    uint32_t published;
+    uint32_t refused;           /* messages not taken by the client */
+    uint32_t connects;
+    uint32_t disconnects;
+} mqttt_t;
+
+static mqttt_t mqttt = {
+    .topic = MQTT_TELEMETRY_TOPIC,
+};
+
+static const struct mqtt_connect_client_info_t client_info = {
+    .client_id = MQTT_TELEMETRY_CLIENT_ID,
+    .keep_alive = MQTT_TELEMETRY_KEEP_ALIVE,
+};
+
+// PTP thread, never waits for the lwIP thread
+static void mqtt_telemetry_sample(const ServoSample *sample)
+{
+    uint32_t head = mqttt.head;
+
+    if (head - __atomic_load_n(&mqttt.tail, __ATOMIC_ACQUIRE) >= MQTT_TELEMETRY_SAMPLES) {
+        mqttt.dropped++;
+        return;
+    }
+
+    mqttt.samples[head & (MQTT_TELEMETRY_SAMPLES - 1)] = *sample;
+    __atomic_store_n(&mqttt.head, head + 1, __ATOMIC_RELEASE);
+}
+
+static void mqtt_telemetry_fail(void)
+{
+    mqttt.backoff = mqttt.backoff ? mqttt.backoff * 2 : MQTT_TELEMETRY_PERIOD;
+
+    if (mqttt.backoff > MQTT_TELEMETRY_BACKOFF_MAX) {
+        mqttt.backoff = MQTT_TELEMETRY_BACKOFF_MAX;
+    }
+
+    mqttt.retry = sys_now() + mqttt.backoff;
+}
+
+static void mqtt_telemetry_connection_cb(mqtt_client_t *client, void *arg, mqtt_connection_status_t status)
+{
+    mqttt.connecting = 0;
+
+    if (status == MQTT_CONNECT_ACCEPTED) {
+        mqttt.connects++;
+        mqttt.backoff = 0;
+        LOG_INF("MQTT: connected to %s", ipaddr_ntoa(&mqttt.broker));
+        return;
+    }
+
+    mqttt.disconnects++;
+    mqtt_telemetry_fail();
+    LOG_WRN("MQTT: connection closed (%d), retry in %lu ms", status, (unsigned long)mqttt.backoff);
+}
+
+/**
+ * @brief Format up to MQTT_TELEMETRY_BATCH queued updates after the state.
+ * @return number of updates in the payload, the payload length in len
+ */
+static uint32_t mqtt_telemetry_format(uint32_t tail, uint32_t head, uint16_t *len)
+{
+    const ServoSample *first = &mqttt.samples[tail & (MQTT_TELEMETRY_SAMPLES - 1)];
+    char *buf = mqttt.payload;
+    size_t size = sizeof(mqttt.payload);
+    PtpCounters counters;
+    pps_stats_t stats;
+    uint32_t count, i, drops;
+    int n;
+
+    ptpd_get_counters(&counters);
+
+    drops = 0;
+    for (i = 0; i < RX_DROP_COUNT; i++) {
+        drops += counters.rxDropped[i];
+    }
+
+    count = head - tail;
+    if (count > MQTT_TELEMETRY_BATCH) {
+        count = MQTT_TELEMETRY_BATCH;
+    }
+
+    pps_stats_reset(&stats);
+    for (i = 0; i < count; i++) {
+        pps_stats_add(&stats, mqttt.samples[(tail + i) & (MQTT_TELEMETRY_SAMPLES - 1)].offsetFromMaster);
+    }
+
+    n = snprintf(buf, size,
+                 "{\"state\":%u,\"offset\":%ld,\"delay\":%ld,\"drift\":%ld,"
+                 "\"steps\":%lu,\"changes\":%lu,\"gaps\":%lu,\"drops\":%lu,\"lost\":%lu",
+                 counters.portState, (long)counters.offsetFromMaster, (long)counters.meanPathDelay,
+                 (long)counters.observedDrift, (unsigned long)counters.clockSteps,
+                 (unsigned long)counters.stateChanges, (unsigned long)counters.syncSequenceGaps,
+                 (unsigned long)drops, (unsigned long)mqttt.dropped);
+
+    if (count > 0) {
+        n += snprintf(buf + n, size - n,
+                      ",\"n\":%lu,\"mean\":%ld,\"min\":%ld,\"max\":%ld,\"sd\":%lu,\"t\":%lu.%09lu,\"s\":[",
+                      (unsigned long)stats.count, (long)stats.mean, (long)stats.min, (long)stats.max,
+                      (unsigned long)pps_stats_stddev(&stats),
+                      (unsigned long)first->seconds, (unsigned long)first->nanoseconds);
+    }
+
+    /* [ms after t, offset, delay] per update, stop short of a truncated one */
+    for (i = 0; i < count && n < (int)size; i++) {
+        const ServoSample *s = &mqttt.samples[(tail + i) & (MQTT_TELEMETRY_SAMPLES - 1)];
+        int32_t ms = (int32_t)(s->seconds - first->seconds) * 1000 +
+                     ((int32_t)s->nanoseconds - (int32_t)first->nanoseconds) / 1000000;
+        int m = snprintf(buf + n, size - n, "%s[%ld,%ld,%ld]", i ? "," : "",
+                         (long)ms, (long)s->offsetFromMaster, (long)s->meanPathDelay);
+
+        if (m >= (int)(size - n) - 3) {
+            break;
+        }
+        n += m;
+    }
+
+    count = i;
+    n += snprintf(buf + n, size - n, count ? "]}" : "}");
+
+    *len = n < (int)size ? n : size - 1;
+
+    return count;
+}
+
+// lwIP thread, the queued updates are released once the client took them
+static void mqtt_telemetry_publish(void)
+{
+    uint32_t tail = mqttt.tail;
+    uint32_t head = __atomic_load_n(&mqttt.head, __ATOMIC_ACQUIRE);
+    uint32_t count;
+    uint16_t len;
+
+    do {
+        count = mqtt_telemetry_format(tail, head, &len);
+
+        if (mqtt_publish(mqttt.client, mqttt.topic, mqttt.payload, len, 0, 0, NULL, NULL) != ERR_OK) {
+            /* Output buffer full, the broker is not keeping up */
+            mqttt.refused++;
+            mqtt_telemetry_fail();
+            return;
+        }
+
+        mqttt.published++;
+        mqttt.backoff = 0;
+        tail += count;
+        __atomic_store_n(&mqttt.tail, tail, __ATOMIC_RELEASE);
+    } while (count > 0 && head - tail >= MQTT_TELEMETRY_BATCH);
+}
+
+static void mqtt_telemetry_tick(void *arg)
+{
+    if (!mqttt.running) {
+        return;
+    }
+
+    if ((int32_t)(sys_now() - mqttt.retry) >= 0) {
+        if (mqtt_client_is_connected(mqttt.client)) {
+            mqtt_telemetry_publish();
+        } else if (!mqttt.connecting) {
+            if (mqtt_client_connect(mqttt.client, &mqttt.broker, mqttt.port,
+                                    mqtt_telemetry_connection_cb, NULL, &client_info) == ERR_OK) {
+                mqttt.connecting = 1;
+            } else {
+                mqtt_telemetry_fail();
+            }
+        }
+    }
+
+    sys_timeout(MQTT_TELEMETRY_PERIOD, mqtt_telemetry_tick, NULL);
+}
+
+static void mqtt_telemetry_begin(void *arg)
+{
+    if (mqttt.client == NULL) {
+        mqttt.client = mqtt_client_new();
+
+        if (mqttt.client == NULL) {
+            LOG_ERR("MQTT: failed to create client");
+            mqttt.running = 0;
+            return;
+        }
+    }
+
+    mqttt.backoff = 0;
+    mqttt.retry = sys_now();
+    mqtt_telemetry_tick(NULL);
+}
+
+static void mqtt_telemetry_end(void *arg)
+{
+    sys_untimeout(mqtt_telemetry_tick, NULL);
+
+    if (mqttt.client != NULL) {
+        mqtt_disconnect(mqttt.client);
+    }
+
+    mqttt.connecting = 0;
+}
+
+osStatus mqtt_telemetry_start(const ip_addr_t *broker, uint16_t port)
+{
+    if (mqttt.running) {
+        return osErrorResource;
+    }
+
+    ip_addr_copy(mqttt.broker, *broker);
+    mqttt.port = port ? port : MQTT_TELEMETRY_PORT;
+    /* Not registered, stop waited for the last update to be queued */
+    mqttt.tail = mqttt.head;
+    mqttt.running = 1;
+
+    if (tcpip_callback(mqtt_telemetry_begin, NULL) != ERR_OK) {
+        mqttt.running = 0;
+        return osErrorOS;
+    }
+
+    if (!ptpd_add_sample_callback(mqtt_telemetry_sample)) {
+        LOG_WRN("MQTT: no servo update slot, state only");
+    }
+
+    LOG_INF("MQTT: publishing to %s:%u %s", ipaddr_ntoa(&mqttt.broker), mqttt.port, mqttt.topic);
+    return osOK;
+}
+
+void mqtt_telemetry_stop(void)
+{
+    if (!mqttt.running) {
+        return;
+    }
+
+    /* Returns once the PTP thread is out of mqtt_telemetry_sample */
+    ptpd_remove_sample_callback(mqtt_telemetry_sample);
+    mqttt.running = 0;
+    tcpip_callback(mqtt_telemetry_end, NULL);
+}
+
+osStatus mqtt_telemetry_set_topic(const char *topic)
+{
+    if (mqttt.running || strlen(topic) >= sizeof(mqttt.topic)) {
+        return osErrorResource;
+    }
+
+    strcpy(mqttt.topic, topic);
+
+    return osOK;
+}
+
+void mqtt_telemetry_stats(void)
+{
+    LOG_PRINT("\tbroker: %s:%u, topic: %s, %s", ipaddr_ntoa(&mqttt.broker), mqttt.port, mqttt.topic,
+              !mqttt.running ? "stopped" : mqttt.client && mqtt_client_is_connected(mqttt.client) ? "connected" : "not connected");
+    LOG_PRINT("\tpublished: %lu, refused: %lu, connects: %lu, disconnects: %lu",
+              (unsigned long)mqttt.published, (unsigned long)mqttt.refused,
+              (unsigned long)mqttt.connects, (unsigned long)mqttt.disconnects);
+    LOG_PRINT("\tqueued: %lu, dropped: %lu, backoff: %lu ms",
+              (unsigned long)(mqttt.head - mqttt.tail), (unsigned long)mqttt.dropped, (unsigned long)mqttt.backoff);
+}
@@ -0,0 +1,203 @@
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include "nmea.h"
+
+#define NMEA_MAX_FIELDS 20
+
+static int hexval(char c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
+}
+
+// Parse exactly n decimal digits
+static int digits(const char *s, int n)
+{
+    int v = 0;
+
+    while (n--) {
+        if (*s < '0' || *s > '9') {
+            return -1;
+        }
+        v = v * 10 + (*s++ - '0');
+    }
+
+    return v;
+}
+
+// Split a sentence body in place, returns the number of fields
+static int split(char *s, char **fields)
+{
+    int n = 0;
+
+    fields[n++] = s;
+
+    while (*s && n < NMEA_MAX_FIELDS) {
+        if (*s == ',') {
+            *s = '\0';
+            fields[n++] = s + 1;
+        }
+        s++;
+    }
+
+    return n;
+}
+
+static int parse_hhmmss(const char *s, int *hour, int *min, int *sec)
+{
+    if (strlen(s) < 6) {
+        return -1;
+    }
+
+    *hour = digits(s, 2);
+    *min = digits(s + 2, 2);
+    *sec = digits(s + 4, 2);
+
+    if (*hour < 0 || *hour > 23 || *min < 0 || *min > 59 || *sec < 0 || *sec > 60) {
+        return -1;
+    }
+
+    return 0;
+}
+
+// Days since 1970-01-01 of a proleptic Gregorian date
+static int32_t days_from_civil(int y, int m, int d)
+{
+    y -= m <= 2;
+    int32_t era = (y >= 0 ? y : y - 399) / 400;
+    uint32_t yoe = (uint32_t)(y - era * 400);
+    uint32_t doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    uint32_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+
+    return era * 146097 + (int32_t)doe - 719468;
+}
+
+uint32_t nmea_mktime(int year, int mon, int day, int hour, int min, int sec)
+{
+    return (uint32_t)days_from_civil(year, mon, day) * 86400UL +
+           hour * 3600UL + min * 60UL + sec;
+}
+
+int nmea_parse(const char *sentence, nmea_time_t *time)
+{
+    char buf[NMEA_MAX_SENTENCE + 1];
+    char *fields[NMEA_MAX_FIELDS];
+    char *star;
+    int hour, min, sec, day, mon, year;
+    int n;
+
+    if (sentence[0] != '$' || strlen(sentence) > NMEA_MAX_SENTENCE) {
+        return -1;
+    }
+
+    strcpy(buf, sentence + 1);
+
+    star = strchr(buf, '*');
+
+    if (star) {
+        uint8_t sum = 0;
+        int hi = hexval(star[1]);
+        int lo = hi < 0 ? -1 : hexval(star[2]);   /* star[1] may end the string */
+
+        for (char *p = buf; p < star; p++) {
+            sum ^= (uint8_t)*p;
+        }
+
+        if (hi < 0 || lo < 0 || sum != ((hi << 4) | lo)) {
+            return -1;
+        }
+
+        *star = '\0';
+    }
+
+    n = split(buf, fields);
+
+    /* Talker ID is ignored, GP/GN/GL/GA all carry the same time */
+    if (strlen(fields[0]) != 5) {
+        return 0;
+    }
+
+    if (!strcmp(fields[0] + 2, "RMC")) {
+        /* $--RMC,hhmmss.ss,A,llll.ll,a,yyyyy.yy,a,x.x,x.x,ddmmyy,... */
+        if (n < 10 || strlen(fields[9]) != 6 || parse_hhmmss(fields[1], &hour, &min, &sec) != 0) {
+            return -1;
+        }
+
+        day = digits(fields[9], 2);
+        mon = digits(fields[9] + 2, 2);
+        year = digits(fields[9] + 4, 2);
+
+        if (day < 1 || mon < 1 || mon > 12 || year < 0) {
+            return -1;
+        }
+
+        /* Two digit year, pivot at 1980 (GPS epoch) */
+        year += year < 80 ? 2000 : 1900;
+
+        time->valid = fields[2][0] == 'A';
+        time->utc = nmea_mktime(year, mon, day, hour, min, sec);
+        return 1;
+    }
+
+    if (!strcmp(fields[0] + 2, "ZDA")) {
+        /* $--ZDA,hhmmss.ss,dd,mm,yyyy,zh,zm */
+        if (n < 5 || strlen(fields[2]) != 2 || strlen(fields[3]) != 2 || strlen(fields[4]) != 4 ||
+            parse_hhmmss(fields[1], &hour, &min, &sec) != 0) {
+            return -1;
+        }
+
+        day = digits(fields[2], 2);
+        mon = digits(fields[3], 2);
+        year = digits(fields[4], 4);
+
+        if (day < 1 || mon < 1 || mon > 12 || year < 1970) {
+            return -1;
+        }
+
+        /* ZDA carries no fix status, a populated date implies a time solution */
+        time->valid = 1;
+        time->utc = nmea_mktime(year, mon, day, hour, min, sec);
+        return 1;
+    }
+
+    return 0;
+}
+
+int nmea_feed(nmea_parser_t *parser, char c, nmea_time_t *time)
+{
+    int res;
+
+    if (c == '$') {
+        parser->len = 0;
+    } else if (parser->len == 0) {
+        /* Wait for start of sentence */
+        return 0;
+    }
+
+    if (c == '\r' || c == '\n') {
+        parser->line[parser->len] = '\0';
+        parser->len = 0;
+
+        res = nmea_parse(parser->line, time);
+
+        if (res < 0) {
+            parser->errors++;
+            return 0;
+        }
+
+        return res;
+    }
+
+    if (parser->len >= NMEA_MAX_SENTENCE - 2) {
+        parser->errors++;
+        parser->len = 0;
+        return 0;
+    }
+
+    parser->line[parser->len++] = c;
+
+    return 0;
+}
@@ -0,0 +1,430 @@
+#include <stdint.h>
+#include <string.h>
+#include "lwip/udp.h"
+#include "lwip/pbuf.h"
+#include "app.h"
+#include "cmsis_os.h"
+#include "queue.h"
+#include "ethernetif.h"
+#include "ptpd.h"
+#include "time_source.h"
+#include "ntp_client.h"
+
+#define NTP_CLIENT_QUEUE_SIZE   2
+
+typedef struct ntp_reply {
+    ntp_packet_t pkt;
+    struct ptptime_t rx;        /* T4 */
+    ip_addr_t addr;
+} ntp_reply_t;
+
+typedef struct ntp_server {
+    ip_addr_t addr;
+    uint32_t used_seq;          /* last filter sample fed to the discipline */
+    uint8_t reach;              /* shift register of answered polls */
+    uint8_t stratum;
+} ntp_server_t;
+
+typedef struct _ntpc {
+    struct udp_pcb *pcb;
+    QueueHandle_t queue;
+    osThreadId threadid;
+    ntp_server_t servers[NTP_CLIENT_MAX_SERVERS];
+    ntp_peer_t peers[NTP_CLIENT_MAX_SERVERS];   /* clock filter of each server */
+    uint8_t nservers;
+    ntp_discipline_t disc;
+    int sys_peer;
+    uint8_t active;
+    uint8_t updates;            /* discipline updates since activation */
+    uint8_t locked;
+    uint32_t error;             /* ns, error estimate when last reachable */
+    uint32_t holdover;          /* s without a usable server */
+
+    /* Request in flight */
+    struct pbuf *volatile tx_pbuf;
+    ntp_ts_t nonce;
+    struct ptptime_t t1;
+    struct ptptime_t t1_hw;
+    volatile uint8_t t1_hw_valid;
+
+    uint32_t sent;
+    uint32_t received;
+    uint32_t hw_t1;
+    uint32_t steps;
+} ntpc_t;
+
+static ntpc_t ntpc;
+
+static void ntp_client_tx_timestamp(struct pbuf *p, const struct ptptime_t *timestamp)
+{
+    if (p != NULL && p == ntpc.tx_pbuf) {
+        ntpc.t1_hw = *timestamp;
+        ntpc.t1_hw_valid = 1;
+        ntpc.tx_pbuf = NULL;
+    }
+}
+
+// Callback for NTP replies, runs in the tcpip thread
+static void ntp_client_recv_cb(void *arg, struct udp_pcb *pcb, struct pbuf *p,
+                               const ip_addr_t *addr, u16_t port)
+{
+    ntp_reply_t reply;
+
+    if (p->tot_len >= NTP_PACKET_SIZE) {
+        if (!ethernetif_get_rx_timestamp(p, &reply.rx)) {
+            ethernetif_ptp_get_time(&reply.rx);
+        }
+
+        pbuf_copy_partial(p, &reply.pkt, NTP_PACKET_SIZE, 0);
+        ip_addr_copy(reply.addr, *addr);
+
+        /* Collect the request transmit timestamp before the reply is processed */
+        if (ntpc.tx_pbuf != NULL) {
+            ethernetif_release_tx();
+        }
+
+        xQueueSend(ntpc.queue, &reply, 0);
+    }
+
+    pbuf_free(p);
+}
+
+static int ntp_client_send(ntp_server_t *server)
+{
+    ntp_packet_t *pkt;
+    struct pbuf *p;
+    err_t err;
+
+    p = pbuf_alloc(PBUF_TRANSPORT, NTP_PACKET_SIZE, PBUF_RAM);
+    if (p == NULL) {
+        return -1;
+    }
+
+    pkt = (ntp_packet_t *)p->payload;
+    memset(pkt, 0, NTP_PACKET_SIZE);
+    pkt->li_vn_mode = NTP_LI_VN_MODE(0, NTP_VERSION, NTP_MODE_CLIENT);
+    pkt->poll = 4;      /* log2(NTP_CLIENT_POLL) */
+
+    ntpc.t1_hw_valid = 0;
+    ethernetif_ptp_get_time(&ntpc.t1);
+
+    /* Software T1 doubles as the nonce matched against the reply origin */
+    ntpc.nonce = ntp_ts_from_phc(ntpc.t1.tv_sec, ntpc.t1.tv_nsec, TIME_SOURCE_UTC_OFFSET);
+    ntp_ts_set(pkt->tx_ts, ntpc.nonce);
+
+    ntpc.tx_pbuf = p;
+    err = udp_sendto(ntpc.pcb, p, &server->addr, NTP_PORT);
+    pbuf_free(p);
+
+    if (err != ERR_OK) {
+        ntpc.tx_pbuf = NULL;
+        return -1;
+    }
+
+    ntpc.sent++;
+    return 0;
+}
+
+static int ntp_client_valid(const ntp_server_t *server, const ntp_reply_t *reply)
+{
+    const ntp_packet_t *pkt = &reply->pkt;
+
+    return ip_addr_cmp(&reply->addr, &server->addr) &&
+           NTP_MODE(pkt->li_vn_mode) == NTP_MODE_SERVER &&
+           NTP_LI(pkt->li_vn_mode) != NTP_LI_ALARM &&
+           pkt->stratum > 0 && pkt->stratum < NTP_STRATUM_UNSYNC &&
+           ntp_ts_get(pkt->orig_ts) == ntpc.nonce &&
+           ntp_ts_get(pkt->tx_ts) != 0;
+}
+
+// Poll one server, returns 1 if a sample was added to its filter
+static int ntp_client_query(uint8_t idx)
+{
+    ntp_server_t *server = &ntpc.servers[idx];
+    uint32_t deadline = osKernelSysTick() + NTP_CLIENT_TIMEOUT;
+    const struct ptptime_t *t1;
+    ntp_reply_t reply;
+    ntp_ts_t T1, T2, T3, T4;
+    int64_t offset, delay;
+
+    xQueueReset(ntpc.queue);
+
+    if (ntp_client_send(server) != 0) {
+        return 0;
+    }
+
+    for (;;) {
+        int32_t wait = (int32_t)(deadline - osKernelSysTick());
+
+        if (wait <= 0 || xQueueReceive(ntpc.queue, &reply, wait) != pdTRUE) {
+            ntpc.tx_pbuf = NULL;
+            return 0;
+        }
+
+        if (ntp_client_valid(server, &reply)) {
+            break;
+        }
+    }
+
+    ntpc.tx_pbuf = NULL;
+    ntpc.received++;
+
+    t1 = &ntpc.t1;
+    if (ntpc.t1_hw_valid) {
+        t1 = &ntpc.t1_hw;
+        ntpc.hw_t1++;
+    }
+
+    /* The PHC carries TAI whenever NTP drives it */
+    T1 = ntp_ts_from_phc(t1->tv_sec, t1->tv_nsec, TIME_SOURCE_UTC_OFFSET);
+    T2 = ntp_ts_get(reply.pkt.rx_ts);
+    T3 = ntp_ts_get(reply.pkt.tx_ts);
+    T4 = ntp_ts_from_phc(reply.rx.tv_sec, reply.rx.tv_nsec, TIME_SOURCE_UTC_OFFSET);
+
+    offset = (ntp_ts_diff(T2, T1) + ntp_ts_diff(T3, T4)) / 2;
+    delay = ntp_ts_diff(T4, T1) - ntp_ts_diff(T3, T2);
+
+    if (delay < 0 || delay > NTP_CLIENT_MAX_DELAY) {
+        return 0;
+    }
+
+    server->stratum = reply.pkt.stratum;
+    ntp_peer_add(&ntpc.peers[idx], offset, (uint32_t)delay,
+                 ntp_short_ns(reply.pkt.root_delay) / 2 + ntp_short_ns(reply.pkt.root_dispersion));
+
+    return 1;
+}
+
+static void ntp_client_step(int64_t offset)
+{
+    struct ptptime_t step;
+    uint8_t i;
+
+    step.tv_sec = (int32_t)(offset / 1000000000LL);
+    step.tv_nsec = (int32_t)(offset % 1000000000LL);
+    ethernetif_ptp_update_offset(&step);
+    ntpc.steps++;
+
+    /* Samples refer to the clock before the step */
+    for (i = 0; i < ntpc.nservers; i++) {
+        ntp_peer_reset(&ntpc.peers[i]);
+        ntpc.servers[i].used_seq = 0;
+    }
+}
+
+// Report the client state to the source manager
+static void ntp_client_report(void)
+{
+    time_source_status_t status = {0};
+
+    status.clock_class = DEFAULT_CLOCK_CLASS;
+
+    if (ntpc.sys_peer >= 0) {
+        const ntp_peer_t *peer = &ntpc.peers[ntpc.sys_peer];
+        uint64_t error = ntp_peer_distance(peer) + (uint64_t)(peer->offset < 0 ? -peer->offset : peer->offset);
+
+        ntpc.locked = ntpc.active && ntpc.updates >= NTP_CLIENT_LOCK_UPDATES &&
+                      error < NTP_CLIENT_LOCK_ERROR;
+        status.state = ntpc.locked ? TIME_SOURCE_LOCKED : TIME_SOURCE_ACQUIRING;
+        status.error = error > 0xFFFFFFFFULL ? 0xFFFFFFFFUL : (uint32_t)error;
+        status.jitter = peer->jitter;
+        ntpc.error = status.error;
+        ntpc.holdover = 0;
+    } else if (ntpc.locked) {
+        /* Servers lost, the PHC keeps the learned frequency */
+        ntpc.holdover += NTP_CLIENT_POLL;
+        status.state = TIME_SOURCE_HOLDOVER;
+        status.error = ntpc.error + ntpc.holdover * TIME_SOURCE_HOLDOVER_DRIFT;
+    }
+
+    time_source_report(TIME_SOURCE_NTP, &status);
+}
+
+// Discipline the PHC to the system peer
+static void ntp_client_update(void)
+{
+    ntp_server_t *server;
+    ntp_peer_t *peer;
+    uint8_t active;
+    int sel;
+
+    sel = ntp_clock_select(ntpc.peers, ntpc.nservers);
+
+    if (sel != ntpc.sys_peer) {
+        if (sel < 0) {
+            LOG_INF("NTP: no usable server");
+        } else {
+            LOG_INF("NTP: selected %s", ipaddr_ntoa(&ntpc.servers[sel].addr));
+        }
+        ntpc.sys_peer = sel;
+    }
+
+    ntp_client_report();
+
+    active = time_source_may_discipline(TIME_SOURCE_NTP);
+
+    if (active && !ntpc.active) {
+        /* Another reference had the clock, its offset to ours is slewed out,
+           the time stays continuous for the PHC users */
+        ntpc.updates = 0;
+    }
+    ntpc.active = active;
+
+    if (sel < 0 || !active) {
+        return;
+    }
+
+    server = &ntpc.servers[sel];
+    peer = &ntpc.peers[sel];
+
+    /* Each filtered sample is used once, older ones predate the last correction */
+    if (peer->best_seq == server->used_seq) {
+        return;
+    }
+
+    server->used_seq = peer->best_seq;
+
+    if (ntp_discipline_update(&ntpc.disc, peer->offset, NTP_CLIENT_POLL) == NTP_CLOCK_STEP) {
+        LOG_INF("NTP: setting time, offset %ld s", (long)(peer->offset / 1000000000LL));
+        ntp_client_step(peer->offset);
+    }
+
+    ethernetif_ptp_adj_freq(ntpc.disc.freq);
+
+    if (ntpc.updates < 255) {
+        ntpc.updates++;
+    }
+}
+
+static void ntp_client_thread(const void *arg)
+{
+    uint32_t start = osKernelSysTick();
+    int32_t wait;
+    uint8_t i;
+
+    for (;;) {
+        for (i = 0; i < ntpc.nservers; i++) {
+            ntp_server_t *server = &ntpc.servers[i];
+            uint8_t ok = ntp_client_query(i);
+
+            server->reach = (server->reach << 1) | ok;
+
+            if (server->reach == 0 && ntpc.peers[i].count != 0) {
+                LOG_INF("NTP: server %s unreachable", ipaddr_ntoa(&server->addr));
+                ntp_peer_reset(&ntpc.peers[i]);
+                server->used_seq = 0;
+            }
+        }
+
+        ntp_client_update();
+
+        start += NTP_CLIENT_POLL * 1000;
+        wait = (int32_t)(start - osKernelSysTick());
+        if (wait > 0) {
+            osDelay(wait);
+        } else {
+            start = osKernelSysTick();
+        }
+    }
+}
+
+// Public: add a server to poll
+osStatus ntp_client_add_server(const ip_addr_t *addr)
+{
+    uint8_t i;
+
+    for (i = 0; i < ntpc.nservers; i++) {
+        if (ip_addr_cmp(&ntpc.servers[i].addr, addr)) {
+            return osOK;
+        }
+    }
+
+    if (ntpc.nservers == NTP_CLIENT_MAX_SERVERS) {
+        return osErrorNoMemory;
+    }
+
+    memset(&ntpc.servers[i], 0, sizeof(ntp_server_t));
+    ip_addr_copy(ntpc.servers[i].addr, *addr);
+    ntp_peer_reset(&ntpc.peers[i]);
+    ntpc.nservers++;
+
+    return osOK;
+}
+
+// Public: start the NTP client
+osStatus ntp_client_start(void)
+{
+    if (ntpc.threadid != NULL) {
+        return osOK;
+    }
+
+    if (ntpc.queue == NULL) {
+        ntpc.queue = xQueueCreate(NTP_CLIENT_QUEUE_SIZE, sizeof(ntp_reply_t));
+
+        if (ntpc.queue == NULL) {
+            LOG_ERR("NTP: failed to create queue");
+            return osErrorOS;
+        }
+    }
+
+    if (ntpc.pcb == NULL) {
+        ntpc.pcb = udp_new();
+
+        if (ntpc.pcb == NULL) {
+            LOG_ERR("NTP: failed to create PCB");
+            return osErrorOS;
+        }
+
+        udp_bind(ntpc.pcb, IP_ADDR_ANY, 0);
+        udp_recv(ntpc.pcb, ntp_client_recv_cb, NULL);
+        ethernetif_add_tx_timestamp_cb(ntp_client_tx_timestamp);
+        ntp_discipline_init(&ntpc.disc);
+        ntpc.sys_peer = -1;
+    }
+
+    osThreadDef(NTPC, ntp_client_thread, osPriorityBelowNormal, 0, configMINIMAL_STACK_SIZE * 2);
+    ntpc.threadid = osThreadCreate(osThread(NTPC), NULL);
+
+    if (ntpc.threadid == NULL) {
+        LOG_ERR("NTP: failed to create task");
+        return osErrorOS;
+    }
+
+    LOG_INF("NTP: polling %d server(s)", ntpc.nservers);
+    return osOK;
+}
+
+void ntp_client_stop(void)
+{
+    if (ntpc.threadid == NULL) {
+        return;
+    }
+
+    osThreadTerminate(ntpc.threadid);
+    ntpc.threadid = NULL;
+    ntpc.tx_pbuf = NULL;
+    ntpc.locked = 0;
+    ntpc.sys_peer = -1;
+    ntp_client_report();
+}
+
+void ntp_client_stats(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < ntpc.nservers; i++) {
+        const ntp_peer_t *peer = &ntpc.peers[i];
+
+        LOG_PRINT("	%c%-15s st %2u reach %03o offset %ld ns delay %lu ns jitter %lu ns",
+                  (int)i == ntpc.sys_peer ? '*' : ' ', ipaddr_ntoa(&ntpc.servers[i].addr),
+                  ntpc.servers[i].stratum, ntpc.servers[i].reach,
+                  (long)peer->offset, (unsigned long)peer->delay, (unsigned long)peer->jitter);
+    }
+
+    LOG_PRINT("	state: %s%s", ntpc.threadid ? "running" : "stopped",
+              ntpc.active ? ", disciplining" : "");
+    LOG_PRINT("	freq: %ld ppb, last offset %ld ns, steps %lu",
+              (long)ntpc.disc.freq, (long)ntpc.disc.offset, (unsigned long)ntpc.steps);
+    LOG_PRINT("	sent: %lu, received: %lu, hw tx timestamps: %lu",
+              (unsigned long)ntpc.sent, (unsigned long)ntpc.received, (unsigned long)ntpc.hw_t1);
+}
@@ -0,0 +1,162 @@
+#include <stdint.h>
+#include "ntp_clock.h"
+
+#define NTP_CLOCK_KP                0.5f
+#define NTP_CLOCK_KI                0.1f
+#define NTP_CLOCK_STEP_THRESHOLD    128000000LL     /* 128 ms */
+#define NTP_CLOCK_SLEW_MAX          500000          /* 500 ppm */
+#define NTP_CLOCK_FREQ_MAX          500000          /* ADJ_FREQ_MAX */
+#define NTP_CLOCK_PRECISION         1000            /* ns, added to every distance */
+
+static float clamp(float v, int32_t max)
+{
+    if (v > max) return max;
+    if (v < -max) return -max;
+    return v;
+}
+
+static uint64_t abs64(int64_t v)
+{
+    return v < 0 ? -v : v;
+}
+
+void ntp_peer_reset(ntp_peer_t *peer)
+{
+    peer->count = 0;
+    peer->next = 0;
+    peer->offset = 0;
+    peer->delay = 0;
+    peer->jitter = 0;
+    peer->root = 0;
+    peer->best_seq = 0;
+}
+
+void ntp_peer_add(ntp_peer_t *peer, int64_t offset, uint32_t delay, uint32_t root)
+{
+    const ntp_sample_t *best;
+    uint64_t dev = 0;
+    uint8_t i;
+
+    peer->seq++;
+    peer->samples[peer->next].offset = offset;
+    peer->samples[peer->next].delay = delay;
+    peer->samples[peer->next].seq = peer->seq;
+    peer->next = (peer->next + 1) % NTP_CLOCK_FILTER_SIZE;
+    if (peer->count < NTP_CLOCK_FILTER_SIZE) {
+        peer->count++;
+    }
+
+    /* The lowest delay sample suffered the least queuing */
+    best = &peer->samples[0];
+    for (i = 1; i < peer->count; i++) {
+        if (peer->samples[i].delay < best->delay) {
+            best = &peer->samples[i];
+        }
+    }
+
+    for (i = 0; i < peer->count; i++) {
+        dev += abs64(peer->samples[i].offset - best->offset);
+    }
+
+    peer->offset = best->offset;
+    peer->delay = best->delay;
+    peer->best_seq = best->seq;
+    peer->jitter = dev / peer->count > 0xFFFFFFFFULL ? 0xFFFFFFFFUL : (uint32_t)(dev / peer->count);
+    peer->root = root;
+}
+
+uint32_t ntp_peer_distance(const ntp_peer_t *peer)
+{
+    uint64_t d = (uint64_t)peer->delay / 2 + peer->root + peer->jitter + NTP_CLOCK_PRECISION;
+
+    return d > 0xFFFFFFFFULL ? 0xFFFFFFFFUL : (uint32_t)d;
+}
+
+int ntp_clock_select(const ntp_peer_t *peers, uint8_t n)
+{
+    uint8_t idx[NTP_CLOCK_MAX_PEERS];
+    uint8_t count = 0;
+    uint8_t i, j, med;
+    int best = -1;
+
+    if (n > NTP_CLOCK_MAX_PEERS) {
+        n = NTP_CLOCK_MAX_PEERS;
+    }
+
+    for (i = 0; i < n; i++) {
+        if (peers[i].count == 0) {
+            continue;
+        }
+
+        /* Insert sorted by offset */
+        for (j = count; j > 0 && peers[idx[j - 1]].offset > peers[i].offset; j--) {
+            idx[j] = idx[j - 1];
+        }
+        idx[j] = i;
+        count++;
+    }
+
+    if (count == 0) {
+        return -1;
+    }
+
+    med = idx[(count - 1) / 2];
+
+    for (i = 0; i < count; i++) {
+        const ntp_peer_t *p = &peers[idx[i]];
+
+        if (abs64(p->offset - peers[med].offset) >
+            (uint64_t)ntp_peer_distance(p) + ntp_peer_distance(&peers[med])) {
+            continue;
+        }
+
+        if (best < 0 || ntp_peer_distance(p) < ntp_peer_distance(&peers[best])) {
+            best = idx[i];
+        }
+    }
+
+    return best;
+}
+
+void ntp_discipline_init(ntp_discipline_t *d)
+{
+    d->kp = NTP_CLOCK_KP;
+    d->ki = NTP_CLOCK_KI;
+    d->step_threshold = NTP_CLOCK_STEP_THRESHOLD;
+    d->slew_max = NTP_CLOCK_SLEW_MAX;
+    d->freq_max = NTP_CLOCK_FREQ_MAX;
+
+    d->integral = 0;
+    d->freq = 0;
+    d->offset = 0;
+    d->used_seq = 0;
+    d->synced = 0;
+}
+
+int ntp_discipline_update(ntp_discipline_t *d, int64_t offset, uint32_t interval)
+{
+    float rate;
+
+    d->offset = offset;
+
+    if (!d->synced && abs64(offset) > (uint64_t)d->step_threshold) {
+        /* Setting the time at startup, frequency is still unknown */
+        d->synced = 1;
+        d->freq = (int32_t)d->integral;
+        return NTP_CLOCK_STEP;
+    }
+
+    d->synced = 1;
+
+    if (interval == 0) {
+        interval = 1;
+    }
+
+    /* ns of offset per s of interval is ppb */
+    rate = (float)offset / interval;
+
+    d->integral = clamp(d->integral + d->ki * rate, d->freq_max);
+    d->freq = (int32_t)(d->integral + clamp(d->kp * rate, d->slew_max));
+
+    return NTP_CLOCK_ADJUST;
+}
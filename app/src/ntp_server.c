@@ -0,0 +1,282 @@
+#include <stdint.h>
+#include <string.h>
+#include "lwip/udp.h"
+#include "lwip/pbuf.h"
+#include "lwip/inet.h"
+#include "app.h"
+#include "cmsis_os.h"
+#include "ethernetif.h"
+#include "ptpd.h"
+#include "ntp_server.h"
+
+#define NTP_PRECISION       -25         /* 2^-25 s ~ 30 ns, PHC ticks at 20 ns */
+#define NTP_TX_LATENCY_MAX  1000000     /* ns, ignore hardware samples beyond this */
+#define NTP_CLIENTS         16          /* clients remembered for interleaved mode */
+
+/* Last exchange with a client, the hardware transmit time of the reply is
+ * sent in the next one when the client asks in interleaved mode */
+typedef struct ntp_client_entry {
+    uint32_t addr;
+    uint16_t port;
+    uint32_t last;              /* requests counter when last seen */
+    ntp_ts_t rx;                /* receive timestamp sent in the last reply */
+    ntp_ts_t tx;                /* hardware transmit time of the last reply, 0 until known */
+    int32_t utc_offset;         /* used for the last reply */
+} ntp_client_entry_t;
+
+typedef struct _ntps {
+    struct udp_pcb *pcb;
+    struct pbuf_custom reply;
+    uint8_t mem[LWIP_MEM_ALIGN_SIZE(PBUF_TRANSPORT) + NTP_PACKET_SIZE];
+    struct ptptime_t reply_tx;      /* software transmit time of the reply in flight */
+    ntp_client_entry_t *reply_client;
+    volatile int32_t tx_latency;    /* ns, average hardware minus software transmit time */
+    ntp_client_entry_t clients[NTP_CLIENTS];
+    uint32_t requests;
+    uint32_t replies;
+    uint32_t interleaved;
+    uint32_t busy;
+    uint32_t no_rx_ts;
+    uint32_t tx_ts;
+} ntps_t;
+
+static ntps_t ntps;
+
+static uint32_t ntp_short(uint32_t ns)
+{
+    return htonl((uint32_t)(((uint64_t)ns << 16) / 1000000000ULL));
+}
+
+static uint32_t ntp_abs(const TimeInternal *t)
+{
+    int64_t ns = (int64_t)t->seconds * 1000000000LL + t->nanoseconds;
+
+    if (ns < 0) ns = -ns;
+
+    return ns > 0xFFFFFFFFLL ? 0xFFFFFFFFUL : (uint32_t)ns;
+}
+
+// Stratum, reference and error bounds derived from the PTP state
+static void ntp_sync_state(ntp_packet_t *pkt, int32_t *utc_offset)
+{
+    SyncInfo info;
+    uint8_t class;
+    uint32_t dispersion;
+
+    ptpd_get_sync_info(&info);
+    class = info.grandmasterClockQuality.clockClass;
+
+    /* PHC on the PTP timescale runs on TAI */
+    *utc_offset = info.ptpTimescale ? info.currentUtcOffset : 0;
+
+    pkt->root_delay = 0;
+
+    if (info.portState == PTP_SLAVE) {
+        /* A primary grandmaster counts as stratum 1 */
+        pkt->stratum = info.stepsRemoved + (class < 128 ? 1 : 2);
+        if (pkt->stratum > 15) pkt->stratum = 15;
+        memcpy(&pkt->ref_id, "PTP", 4);
+        pkt->root_delay = ntp_short(2 * ntp_abs(&info.meanPathDelay));
+        dispersion = ntp_abs(&info.offsetFromMaster) + 1000;
+    } else if (info.portState == PTP_MASTER && class < 128) {
+        pkt->stratum = 1;
+        memcpy(&pkt->ref_id, info.timeSource == GPS ? "GPS" : "PTP", 4);
+        dispersion = class <= 6 ? 1000 : class == 7 ? 10000 : 1000000;
+    } else {
+        /* Free running, clients must not use us */
+        pkt->li_vn_mode |= NTP_LI_ALARM << 6;
+        pkt->stratum = NTP_STRATUM_UNSYNC;
+        memcpy(&pkt->ref_id, "INIT", 4);
+        dispersion = 1000000000UL;
+    }
+
+    if (info.ptpTimescale && !info.currentUtcOffsetValid) {
+        pkt->li_vn_mode |= NTP_LI_ALARM << 6;
+    }
+
+    pkt->root_dispersion = ntp_short(dispersion);
+}
+
+// Find the entry of a client, or take the least recently seen one
+static ntp_client_entry_t *ntp_client_find(uint32_t addr, uint16_t port)
+{
+    ntp_client_entry_t *c, *oldest = &ntps.clients[0];
+
+    for (c = ntps.clients; c < ntps.clients + NTP_CLIENTS; c++) {
+        if (c->addr == addr && c->port == port) {
+            return c;
+        }
+        if (ntps.requests - c->last > ntps.requests - oldest->last) {
+            oldest = c;
+        }
+    }
+
+    taskENTER_CRITICAL();
+    memset(oldest, 0, sizeof(*oldest));
+    oldest->addr = addr;
+    oldest->port = port;
+    taskEXIT_CRITICAL();
+
+    return oldest;
+}
+
+// Runs in whichever thread releases the reply buffer
+static void ntp_tx_timestamp(struct pbuf *p, const struct ptptime_t *timestamp)
+{
+    ntp_client_entry_t *c = ntps.reply_client;
+    int32_t latency;
+
+    if (p != &ntps.reply.pbuf) {
+        return;
+    }
+
+    if (c != NULL) {
+        taskENTER_CRITICAL();
+        c->tx = ntp_ts_from_phc(timestamp->tv_sec, timestamp->tv_nsec, c->utc_offset);
+        taskEXIT_CRITICAL();
+    }
+
+    latency = (timestamp->tv_sec - ntps.reply_tx.tv_sec) * 1000000000L + (timestamp->tv_nsec - ntps.reply_tx.tv_nsec);
+
+    if (latency > 0 && latency < NTP_TX_LATENCY_MAX) {
+        ntps.tx_latency += (latency - ntps.tx_latency) / 8;
+        ntps.tx_ts++;
+    }
+}
+
+// Callback for NTP requests, runs in the tcpip thread
+static void ntp_recv_cb(void *arg, struct udp_pcb *pcb, struct pbuf *p,
+                        const ip_addr_t *addr, u16_t port)
+{
+    struct pbuf *reply = &ntps.reply.pbuf;
+    struct ptptime_t rx, tx;
+    ntp_packet_t req, pkt;
+    ntp_client_entry_t *client;
+    ntp_ts_t rx_ts, prev_rx, prev_tx;
+    int32_t utc_offset;
+
+    ntps.requests++;
+
+    if (p->tot_len < NTP_PACKET_SIZE) {
+        pbuf_free(p);
+        return;
+    }
+
+    if (!ethernetif_get_rx_timestamp(p, &rx)) {
+        ethernetif_ptp_get_time(&rx);
+        ntps.no_rx_ts++;
+    }
+
+    pbuf_copy_partial(p, &req, NTP_PACKET_SIZE, 0);
+    pbuf_free(p);
+
+    if (NTP_MODE(req.li_vn_mode) != NTP_MODE_CLIENT) {
+        return;
+    }
+
+    /* Reply buffer still held by the driver from the previous reply */
+    if (reply->ref > 1) {
+        ethernetif_release_tx();
+        if (reply->ref > 1) {
+            ntps.busy++;
+            return;
+        }
+    }
+
+    memset(&pkt, 0, sizeof(pkt));
+    pkt.li_vn_mode = NTP_LI_VN_MODE(0, NTP_VN(req.li_vn_mode), NTP_MODE_SERVER);
+    pkt.poll = req.poll;
+    pkt.precision = NTP_PRECISION;
+    ntp_sync_state(&pkt, &utc_offset);
+
+    rx_ts = ntp_ts_from_phc(rx.tv_sec, rx.tv_nsec, utc_offset);
+    ntp_ts_set(pkt.rx_ts, rx_ts);
+    pkt.ref_ts[0] = pkt.rx_ts[0];
+
+    client = ntp_client_find(ip4_addr_get_u32(ip_2_ip4(addr)), port);
+
+    taskENTER_CRITICAL();
+    prev_rx = client->rx;
+    prev_tx = client->tx;
+    client->rx = rx_ts;
+    client->tx = 0;
+    client->utc_offset = utc_offset;
+    client->last = ntps.requests;
+    taskEXIT_CRITICAL();
+
+    /* Interleaved mode: the client echoes the receive timestamp of our last
+     * reply as origin, answer with that reply's hardware transmit time */
+    if (prev_rx != 0 && prev_tx != 0 && ntp_ts_get(req.orig_ts) == prev_rx &&
+        ntp_ts_get(req.orig_ts) != ntp_ts_get(req.tx_ts)) {
+        pkt.orig_ts[0] = req.rx_ts[0];
+        pkt.orig_ts[1] = req.rx_ts[1];
+        ntp_ts_set(pkt.tx_ts, prev_tx);
+        ethernetif_ptp_get_time(&ntps.reply_tx);
+        ntps.interleaved++;
+    } else {
+        pkt.orig_ts[0] = req.tx_ts[0];
+        pkt.orig_ts[1] = req.tx_ts[1];
+
+        ethernetif_ptp_get_time(&tx);
+        ntps.reply_tx = tx;
+
+        /* Basic mode, account for the time to reach the wire learned from
+         * hardware timestamps of earlier replies */
+        tx.tv_nsec += ntps.tx_latency;
+        if (tx.tv_nsec >= 1000000000L) {
+            tx.tv_nsec -= 1000000000L;
+            tx.tv_sec++;
+        }
+        ntp_ts_set(pkt.tx_ts, ntp_ts_from_phc(tx.tv_sec, tx.tv_nsec, utc_offset));
+    }
+
+    memcpy(reply->payload, &pkt, NTP_PACKET_SIZE);
+    ntps.reply_client = client;
+
+    if (udp_sendto(pcb, reply, addr, port) == ERR_OK) {
+        ntps.replies++;
+    }
+
+    /* Restore the payload past the headers lwIP prepended */
+    pbuf_remove_header(reply, reply->len - NTP_PACKET_SIZE);
+}
+
+/* Reply storage is static, nothing to give back */
+static void ntp_reply_free(struct pbuf *p)
+{
+}
+
+// Public: NTP server initialization
+osStatus ntp_server_init(void)
+{
+    ntps.reply.custom_free_function = ntp_reply_free;
+    pbuf_alloced_custom(PBUF_TRANSPORT, NTP_PACKET_SIZE, PBUF_RAM, &ntps.reply, ntps.mem, sizeof(ntps.mem));
+
+    ntps.pcb = udp_new();
+    if (ntps.pcb == NULL) {
+        printf("Failed to create NTP PCB\n");
+        return osErrorOS;
+    }
+
+    if (udp_bind(ntps.pcb, IP_ADDR_ANY, NTP_PORT) != ERR_OK) {
+        printf("Failed to bind NTP PCB\n");
+        udp_remove(ntps.pcb);
+        ntps.pcb = NULL;
+        return osErrorOS;
+    }
+
+    ethernetif_add_tx_timestamp_cb(ntp_tx_timestamp);
+    udp_recv(ntps.pcb, ntp_recv_cb, NULL);
+
+    printf("NTP Server: Listening on port %d\n", NTP_PORT);
+    return osOK;
+}
+
+void ntp_server_stats(void)
+{
+    LOG_PRINT("\trequests: %lu, replies: %lu, interleaved: %lu, busy: %lu",
+              (unsigned long)ntps.requests, (unsigned long)ntps.replies,
+              (unsigned long)ntps.interleaved, (unsigned long)ntps.busy);
+    LOG_PRINT("\tsoftware rx timestamps: %lu", (unsigned long)ntps.no_rx_ts);
+    LOG_PRINT("\ttx latency: %ld ns (%lu hw samples)", (long)ntps.tx_latency, (unsigned long)ntps.tx_ts);
+}
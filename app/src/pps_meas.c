@@ -0,0 +1,131 @@
+#include <stdint.h>
+#include "app.h"
+#include "cmsis_os.h"
+#include "queue.h"
+#include "ethernetif.h"
+#include "pps_capture.h"
+#include "pps_stats.h"
+#include "pps_meas.h"
+
+#define PPS_MEAS_QUEUE_SIZE 4
+
+typedef struct _pps_meas {
+    QueueHandle_t queue;
+    osThreadId threadid;
+    pps_stats_t stats;
+    uint32_t overruns;
+    uint8_t stream;
+} pps_meas_t;
+
+static pps_meas_t meas;
+
+static void pps_meas_cb(uint8_t input, const pps_edge_t *edge)
+{
+    BaseType_t woken = pdFALSE;
+
+    if (xQueueSendFromISR(meas.queue, edge, &woken) != pdTRUE) {
+        meas.overruns++;
+    }
+
+    portYIELD_FROM_ISR(woken);
+}
+
+static void pps_meas_thread(const void *arg)
+{
+    pps_edge_t edge;
+
+    for (;;) {
+        if (xQueueReceive(meas.queue, &edge, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+
+        taskENTER_CRITICAL();
+        pps_stats_add(&meas.stats, edge.offset);
+        taskEXIT_CRITICAL();
+
+        if (meas.stream) {
+            LOG_PRINT("pps: %lu %ld ns", (unsigned long)edge.sec, (long)edge.offset);
+        }
+    }
+}
+
+// Public: start DUT PPS measurement
+osStatus pps_meas_start(void)
+{
+    if (meas.threadid != NULL) {
+        return osOK;
+    }
+
+    if (meas.queue == NULL) {
+        meas.queue = xQueueCreate(PPS_MEAS_QUEUE_SIZE, sizeof(pps_edge_t));
+
+        if (meas.queue == NULL) {
+            LOG_ERR("PPS: failed to create queue");
+            return osErrorOS;
+        }
+    }
+
+    pps_meas_reset();
+
+    osThreadDef(PPSM, pps_meas_thread, osPriorityNormal, 0, configMINIMAL_STACK_SIZE * 2);
+    meas.threadid = osThreadCreate(osThread(PPSM), NULL);
+
+    if (meas.threadid == NULL) {
+        LOG_ERR("PPS: failed to create task");
+        return osErrorOS;
+    }
+
+    /* PHC PPS at 1 Hz is the capture reference */
+    ethernetif_ptp_set_pps_output(0);
+    pps_capture_init();
+    pps_capture_set_callback(PPS_INPUT_DUT, pps_meas_cb);
+
+    LOG_INF("PPS: measuring");
+    return osOK;
+}
+
+void pps_meas_stop(void)
+{
+    if (meas.threadid == NULL) {
+        return;
+    }
+
+    pps_capture_set_callback(PPS_INPUT_DUT, NULL);
+    osThreadTerminate(meas.threadid);
+    meas.threadid = NULL;
+    xQueueReset(meas.queue);
+}
+
+void pps_meas_stream(uint8_t enable)
+{
+    meas.stream = enable;
+}
+
+void pps_meas_reset(void)
+{
+    taskENTER_CRITICAL();
+    pps_stats_reset(&meas.stats);
+    meas.overruns = 0;
+    taskEXIT_CRITICAL();
+}
+
+void pps_meas_stats(void)
+{
+    pps_stats_t stats;
+
+    taskENTER_CRITICAL();
+    stats = meas.stats;
+    taskEXIT_CRITICAL();
+
+    LOG_PRINT("\tsamples: %lu%s", (unsigned long)stats.count, meas.threadid ? "" : " (stopped)");
+
+    if (stats.count == 0) {
+        return;
+    }
+
+    LOG_PRINT("\tlast: %ld ns", (long)stats.last);
+    LOG_PRINT("\tmean: %ld ns", (long)stats.mean);
+    LOG_PRINT("\tstddev: %lu ns", (unsigned long)pps_stats_stddev(&stats));
+    LOG_PRINT("\tmin: %ld ns, max: %ld ns", (long)stats.min, (long)stats.max);
+    LOG_PRINT("\toverruns: %lu", (unsigned long)meas.overruns);
+}
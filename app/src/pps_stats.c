@@ -0,0 +1,59 @@
+#include <stdint.h>
+#include "pps_stats.h"
+
+// Integer square root, avoids pulling libm in
+static uint32_t isqrt(uint64_t v)
+{
+    uint64_t res = 0;
+    uint64_t bit = 1ULL << 62;
+
+    while (bit > v) {
+        bit >>= 2;
+    }
+
+    while (bit) {
+        if (v >= res + bit) {
+            v -= res + bit;
+            res = (res >> 1) + bit;
+        } else {
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return (uint32_t)res;
+}
+
+void pps_stats_reset(pps_stats_t *stats)
+{
+    stats->count = 0;
+    stats->last = 0;
+    stats->min = INT32_MAX;
+    stats->max = INT32_MIN;
+    stats->mean = 0;
+    stats->m2 = 0;
+}
+
+void pps_stats_add(pps_stats_t *stats, int32_t offset)
+{
+    double delta;
+
+    stats->count++;
+    stats->last = offset;
+
+    if (offset < stats->min) stats->min = offset;
+    if (offset > stats->max) stats->max = offset;
+
+    delta = offset - stats->mean;
+    stats->mean += delta / stats->count;
+    stats->m2 += delta * (offset - stats->mean);
+}
+
+uint32_t pps_stats_stddev(const pps_stats_t *stats)
+{
+    if (stats->count < 2) {
+        return 0;
+    }
+
+    return isqrt((uint64_t)(stats->m2 / (stats->count - 1)));
+}
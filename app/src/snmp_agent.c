@@ -0,0 +1,284 @@
+#include <stdint.h>
+#include <string.h>
+#include "lwip/sys.h"
+#include "lwip/apps/snmp.h"
+#include "lwip/apps/snmp_core.h"
+#include "lwip/apps/snmp_mib2.h"
+#include "lwip/apps/snmp_scalar.h"
+#include "app.h"
+#include "cmsis_os.h"
+#include "ptpd.h"
+#include "snmp_agent.h"
+
+#if LWIP_SNMP /* enabled by ENABLE_SNMP in lwipopts.h */
+
+typedef struct _snmpa {
+    PtpDataSets ds;
+    PtpCounters counters;
+    uint32_t time;              /* ms, sys_now() of the snapshot */
+    uint8_t valid;
+    uint32_t snapshots;
+} snmpa_t;
+
+static snmpa_t snmpa;
+
+// Take a new snapshot when the cached one is too old for this request
+static void snmp_agent_refresh(void)
+{
+    uint32_t now = sys_now();
+
+    if (snmpa.valid && (now - snmpa.time) < SNMP_AGENT_SNAPSHOT_MS) {
+        return;
+    }
+
+    /* Nested, so data sets and counters come from the same instant */
+    taskENTER_CRITICAL();
+    ptpd_get_datasets(&snmpa.ds);
+    ptpd_get_counters(&snmpa.counters);
+    taskEXIT_CRITICAL();
+
+    snmpa.time = now;
+    snmpa.valid = 1;
+    snmpa.snapshots++;
+}
+
+static s32_t snmp_ns(const TimeInternal *t)
+{
+    int64_t ns = (int64_t)t->seconds * 1000000000LL + t->nanoseconds;
+
+    if (ns > INT32_MAX) return INT32_MAX;
+    if (ns < INT32_MIN) return INT32_MIN;
+
+    return (s32_t)ns;
+}
+
+static s16_t snmp_octets(void *value, const void *src, uint8_t len)
+{
+    memcpy(value, src, len);
+    return len;
+}
+
+static s16_t snmp_integer(void *value, s32_t n)
+{
+    *(s32_t *)value = n;
+    return sizeof(s32_t);
+}
+
+static s16_t snmp_unsigned(void *value, u32_t n)
+{
+    *(u32_t *)value = n;
+    return sizeof(u32_t);
+}
+
+/* ptpDefaultDS */
+static const struct snmp_scalar_array_node_def default_nodes[] = {
+    { 1, SNMP_ASN1_TYPE_OCTET_STRING, SNMP_NODE_INSTANCE_READ_ONLY },   /* clockIdentity */
+    { 2, SNMP_ASN1_TYPE_INTEGER, SNMP_NODE_INSTANCE_READ_ONLY },        /* twoStepFlag */
+    { 3, SNMP_ASN1_TYPE_INTEGER, SNMP_NODE_INSTANCE_READ_ONLY },        /* slaveOnly */
+    { 4, SNMP_ASN1_TYPE_UNSIGNED32, SNMP_NODE_INSTANCE_READ_ONLY },     /* priority1 */
+    { 5, SNMP_ASN1_TYPE_UNSIGNED32, SNMP_NODE_INSTANCE_READ_ONLY },     /* priority2 */
+    { 6, SNMP_ASN1_TYPE_UNSIGNED32, SNMP_NODE_INSTANCE_READ_ONLY },     /* domainNumber */
+    { 7, SNMP_ASN1_TYPE_UNSIGNED32, SNMP_NODE_INSTANCE_READ_ONLY },     /* clockClass */
+    { 8, SNMP_ASN1_TYPE_UNSIGNED32, SNMP_NODE_INSTANCE_READ_ONLY },     /* clockAccuracy */
+    { 9, SNMP_ASN1_TYPE_INTEGER, SNMP_NODE_INSTANCE_READ_ONLY },        /* offsetScaledLogVariance */
+};
+
+static s16_t default_get_value(const struct snmp_scalar_array_node_def *node, void *value)
+{
+    const DefaultDS *ds = &snmpa.ds.defaultDS;
+
+    snmp_agent_refresh();
+
+    switch (node->oid) {
+        case 1: return snmp_octets(value, ds->clockIdentity, CLOCK_IDENTITY_LENGTH);
+        case 2: return snmp_integer(value, ds->twoStepFlag);
+        case 3: return snmp_integer(value, ds->slaveOnly);
+        case 4: return snmp_unsigned(value, ds->priority1);
+        case 5: return snmp_unsigned(value, ds->priority2);
+        case 6: return snmp_unsigned(value, ds->domainNumber);
+        case 7: return snmp_unsigned(value, ds->clockQuality.clockClass);
+        case 8: return snmp_unsigned(value, ds->clockQuality.clockAccuracy);
+        case 9: return snmp_integer(value, ds->clockQuality.offsetScaledLogVariance);
+        default: return 0;
+    }
+}
+
+/* ptpCurrentDS */
+static const struct snmp_scalar_array_node_def current_nodes[] = {
+    { 1, SNMP_ASN1_TYPE_UNSIGNED32, SNMP_NODE_INSTANCE_READ_ONLY },     /* stepsRemoved */
+    { 2, SNMP_ASN1_TYPE_INTEGER, SNMP_NODE_INSTANCE_READ_ONLY },        /* offsetFromMaster, ns */
+    { 3, SNMP_ASN1_TYPE_INTEGER, SNMP_NODE_INSTANCE_READ_ONLY },        /* meanPathDelay, ns */
+};
+
+static s16_t current_get_value(const struct snmp_scalar_array_node_def *node, void *value)
+{
+    snmp_agent_refresh();
+
+    switch (node->oid) {
+        case 1: return snmp_unsigned(value, (u16_t)snmpa.ds.currentDS.stepsRemoved);
+        case 2: return snmp_integer(value, snmpa.counters.offsetFromMaster);
+        case 3: return snmp_integer(value, snmpa.counters.meanPathDelay);
+        default: return 0;
+    }
+}
+
+/* ptpParentDS */
+static const struct snmp_scalar_array_node_def parent_nodes[] = {
+    { 1, SNMP_ASN1_TYPE_OCTET_STRING, SNMP_NODE_INSTANCE_READ_ONLY },   /* parent clockIdentity */
+    { 2, SNMP_ASN1_TYPE_UNSIGNED32, SNMP_NODE_INSTANCE_READ_ONLY },     /* parent portNumber */
+    { 3, SNMP_ASN1_TYPE_OCTET_STRING, SNMP_NODE_INSTANCE_READ_ONLY },   /* grandmasterIdentity */
+    { 4, SNMP_ASN1_TYPE_UNSIGNED32, SNMP_NODE_INSTANCE_READ_ONLY },     /* grandmasterPriority1 */
+    { 5, SNMP_ASN1_TYPE_UNSIGNED32, SNMP_NODE_INSTANCE_READ_ONLY },     /* grandmasterPriority2 */
+    { 6, SNMP_ASN1_TYPE_UNSIGNED32, SNMP_NODE_INSTANCE_READ_ONLY },     /* grandmaster clockClass */
+    { 7, SNMP_ASN1_TYPE_UNSIGNED32, SNMP_NODE_INSTANCE_READ_ONLY },     /* grandmaster clockAccuracy */
+    { 8, SNMP_ASN1_TYPE_INTEGER, SNMP_NODE_INSTANCE_READ_ONLY },        /* grandmaster offsetScaledLogVariance */
+};
+
+static s16_t parent_get_value(const struct snmp_scalar_array_node_def *node, void *value)
+{
+    const ParentDS *ds = &snmpa.ds.parentDS;
+
+    snmp_agent_refresh();
+
+    switch (node->oid) {
+        case 1: return snmp_octets(value, ds->parentPortIdentity.clockIdentity, CLOCK_IDENTITY_LENGTH);
+        case 2: return snmp_unsigned(value, (u16_t)ds->parentPortIdentity.portNumber);
+        case 3: return snmp_octets(value, ds->grandmasterIdentity, CLOCK_IDENTITY_LENGTH);
+        case 4: return snmp_unsigned(value, ds->grandmasterPriority1);
+        case 5: return snmp_unsigned(value, ds->grandmasterPriority2);
+        case 6: return snmp_unsigned(value, ds->grandmasterClockQuality.clockClass);
+        case 7: return snmp_unsigned(value, ds->grandmasterClockQuality.clockAccuracy);
+        case 8: return snmp_integer(value, ds->grandmasterClockQuality.offsetScaledLogVariance);
+        default: return 0;
+    }
+}
+
+/* ptpPortDS */
+static const struct snmp_scalar_array_node_def port_nodes[] = {
+    { 1, SNMP_ASN1_TYPE_INTEGER, SNMP_NODE_INSTANCE_READ_ONLY },        /* portState */
+    { 2, SNMP_ASN1_TYPE_INTEGER, SNMP_NODE_INSTANCE_READ_ONLY },        /* logSyncInterval */
+    { 3, SNMP_ASN1_TYPE_INTEGER, SNMP_NODE_INSTANCE_READ_ONLY },        /* logAnnounceInterval */
+    { 4, SNMP_ASN1_TYPE_INTEGER, SNMP_NODE_INSTANCE_READ_ONLY },        /* logMinDelayReqInterval */
+    { 5, SNMP_ASN1_TYPE_INTEGER, SNMP_NODE_INSTANCE_READ_ONLY },        /* delayMechanism */
+    { 6, SNMP_ASN1_TYPE_INTEGER, SNMP_NODE_INSTANCE_READ_ONLY },        /* peerMeanPathDelay, ns */
+};
+
+static s16_t port_get_value(const struct snmp_scalar_array_node_def *node, void *value)
+{
+    const PortDS *ds = &snmpa.ds.portDS;
+
+    snmp_agent_refresh();
+
+    switch (node->oid) {
+        case 1: return snmp_integer(value, ds->portState);
+        case 2: return snmp_integer(value, ds->logSyncInterval);
+        case 3: return snmp_integer(value, ds->logAnnounceInterval);
+        case 4: return snmp_integer(value, ds->logMinDelayReqInterval);
+        case 5: return snmp_integer(value, ds->delayMechanism);
+        case 6: return snmp_integer(value, snmp_ns(&ds->peerMeanPathDelay));
+        default: return 0;
+    }
+}
+
+/* ptpServo */
+static const struct snmp_scalar_array_node_def servo_nodes[] = {
+    { 1, SNMP_ASN1_TYPE_INTEGER, SNMP_NODE_INSTANCE_READ_ONLY },        /* observedDrift, ppb */
+    { 2, SNMP_ASN1_TYPE_COUNTER32, SNMP_NODE_INSTANCE_READ_ONLY },      /* servo updates */
+    { 3, SNMP_ASN1_TYPE_COUNTER32, SNMP_NODE_INSTANCE_READ_ONLY },      /* clock steps */
+    { 4, SNMP_ASN1_TYPE_COUNTER32, SNMP_NODE_INSTANCE_READ_ONLY },      /* port state changes */
+    { 5, SNMP_ASN1_TYPE_COUNTER32, SNMP_NODE_INSTANCE_READ_ONLY },      /* standby master switches */
+};
+
+static s16_t servo_get_value(const struct snmp_scalar_array_node_def *node, void *value)
+{
+    const PtpCounters *c = &snmpa.counters;
+
+    snmp_agent_refresh();
+
+    switch (node->oid) {
+        case 1: return snmp_integer(value, c->observedDrift);
+        case 2: return snmp_unsigned(value, c->servoUpdates);
+        case 3: return snmp_unsigned(value, c->clockSteps);
+        case 4: return snmp_unsigned(value, c->stateChanges);
+        case 5: return snmp_unsigned(value, c->standbySwitches);
+        default: return 0;
+    }
+}
+
+/* ptpErrors, 6 and up are the receive filter drops in RX_DROP_* order */
+static const struct snmp_scalar_array_node_def error_nodes[] = {
+    { 1, SNMP_ASN1_TYPE_COUNTER32, SNMP_NODE_INSTANCE_READ_ONLY },      /* sync sequence gaps */
+    { 2, SNMP_ASN1_TYPE_COUNTER32, SNMP_NODE_INSTANCE_READ_ONLY },      /* missed Follow_Ups */
+    { 3, SNMP_ASN1_TYPE_COUNTER32, SNMP_NODE_INSTANCE_READ_ONLY },      /* orphan Follow_Ups */
+    { 4, SNMP_ASN1_TYPE_COUNTER32, SNMP_NODE_INSTANCE_READ_ONLY },      /* late Delay_Resps */
+    { 5, SNMP_ASN1_TYPE_COUNTER32, SNMP_NODE_INSTANCE_READ_ONLY },      /* expired Delay_Reqs */
+    { 6, SNMP_ASN1_TYPE_COUNTER32, SNMP_NODE_INSTANCE_READ_ONLY },      /* short messages */
+    { 7, SNMP_ASN1_TYPE_COUNTER32, SNMP_NODE_INSTANCE_READ_ONLY },      /* other domain */
+    { 8, SNMP_ASN1_TYPE_COUNTER32, SNMP_NODE_INSTANCE_READ_ONLY },      /* master not acceptable */
+    { 9, SNMP_ASN1_TYPE_COUNTER32, SNMP_NODE_INSTANCE_READ_ONLY },      /* rate limited */
+    { 10, SNMP_ASN1_TYPE_COUNTER32, SNMP_NODE_INSTANCE_READ_ONLY },     /* receive queue full */
+};
+
+static s16_t error_get_value(const struct snmp_scalar_array_node_def *node, void *value)
+{
+    const PtpCounters *c = &snmpa.counters;
+
+    snmp_agent_refresh();
+
+    switch (node->oid) {
+        case 1: return snmp_unsigned(value, c->syncSequenceGaps);
+        case 2: return snmp_unsigned(value, c->orphanSyncs);
+        case 3: return snmp_unsigned(value, c->orphanFollowUps);
+        case 4: return snmp_unsigned(value, c->lateDelayResps);
+        case 5: return snmp_unsigned(value, c->expiredDelayReqs);
+        default:
+            if (node->oid >= 6 && node->oid < 6 + RX_DROP_COUNT) {
+                return snmp_unsigned(value, c->rxDropped[node->oid - 6]);
+            }
+            return 0;
+    }
+}
+
+static const struct snmp_scalar_array_node default_node = SNMP_SCALAR_CREATE_ARRAY_NODE(1, default_nodes, default_get_value, NULL, NULL);
+static const struct snmp_scalar_array_node current_node = SNMP_SCALAR_CREATE_ARRAY_NODE(2, current_nodes, current_get_value, NULL, NULL);
+static const struct snmp_scalar_array_node parent_node = SNMP_SCALAR_CREATE_ARRAY_NODE(3, parent_nodes, parent_get_value, NULL, NULL);
+static const struct snmp_scalar_array_node port_node = SNMP_SCALAR_CREATE_ARRAY_NODE(4, port_nodes, port_get_value, NULL, NULL);
+static const struct snmp_scalar_array_node servo_node = SNMP_SCALAR_CREATE_ARRAY_NODE(5, servo_nodes, servo_get_value, NULL, NULL);
+static const struct snmp_scalar_array_node error_node = SNMP_SCALAR_CREATE_ARRAY_NODE(6, error_nodes, error_get_value, NULL, NULL);
+
+static const struct snmp_node *const ptp_nodes[] = {
+    &default_node.node.node,
+    &current_node.node.node,
+    &parent_node.node.node,
+    &port_node.node.node,
+    &servo_node.node.node,
+    &error_node.node.node,
+};
+
+static const struct snmp_tree_node ptp_root = SNMP_CREATE_TREE_NODE(0, ptp_nodes);
+
+static const u32_t ptp_base_oid[] = SNMP_AGENT_PTP_OID;
+static const struct snmp_mib ptp_mib = SNMP_MIB_CREATE(ptp_base_oid, &ptp_root.node);
+
+static const struct snmp_mib *mibs[] = { &mib2, &ptp_mib };
+
+void snmp_agent_init(void)
+{
+    snmp_set_mibs(mibs, LWIP_ARRAYSIZE(mibs));
+    snmp_init();
+
+    LOG_PRINT("SNMP agent started");
+}
+
+void snmp_agent_stats(void)
+{
+    LOG_PRINT("\trequests: %lu, get: %lu, getnext: %lu, set: %lu",
+              (unsigned long)snmp_stats.inpkts, (unsigned long)snmp_stats.ingetrequests,
+              (unsigned long)snmp_stats.ingetnexts, (unsigned long)snmp_stats.insetrequests);
+    LOG_PRINT("\tbad community: %lu, parse errors: %lu, responses: %lu",
+              (unsigned long)snmp_stats.inbadcommunitynames, (unsigned long)snmp_stats.inasnparseerrs,
+              (unsigned long)snmp_stats.outgetresponses);
+    LOG_PRINT("\tsnapshots: %lu", (unsigned long)snmpa.snapshots);
+}
+
+#endif /* LWIP_SNMP */
@@ -0,0 +1,166 @@
+#include <stdint.h>
+#include "app.h"
+#include "cmsis_os.h"
+#include "ethernetif.h"
+#include "temp_sensor.h"
+#include "time_source.h"
+#include "temp_comp.h"
+
+typedef struct _tcomp {
+    osThreadId threadid;
+    temp_model_t model;
+    float temp;                 /* degC, filtered */
+    float temp_sum;
+    float freq_sum;
+    uint8_t count;              /* readings in the sums */
+    int32_t bias;               /* ppb, applied */
+    uint8_t reset;
+    uint8_t trace;
+    uint32_t skipped;           /* samples taken while unlocked */
+} tcomp_t;
+
+static tcomp_t tcomp;
+
+// Accumulate one reading, feed the model every TEMP_COMP_AVERAGE locked readings
+static void temp_comp_learn(void)
+{
+    float temp, freq;
+
+    if (!time_source_locked()) {
+        if (tcomp.count != 0) {
+            tcomp.skipped++;
+        }
+        tcomp.count = 0;
+        tcomp.temp_sum = 0;
+        tcomp.freq_sum = 0;
+        return;
+    }
+
+    tcomp.temp_sum += tcomp.temp;
+    tcomp.freq_sum += ethernetif_ptp_get_freq();
+
+    if (++tcomp.count < TEMP_COMP_AVERAGE) {
+        return;
+    }
+
+    temp = tcomp.temp_sum / tcomp.count;
+    freq = tcomp.freq_sum / tcomp.count;
+    tcomp.count = 0;
+    tcomp.temp_sum = 0;
+    tcomp.freq_sum = 0;
+
+    temp_model_add(&tcomp.model, temp, freq);
+
+    if (tcomp.trace) {
+        LOG_PRINT("tcomp,%lu,%ld,%ld", (unsigned long)(osKernelSysTick() / 1000),
+                  (long)(temp * 1000), (long)freq);
+    }
+}
+
+static void temp_comp_thread(const void *arg)
+{
+    uint32_t start = osKernelSysTick();
+    int32_t wait;
+    float bias;
+
+    tcomp.temp = temp_sensor_read() / 1000.0f;
+
+    for (;;) {
+        if (tcomp.reset) {
+            tcomp.reset = 0;
+            tcomp.count = 0;
+            temp_model_init(&tcomp.model);
+        }
+
+        tcomp.temp += (temp_sensor_read() / 1000.0f - tcomp.temp) / TEMP_COMP_FILTER;
+
+        temp_comp_learn();
+
+        bias = temp_model_bias(&tcomp.model, tcomp.temp);
+        if (bias > TEMP_COMP_MAX_BIAS) {
+            bias = TEMP_COMP_MAX_BIAS;
+        } else if (bias < -TEMP_COMP_MAX_BIAS) {
+            bias = -TEMP_COMP_MAX_BIAS;
+        }
+
+        if ((int32_t)bias != tcomp.bias) {
+            tcomp.bias = (int32_t)bias;
+            ethernetif_ptp_set_freq_bias(tcomp.bias);
+        }
+
+        start += TEMP_COMP_PERIOD;
+        wait = (int32_t)(start - osKernelSysTick());
+        if (wait > 0) {
+            osDelay(wait);
+        } else {
+            start = osKernelSysTick();
+        }
+    }
+}
+
+// Public: start the compensation thread
+osStatus temp_comp_start(void)
+{
+    if (tcomp.threadid != NULL) {
+        return osOK;
+    }
+
+    temp_sensor_init();
+
+    if (tcomp.model.forget == 0) {
+        temp_model_init(&tcomp.model);
+    }
+
+    osThreadDef(TCMP, temp_comp_thread, osPriorityBelowNormal, 0, configMINIMAL_STACK_SIZE * 2);
+    tcomp.threadid = osThreadCreate(osThread(TCMP), NULL);
+
+    if (tcomp.threadid == NULL) {
+        LOG_ERR("TCOMP: failed to create task");
+        return osErrorOS;
+    }
+
+    LOG_INF("TCOMP: started");
+    return osOK;
+}
+
+void temp_comp_stop(void)
+{
+    if (tcomp.threadid == NULL) {
+        return;
+    }
+
+    osThreadTerminate(tcomp.threadid);
+    tcomp.threadid = NULL;
+    tcomp.count = 0;
+    tcomp.temp_sum = 0;
+    tcomp.freq_sum = 0;
+    tcomp.bias = 0;
+    ethernetif_ptp_set_freq_bias(0);
+}
+
+void temp_comp_reset(void)
+{
+    if (tcomp.threadid != NULL) {
+        /* Applied by the thread between model updates */
+        tcomp.reset = 1;
+    } else {
+        temp_model_init(&tcomp.model);
+    }
+}
+
+void temp_comp_trace(uint8_t enable)
+{
+    tcomp.trace = enable;
+}
+
+void temp_comp_stats(void)
+{
+    const temp_model_t *m = &tcomp.model;
+
+    LOG_PRINT("\t%s, temperature %ld mdegC, bias %ld ppb", tcomp.threadid ? "running" : "stopped",
+              (long)(tcomp.temp * 1000), (long)tcomp.bias);
+    LOG_PRINT("\tmodel %s, %lu samples, slope %ld ppb/K, ref %ld mdegC, spread %ld mdegC",
+              m->valid ? "valid" : "learning", (unsigned long)m->samples, (long)m->slope,
+              (long)(m->ref * 1000), (long)(m->spread * 1000));
+    LOG_PRINT("\tunlocked periods: %lu", (unsigned long)tcomp.skipped);
+}
@@ -0,0 +1,73 @@
+#include <stdint.h>
+#include "temp_model.h"
+
+void temp_model_init(temp_model_t *m)
+{
+    m->forget = 1.0f - 1.0f / TEMP_MODEL_MEMORY;
+    m->min_spread = TEMP_MODEL_MIN_SPREAD;
+    m->slope_max = TEMP_MODEL_SLOPE_MAX;
+    m->min_samples = TEMP_MODEL_MIN_SAMPLES;
+
+    m->w = 0;
+    m->sx = m->sy = 0;
+    m->sxx = m->sxy = 0;
+    m->y0 = 0;
+    m->samples = 0;
+
+    m->ref = 0;
+    m->slope = 0;
+    m->spread = 0;
+    m->valid = 0;
+}
+
+void temp_model_add(temp_model_t *m, float temp, float freq)
+{
+    float x, y, mx, my, var, cov, slope;
+
+    /* Centring keeps the sums well conditioned in single precision */
+    if (m->samples == 0) {
+        m->ref = temp;
+        m->y0 = freq;
+    }
+
+    x = temp - m->ref;
+    y = freq - m->y0;
+
+    m->w = m->w * m->forget + 1.0f;
+    m->sx = m->sx * m->forget + x;
+    m->sy = m->sy * m->forget + y;
+    m->sxx = m->sxx * m->forget + x * x;
+    m->sxy = m->sxy * m->forget + x * y;
+    m->samples++;
+
+    mx = m->sx / m->w;
+    my = m->sy / m->w;
+    var = m->sxx / m->w - mx * mx;
+    cov = m->sxy / m->w - mx * my;
+
+    m->spread = var > 0 ? __builtin_sqrtf(var) : 0;
+
+    /* A slope needs the temperature to have moved */
+    if (m->samples < m->min_samples || m->spread < m->min_spread) {
+        return;
+    }
+
+    slope = cov / var;
+
+    if (slope > m->slope_max || slope < -m->slope_max) {
+        m->valid = 0;
+        return;
+    }
+
+    m->slope = slope;
+    m->valid = 1;
+}
+
+float temp_model_bias(const temp_model_t *m, float temp)
+{
+    if (!m->valid) {
+        return 0;
+    }
+
+    return m->slope * (temp - m->ref);
+}
@@ -0,0 +1,269 @@
+#include <stdint.h>
+#include <string.h>
+#include "app.h"
+#include "cmsis_os.h"
+#include "ptpd.h"
+#include "time_source.h"
+
+typedef struct _tsrc {
+    time_source_status_t status[TIME_SOURCE_COUNT];
+    uint8_t selected;           /* best reported source, TIME_SOURCE_FREE_RUN if none */
+    uint8_t published;          /* source whose quality is announced */
+    TimeSource quality;         /* last announced */
+    uint32_t switches;
+} tsrc_t;
+
+static tsrc_t tsrc = {
+    .selected = TIME_SOURCE_FREE_RUN,
+    .published = TIME_SOURCE_FREE_RUN,
+};
+
+/* clockAccuracy 0x20..0x2F bounds, ns (Table 6) */
+static const uint32_t accuracy_limits[] = {
+    25, 100, 250, 1000, 2500, 10000, 25000, 100000, 250000,
+    1000000, 2500000, 10000000, 25000000, 100000000, 250000000, 1000000000
+};
+
+uint8_t time_source_accuracy(uint32_t error)
+{
+    uint8_t i;
+
+    for (i = 0; i < sizeof(accuracy_limits) / sizeof(accuracy_limits[0]); i++) {
+        if (error <= accuracy_limits[i]) {
+            return 0x20 + i;
+        }
+    }
+
+    return 0x30;    /* within 10 s, uint32_t ns cannot exceed it */
+}
+
+uint16_t time_source_variance(uint32_t jitter)
+{
+    uint32_t msb, log2;
+    int32_t v;
+
+    if (jitter == 0) {
+        jitter = 1;
+    }
+
+    /* log2 with 8 fractional bits, mantissa linearly interpolated */
+    msb = 31 - __builtin_clz(jitter);
+    log2 = (msb << 8) | (((uint64_t)jitter << (32 - msb)) >> 24 & 0xFF);
+
+    /* 0x8000 + 256 * log2(variance in s^2), variance = (jitter * 1e-9)^2 */
+    v = 0x8000 - 15307 + 2 * (int32_t)log2;
+
+    return v < 0 ? 0 : v > 0xFFFF ? 0xFFFF : (uint16_t)v;
+}
+
+const char *time_source_name(uint8_t id)
+{
+    switch (id) {
+        case TIME_SOURCE_GNSS:      return "gnss";
+        case TIME_SOURCE_NTP:       return "ntp";
+        case TIME_SOURCE_PTP:       return "ptp";
+        case TIME_SOURCE_FREE_RUN:  return "free run";
+        default:                    return "?";
+    }
+}
+
+static const char *time_source_state_name(uint8_t state)
+{
+    switch (state) {
+        case TIME_SOURCE_NONE:      return "none";
+        case TIME_SOURCE_ACQUIRING: return "acquiring";
+        case TIME_SOURCE_LOCKED:    return "locked";
+        case TIME_SOURCE_HOLDOVER:  return "holdover";
+        default:                    return "?";
+    }
+}
+
+// Returns 1 if a ranks before b
+static int time_source_better(const time_source_status_t *a, const time_source_status_t *b)
+{
+    if (a->clock_class != b->clock_class) {
+        return a->clock_class < b->clock_class;
+    }
+
+    return a->error < b->error;
+}
+
+static uint8_t time_source_select(void)
+{
+    uint8_t best = TIME_SOURCE_FREE_RUN;
+    uint8_t i;
+
+    for (i = 0; i < TIME_SOURCE_COUNT; i++) {
+        if (tsrc.status[i].state == TIME_SOURCE_NONE) {
+            continue;
+        }
+
+        if (best == TIME_SOURCE_FREE_RUN || time_source_better(&tsrc.status[i], &tsrc.status[best])) {
+            best = i;
+        }
+    }
+
+    return best;
+}
+
+// Clock quality and time properties announced for a source
+static void time_source_quality(uint8_t id, TimeSource *ts)
+{
+    const time_source_status_t *st;
+    bool traceable;
+
+    memset(ts, 0, sizeof(TimeSource));
+    ts->clockQuality.clockClass = DEFAULT_CLOCK_CLASS;
+    ts->clockQuality.clockAccuracy = DEFAULT_CLOCK_ACCURACY;
+    ts->clockQuality.offsetScaledLogVariance = DEFAULT_CLOCK_VARIANCE;
+    ts->currentUtcOffset = DEFAULT_UTC_OFFSET;
+    ts->currentUtcOffsetValid = DEFAULT_UTC_VALID;
+    ts->timeTraceable = DEFAULT_TIME_TRACEABLE;
+    ts->frequencyTraceable = DEFAULT_FREQUENCY_TRACEABLE;
+    ts->ptpTimescale = (bool)(DEFAULT_TIMESCALE == PTP_TIMESCALE);
+    ts->timeSource = DEFAULT_TIME_SOURCE;
+
+    if (id >= TIME_SOURCE_COUNT) {
+        return;
+    }
+
+    st = &tsrc.status[id];
+
+    /* Holdover within specification (class 7) stays traceable */
+    traceable = st->state == TIME_SOURCE_LOCKED || st->clock_class == 7;
+
+    ts->clockQuality.clockClass = st->clock_class;
+    ts->clockQuality.clockAccuracy = time_source_accuracy(st->error);
+    ts->clockQuality.offsetScaledLogVariance = time_source_variance(st->jitter);
+    ts->currentUtcOffset = TIME_SOURCE_UTC_OFFSET;
+    ts->currentUtcOffsetValid = TRUE;
+    ts->timeTraceable = traceable;
+    ts->frequencyTraceable = traceable;
+    ts->ptpTimescale = TRUE;
+
+    if (traceable) {
+        ts->timeSource = id == TIME_SOURCE_GNSS ? GPS : id == TIME_SOURCE_NTP ? NTP : PTP;
+    }
+}
+
+// Holdover reports from the PTP thread
+static void time_source_ptp_holdover(const HoldoverInfo *info)
+{
+    time_source_status_t status = {0};
+    uint8_t gm_class = info->grandmasterClockQuality.clockClass;
+
+    if (info->active) {
+        status.state = TIME_SOURCE_HOLDOVER;
+        status.error = info->error;
+        status.jitter = info->offset;
+
+        /* Holding over a primary reference keeps its degraded classes */
+        if (gm_class == 6 || gm_class == 7) {
+            status.clock_class = info->error <= TIME_SOURCE_HOLDOVER_SPEC ? 7 : 52;
+        } else {
+            status.clock_class = DEFAULT_CLOCK_CLASS;
+        }
+    }
+
+    time_source_report(TIME_SOURCE_PTP, &status);
+}
+
+// Public: update a source and reselect
+void time_source_report(uint8_t id, const time_source_status_t *status)
+{
+    uint8_t selected, published;
+    TimeSource ts;
+    bool changed;
+
+    if (id >= TIME_SOURCE_COUNT) {
+        return;
+    }
+
+    taskENTER_CRITICAL();
+    tsrc.status[id] = *status;
+    tsrc.selected = selected = time_source_select();
+    taskEXIT_CRITICAL();
+
+    /* A better reference takes the PHC from the holdover */
+    if (selected != TIME_SOURCE_PTP && tsrc.status[TIME_SOURCE_PTP].state == TIME_SOURCE_HOLDOVER) {
+        ptpd_release_holdover();
+    }
+
+    /* Quality only follows sources with a usable estimate */
+    published = TIME_SOURCE_FREE_RUN;
+    if (selected < TIME_SOURCE_COUNT && tsrc.status[selected].state != TIME_SOURCE_ACQUIRING) {
+        published = selected;
+    }
+
+    time_source_quality(published, &ts);
+
+    taskENTER_CRITICAL();
+    changed = published != tsrc.published || memcmp(&ts, &tsrc.quality, sizeof(TimeSource)) != 0;
+    if (changed) {
+        if (published != tsrc.published) {
+            tsrc.switches++;
+        }
+        tsrc.published = published;
+        tsrc.quality = ts;
+    }
+    taskEXIT_CRITICAL();
+
+    if (changed) {
+        LOG_INF("Time source: %s, clock class %u, accuracy 0x%02X", time_source_name(published),
+                ts.clockQuality.clockClass, ts.clockQuality.clockAccuracy);
+        ptpd_set_time_source(&ts);
+    }
+}
+
+void time_source_init(void)
+{
+    ptpd_set_holdover_callback(time_source_ptp_holdover);
+}
+
+uint8_t time_source_active(void)
+{
+    uint8_t state = ptpd_port_state();
+
+    /* PHC belongs to the PTP servo while synchronising to another master */
+    if (state == PTP_SLAVE || state == PTP_UNCALIBRATED) {
+        return TIME_SOURCE_PTP;
+    }
+
+    return tsrc.selected;
+}
+
+uint8_t time_source_may_discipline(uint8_t id)
+{
+    return time_source_active() == id;
+}
+
+uint8_t time_source_locked(void)
+{
+    uint8_t active = time_source_active();
+
+    if (active == TIME_SOURCE_PTP && tsrc.status[TIME_SOURCE_PTP].state != TIME_SOURCE_HOLDOVER) {
+        return ptpd_port_state() == PTP_SLAVE;
+    }
+
+    return active < TIME_SOURCE_COUNT && tsrc.status[active].state == TIME_SOURCE_LOCKED;
+}
+
+void time_source_stats(void)
+{
+    uint8_t active = time_source_active();
+    uint8_t i;
+
+    LOG_PRINT("\tactive: %s, announced: %s, switches: %lu", time_source_name(active),
+              time_source_name(tsrc.published), (unsigned long)tsrc.switches);
+    LOG_PRINT("\tclass %u, accuracy 0x%02X, variance 0x%04X, source 0x%02X",
+              tsrc.quality.clockQuality.clockClass, tsrc.quality.clockQuality.clockAccuracy,
+              tsrc.quality.clockQuality.offsetScaledLogVariance, tsrc.quality.timeSource);
+
+    for (i = 0; i < TIME_SOURCE_COUNT; i++) {
+        const time_source_status_t *st = &tsrc.status[i];
+
+        LOG_PRINT("\t%c%-5s %-9s class %3u error %lu ns jitter %lu ns", i == active ? '*' : ' ',
+                  time_source_name(i), time_source_state_name(st->state), st->clock_class,
+                  (unsigned long)st->error, (unsigned long)st->jitter);
+    }
+}
@@ -73,6 +73,25 @@ struct ptptime_t {
 };
 
 /* Exported types ------------------------------------------------------------*/
+#define ETHERNETIF_TX_TIMESTAMP_CBS 3   /* PTP, NTP server and client */
+
+typedef struct ethernetif_mmc {
+  uint32_t rx_unicast;
+  uint32_t rx_crc_errors;
+  uint32_t rx_align_errors;
+  uint32_t tx_good;
+  uint32_t tx_single_collisions;
+  uint32_t tx_multiple_collisions;
+} ethernetif_mmc_t;
+
+typedef void (*ethernetif_tx_timestamp_cb_t)(struct pbuf *p, const struct ptptime_t *timestamp);
+
+#define ETHERNETIF_RX 0
+#define ETHERNETIF_TX 1
+
+/* Every frame with its hardware timestamp, zero if not stamped */
+typedef void (*ethernetif_capture_cb_t)(const struct pbuf *p, const struct ptptime_t *timestamp, uint8_t dir);
+
 /* Exported functions ------------------------------------------------------- */
 err_t ethernetif_init(struct netif *netif);
 void ethernetif_ptp_init(void);
@@ -81,6 +100,13 @@ void ethernetif_ptp_set_time(struct ptptime_t * timestamp);
 void ethernetif_ptp_get_time(struct ptptime_t * timestamp);
 void ethernetif_ptp_update_offset(struct ptptime_t * timeoffset);
 void ethernetif_ptp_adj_freq(int32_t Adj);
-void ethernetif_ptp_get_tx_timestamp(TimeInternal *time);
+void ethernetif_ptp_set_freq_bias(int32_t Bias);
+int32_t ethernetif_ptp_get_freq(void);
 void ethernetif_ptp_get_rx_timestamp(TimeInternal *time);
+void ethernetif_release_tx(void);
+void ethernetif_wait_tx(uint32_t timeout);
+uint8_t ethernetif_get_rx_timestamp(const struct pbuf *p, struct ptptime_t *timestamp);
+int ethernetif_add_tx_timestamp_cb(ethernetif_tx_timestamp_cb_t cb);
+void ethernetif_get_mmc(ethernetif_mmc_t *mmc);
+void ethernetif_set_capture_cb(ethernetif_capture_cb_t cb);
 #endif
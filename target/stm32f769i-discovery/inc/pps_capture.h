@@ -0,0 +1,101 @@
+#ifndef PPS_CAPTURE_H
+#define PPS_CAPTURE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/**
+ * TIM2 runs free from the 100 MHz APB1 timer clock. The ETH PTP PPS output
+ * is routed internally to ITR1 and captured on CH2 (TRC), so every PHC second
+ * rollover latches a timer reference. External pulses are captured on the
+ * remaining channels and converted into an offset against the PHC second.
+ */
+#define PPS_CAPTURE_TIMER_CLOCK     100000000UL
+
+/* GNSS receiver PPS: TIM2_CH1 */
+#define PPS_GNSS_GPIO_PORT          GPIOA
+#define PPS_GNSS_GPIO_PIN           GPIO_PIN_15
+#define PPS_GNSS_GPIO_CLK_ENABLE()  __HAL_RCC_GPIOA_CLK_ENABLE()
+
+/* Device under test PPS: TIM2_CH3 */
+#define PPS_DUT_GPIO_PORT           GPIOB
+#define PPS_DUT_GPIO_PIN            GPIO_PIN_10
+#define PPS_DUT_GPIO_CLK_ENABLE()   __HAL_RCC_GPIOB_CLK_ENABLE()
+
+#define PPS_CAPTURE_IRQ_PRIORITY    6
+
+enum {
+    PPS_INPUT_GNSS = 0,
+    PPS_INPUT_DUT,
+    PPS_INPUT_COUNT
+};
+
+/* Timer count latched at a PHC second rollover */
+typedef struct pps_ref {
+    uint32_t count;
+    uint32_t sec;       /* PHC seconds after the rollover */
+    uint32_t period;    /* timer ticks per PHC second */
+} pps_ref_t;
+
+typedef struct pps_edge {
+    uint32_t sec;       /* PHC second nearest to the edge */
+    int32_t offset;     /* PHC time minus that second, in ns (positive: PHC ahead) */
+} pps_edge_t;
+
+/**
+ * @brief Called from the capture interrupt for every external edge
+ */
+typedef void (*pps_capture_cb_t)(uint8_t input, const pps_edge_t *edge);
+
+/**
+ * @brief Convert a capture into a PHC referenced edge
+ *
+ * @param ref_sec   PHC seconds latched with the reference capture
+ * @param ticks     timer ticks from the reference capture to the edge, may be negative
+ * @param period    timer ticks per PHC second
+ * @param edge      result, offset folded into [-0.5 s, 0.5 s)
+ */
+static inline void pps_capture_edge(uint32_t ref_sec, int32_t ticks, uint32_t period, pps_edge_t *edge)
+{
+    int64_t ns = ((int64_t)ticks * 1000000000LL) / (int64_t)period;
+
+    edge->sec = ref_sec;
+
+    while (ns >= 500000000LL) {
+        ns -= 1000000000LL;
+        edge->sec++;
+    }
+
+    while (ns < -500000000LL) {
+        ns += 1000000000LL;
+        edge->sec--;
+    }
+
+    edge->offset = (int32_t)ns;
+}
+
+/**
+ * @brief Timer count at which the PHC reads sec + ns
+ *
+ * Valid within +-21 s of the reference (signed 32-bit tick distance).
+ */
+static inline uint32_t pps_capture_ticks(const pps_ref_t *ref, uint32_t sec, uint32_t ns)
+{
+    int64_t delta = (int64_t)(int32_t)(sec - ref->sec) * 1000000000LL + ns;
+
+    return ref->count + (uint32_t)((delta * (int64_t)ref->period) / 1000000000LL);
+}
+
+void pps_capture_init(void);
+void pps_capture_set_callback(uint8_t input, pps_capture_cb_t cb);
+uint32_t pps_capture_period(void);
+uint8_t pps_capture_get_reference(pps_ref_t *ref);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // PPS_CAPTURE_H
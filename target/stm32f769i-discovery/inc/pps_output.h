@@ -0,0 +1,116 @@
+#ifndef PPS_OUTPUT_H
+#define PPS_OUTPUT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "pps_capture.h"
+
+/**
+ * PHC aligned pulse generator on TIM2 CH4. Pulse edges are output compare
+ * matches computed from the PHC second reference captured on CH2, so they
+ * land on PHC time with timer clock resolution (10 ns) and no interrupt jitter.
+ * Each second starts a new train: pulse n of a rate R train rises at
+ * phase + floor(n * 10^9 / R) ns, n = 0..R-1.
+ */
+
+/* Generator output: TIM2_CH4 */
+#define PPS_OUT_GPIO_PORT           GPIOB
+#define PPS_OUT_GPIO_PIN            GPIO_PIN_11
+#define PPS_OUT_GPIO_CLK_ENABLE()   __HAL_RCC_GPIOB_CLK_ENABLE()
+
+#define PPS_OUTPUT_MAX_RATE         10000
+#define PPS_OUTPUT_MIN_WIDTH        2000    /* ns, covers compare interrupt latency */
+
+typedef struct pps_time {
+    uint32_t sec;
+    uint32_t ns;
+} pps_time_t;
+
+typedef struct pps_output_cfg {
+    uint32_t rate;      /* pulses per second, 0: one-shot triggers only */
+    uint32_t width;     /* ns */
+    uint32_t phase;     /* ns, delay of the train from the second */
+} pps_output_cfg_t;
+
+/**
+ * @brief Check rate, width and phase fit a pulse slot
+ *
+ * @return 0 if valid
+ */
+static inline int pps_output_check(const pps_output_cfg_t *cfg)
+{
+    uint32_t slot;
+
+    if (cfg->rate > PPS_OUTPUT_MAX_RATE || cfg->width < PPS_OUTPUT_MIN_WIDTH) {
+        return -1;
+    }
+
+    slot = cfg->rate ? 1000000000UL / cfg->rate : 1000000000UL;
+
+    if (cfg->phase >= slot || cfg->width > slot - PPS_OUTPUT_MIN_WIDTH) {
+        return -1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief First rising edge of the train at or after the given PHC time
+ *
+ * @return 0 on success, -1 if the train is empty (rate 0)
+ */
+static inline int pps_output_next(const pps_output_cfg_t *cfg, uint32_t sec, uint32_t ns, pps_time_t *next)
+{
+    uint64_t n = 0;
+    uint32_t t;
+
+    if (cfg->rate == 0) {
+        return -1;
+    }
+
+    if (ns > cfg->phase) {
+        n = ((uint64_t)(ns - cfg->phase) * cfg->rate + 999999999ULL) / 1000000000ULL;
+    }
+
+    for (;;) {
+        if (n >= cfg->rate) {
+            next->sec = sec + 1;
+            next->ns = cfg->phase;
+            return 0;
+        }
+
+        t = (uint32_t)((n * 1000000000ULL) / cfg->rate) + cfg->phase;
+
+        if (t >= ns) {
+            next->sec = sec;
+            next->ns = t;
+            return 0;
+        }
+
+        n++;
+    }
+}
+
+/**
+ * @brief Compare two PHC times
+ */
+static inline int pps_time_before(const pps_time_t *a, const pps_time_t *b)
+{
+    return a->sec != b->sec ? (int32_t)(a->sec - b->sec) < 0 : a->ns < b->ns;
+}
+
+void pps_output_irq(uint32_t compare, const pps_ref_t *ref);
+
+int pps_output_start(const pps_output_cfg_t *cfg);
+int pps_output_trigger(uint32_t sec, uint32_t ns, uint32_t width);
+void pps_output_stop(void);
+void pps_output_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // PPS_OUTPUT_H
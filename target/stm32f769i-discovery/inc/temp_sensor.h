@@ -0,0 +1,41 @@
+#ifndef TEMP_SENSOR_H
+#define TEMP_SENSOR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/**
+ * MCU die temperature from the internal sensor on ADC1 channel 18.
+ * Readings are scaled with the factory calibration at 30 and 110 degC and
+ * corrected for the actual VDDA, measured through VREFINT on channel 17.
+ */
+
+/* Factory calibration, raw 12 bit counts at VDDA = 3.3 V */
+#define TEMP_SENSOR_CAL1            (*(const uint16_t *)0x1FF0F44CUL)   /* 30 degC */
+#define TEMP_SENSOR_CAL2            (*(const uint16_t *)0x1FF0F44EUL)   /* 110 degC */
+#define TEMP_SENSOR_VREFINT_CAL     (*(const uint16_t *)0x1FF0F44AUL)
+#define TEMP_SENSOR_CAL1_TEMP       30000   /* mdegC */
+#define TEMP_SENSOR_CAL2_TEMP       110000  /* mdegC */
+
+#define TEMP_SENSOR_OVERSAMPLE      16      /* conversions averaged per reading */
+
+/**
+ * @brief Power up ADC1 with the temperature sensor and VREFINT
+ */
+void temp_sensor_init(void);
+
+/**
+ * @brief Blocking reading, about 0.6 ms
+ *
+ * @return die temperature in mdegC
+ */
+int32_t temp_sensor_read(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TEMP_SENSOR_H
@@ -49,6 +49,7 @@
 #include "lwip/opt.h"
 #include "lwip/memp.h"
 #include "lwip/timeouts.h"
+#include "lwip/snmp.h"
 #include "netif/ethernet.h"
 #include "netif/etharp.h"
 #include "ethernetif.h"
@@ -59,6 +60,7 @@
 typedef struct
 {
     struct pbuf_custom pbuf_custom;
+    ETH_TimeStampTypeDef timestamp;     /* hardware receive time, zero if not stamped */
     uint8_t buff[(ETH_RX_BUF_SIZE + 31) & ~31];
 } RxBuff_t;
 /* Private define ------------------------------------------------------------*/
@@ -107,9 +109,14 @@ static LWIP_MEMPOOL_DECLARE(RX_POOL, ETH_RX_BUFFER_CNT, sizeof(RxBuff_t), "Zero-
 
 static osSemaphoreId RxPktSemaphore;
 static osSemaphoreId TxPktSemaphore;
+static osMutexId TxMutex;       /* TX descriptors, taken to transmit or release */
 static ETH_TxPacketConfigTypeDef TxConfig;
 static lan8742_Object_t LAN8742;
 static uint8_t RxAllocStatus;
+static ethernetif_tx_timestamp_cb_t TxTimestampCb[ETHERNETIF_TX_TIMESTAMP_CBS];
+static ethernetif_capture_cb_t CaptureCb;
+static int32_t PtpFreqAdj;      /* ppb, last correction requested by the servo */
+static int32_t PtpFreqBias;     /* ppb, feed-forward added to every correction */
 /* Global variables ---------------------------------------------------------*/
 ETH_HandleTypeDef EthHandle;
 
@@ -265,6 +272,7 @@ static void low_level_init(struct netif *netif)
     /* create a binary semaphore used for informing ethernetif of frame reception */
     RxPktSemaphore = xSemaphoreCreateBinary();
     TxPktSemaphore = xSemaphoreCreateBinary();
+    TxMutex = xSemaphoreCreateMutex();
 
     /* create the task that handles the ETH_MAC */
     osThreadDef(EthIf, ethernetif_input_thread, osPriorityRealtime, 0, INTERFACE_THREAD_STACK_SIZE);
@@ -325,6 +333,8 @@ static err_t low_level_output(struct netif *netif, struct pbuf *p)
 
     pbuf_ref (p);
 
+    osMutexWait (TxMutex, osWaitForever);
+
     do {
         HAL_ETH_PTP_InsertTxTimestamp(&EthHandle);
 
@@ -336,8 +346,10 @@ static err_t low_level_output(struct netif *netif, struct pbuf *p)
         {
             if (HAL_ETH_GetError (&EthHandle) & HAL_ETH_ERROR_BUSY)
             {
-                /* Wait for descriptors to become available */
+                /* Wait for descriptors to become available, others may release meanwhile */
+                osMutexRelease (TxMutex);
                 osSemaphoreWait (TxPktSemaphore, ETHIF_TX_TIMEOUT);
+                osMutexWait (TxMutex, osWaitForever);
                 HAL_ETH_ReleaseTxPacket (&EthHandle);
                 errval = ERR_BUF;
             }
@@ -350,6 +362,8 @@ static err_t low_level_output(struct netif *netif, struct pbuf *p)
         }
     } while (errval == ERR_BUF);
 
+    osMutexRelease (TxMutex);
+
     return errval;
 }
 
@@ -366,7 +380,15 @@ static struct pbuf * low_level_input(struct netif *netif)
     struct pbuf *p = NULL;
 
     if(RxAllocStatus == 0) {
+        EthHandle.RxDescList.TimeStamp.TimeStampHigh = 0;
+        EthHandle.RxDescList.TimeStamp.TimeStampLow = 0;
+
         HAL_ETH_ReadData(&EthHandle, (void **)&p);
+
+        /* Keep the frame timestamp with its buffer, the handle only holds the last one */
+        if (p != NULL) {
+            ((RxBuff_t *)p)->timestamp = EthHandle.RxDescList.TimeStamp;
+        }
     }
 
     return p;
@@ -445,6 +467,13 @@ static void ethernetif_input_thread( void const * argument )
         p = low_level_input( netif );
         if (p != NULL)
         {
+          if (CaptureCb != NULL)
+          {
+            struct ptptime_t ts = {0, 0};
+
+            ethernetif_get_rx_timestamp(p, &ts);
+            CaptureCb(p, &ts, ETHERNETIF_RX);
+          }
           if (netif->input( p, netif) != ERR_OK )
           {
             pbuf_free(p);
@@ -476,6 +505,9 @@ err_t ethernetif_init(struct netif *netif)
     netif->hostname = "lwip";
 #endif /* LWIP_NETIF_HOSTNAME */
 
+    /* ifType and ifSpeed of the MIB-2 interfaces table */
+    MIB2_INIT_NETIF(netif, snmp_ifType_ethernet_csmacd, 100000000);
+
     netif->name[0] = IFNAME0;
     netif->name[1] = IFNAME1;
     /* set netif MAC hardware address length */
@@ -522,7 +554,7 @@ void ethernetif_ptp_init(void)
 
     ptp_cfg.Timestamp           = ENABLE;
     ptp_cfg.TimestampUpdate     = ENABLE;   // Fine update
-    ptp_cfg.TimestampAll        = DISABLE;
+    ptp_cfg.TimestampAll        = ENABLE;   // Stamp every frame, timestamps are kept per pbuf
     ptp_cfg.TimestampV2         = ENABLE;   // PTPv2 only
     ptp_cfg.TimestampIPv6       = DISABLE;
     ptp_cfg.TimestampIPv4       = ENABLE;
@@ -645,7 +677,7 @@ void ethernetif_ptp_update_offset(struct ptptime_t * timeoffset)
   EthHandle.Instance->PTPTSCR |= ETH_PTPTSCR_TSARU;
 }
 
-void ethernetif_ptp_adj_freq(int32_t Adj)
+static void ll_ptp_set_freq(int32_t Adj)
 {
     uint32_t addend;
 
@@ -673,16 +705,125 @@ void ethernetif_ptp_adj_freq(int32_t Adj)
   EthHandle.Instance->PTPTSCR |= ETH_PTPTSCR_TSARU;
 }
 
+void ethernetif_ptp_adj_freq(int32_t Adj)
+{
+  taskENTER_CRITICAL();
+  PtpFreqAdj = Adj;
+  ll_ptp_set_freq(Adj + PtpFreqBias);
+  taskEXIT_CRITICAL();
+}
+
 /**
- * @brief get timestamp of last sent packet
- * @param time
+ * @brief set a frequency offset applied on top of the servo corrections
+ * @param Bias ppb
+ */
+void ethernetif_ptp_set_freq_bias(int32_t Bias)
+{
+  taskENTER_CRITICAL();
+  PtpFreqBias = Bias;
+  ll_ptp_set_freq(PtpFreqAdj + Bias);
+  taskEXIT_CRITICAL();
+}
+
+/**
+ * @brief total frequency correction applied to the clock, bias included
+ * @return ppb
  */
-void ethernetif_ptp_get_tx_timestamp(TimeInternal *time)
+int32_t ethernetif_ptp_get_freq(void)
 {
-    osSemaphoreWait(TxPktSemaphore, ETHIF_TX_TIMEOUT);
+  return PtpFreqAdj + PtpFreqBias;
+}
+
+/**
+ * @brief release descriptors of completed transmissions, dropping the
+ * driver reference on their pbufs. Safe from any thread, the timestamp and
+ * free callbacks run in the caller with the TX descriptors locked and must
+ * not transmit.
+ */
+void ethernetif_release_tx(void)
+{
+    osMutexWait(TxMutex, osWaitForever);
     HAL_ETH_ReleaseTxPacket(&EthHandle);
-    time->nanoseconds = subsecond_to_nanosecond(EthHandle.TxTimestamp.TimeStampLow);
-    time->seconds = EthHandle.TxTimestamp.TimeStampHigh;
+    osMutexRelease(TxMutex);
+}
+
+/**
+ * @brief wait for a transmission to complete and release the descriptors,
+ * the timestamp callbacks receive the hardware transmit time of each frame
+ * @param timeout ms
+ */
+void ethernetif_wait_tx(uint32_t timeout)
+{
+    osSemaphoreWait(TxPktSemaphore, timeout);
+    ethernetif_release_tx();
+}
+
+/**
+ * @brief get hardware receive timestamp of a frame handed to lwIP
+ * @param p pbuf received from this interface, as passed to the protocol callbacks
+ * @param timestamp
+ * @retval 1 if the frame carries a timestamp
+ */
+uint8_t ethernetif_get_rx_timestamp(const struct pbuf *p, struct ptptime_t *timestamp)
+{
+    const RxBuff_t *rx = (const RxBuff_t *)p;
+
+    if (!(p->flags & PBUF_FLAG_IS_CUSTOM) || rx->pbuf_custom.custom_free_function != pbuf_free_custom) {
+        return 0;
+    }
+
+    if (rx->timestamp.TimeStampHigh == 0 && rx->timestamp.TimeStampLow == 0) {
+        return 0;
+    }
+
+    timestamp->tv_nsec = subsecond_to_nanosecond(rx->timestamp.TimeStampLow);
+    timestamp->tv_sec = rx->timestamp.TimeStampHigh;
+
+    return 1;
+}
+
+/**
+ * @brief register a callback receiving the hardware transmit timestamp of
+ * every frame, called when its descriptor is released
+ * @retval 0 on success, -1 if all slots are taken
+ */
+int ethernetif_add_tx_timestamp_cb(ethernetif_tx_timestamp_cb_t cb)
+{
+    for (uint8_t i = 0; i < ETHERNETIF_TX_TIMESTAMP_CBS; i++) {
+        if (TxTimestampCb[i] == NULL || TxTimestampCb[i] == cb) {
+            TxTimestampCb[i] = cb;
+            return 0;
+        }
+    }
+
+    return -1;
+}
+
+/**
+ * @brief read the MAC management counters, the RMII watchdog may clear
+ * them while the link comes up
+ * @param mmc
+ */
+void ethernetif_get_mmc(ethernetif_mmc_t *mmc)
+{
+    mmc->rx_unicast = EthHandle.Instance->MMCRGUFCR;
+    mmc->rx_crc_errors = EthHandle.Instance->MMCRFCECR;
+    mmc->rx_align_errors = EthHandle.Instance->MMCRFAECR;
+    mmc->tx_good = EthHandle.Instance->MMCTGFCR;
+    mmc->tx_single_collisions = EthHandle.Instance->MMCTGFSCCR;
+    mmc->tx_multiple_collisions = EthHandle.Instance->MMCTGFMSCCR;
+}
+
+/**
+ * @brief register a callback receiving every frame sent or received with
+ * its hardware timestamp, NULL to remove it. Received frames are passed
+ * from the input thread before lwIP, sent frames when their descriptor is
+ * released.
+ * @param cb
+ */
+void ethernetif_set_capture_cb(ethernetif_capture_cb_t cb)
+{
+    CaptureCb = cb;
 }
 
 /**
@@ -797,6 +938,22 @@ void HAL_ETH_TxCpltCallback(ETH_HandleTypeDef *heth)
     osSemaphoreRelease(TxPktSemaphore);
 }
 
+void HAL_ETH_TxPtpCallback(uint32_t *buff, ETH_TimeStampTypeDef *timestamp)
+{
+    struct ptptime_t ts;
+
+    ts.tv_nsec = subsecond_to_nanosecond(timestamp->TimeStampLow);
+    ts.tv_sec = timestamp->TimeStampHigh;
+
+    for (uint8_t i = 0; i < ETHERNETIF_TX_TIMESTAMP_CBS && TxTimestampCb[i] != NULL; i++) {
+        TxTimestampCb[i]((struct pbuf *)buff, &ts);
+    }
+
+    if (CaptureCb != NULL) {
+        CaptureCb((struct pbuf *)buff, &ts, ETHERNETIF_TX);
+    }
+}
+
 void HAL_ETH_TxFreeCallback(uint32_t * buff)
 {
     pbuf_free((struct pbuf *)buff);
@@ -0,0 +1,157 @@
+/*
+ * pps_capture.c
+ *
+ * PHC referenced capture of external PPS edges on TIM2
+ */
+#include <stdint.h>
+#include "stm32f7xx.h"
+#include "stm32f7xx_hal.h"
+#include "pps_capture.h"
+#include "pps_output.h"
+
+/* Reject reference periods further than this from nominal (missed PPS, time steps) */
+#define PPS_PERIOD_TOLERANCE    (PPS_CAPTURE_TIMER_CLOCK / 1000)
+
+typedef struct pps_capture {
+    TIM_HandleTypeDef htim;
+    pps_capture_cb_t cb[PPS_INPUT_COUNT];
+    pps_ref_t ref;
+    uint8_t ref_valid;
+} pps_capture_t;
+
+static pps_capture_t pps;
+
+static void pps_capture_reference(uint32_t count)
+{
+    uint32_t period = count - pps.ref.count;
+
+    if (pps.ref_valid &&
+        period > PPS_CAPTURE_TIMER_CLOCK - PPS_PERIOD_TOLERANCE &&
+        period < PPS_CAPTURE_TIMER_CLOCK + PPS_PERIOD_TOLERANCE) {
+        pps.ref.period = period;
+    }
+
+    /* The PPS pulse marks the rollover, seconds register already holds the new value */
+    pps.ref.count = count;
+    pps.ref.sec = ETH->PTPTSHR;
+    pps.ref_valid = 1;
+}
+
+static void pps_capture_input(uint8_t input, uint32_t count)
+{
+    pps_edge_t edge;
+
+    if (!pps.ref_valid || pps.cb[input] == NULL) {
+        return;
+    }
+
+    pps_capture_edge(pps.ref.sec, (int32_t)(count - pps.ref.count), pps.ref.period, &edge);
+    pps.cb[input](input, &edge);
+}
+
+void TIM2_IRQHandler(void)
+{
+    uint32_t sr = TIM2->SR & TIM2->DIER;
+
+    TIM2->SR = ~sr;
+
+    /* Reference first, so edges captured in the same interrupt use the newest second */
+    if (sr & TIM_SR_CC2IF) {
+        pps_capture_reference(TIM2->CCR2);
+    }
+
+    if (sr & TIM_SR_CC1IF) {
+        pps_capture_input(PPS_INPUT_GNSS, TIM2->CCR1);
+    }
+
+    if (sr & TIM_SR_CC3IF) {
+        pps_capture_input(PPS_INPUT_DUT, TIM2->CCR3);
+    }
+
+    if (pps.ref_valid && (sr & (TIM_SR_CC2IF | TIM_SR_CC4IF))) {
+        pps_output_irq(sr & TIM_SR_CC4IF, &pps.ref);
+    }
+}
+
+void pps_capture_set_callback(uint8_t input, pps_capture_cb_t cb)
+{
+    if (input < PPS_INPUT_COUNT) {
+        pps.cb[input] = cb;
+    }
+}
+
+uint32_t pps_capture_period(void)
+{
+    return pps.ref.period;
+}
+
+uint8_t pps_capture_get_reference(pps_ref_t *ref)
+{
+    *ref = pps.ref;
+    return pps.ref_valid;
+}
+
+/**
+ * @brief Start TIM2 as free running 32-bit counter capturing the PHC PPS
+ * on CH2 (ITR1 -> TRC) and the external inputs on the remaining channels.
+ * PHC PPS output must be configured for 1 Hz. Safe to call more than once.
+ */
+void pps_capture_init(void)
+{
+    GPIO_InitTypeDef gpio_init = {0};
+    TIM_IC_InitTypeDef ic = {0};
+
+    if (pps.htim.Instance != NULL) {
+        return;
+    }
+
+    pps.ref.period = PPS_CAPTURE_TIMER_CLOCK;
+    pps.ref_valid = 0;
+
+    __HAL_RCC_TIM2_CLK_ENABLE();
+    PPS_GNSS_GPIO_CLK_ENABLE();
+    PPS_DUT_GPIO_CLK_ENABLE();
+
+    gpio_init.Pin = PPS_GNSS_GPIO_PIN;
+    gpio_init.Mode = GPIO_MODE_AF_PP;
+    gpio_init.Pull = GPIO_PULLDOWN;
+    gpio_init.Speed = GPIO_SPEED_FREQ_LOW;
+    gpio_init.Alternate = GPIO_AF1_TIM2;
+    HAL_GPIO_Init(PPS_GNSS_GPIO_PORT, &gpio_init);
+
+    gpio_init.Pin = PPS_DUT_GPIO_PIN;
+    HAL_GPIO_Init(PPS_DUT_GPIO_PORT, &gpio_init);
+
+    pps.htim.Instance = TIM2;
+    pps.htim.Init.Prescaler = 0;
+    pps.htim.Init.CounterMode = TIM_COUNTERMODE_UP;
+    pps.htim.Init.Period = 0xFFFFFFFF;
+    pps.htim.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+    pps.htim.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
+
+    if (HAL_TIM_IC_Init(&pps.htim) != HAL_OK) {
+        return;
+    }
+
+    /* ETH PTP PPS output to ITR1, selected as TRGI without a slave mode */
+    HAL_TIMEx_RemapConfig(&pps.htim, TIM_TIM2_ETH_PTP);
+    MODIFY_REG(TIM2->SMCR, TIM_SMCR_TS | TIM_SMCR_SMS, TIM_TS_ITR1);
+
+    ic.ICPolarity = TIM_ICPOLARITY_RISING;
+    ic.ICPrescaler = TIM_ICPSC_DIV1;
+    ic.ICFilter = 0;
+
+    ic.ICSelection = TIM_ICSELECTION_TRC;
+    HAL_TIM_IC_ConfigChannel(&pps.htim, &ic, TIM_CHANNEL_2);
+
+    ic.ICSelection = TIM_ICSELECTION_DIRECTTI;
+    HAL_TIM_IC_ConfigChannel(&pps.htim, &ic, TIM_CHANNEL_1);
+    HAL_TIM_IC_ConfigChannel(&pps.htim, &ic, TIM_CHANNEL_3);
+
+    HAL_NVIC_SetPriority(TIM2_IRQn, PPS_CAPTURE_IRQ_PRIORITY, 0);
+    HAL_NVIC_EnableIRQ(TIM2_IRQn);
+
+    HAL_TIM_IC_Start_IT(&pps.htim, TIM_CHANNEL_2);
+    HAL_TIM_IC_Start_IT(&pps.htim, TIM_CHANNEL_1);
+    HAL_TIM_IC_Start_IT(&pps.htim, TIM_CHANNEL_3);
+}
@@ -0,0 +1,296 @@
+/*
+ * pps_output.c
+ *
+ * PHC aligned pulse trains and one-shot triggers on TIM2 CH4
+ */
+#include <stdint.h>
+#include "stm32f7xx.h"
+#include "stm32f7xx_hal.h"
+#include "app.h"
+#include "ethernetif.h"
+#include "pps_capture.h"
+#include "pps_output.h"
+
+#define PPS_OUTPUT_MIN_LEAD     200     /* ticks between programming a compare and its match */
+
+enum {
+    PPS_OUT_IDLE = 0,
+    PPS_OUT_RISE,       /* rising edge compare armed */
+    PPS_OUT_FALL        /* falling edge compare armed */
+};
+
+typedef struct pps_output {
+    pps_output_cfg_t cfg;
+    pps_time_t next;        /* next rising edge of the train */
+    pps_time_t shot;        /* pending one-shot rising edge */
+    uint32_t shot_width;
+    uint32_t rise;          /* timer count of the armed rising edge */
+    uint32_t width;         /* armed pulse width, ticks */
+    uint32_t pulses;
+    uint32_t missed;
+    uint8_t running;
+    uint8_t shot_pending;
+    uint8_t armed_shot;
+    uint8_t state;
+    uint8_t init;
+} pps_output_t;
+
+static pps_output_t out;
+
+static void pps_output_mode(uint32_t mode)
+{
+    /* TIM_OCMODE_x are defined for channel 1, channel 4 sits 8 bits higher */
+    MODIFY_REG(TIM2->CCMR2, TIM_CCMR2_OC4M, mode << 8);
+}
+
+static void pps_output_disarm(void)
+{
+    CLEAR_BIT(TIM2->DIER, TIM_DIER_CC4IE);
+    pps_output_mode(TIM_OCMODE_FORCED_INACTIVE);
+    TIM2->SR = ~TIM_SR_CC4IF;
+    out.state = PPS_OUT_IDLE;
+}
+
+// Move past the pulse just output or missed
+static void pps_output_advance(uint8_t shot)
+{
+    if (shot) {
+        out.shot_pending = 0;
+    } else {
+        pps_output_next(&out.cfg, out.next.sec, out.next.ns + 1, &out.next);
+    }
+}
+
+// Arm the earliest pending rising edge within the next PHC second
+static void pps_output_arm(const pps_ref_t *ref)
+{
+    const pps_time_t *t;
+    uint32_t width, count;
+    uint8_t shot;
+
+    for (;;) {
+        if (out.shot_pending && (!out.running || pps_time_before(&out.shot, &out.next))) {
+            t = &out.shot;
+            width = out.shot_width;
+            shot = 1;
+        } else if (out.running) {
+            t = &out.next;
+            width = out.cfg.width;
+            shot = 0;
+        } else {
+            return;
+        }
+
+        /* The train never runs more than a second ahead, the PHC was stepped */
+        if (!shot && ((int32_t)(t->sec - ref->sec) < 0 || (int32_t)(t->sec - ref->sec) > 1)) {
+            pps_output_next(&out.cfg, ref->sec, 0, &out.next);
+            out.missed++;
+            continue;
+        }
+
+        /* Later edges are armed from a later reference */
+        if ((int32_t)(t->sec - ref->sec) > 1) {
+            return;
+        }
+
+        count = pps_capture_ticks(ref, t->sec, t->ns);
+
+        if ((int32_t)(t->sec - ref->sec) < 0 || (int32_t)(count - TIM2->CNT) < PPS_OUTPUT_MIN_LEAD) {
+            out.missed++;
+            pps_output_advance(shot);
+            continue;
+        }
+
+        out.rise = count;
+        out.width = (uint32_t)(((uint64_t)width * ref->period) / 1000000000ULL);
+        out.armed_shot = shot;
+        out.state = PPS_OUT_RISE;
+
+        TIM2->CCR4 = count;
+        pps_output_mode(TIM_OCMODE_ACTIVE);
+        TIM2->SR = ~TIM_SR_CC4IF;
+        SET_BIT(TIM2->DIER, TIM_DIER_CC4IE);
+        return;
+    }
+}
+
+/**
+ * @brief Called from the TIM2 interrupt on PHC second references and CH4 matches
+ */
+void pps_output_irq(uint32_t compare, const pps_ref_t *ref)
+{
+    if (compare && out.state == PPS_OUT_RISE) {
+        uint32_t fall = out.rise + out.width;
+
+        TIM2->CCR4 = fall;
+        pps_output_mode(TIM_OCMODE_INACTIVE);
+        out.state = PPS_OUT_FALL;
+
+        /* Too late for the compare, end the pulse now */
+        if ((int32_t)(fall - TIM2->CNT) > 0) {
+            return;
+        }
+
+        pps_output_mode(TIM_OCMODE_FORCED_INACTIVE);
+    }
+
+    if (compare && out.state == PPS_OUT_FALL) {
+        out.pulses++;
+        out.state = PPS_OUT_IDLE;
+        CLEAR_BIT(TIM2->DIER, TIM_DIER_CC4IE);
+        pps_output_advance(out.armed_shot);
+    }
+
+    if (out.state == PPS_OUT_IDLE) {
+        pps_output_arm(ref);
+    }
+}
+
+static void pps_output_init(void)
+{
+    GPIO_InitTypeDef gpio_init = {0};
+
+    if (out.init) {
+        return;
+    }
+
+    pps_capture_init();
+
+    PPS_OUT_GPIO_CLK_ENABLE();
+
+    gpio_init.Pin = PPS_OUT_GPIO_PIN;
+    gpio_init.Mode = GPIO_MODE_AF_PP;
+    gpio_init.Pull = GPIO_NOPULL;
+    gpio_init.Speed = GPIO_SPEED_FREQ_HIGH;
+    gpio_init.Alternate = GPIO_AF1_TIM2;
+    HAL_GPIO_Init(PPS_OUT_GPIO_PORT, &gpio_init);
+
+    /* CH4 as output compare without preload, driven low until armed */
+    MODIFY_REG(TIM2->CCMR2, TIM_CCMR2_CC4S | TIM_CCMR2_OC4PE, 0);
+    pps_output_mode(TIM_OCMODE_FORCED_INACTIVE);
+    SET_BIT(TIM2->CCER, TIM_CCER_CC4E);
+
+    out.init = 1;
+}
+
+// Arm from thread context if the generator is waiting for an edge
+static void pps_output_kick(void)
+{
+    pps_ref_t ref;
+
+    if (out.state == PPS_OUT_IDLE && pps_capture_get_reference(&ref)) {
+        pps_output_arm(&ref);
+    }
+}
+
+/**
+ * @brief Start a pulse train, first pulse at least 1 ms from now
+ *
+ * @return 0 on success, -1 on invalid configuration
+ */
+int pps_output_start(const pps_output_cfg_t *cfg)
+{
+    struct ptptime_t now;
+    uint32_t ns;
+
+    if (cfg->rate == 0 || pps_output_check(cfg) != 0) {
+        return -1;
+    }
+
+    pps_output_init();
+    ethernetif_ptp_get_time(&now);
+
+    /* Edges are placed from the PHC second reference, the PHC PPS must
+     * run at 1 Hz whatever it was set to */
+    ethernetif_ptp_set_pps_output(0);
+
+    HAL_NVIC_DisableIRQ(TIM2_IRQn);
+
+    /* Restart cleanly, a pulse in progress is cut short */
+    pps_output_disarm();
+
+    out.cfg = *cfg;
+    ns = now.tv_nsec + 1000000;
+    pps_output_next(&out.cfg, now.tv_sec + ns / 1000000000UL, ns % 1000000000UL, &out.next);
+    out.running = 1;
+    out.pulses = 0;
+    out.missed = 0;
+
+    pps_output_kick();
+
+    HAL_NVIC_EnableIRQ(TIM2_IRQn);
+
+    return 0;
+}
+
+/**
+ * @brief Output a single pulse at an absolute PHC time
+ *
+ * @return 0 on success, -1 if width is invalid or the time has passed
+ */
+int pps_output_trigger(uint32_t sec, uint32_t ns, uint32_t width)
+{
+    struct ptptime_t now;
+
+    if (ns >= 1000000000UL || width < PPS_OUTPUT_MIN_WIDTH || width >= 1000000000UL) {
+        return -1;
+    }
+
+    pps_output_init();
+    ethernetif_ptp_get_time(&now);
+
+    if ((int32_t)(sec - now.tv_sec) < 0 || (sec == (uint32_t)now.tv_sec && ns <= (uint32_t)now.tv_nsec)) {
+        return -1;
+    }
+
+    /* Placed from the PHC second reference, as a train */
+    ethernetif_ptp_set_pps_output(0);
+
+    HAL_NVIC_DisableIRQ(TIM2_IRQn);
+
+    /* Re-arm if the trigger comes before the train edge waiting to fire */
+    if (out.state == PPS_OUT_RISE && !out.armed_shot) {
+        pps_output_disarm();
+    }
+
+    out.shot.sec = sec;
+    out.shot.ns = ns;
+    out.shot_width = width;
+    out.shot_pending = 1;
+
+    pps_output_kick();
+
+    HAL_NVIC_EnableIRQ(TIM2_IRQn);
+
+    return 0;
+}
+
+void pps_output_stop(void)
+{
+    if (!out.init) {
+        return;
+    }
+
+    HAL_NVIC_DisableIRQ(TIM2_IRQn);
+    pps_output_disarm();
+    out.running = 0;
+    out.shot_pending = 0;
+    HAL_NVIC_EnableIRQ(TIM2_IRQn);
+}
+
+void pps_output_stats(void)
+{
+    if (out.running) {
+        LOG_PRINT("\ttrain: %lu Hz, width %lu ns, phase %lu ns",
+                  (unsigned long)out.cfg.rate, (unsigned long)out.cfg.width, (unsigned long)out.cfg.phase);
+        LOG_PRINT("\tnext: %lu.%09lu", (unsigned long)out.next.sec, (unsigned long)out.next.ns);
+    } else {
+        LOG_PRINT("\ttrain: stopped");
+    }
+
+    if (out.shot_pending) {
+        LOG_PRINT("\ttrigger: %lu.%09lu", (unsigned long)out.shot.sec, (unsigned long)out.shot.ns);
+    }
+
+    LOG_PRINT("\tpulses: %lu, missed: %lu", (unsigned long)out.pulses, (unsigned long)out.missed);
+}
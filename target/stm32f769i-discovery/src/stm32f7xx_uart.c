@@ -216,6 +216,31 @@ void HAL_UART_MspInit(UART_HandleTypeDef *huart)
         GPIO_InitStruct.Alternate = GPIO_AF7_USART1;
         HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
     }
+    else if (huart->Instance == USART6)
+    {
+        __HAL_RCC_USART6_CLK_ENABLE();
+
+        __HAL_RCC_GPIOC_CLK_ENABLE();
+        /**USART6 GPIO Configuration (GNSS receiver)
+        PC7     ------> USART6_RX
+        PC6     ------> USART6_TX
+        */
+        GPIO_InitStruct.Pin = GPIO_PIN_7 | GPIO_PIN_6;
+        GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
+        GPIO_InitStruct.Pull = GPIO_PULLUP;
+        GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
+        GPIO_InitStruct.Alternate = GPIO_AF8_USART6;
+        HAL_GPIO_Init(GPIOC, &GPIO_InitStruct);
+    }
+}
+
+void HAL_UART_MspDeInit(UART_HandleTypeDef *huart)
+{
+    if (huart->Instance == USART6)
+    {
+        __HAL_RCC_USART6_CLK_DISABLE();
+        HAL_GPIO_DeInit(GPIOC, GPIO_PIN_7 | GPIO_PIN_6);
+    }
 }
 
 uint8_t UART_Init(void)
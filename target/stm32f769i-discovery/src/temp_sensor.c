@@ -0,0 +1,82 @@
+/*
+ * temp_sensor.c
+ *
+ * MCU internal temperature sensor, polled ADC1 conversions
+ */
+#include <stdint.h>
+#include "stm32f7xx.h"
+#include "stm32f7xx_hal.h"
+#include "temp_sensor.h"
+
+#define TEMP_SENSOR_CHANNEL     18
+#define TEMP_SENSOR_VREFINT     17
+#define TEMP_SENSOR_SMP_480     7       /* 480 cycles, sensor needs 10 us */
+
+static uint8_t temp_sensor_ready;
+
+static uint32_t temp_sensor_convert(uint32_t channel)
+{
+    uint32_t sum = 0;
+    uint8_t i;
+
+    ADC1->SQR3 = channel;
+
+    for (i = 0; i < TEMP_SENSOR_OVERSAMPLE; i++) {
+        ADC1->SR = ~ADC_SR_EOC;
+        ADC1->CR2 |= ADC_CR2_SWSTART;
+        while (!(ADC1->SR & ADC_SR_EOC));
+        sum += ADC1->DR;
+    }
+
+    return sum;
+}
+
+void temp_sensor_init(void)
+{
+    if (temp_sensor_ready) {
+        return;
+    }
+
+    __HAL_RCC_ADC1_CLK_ENABLE();
+
+    /* ADCCLK = PCLK2 / 4, temperature sensor and VREFINT on, VBAT off (shares channel 18) */
+    MODIFY_REG(ADC->CCR, ADC_CCR_ADCPRE | ADC_CCR_VBATE, ADC_CCR_ADCPRE_0 | ADC_CCR_TSVREFE);
+
+    /* 12 bit, single conversion of one channel */
+    ADC1->CR1 = 0;
+    ADC1->CR2 = 0;
+    ADC1->SQR1 = 0;
+    MODIFY_REG(ADC1->SMPR1, ADC_SMPR1_SMP17 | ADC_SMPR1_SMP18,
+               (TEMP_SENSOR_SMP_480 << ADC_SMPR1_SMP17_Pos) | (TEMP_SENSOR_SMP_480 << ADC_SMPR1_SMP18_Pos));
+
+    ADC1->CR2 |= ADC_CR2_ADON;
+
+    /* ADC stabilization and sensor start-up, both a few us */
+    HAL_Delay(1);
+
+    temp_sensor_ready = 1;
+}
+
+int32_t temp_sensor_read(void)
+{
+    uint32_t vref, raw;
+
+    if (!temp_sensor_ready) {
+        temp_sensor_init();
+    }
+
+    vref = temp_sensor_convert(TEMP_SENSOR_VREFINT);
+    raw = temp_sensor_convert(TEMP_SENSOR_CHANNEL);
+
+    if (vref == 0) {
+        return TEMP_SENSOR_CAL1_TEMP;
+    }
+
+    /* Sensor reading rescaled to the 3.3 V calibration supply, still oversampled */
+    raw = (uint32_t)(((uint64_t)raw * TEMP_SENSOR_VREFINT_CAL * TEMP_SENSOR_OVERSAMPLE) / vref);
+
+    return TEMP_SENSOR_CAL1_TEMP +
+           (int32_t)(((int64_t)((int32_t)raw - TEMP_SENSOR_CAL1 * TEMP_SENSOR_OVERSAMPLE) *
+                      (TEMP_SENSOR_CAL2_TEMP - TEMP_SENSOR_CAL1_TEMP)) /
+                     ((TEMP_SENSOR_CAL2 - TEMP_SENSOR_CAL1) * TEMP_SENSOR_OVERSAMPLE));
+}
@@ -0,0 +1,55 @@
+/*
+ * Shared by the host tests: failure counting and a reproducible pseudo
+ * random sequence, each test binary has its own copy.
+ *
+ *     CHECK(s.count == n, "count %u", s.count);
+ *     return check_result("pps_stats");
+ */
+
+#ifndef CHECK_H
+#define CHECK_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+static int failures;
+static uint32_t rng = 1;
+
+#define CHECK(cond, ...) do { \
+    if (!(cond)) { printf("FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); printf("\n"); failures++; } \
+} while (0)
+
+static inline uint32_t random_next(void)
+{
+    rng = rng * 1103515245 + 12345;
+    return rng;
+}
+
+/* Full 32 bits, from the high halves of two steps */
+static inline uint32_t random32(void)
+{
+    uint32_t hi = random_next() & 0xFFFF0000;
+
+    return hi | (random_next() >> 16);
+}
+
+/* Uniform in [-amplitude, amplitude], any amplitude up to INT32_MAX */
+static inline int32_t noise(int32_t amplitude)
+{
+    return (int32_t)(((uint64_t)(random_next() >> 1) * (2 * (uint64_t)amplitude + 1)) >> 31) - amplitude;
+}
+
+/* Uniform in [-amplitude, amplitude) */
+static inline float noisef(float amplitude)
+{
+    return amplitude * (((random_next() >> 8) & 0xFFFF) / 32768.0f - 1.0f);
+}
+
+/* Result line of the test, then its exit status */
+static inline int check_result(const char *name)
+{
+    printf("%s: %s\n", name, failures ? "FAILED" : "ok");
+    return failures != 0;
+}
+
+#endif // CHECK_H
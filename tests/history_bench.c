@@ -0,0 +1,200 @@
+/*
+ * Host benchmark of the servo history encoder of app/src/history.c.
+ *
+ * Servo update traces are written with history_update(), the time taken
+ * and the bytes stored per update are reported, then every update is read
+ * back with history_query_next() and compared. Traces are synthetic, or
+ * CSV files as returned by GET /history on the board:
+ *
+ *     ./history_bench [trace.csv ...]
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "history.h"
+
+/* The SDRAM area is an array here */
+static uint8_t history_area[HISTORY_SIZE] __attribute__((aligned(HISTORY_BLOCK)));
+#undef HISTORY_ADDR
+#define HISTORY_ADDR ((uintptr_t)history_area)
+
+#include "../app/src/history.c"
+
+/* Updates kept for the check, below the capacity of the area */
+#define TRACE_MAX   200000
+
+typedef struct trace {
+    const char *name;
+    uint32_t count;
+    ServoSample s[TRACE_MAX];
+} trace_t;
+
+static trace_t trace;
+static uint32_t rng = 12345;
+
+bool ptpd_add_sample_callback(void (*cb)(const ServoSample *sample))
+{
+    (void)cb;
+    return TRUE;
+}
+
+static int32_t noise(int32_t amplitude)
+{
+    rng = rng * 1103515245 + 12345;
+    return amplitude ? (int32_t)((rng >> 8) % (2 * (uint32_t)amplitude + 1)) - amplitude : 0;
+}
+
+static void add_ns(ServoSample *s, int64_t ns)
+{
+    int64_t t = (int64_t)s->nanoseconds + ns;
+
+    s->seconds += (uint32_t)(t / 1000000000LL);
+    s->nanoseconds = (uint32_t)(t % 1000000000LL);
+}
+
+/*
+ * A slave at 2^-log_interval updates per second: the offset is noise of
+ * jitter ns, the delay wanders around 5 us, the drift walks slowly, Sync
+ * ingress times carry a few us of jitter. Locking starts far off with the
+ * port uncalibrated.
+ */
+static void synth(const char *name, int log_interval, int32_t jitter, uint32_t count, uint8_t locking)
+{
+    int64_t interval = 1000000000LL >> log_interval;
+    ServoSample s = { 1700000000, 123456789, 0, 5000, -1200, PTP_SLAVE };
+    int32_t offset = locking ? 80000 : 0;
+    uint32_t i;
+
+    trace.name = name;
+    trace.count = count;
+
+    for (i = 0; i < count; i++) {
+        if (locking) {
+            s.portState = offset > 1000 || offset < -1000 ? PTP_UNCALIBRATED : PTP_SLAVE;
+            offset = offset * 9 / 10;
+        }
+        s.offsetFromMaster = offset + noise(jitter);
+        s.meanPathDelay = 5000 + noise(jitter / 4);
+        s.observedDrift += noise(1);
+        trace.s[i] = s;
+        add_ns(&s, interval + noise(2000));
+    }
+}
+
+static int load(const char *path)
+{
+    char line[160];
+    unsigned long sec, nsec;
+    long offset, delay, drift;
+    unsigned state;
+    FILE *f = fopen(path, "r");
+
+    if (f == NULL) {
+        perror(path);
+        return -1;
+    }
+
+    trace.name = path;
+    trace.count = 0;
+
+    while (trace.count < TRACE_MAX && fgets(line, sizeof(line), f) != NULL) {
+        ServoSample *s = &trace.s[trace.count];
+
+        /* Header and downsampled CSV are skipped */
+        if (sscanf(line, "%lu,%lu,%ld,%ld,%ld,%u", &sec, &nsec, &offset, &delay, &drift, &state) != 6) {
+            continue;
+        }
+        s->seconds = sec;
+        s->nanoseconds = nsec;
+        s->offsetFromMaster = offset;
+        s->meanPathDelay = delay;
+        s->observedDrift = drift;
+        s->portState = state;
+        trace.count++;
+    }
+
+    fclose(f);
+    return trace.count > 0 ? 0 : -1;
+}
+
+static int same(const ServoSample *a, const ServoSample *b)
+{
+    return a->seconds == b->seconds && a->nanoseconds == b->nanoseconds &&
+           a->offsetFromMaster == b->offsetFromMaster && a->meanPathDelay == b->meanPathDelay &&
+           a->observedDrift == b->observedDrift && a->portState == b->portState;
+}
+
+static double now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/* Encode the trace, read it back, 0 if every update matches */
+static int run(void)
+{
+    static history_query_t q;
+    ServoSample out;
+    double start, elapsed;
+    uint32_t i, n = 0, bad = 0;
+
+    history_reset();
+
+    start = now_ns();
+    for (i = 0; i < trace.count; i++) {
+        history_update(&trace.s[i]);
+    }
+    elapsed = now_ns() - start;
+
+    history_query_open(&q, 0, UINT32_MAX);
+    while (history_query_next(&q, &out)) {
+        if (n >= trace.count || !same(&out, &trace.s[n])) {
+            if (bad++ == 0) {
+                printf("  mismatch at update %u\n", n);
+            }
+        }
+        n++;
+    }
+    if (n != trace.count) {
+        printf("  read %u of %u updates\n", n, trace.count);
+        bad++;
+    }
+
+    printf("%-28s %8u %10.2f %10.1f %8u %s\n", trace.name, trace.count,
+           (double)hist.bytes / hist.updates, elapsed / trace.count,
+           hist.seq, bad ? "FAIL" : "ok");
+
+    return bad ? 1 : 0;
+}
+
+int main(int argc, char **argv)
+{
+    int i, failed = 0;
+
+    printf("%-28s %8s %10s %10s %8s\n", "trace", "updates", "bytes/upd", "ns/upd", "blocks");
+
+    if (argc > 1) {
+        for (i = 1; i < argc; i++) {
+            failed |= load(argv[i]) != 0 || run() != 0;
+        }
+        return failed;
+    }
+
+    synth("slave 1/s, 20 ns", 0, 20, 86400, 0);
+    failed |= run();
+    synth("slave 16/s, 20 ns", 4, 20, TRACE_MAX, 0);
+    failed |= run();
+    synth("slave 128/s, 50 ns", 7, 50, TRACE_MAX, 0);
+    failed |= run();
+    synth("slave 1/s, 2 us", 0, 2000, 86400, 0);
+    failed |= run();
+    synth("locking 16/s", 4, 20, 20000, 1);
+    failed |= run();
+
+    return failed;
+}
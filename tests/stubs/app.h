@@ -0,0 +1,13 @@
+#ifndef _app_h_
+#define _app_h_
+
+/* Host build of the app modules: the log goes to stdout */
+
+#include <stdio.h>
+
+#define LOG_PRINT(...)  do { printf(__VA_ARGS__); printf("\n"); } while (0)
+#define LOG_INF(...)    LOG_PRINT("INFO: " __VA_ARGS__)
+#define LOG_WRN(...)    LOG_PRINT("WARN: " __VA_ARGS__)
+#define LOG_ERR(...)    LOG_PRINT("ERROR: " __VA_ARGS__)
+
+#endif
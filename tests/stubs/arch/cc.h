@@ -0,0 +1,12 @@
+#ifndef CC_H_
+#define CC_H_
+
+/* Host build of lwIP: compiler and platform of the test machine */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define LWIP_PLATFORM_DIAG(x)   do { printf x; } while (0)
+#define LWIP_PLATFORM_ASSERT(x) do { printf("assertion \"%s\" failed at line %d in %s\n", x, __LINE__, __FILE__); abort(); } while (0)
+
+#endif
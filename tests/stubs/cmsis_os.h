@@ -0,0 +1,18 @@
+#ifndef CMSIS_OS_H_
+#define CMSIS_OS_H_
+
+/* Host build of the app modules: one thread, nothing to lock */
+
+#include <stdint.h>
+
+#define taskENTER_CRITICAL()
+#define taskEXIT_CRITICAL()
+
+typedef enum {
+    osOK = 0,
+    osErrorResource = 0x81,
+    osErrorNoMemory = 0x85,
+    osErrorOS = 0xFF
+} osStatus;
+
+#endif
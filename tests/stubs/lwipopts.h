@@ -0,0 +1,22 @@
+#ifndef LWIPOPTS_H_
+#define LWIPOPTS_H_
+
+/* Host build of the lwIP SNMP agent: no threads, pbufs but no stack behind them */
+
+#define NO_SYS                  1
+#define SYS_LIGHTWEIGHT_PROT    0
+#define LWIP_NETCONN            0
+#define LWIP_SOCKET             0
+#define LWIP_IPV6               0
+#define LWIP_UDP                1
+#define LWIP_TCP                0
+
+/* pbufs for the SNMP messages come from the C library */
+#define MEM_LIBC_MALLOC         1
+#define MEMP_MEM_MALLOC         1
+
+#define LWIP_SNMP               1
+#define SNMP_LWIP_MIB2          0
+#define SNMP_USE_RAW            1
+
+#endif
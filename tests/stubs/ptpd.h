@@ -0,0 +1,153 @@
+#ifndef PTPD_H_
+#define PTPD_H_
+
+/* Host build of the app modules: the ptpd types they use */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef FALSE
+#define FALSE 0
+#define TRUE 1
+#endif
+
+#define CLOCK_IDENTITY_LENGTH 8
+
+typedef unsigned char enum8bit_t;
+typedef unsigned char uint4bit_t;
+typedef char octet_t;
+
+enum {
+    PTP_INITIALIZING = 0, PTP_FAULTY, PTP_DISABLED, PTP_LISTENING, PTP_PRE_MASTER,
+    PTP_MASTER, PTP_PASSIVE, PTP_UNCALIBRATED, PTP_SLAVE
+};
+
+enum {
+    RX_DROP_SHORT = 0, RX_DROP_DOMAIN, RX_DROP_NOT_ACCEPTABLE, RX_DROP_RATE, RX_DROP_QUEUE_FULL,
+    RX_DROP_COUNT
+};
+
+/* Data sets and counters as in datatypes.h */
+
+typedef octet_t ClockIdentity[CLOCK_IDENTITY_LENGTH];
+
+typedef struct
+{
+    ClockIdentity clockIdentity;
+    int16_t portNumber;
+} PortIdentity;
+
+typedef struct
+{
+    uint8_t clockClass;
+    enum8bit_t clockAccuracy;
+    int16_t offsetScaledLogVariance;
+} ClockQuality;
+
+typedef struct
+{
+    int32_t seconds;
+    int32_t nanoseconds;
+} TimeInternal;
+
+typedef struct
+{
+    bool twoStepFlag;
+    ClockIdentity clockIdentity;
+    int16_t numberPorts;
+    ClockQuality clockQuality;
+    uint8_t priority1;
+    uint8_t priority2;
+    uint8_t domainNumber;
+    bool slaveOnly;
+    bool transportSpecific;
+} DefaultDS;
+
+typedef struct
+{
+    int16_t stepsRemoved;
+    TimeInternal offsetFromMaster;
+    TimeInternal meanPathDelay;
+} CurrentDS;
+
+typedef struct
+{
+    PortIdentity parentPortIdentity;
+    bool parentStats;
+    int16_t observedParentOffsetScaledLogVariance;
+    int32_t observedParentClockPhaseChangeRate;
+    ClockIdentity grandmasterIdentity;
+    ClockQuality grandmasterClockQuality;
+    uint8_t grandmasterPriority1;
+    uint8_t grandmasterPriority2;
+} ParentDS;
+
+typedef struct
+{
+    int16_t currentUtcOffset;
+    bool currentUtcOffsetValid;
+    bool leap59;
+    bool leap61;
+    bool timeTraceable;
+    bool frequencyTraceable;
+    bool ptpTimescale;
+    enum8bit_t timeSource;
+} TimePropertiesDS;
+
+typedef struct
+{
+    PortIdentity portIdentity;
+    enum8bit_t portState;
+    int8_t logMinDelayReqInterval;
+    TimeInternal peerMeanPathDelay;
+    int8_t logAnnounceInterval;
+    uint8_t announceReceiptTimeout;
+    int8_t logSyncInterval;
+    enum8bit_t delayMechanism;
+    int8_t logMinPdelayReqInterval;
+    uint4bit_t versionNumber;
+} PortDS;
+
+typedef struct
+{
+    DefaultDS defaultDS;
+    CurrentDS currentDS;
+    ParentDS parentDS;
+    TimePropertiesDS timePropertiesDS;
+    PortDS portDS;
+} PtpDataSets;
+
+typedef struct
+{
+    uint8_t portState;
+    uint32_t stateChanges;
+    uint32_t syncSequenceGaps;
+    uint32_t orphanSyncs;
+    uint32_t orphanFollowUps;
+    uint32_t lateDelayResps;
+    uint32_t expiredDelayReqs;
+    uint32_t servoUpdates;
+    uint32_t clockSteps;
+    uint32_t standbySwitches;
+    uint32_t rxDropped[RX_DROP_COUNT];
+    uint32_t txBusy;
+    int32_t offsetFromMaster;
+    int32_t meanPathDelay;
+    int32_t observedDrift;
+} PtpCounters;
+
+typedef struct
+{
+    uint32_t seconds;
+    uint32_t nanoseconds;
+    int32_t offsetFromMaster;
+    int32_t meanPathDelay;
+    int32_t observedDrift;
+    uint8_t portState;
+} ServoSample;
+
+bool ptpd_add_sample_callback(void (*cb)(const ServoSample *sample));
+void ptpd_get_counters(PtpCounters *counters);
+void ptpd_get_datasets(PtpDataSets *ds);
+
+#endif
@@ -0,0 +1,242 @@
+/*
+ * Host test of the dashboard drawing of app/src/dash_draw.c.
+ *
+ * A servo run of two chart sweeps is drawn into an array the way the display
+ * task does it. Each render may only touch the labels marked dirty and
+ * the chart columns due, must stay within its pixel budget, and once the
+ * renders caught up the screen must be the same as a whole redraw of the
+ * same state.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "check.h"
+#include "dash_draw.h"
+
+#define UPDATES     (2 * DASH_CHART_WIDTH + 100)   /* the sweep wraps twice */
+#define PIXELS      (DASH_WIDTH * DASH_HEIGHT)
+
+/* Largest item drawn whole once started: a Font24 or Font16 header label */
+#define OVERSHOOT   (460 * 16)
+
+static uint32_t screen[PIXELS], before[PIXELS], reference[PIXELS];
+static uint8_t allowed[PIXELS];
+static dash_t dash, whole;
+
+/* Locking from 20 us off, then a slave with some jitter */
+static void servo_state(dash_state_t *s, int i)
+{
+    static const uint8_t gm[8] = { 0x00, 0x1b, 0x21, 0xff, 0xfe, 0x12, 0x34, 0x56 };
+
+    memset(s, 0, sizeof(*s));
+    memcpy(s->grandmaster, gm, sizeof(gm));
+    s->gm_class = 6;
+    s->domain = 0;
+    s->utc_offset = 37;
+    s->utc_valid = 1;
+    s->steps_removed = 1;
+    s->state_changes = i < 60 ? 2 : 3;
+    s->port_state = i < 60 ? "UNCALIBRATED" : "SLAVE";
+    s->health = i < 60 ? DASH_HEALTH_WARN : DASH_HEALTH_OK;
+    s->updates = i + 1;
+    s->offset = (int32_t)(20000 * exp(-i / 25.0) * cos(i / 5.0)) + noise(20);
+    s->delay = 4980 + noise(20);
+    s->drift = -1200 + (int32_t)(300 * exp(-i / 60.0)) + noise(2);
+    s->gaps = i / 100;
+}
+
+static void init(dash_t *d, uint32_t *pixels)
+{
+    dash_fb_t fb = { pixels, DASH_WIDTH, DASH_HEIGHT, DASH_WIDTH };
+
+    dash_init(d, &fb);
+}
+
+static uint32_t render_all(dash_t *d)
+{
+    uint32_t used, total = 0;
+
+    while ((used = dash_render(d, UINT32_MAX)) != 0) {
+        total += used;
+    }
+
+    return total;
+}
+
+static void allow(int x, int y, int w, int h)
+{
+    int i;
+
+    for (; h > 0; h--, y++) {
+        for (i = 0; i < w; i++) {
+            allowed[y * DASH_WIDTH + x + i] = 1;
+        }
+    }
+}
+
+static void allow_label(const dash_label_t *l)
+{
+    if (l->dirty) {
+        allow(l->x, l->y, l->w, l->font->Height);
+    }
+}
+
+/* Mark what the next render may change: dirty labels and due chart columns */
+static void allow_dirty(const dash_t *d)
+{
+    const dash_chart_t *c;
+    uint32_t n;
+    int i;
+
+    memset(allowed, 0, sizeof(allowed));
+
+    allow_label(&d->state);
+    allow_label(&d->master);
+    for (i = 0; i < DASH_ROWS; i++) {
+        allow_label(&d->names[i]);
+        allow_label(&d->values[i]);
+    }
+
+    for (i = 0; i < 3; i++) {
+        c = &d->charts[i];
+        allow_label(&c->title);
+        if (c->redraw < c->w || c->count - c->drawn > (uint32_t)(c->w - DASH_CHART_GAP)) {
+            allow(c->x, c->y, c->w, c->h);
+            continue;
+        }
+        for (n = c->drawn; n < c->count; n++) {
+            allow(c->x + n % c->w, c->y, 1, c->h);
+            allow(c->x + (n + DASH_CHART_GAP) % c->w, c->y, 1, c->h);
+        }
+    }
+}
+
+static uint32_t changed(const uint32_t *a, const uint32_t *b, uint32_t *outside)
+{
+    uint32_t i, n = 0;
+
+    *outside = 0;
+    for (i = 0; i < PIXELS; i++) {
+        if (a[i] != b[i]) {
+            n++;
+            *outside += !allowed[i];
+        }
+    }
+
+    return n;
+}
+
+/* First screen: everything is drawn, over as many renders as the budget needs */
+static void test_first(void)
+{
+    uint32_t used, renders = 0, i, blank = 0;
+
+    memset(screen, 0, sizeof(screen));
+    init(&dash, screen);
+
+    while ((used = dash_render(&dash, 20000)) != 0) {
+        CHECK(used <= 20000 + OVERSHOOT, "first screen render of %u pixels, budget 20000", used);
+        renders++;
+    }
+    for (i = 0; i < PIXELS; i++) {
+        blank += screen[i] == 0;
+    }
+
+    CHECK(renders > 1, "first screen drawn in %u render", renders);
+    CHECK(blank == 0, "%u pixels never drawn", blank);
+}
+
+/* Servo updates drawn as they come, with all the budget they need */
+static void test_updates(void)
+{
+    dash_state_t s;
+    uint32_t used, n, outside, total = 0, rescales = 0, worst = 0, i;
+    int k;
+
+    for (k = 0; k < UPDATES; k++) {
+        servo_state(&s, k);
+        dash_update(&dash, &s);
+        for (i = 0; i < 3; i++) {
+            rescales += dash.charts[i].redraw < dash.charts[i].w;
+        }
+
+        allow_dirty(&dash);
+        memcpy(before, screen, sizeof(screen));
+        used = render_all(&dash);
+        n = changed(before, screen, &outside);
+
+        CHECK(outside == 0, "update %d changed %u pixels outside the dirty regions", k, outside);
+        CHECK(n <= used, "update %d changed %u pixels, %u reported", k, n, used);
+        total += used;
+        if (used > worst) worst = used;
+    }
+
+    printf("%d updates: %u pixels per update, worst %u, %u chart rescales\n",
+           UPDATES, total / UPDATES, worst, rescales);
+
+    /* The same state again draws nothing */
+    dash_update(&dash, &s);
+    used = dash_render(&dash, UINT32_MAX);
+    CHECK(used == 0, "unchanged state drew %u pixels", used);
+
+    /* Incremental drawing ends where a whole redraw of the state does */
+    init(&whole, reference);
+    rng = 1;
+    for (k = 0; k < UPDATES; k++) {
+        servo_state(&s, k);
+        dash_update(&whole, &s);
+    }
+    render_all(&whole);
+    CHECK(memcmp(screen, reference, sizeof(screen)) == 0, "screen differs from a whole redraw");
+}
+
+/* A small budget per frame: renders stay within it and catch up */
+static void test_budget(void)
+{
+    dash_state_t s;
+    uint32_t used, budget = 3000, frames = 0, behind = 0;
+    int k;
+
+    rng = 7;
+    init(&dash, screen);
+    render_all(&dash);
+
+    for (k = 0; k < UPDATES; k++) {
+        servo_state(&s, k);
+        dash_update(&dash, &s);
+        used = dash_render(&dash, budget);
+        CHECK(used <= budget + OVERSHOOT, "update %d drew %u pixels, budget %u", k, used, budget);
+        frames++;
+    }
+    while ((used = dash_render(&dash, budget)) != 0) {
+        CHECK(used <= budget + OVERSHOOT, "catching up drew %u pixels, budget %u", used, budget);
+        behind++;
+    }
+    printf("budget %u: %u frames to catch up after %u\n", budget, behind, frames);
+
+    init(&whole, reference);
+    rng = 7;
+    for (k = 0; k < UPDATES; k++) {
+        servo_state(&s, k);
+        dash_update(&whole, &s);
+    }
+    render_all(&whole);
+    CHECK(memcmp(screen, reference, sizeof(screen)) == 0, "screen drawn within a budget differs from a whole redraw");
+
+    /* Invalidated, everything is drawn again to the same picture */
+    dash_invalidate(&dash);
+    memset(screen, 0, sizeof(screen));
+    render_all(&dash);
+    CHECK(memcmp(screen, reference, sizeof(screen)) == 0, "screen differs after dash_invalidate");
+}
+
+int main(void)
+{
+    test_first();
+    test_updates();
+    test_budget();
+
+    return check_result("dash_draw");
+}
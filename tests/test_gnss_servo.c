@@ -0,0 +1,198 @@
+/*
+ * Host test of the GNSS servo of app/src/gnss_servo.c and of the PPS
+ * capture conversion of pps_capture.h.
+ *
+ * A PHC with a frequency error is disciplined to a 1 Hz reference: each
+ * second its offset moves by the frequency error plus the correction the
+ * servo returned, a step takes the offset out the way gnss.c does.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "check.h"
+#include "gnss_servo.h"
+#include "pps_capture.h"
+
+typedef struct phc {
+    double offset;      /* ns, PHC minus reference */
+    double error;       /* ppb, free running frequency error */
+    uint32_t steps;
+} phc_t;
+
+/* One second: sample, apply the correction, let the PHC run */
+static void second(gnss_servo_t *s, phc_t *phc, int32_t jitter)
+{
+    if (gnss_servo_sample(s, (int32_t)phc->offset + noise(jitter)) == GNSS_SERVO_STEP) {
+        phc->offset = 0;
+        phc->steps++;
+    }
+    phc->offset += phc->error + s->freq;
+}
+
+/* From far off: one step, then locked on the learned frequency */
+static void test_lock(void)
+{
+    gnss_servo_t s;
+    phc_t phc = { 2500000, 4321, 0 };
+    int i, locked_at = -1;
+
+    gnss_servo_init(&s);
+    CHECK(s.state == GNSS_SERVO_UNLOCKED, "initial state %s", gnss_servo_state_name(s.state));
+
+    for (i = 0; i < 300; i++) {
+        second(&s, &phc, 20);
+        if (s.state == GNSS_SERVO_LOCKED && locked_at < 0) {
+            locked_at = i;
+        }
+    }
+
+    CHECK(phc.steps == 1, "%u steps, one expected", phc.steps);
+    CHECK(locked_at > 0 && locked_at < 120, "locked after %d s", locked_at);
+    CHECK(s.state == GNSS_SERVO_LOCKED, "state %s after 300 s", gnss_servo_state_name(s.state));
+    CHECK(abs(s.freq + 4321) < 50, "correction %ld ppb for a 4321 ppb error", (long)s.freq);
+    CHECK(abs((int32_t)phc.offset) < 100, "offset %.0f ns after 300 s", phc.offset);
+}
+
+/* Lock needs lock_samples good samples in a row, one bad sample loses it */
+static void test_lock_samples(void)
+{
+    gnss_servo_t s;
+    int i;
+
+    gnss_servo_init(&s);
+    for (i = 0; i < s.lock_samples - 1; i++) {
+        gnss_servo_sample(&s, 10);
+    }
+    CHECK(s.state == GNSS_SERVO_UNLOCKED, "%s after %d good samples", gnss_servo_state_name(s.state), i);
+    gnss_servo_sample(&s, s.lock_threshold + 1);
+    CHECK(s.state == GNSS_SERVO_LOCKING, "%s after a bad sample", gnss_servo_state_name(s.state));
+
+    for (i = 0; i < s.lock_samples; i++) {
+        CHECK(s.state != GNSS_SERVO_LOCKED, "locked after %d good samples", i);
+        gnss_servo_sample(&s, -s.lock_threshold);
+    }
+    CHECK(s.state == GNSS_SERVO_LOCKED, "%s after %d good samples", gnss_servo_state_name(s.state), i);
+
+    gnss_servo_sample(&s, s.lock_threshold + 1);
+    CHECK(s.state == GNSS_SERVO_LOCKING, "%s after a bad sample while locked", gnss_servo_state_name(s.state));
+}
+
+/* A step keeps the frequency, only the phase was off */
+static void test_step(void)
+{
+    gnss_servo_t s;
+    phc_t phc = { 0, -800, 0 };
+    float integral;
+    int i;
+
+    gnss_servo_init(&s);
+    for (i = 0; i < 200; i++) {
+        second(&s, &phc, 0);
+    }
+    integral = s.integral;
+
+    CHECK(gnss_servo_sample(&s, s.step_threshold + 1) == GNSS_SERVO_STEP, "offset past the threshold not stepped");
+    CHECK(s.state == GNSS_SERVO_LOCKING && s.good == 0, "state %s after a step", gnss_servo_state_name(s.state));
+    CHECK(s.integral == integral && s.freq == (int32_t)-integral, "frequency %ld changed by the step", (long)s.freq);
+    CHECK(gnss_servo_sample(&s, -s.step_threshold) == GNSS_SERVO_ADJUST, "offset at the threshold stepped");
+}
+
+/* Missing samples: holdover on the learned frequency, then unlocked */
+static void test_holdover(void)
+{
+    gnss_servo_t s;
+    phc_t phc = { 0, 1500, 0 };
+    uint32_t i;
+
+    gnss_servo_init(&s);
+    s.holdover_timeout = 100;
+    for (i = 0; i < 200; i++) {
+        second(&s, &phc, 5);
+    }
+    CHECK(s.state == GNSS_SERVO_LOCKED, "not locked before holdover");
+
+    for (i = 1; i < s.missed_max; i++) {
+        gnss_servo_tick(&s);
+    }
+    CHECK(s.state == GNSS_SERVO_LOCKED, "%s after %u missed samples", gnss_servo_state_name(s.state), i - 1);
+    gnss_servo_tick(&s);
+    CHECK(s.state == GNSS_SERVO_HOLDOVER, "%s after %u missed samples", gnss_servo_state_name(s.state), i);
+    CHECK(s.freq == (int32_t)-s.integral && abs(s.freq + 1500) < 10, "holdover frequency %ld", (long)s.freq);
+
+    /* Holdover time counts from the last sample */
+    for (i = s.missed_max; i < s.holdover_timeout - 1; i++) {
+        gnss_servo_tick(&s);
+    }
+    CHECK(s.state == GNSS_SERVO_HOLDOVER, "%s after %u s", gnss_servo_state_name(s.state), i);
+    gnss_servo_tick(&s);
+    CHECK(s.state == GNSS_SERVO_UNLOCKED, "%s after the holdover timeout", gnss_servo_state_name(s.state));
+
+    /* While locking, missing samples unlock at once */
+    gnss_servo_sample(&s, 5000);
+    CHECK(s.state == GNSS_SERVO_LOCKING, "%s after a sample", gnss_servo_state_name(s.state));
+    for (i = 0; i < s.missed_max; i++) {
+        gnss_servo_tick(&s);
+    }
+    CHECK(s.state == GNSS_SERVO_UNLOCKED, "%s after missed samples while locking", gnss_servo_state_name(s.state));
+}
+
+/* Corrections never pass freq_max, whatever the offsets */
+static void test_clamp(void)
+{
+    gnss_servo_t s;
+    int i;
+
+    gnss_servo_init(&s);
+    for (i = 0; i < 100; i++) {
+        gnss_servo_sample(&s, s.step_threshold);
+        CHECK(abs(s.freq) <= s.freq_max && s.integral <= s.freq_max, "correction %ld past the limit", (long)s.freq);
+    }
+    CHECK(s.freq == -s.freq_max, "correction %ld, limit %ld", (long)s.freq, (long)s.freq_max);
+}
+
+/* Capture ticks to PHC second and offset, folded into [-0.5 s, 0.5 s) */
+static void test_capture_edge(void)
+{
+    static const struct {
+        int32_t ticks;
+        uint32_t period;
+        uint32_t sec;
+        int32_t offset;
+    } cases[] = {
+        { 0, 100000000, 1000, 0 },
+        { 12, 100000000, 1000, 120 },
+        { -12, 100000000, 1000, -120 },
+        { 99999988, 100000000, 1001, -120 },        /* just before the next second */
+        { -99999988, 100000000, 999, 120 },
+        { 49999999, 100000000, 1000, 499999990 },
+        { 50000000, 100000000, 1001, -500000000 },
+        { -50000000, 100000000, 1000, -500000000 },
+        { 200000005, 100000000, 1002, 50 },        /* reference two seconds old */
+        { 100000100, 100000100, 1001, 0 },         /* timer clock 1 ppm fast */
+    };
+    pps_edge_t edge;
+    unsigned i;
+
+    for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        pps_capture_edge(1000, cases[i].ticks, cases[i].period, &edge);
+        CHECK(edge.sec == cases[i].sec && edge.offset == cases[i].offset,
+              "%ld ticks: %lu %+ld, expected %lu %+ld", (long)cases[i].ticks,
+              (unsigned long)edge.sec, (long)edge.offset, (unsigned long)cases[i].sec, (long)cases[i].offset);
+    }
+}
+
+int main(void)
+{
+    test_lock();
+    test_lock_samples();
+    test_step();
+    test_holdover();
+    test_clamp();
+    test_capture_edge();
+
+    CHECK(strcmp(gnss_servo_state_name(GNSS_SERVO_HOLDOVER), "holdover") == 0, "state name");
+    CHECK(strcmp(gnss_servo_state_name(200), "?") == 0, "unknown state name");
+
+    return check_result("gnss_servo");
+}
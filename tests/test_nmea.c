@@ -0,0 +1,202 @@
+/*
+ * Host test of the NMEA parser of app/src/nmea.c.
+ *
+ * A synthetic receiver feed is parsed the way the GNSS thread does it, one
+ * character at a time: RMC and ZDA time of day with its validity, checksum
+ * errors, sentences split or cut short, and the second, day, month and
+ * year rollovers the PHC seconds are compared against.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "check.h"
+#include "nmea.h"
+
+/* Sentence of body with its checksum and CR LF */
+static const char *sentence(const char *body)
+{
+    static char buf[128];
+    uint8_t sum = 0;
+    const char *p;
+
+    for (p = body; *p; p++) {
+        sum ^= (uint8_t)*p;
+    }
+    snprintf(buf, sizeof(buf), "$%s*%02X\r\n", body, sum);
+
+    return buf;
+}
+
+/* Feed a string, returns the number of times were completed */
+static int feed(nmea_parser_t *parser, const char *s, nmea_time_t *time)
+{
+    int n = 0;
+
+    while (*s) {
+        n += nmea_feed(parser, *s++, time);
+    }
+
+    return n;
+}
+
+static void test_parse(void)
+{
+    static const struct {
+        const char *sentence;
+        int result;
+        uint32_t utc;
+        uint8_t valid;
+    } cases[] = {
+        { "$GPRMC,123519,A,4807.038,N,01131.000,E,022.4,084.4,230394,003.1,W*6A", 1, 764426119, 1 },
+        { "$GPRMC,123519,A,4807.038,N,01131.000,E,022.4,084.4,230394,003.1,W", 1, 764426119, 1 },
+        { "$GNRMC,123519.00,V,,,,,,,230394,,,N", 1, 764426119, 0 },     /* time without a fix */
+        { "$GPZDA,201530.00,04,07,2002,00,00*60", 1, 1025813730, 1 },
+        { "$GPRMC,000000,A,,,,,,,290224,,", 1, 1709164800, 1 },
+        { "$GPRMC,235959,A,,,,,,,311279,,", 1, 3471292799UL, 1 },       /* two digit year up to 2079 */
+        { "$GPRMC,000000,A,,,,,,,010180,,", 1, 315532800, 1 },          /* and from 1980 */
+        { "$GPRMC,123519,A,4807.038,N,01131.000,E,022.4,084.4,230394,003.1,W*6B", -1, 0, 0 },
+        { "$GPRMC,123519,A,4807.038,N,01131.000,E,022.4,084.4,230394,003.1,W*6", -1, 0, 0 },
+        { "$GPRMC,123519,A,4807.038,N,01131.000,E,022.4,084.4,230394,003.1,W*", -1, 0, 0 },
+        { "$GPRMC,243519,A,,,,,,,230394,,", -1, 0, 0 },                 /* hour */
+        { "$GPRMC,123519,A,,,,,,,231394,,", -1, 0, 0 },                 /* month */
+        { "$GPRMC,12351,A,,,,,,,230394,,", -1, 0, 0 },                  /* short time */
+        { "$GPRMC,123519,A,,,,,,,2303,,", -1, 0, 0 },                   /* short date */
+        { "$GPRMC,123519,A,,,,,,,", -1, 0, 0 },                         /* no date field */
+        { "$GPZDA,201530.00,04,07,02,00,00", -1, 0, 0 },                /* two digit year */
+        { "$GPZDA,201530.00,4,07,2002,00,00", -1, 0, 0 },
+        { "$GPGSV,3,1,11,03,03,111,00,04,15,270,00,06,01,010,00,13,06,292,00*74", 0, 0, 0 },
+        { "$PUBX,04,073731.00,091202,113851.00,1196,15D,1930035,-2660.664,43,*5D", 0, 0, 0 },
+        { "GPRMC,123519,A,,,,,,,230394,,", -1, 0, 0 },                  /* no '$' */
+    };
+    nmea_time_t t;
+    unsigned i;
+    int res;
+
+    for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        memset(&t, 0, sizeof(t));
+        res = nmea_parse(cases[i].sentence, &t);
+        CHECK(res == cases[i].result, "%s: %d, expected %d", cases[i].sentence, res, cases[i].result);
+        if (res == 1) {
+            CHECK(t.utc == cases[i].utc && t.valid == cases[i].valid, "%s: utc %lu valid %u, expected %lu %u",
+                  cases[i].sentence, (unsigned long)t.utc, t.valid, (unsigned long)cases[i].utc, cases[i].valid);
+        }
+    }
+}
+
+/* Consecutive seconds stay one apart across every rollover */
+static void test_rollover(void)
+{
+    static const char *const pairs[][2] = {
+        { "GPRMC,123558.00,A,,,,,,,150624,,", "GPRMC,123559.00,A,,,,,,,150624,," },
+        { "GPRMC,123559.00,A,,,,,,,150624,,", "GPRMC,123600.00,A,,,,,,,150624,," },
+        { "GPRMC,235959.00,A,,,,,,,150624,,", "GPRMC,000000.00,A,,,,,,,160624,," },
+        { "GPRMC,235959.00,A,,,,,,,300624,,", "GPRMC,000000.00,A,,,,,,,010724,," },
+        { "GPRMC,235959.00,A,,,,,,,280224,,", "GPRMC,000000.00,A,,,,,,,290224,," },   /* leap year */
+        { "GPRMC,235959.00,A,,,,,,,290224,,", "GPRMC,000000.00,A,,,,,,,010324,," },
+        { "GPRMC,235959.00,A,,,,,,,280223,,", "GPRMC,000000.00,A,,,,,,,010323,," },
+        { "GPRMC,235959.00,A,,,,,,,281200,,", "GPRMC,000000.00,A,,,,,,,291200,," },   /* 2100 would not be */
+        { "GPRMC,235959.00,A,,,,,,,311299,,", "GPRMC,000000.00,A,,,,,,,010100,," },   /* 1999 to 2000 */
+        { "GPZDA,235959.00,31,12,2024,00,00", "GPZDA,000000.00,01,01,2025,00,00" },
+        { "GPZDA,235959.00,28,02,2100,00,00", "GPZDA,000000.00,01,03,2100,00,00" },
+    };
+    nmea_parser_t parser;
+    nmea_time_t a, b;
+    unsigned i;
+
+    for (i = 0; i < sizeof(pairs) / sizeof(pairs[0]); i++) {
+        memset(&parser, 0, sizeof(parser));
+        CHECK(feed(&parser, sentence(pairs[i][0]), &a) == 1, "%s not parsed", pairs[i][0]);
+        CHECK(feed(&parser, sentence(pairs[i][1]), &b) == 1, "%s not parsed", pairs[i][1]);
+        CHECK(b.utc - a.utc == 1, "%s then %s: %ld s apart", pairs[i][0], pairs[i][1], (long)(b.utc - a.utc));
+    }
+
+    /* A leap second reads as the first second of the next day */
+    nmea_parse(sentence("GPZDA,235960.00,31,12,2016,00,00"), &a);
+    nmea_parse(sentence("GPZDA,000000.00,01,01,2017,00,00"), &b);
+    CHECK(a.utc == b.utc, "leap second %lu, next day %lu", (unsigned long)a.utc, (unsigned long)b.utc);
+}
+
+/* nmea_mktime against the C library over the whole unsigned range */
+static void test_mktime(void)
+{
+    struct tm tm;
+    time_t t;
+    int i;
+
+    for (i = 0; i < 100000; i++) {
+        t = random32();
+        gmtime_r(&t, &tm);
+        CHECK(nmea_mktime(tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec) == (uint32_t)t,
+              "%04d-%02d-%02d %02d:%02d:%02d", tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec);
+        if (failures > 20) {
+            return;
+        }
+    }
+}
+
+/* The receiver feed as the UART delivers it */
+static void test_feed(void)
+{
+    nmea_parser_t parser;
+    nmea_time_t t;
+    char cut[64];
+    int i, n;
+
+    memset(&parser, 0, sizeof(parser));
+    memset(&t, 0, sizeof(t));
+
+    /* Noise before the first '$' and sentences that carry no time */
+    n = feed(&parser, "\xff garbage, no start\r\n", &t);
+    n += feed(&parser, sentence("GPGSA,A,3,04,05,,09,12,,,24,,,,,2.5,1.3,2.1"), &t);
+    CHECK(n == 0 && parser.errors == 0, "%d times, %lu errors from noise", n, (unsigned long)parser.errors);
+
+    /* A sentence split across reads, time is written once it ends */
+    strcpy(cut, sentence("GPZDA,201530.00,04,07,2002,00,00"));
+    n = strlen(cut) - 2;
+    for (i = 0; i < n; i++) {
+        CHECK(nmea_feed(&parser, cut[i], &t) == 0, "time before the end of the sentence at %d", i);
+    }
+    CHECK(t.utc == 0, "time written early");
+    CHECK(nmea_feed(&parser, '\r', &t) == 1 && nmea_feed(&parser, '\n', &t) == 0, "CR LF completes once");
+    CHECK(t.utc == 1025813730 && t.valid, "split sentence: utc %lu", (unsigned long)t.utc);
+
+    /* Bad checksums are counted, the time is kept */
+    n = feed(&parser, "$GPZDA,201531.00,04,07,2002,00,00*00\r\n", &t);
+    CHECK(n == 0 && parser.errors == 1 && t.utc == 1025813730, "bad checksum: %d times, %lu errors, utc %lu",
+          n, (unsigned long)parser.errors, (unsigned long)t.utc);
+
+    /* A sentence cut short by the next one is dropped without an error */
+    strcpy(cut, sentence("GPZDA,201532.00,04,07,2002,00,00"));
+    cut[20] = '\0';
+    n = feed(&parser, cut, &t);
+    n += feed(&parser, sentence("GPZDA,201533.00,04,07,2002,00,00"), &t);
+    CHECK(n == 1 && parser.errors == 1 && t.utc == 1025813733, "cut sentence: %d times, %lu errors, utc %lu",
+          n, (unsigned long)parser.errors, (unsigned long)t.utc);
+
+    /* A fix lost then found again */
+    feed(&parser, sentence("GPRMC,201534.00,V,,,,,,,040702,,,N"), &t);
+    CHECK(!t.valid && t.utc == 1025813734, "fix lost: valid %u utc %lu", t.valid, (unsigned long)t.utc);
+    feed(&parser, sentence("GPRMC,201535.00,A,,,,,,,040702,,,A"), &t);
+    CHECK(t.valid && t.utc == 1025813735, "fix found: valid %u utc %lu", t.valid, (unsigned long)t.utc);
+
+    /* Overlong sentences are counted and the parser recovers */
+    n = feed(&parser, "$GPTXT", &t);
+    for (i = 0; i < NMEA_MAX_SENTENCE; i++) {
+        n += nmea_feed(&parser, 'x', &t);
+    }
+    n += feed(&parser, "\r\n", &t);
+    CHECK(n == 0 && parser.errors == 2, "overlong: %d times, %lu errors", n, (unsigned long)parser.errors);
+    CHECK(feed(&parser, sentence("GPZDA,201536.00,04,07,2002,00,00"), &t) == 1 && t.utc == 1025813736,
+          "no time after an overlong sentence");
+}
+
+int main(void)
+{
+    test_parse();
+    test_rollover();
+    test_mktime();
+    test_feed();
+
+    return check_result("nmea");
+}
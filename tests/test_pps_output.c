@@ -0,0 +1,190 @@
+/*
+ * Host test of the pulse train arithmetic of pps_output.h and of the
+ * PHC time to timer count conversion of pps_capture.h.
+ *
+ * Train edges are checked against the definition, pulse n of a rate R
+ * train rises at phase + floor(n * 10^9 / R) ns, and edges converted to
+ * timer counts must come back to the same PHC time.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "check.h"
+#include "pps_output.h"
+
+static uint32_t edge_ns(const pps_output_cfg_t *cfg, uint32_t n)
+{
+    return (uint32_t)(((uint64_t)n * 1000000000ULL) / cfg->rate) + cfg->phase;
+}
+
+/* First edge at or after sec + ns, by walking the train */
+static pps_time_t first_edge(const pps_output_cfg_t *cfg, uint32_t sec, uint32_t ns)
+{
+    pps_time_t t = { sec + 1, cfg->phase };
+    uint32_t n;
+
+    for (n = 0; n < cfg->rate; n++) {
+        if (edge_ns(cfg, n) >= ns) {
+            t.sec = sec;
+            t.ns = edge_ns(cfg, n);
+            break;
+        }
+    }
+
+    return t;
+}
+
+static void test_check(void)
+{
+    static const struct {
+        pps_output_cfg_t cfg;
+        int valid;
+    } cases[] = {
+        { { 1, 100000000, 0 }, 1 },
+        { { 1, 999998000, 0 }, 1 },                         /* width up to the slot less the minimum */
+        { { 1, 999998001, 0 }, 0 },
+        { { 1, PPS_OUTPUT_MIN_WIDTH - 1, 0 }, 0 },
+        { { 1, 1000, 999999999 }, 0 },
+        { { 1, 2000, 999999999 }, 1 },
+        { { 1, 2000, 1000000000 }, 0 },                     /* phase within the slot */
+        { { 1000, 500000, 999999 }, 1 },
+        { { 1000, 500000, 1000000 }, 0 },
+        { { PPS_OUTPUT_MAX_RATE, 50000, 0 }, 1 },
+        { { PPS_OUTPUT_MAX_RATE, 98000, 0 }, 1 },
+        { { PPS_OUTPUT_MAX_RATE, 98001, 0 }, 0 },
+        { { PPS_OUTPUT_MAX_RATE + 1, 2000, 0 }, 0 },
+        { { 0, 2000, 999999999 }, 1 },                      /* one-shot triggers only */
+        { { 0, 1000, 0 }, 0 },
+    };
+    unsigned i;
+
+    for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        const pps_output_cfg_t *c = &cases[i].cfg;
+
+        CHECK((pps_output_check(c) == 0) == cases[i].valid, "rate %lu width %lu phase %lu %s",
+              (unsigned long)c->rate, (unsigned long)c->width, (unsigned long)c->phase,
+              cases[i].valid ? "refused" : "accepted");
+    }
+}
+
+/* Every edge of a second is found from just before it, at it and right after the previous one */
+static void test_train(const pps_output_cfg_t *cfg)
+{
+    pps_time_t t, want;
+    uint32_t n, ns, sec = 1700000000;
+
+    for (n = 0; n < cfg->rate; n++) {
+        ns = edge_ns(cfg, n);
+
+        pps_output_next(cfg, sec, ns, &t);
+        CHECK(t.sec == sec && t.ns == ns, "rate %lu: edge %lu at %lu found %lu.%09lu",
+              (unsigned long)cfg->rate, (unsigned long)n, (unsigned long)ns, (unsigned long)t.sec, (unsigned long)t.ns);
+
+        /* Moving past an edge gives the next one, the way the generator advances */
+        pps_output_next(cfg, sec, ns + 1, &t);
+        want = first_edge(cfg, sec, ns + 1);
+        CHECK(t.sec == want.sec && t.ns == want.ns, "rate %lu: after edge %lu found %lu.%09lu, expected %lu.%09lu",
+              (unsigned long)cfg->rate, (unsigned long)n, (unsigned long)t.sec, (unsigned long)t.ns,
+              (unsigned long)want.sec, (unsigned long)want.ns);
+
+        if (ns > 0) {
+            pps_output_next(cfg, sec, ns - 1, &t);
+            CHECK(t.sec == sec && t.ns == ns, "rate %lu: before edge %lu found %lu.%09lu",
+                  (unsigned long)cfg->rate, (unsigned long)n, (unsigned long)t.sec, (unsigned long)t.ns);
+        }
+    }
+
+    /* Random times */
+    for (n = 0; n < 10000; n++) {
+        ns = random32() % 1000000000UL;
+        pps_output_next(cfg, sec, ns, &t);
+        want = first_edge(cfg, sec, ns);
+        CHECK(t.sec == want.sec && t.ns == want.ns, "rate %lu phase %lu: from %lu found %lu.%09lu, expected %lu.%09lu",
+              (unsigned long)cfg->rate, (unsigned long)cfg->phase, (unsigned long)ns,
+              (unsigned long)t.sec, (unsigned long)t.ns, (unsigned long)want.sec, (unsigned long)want.ns);
+        if (failures > 20) {
+            return;
+        }
+    }
+}
+
+static void test_trains(void)
+{
+    static const pps_output_cfg_t trains[] = {
+        { 1, 100000000, 0 },
+        { 1, 2000, 999999999 },
+        { 3, 2000, 0 },                     /* edges at 0, 333333333, 666666666 */
+        { 7, 10000, 12345 },
+        { 10, 1000000, 50000000 },
+        { 1000, 2000, 0 },
+        { 9999, 2000, 100 },
+        { PPS_OUTPUT_MAX_RATE, 50000, 99999 },
+    };
+    pps_output_cfg_t none = { 0, 2000, 0 };
+    pps_time_t t;
+    unsigned i;
+
+    for (i = 0; i < sizeof(trains) / sizeof(trains[0]); i++) {
+        CHECK(pps_output_check(&trains[i]) == 0, "train %u not valid", i);
+        test_train(&trains[i]);
+    }
+
+    CHECK(pps_output_next(&none, 1, 0, &t) == -1, "edge of an empty train");
+}
+
+static void test_before(void)
+{
+    pps_time_t a = { 10, 999999999 }, b = { 11, 0 }, w0 = { 0xFFFFFFFF, 5 }, w1 = { 0, 1 };
+
+    CHECK(pps_time_before(&a, &b) && !pps_time_before(&b, &a), "10.999999999 and 11.0");
+    CHECK(!pps_time_before(&a, &a), "a time is not before itself");
+    CHECK(pps_time_before(&w0, &w1) && !pps_time_before(&w1, &w0), "seconds wrapping");
+}
+
+/* Timer counts of PHC times round trip through the capture conversion */
+static void test_ticks(void)
+{
+    static const uint32_t periods[] = { 100000000, 99999950, 100000050 };
+    pps_ref_t ref;
+    pps_edge_t edge;
+    uint32_t i, p, count, ns;
+    int32_t dsec, err;
+
+    for (p = 0; p < sizeof(periods) / sizeof(periods[0]); p++) {
+        ref.period = periods[p];
+        ref.sec = 0xFFFFFFF0;
+        ref.count = 0xFFF00000;
+
+        /* The reference itself, and one PHC second later */
+        CHECK(pps_capture_ticks(&ref, ref.sec, 0) == ref.count, "reference count");
+        CHECK(pps_capture_ticks(&ref, ref.sec + 1, 0) == ref.count + ref.period, "count one second later");
+
+        for (i = 0; i < 10000; i++) {
+            dsec = (int32_t)(random32() % 41) - 20;
+            ns = random32() % 1000000000UL;
+
+            count = pps_capture_ticks(&ref, ref.sec + dsec, ns);
+            pps_capture_edge(ref.sec, (int32_t)(count - ref.count), ref.period, &edge);
+
+            /* Back to the nearest second and the offset from it, within a
+             * tick: both ways truncate, down after the reference and
+             * towards it before */
+            err = (int32_t)(edge.sec - (ref.sec + dsec)) * 1000000000 + edge.offset - (int32_t)ns;
+            CHECK(err >= -10 && err <= 10 && (dsec < 0 || err <= 0), "period %lu: %+ld s %lu ns came back %ld ns off",
+                  (unsigned long)ref.period, (long)dsec, (unsigned long)ns, (long)err);
+            if (failures > 20) {
+                return;
+            }
+        }
+    }
+}
+
+int main(void)
+{
+    test_check();
+    test_trains();
+    test_before();
+    test_ticks();
+
+    return check_result("pps_output");
+}
@@ -0,0 +1,97 @@
+/*
+ * Host test of the PPS offset statistics of app/src/pps_stats.c.
+ *
+ * The running mean, extremes and standard deviation are compared with a
+ * two pass computation over the same offsets, from ns jitter to offsets
+ * near the half second the capture folds into.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "check.h"
+#include "pps_stats.h"
+
+#define SAMPLES     100000
+
+static int32_t offsets[SAMPLES];
+
+/* Offsets around bias, compared with the two pass statistics */
+static void check(const char *name, int32_t bias, int32_t amplitude, uint32_t n)
+{
+    pps_stats_t s;
+    double mean = 0, m2 = 0, sd;
+    int32_t min = INT32_MAX, max = INT32_MIN;
+    uint32_t i;
+
+    pps_stats_reset(&s);
+    for (i = 0; i < n; i++) {
+        offsets[i] = bias + noise(amplitude);
+        pps_stats_add(&s, offsets[i]);
+        mean += offsets[i];
+        if (offsets[i] < min) min = offsets[i];
+        if (offsets[i] > max) max = offsets[i];
+    }
+    mean /= n;
+    for (i = 0; i < n; i++) {
+        m2 += (offsets[i] - mean) * (offsets[i] - mean);
+    }
+    sd = n > 1 ? sqrt(m2 / (n - 1)) : 0;
+
+    CHECK(s.count == n && s.last == offsets[n - 1], "%s: count %u last %ld", name, s.count, (long)s.last);
+    CHECK(s.min == min && s.max == max, "%s: min/max %ld/%ld, expected %ld/%ld",
+          name, (long)s.min, (long)s.max, (long)min, (long)max);
+    CHECK(fabs(s.mean - mean) <= 1e-6 * (fabs(mean) + 1), "%s: mean %.3f, expected %.3f", name, s.mean, mean);
+    /* Truncated to ns */
+    CHECK(pps_stats_stddev(&s) <= sd + 1e-6 * sd && pps_stats_stddev(&s) + 1 > sd - 1e-6 * sd,
+          "%s: stddev %lu, expected %.3f", name, (unsigned long)pps_stats_stddev(&s), sd);
+}
+
+static void test_edges(void)
+{
+    pps_stats_t s;
+    int i;
+
+    pps_stats_reset(&s);
+    CHECK(s.count == 0 && pps_stats_stddev(&s) == 0, "stddev of no samples");
+    pps_stats_add(&s, -42);
+    CHECK(s.min == -42 && s.max == -42 && s.mean == -42 && pps_stats_stddev(&s) == 0, "one sample");
+
+    /* Alternating +-1000 ns: sqrt(1000/999) us, truncated to 1000 ns */
+    pps_stats_reset(&s);
+    for (i = 0; i < 1000; i++) {
+        pps_stats_add(&s, i % 2 ? 1000 : -1000);
+    }
+    CHECK(fabs(s.mean) < 1e-9 && pps_stats_stddev(&s) == 1000, "+-1000 ns: mean %.3f stddev %lu",
+          s.mean, (unsigned long)pps_stats_stddev(&s));
+
+    /* Constant offsets, far from zero */
+    pps_stats_reset(&s);
+    for (i = 0; i < 1000; i++) {
+        pps_stats_add(&s, 499999999);
+    }
+    CHECK(pps_stats_stddev(&s) == 0, "constant offset: stddev %lu", (unsigned long)pps_stats_stddev(&s));
+
+    /* Half second swings do not overflow */
+    pps_stats_reset(&s);
+    for (i = 0; i < 1000; i++) {
+        pps_stats_add(&s, i % 2 ? 499999999 : -500000000);
+    }
+    CHECK(s.min == -500000000 && s.max == 499999999, "half second min/max");
+    CHECK(abs((int32_t)pps_stats_stddev(&s) - 500250187) <= 1, "half second stddev %lu",
+          (unsigned long)pps_stats_stddev(&s));
+}
+
+int main(void)
+{
+    test_edges();
+
+    check("two samples", 100, 50, 2);
+    check("10 ns jitter", 0, 10, SAMPLES);
+    check("DUT 1.2 us late", -1200, 40, SAMPLES);
+    check("PHC 35 us ahead", 35000, 2000, SAMPLES);
+    check("near half a second", 499000000, 900000, SAMPLES);
+    check("100 ms wander", 0, 100000000, SAMPLES);
+
+    return check_result("pps_stats");
+}
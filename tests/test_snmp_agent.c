@@ -0,0 +1,788 @@
+/*
+ * Host test of the SNMP agent of app/src/snmp_agent.c.
+ *
+ * The PTP subtree is resolved through the lwIP SNMP core the way GET and
+ * GETNEXT requests are: every object is walked in OID order, its type and
+ * value are checked against the data sets and counters handed out by a
+ * fake ptpd, and the snapshot is checked to hold for SNMP_AGENT_SNAPSHOT_MS.
+ * BER encoded SNMPv1 and v2c GET and GETNEXT requests are then fed through
+ * the lwIP message layer and the encoded responses decoded and checked.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "check.h"
+#include "lwip/apps/snmp.h"
+#include "lwip/apps/snmp_core.h"
+#include "lwip/apps/snmp_scalar.h"
+#include "snmp_core_priv.h"
+#include "snmp_asn1.h"
+#include "snmp_msg.h"
+#include "lwip/pbuf.h"
+
+/* SNMP_LWIP_MIB2 is off, the test has its own */
+extern const struct snmp_mib mib2;
+
+#include "../app/src/snmp_agent.c"
+
+/* Objects of the PTP subtree, per group */
+#define GROUPS      6
+static const u32_t group_objects[GROUPS] = { 9, 3, 8, 6, 5, 5 + RX_DROP_COUNT };
+
+typedef struct object {
+    u32_t oid[SNMP_MAX_OBJ_ID_LEN];
+    u8_t len;
+    u8_t type;
+    s16_t size;
+    u8_t value[SNMP_MAX_VALUE_SIZE];
+} object_t;
+
+static object_t walked[64];
+static u32_t walked_count;
+
+static PtpDataSets ptp_ds;
+static PtpCounters ptp_counters;
+static u32_t ptp_reads;
+static u32_t now;
+
+/* lwIP and ptpd around the agent */
+
+u32_t sys_now(void)
+{
+    return now;
+}
+
+void snmp_init(void)
+{
+}
+
+/* From ip.c, used by the OID to address conversions */
+const ip_addr_t ip_addr_any = IPADDR4_INIT(IPADDR_ANY);
+
+void ptpd_get_datasets(PtpDataSets *ds)
+{
+    *ds = ptp_ds;
+    ptp_reads++;
+}
+
+void ptpd_get_counters(PtpCounters *counters)
+{
+    *counters = ptp_counters;
+}
+
+/* Stands in for MIB-2, one object in front of the enterprise subtree */
+static s16_t mib2_get_value(struct snmp_node_instance *instance, void *value)
+{
+    (void)instance;
+    *(s32_t *)value = 1;
+    return sizeof(s32_t);
+}
+
+static const struct snmp_scalar_node mib2_scalar = SNMP_SCALAR_CREATE_NODE_READONLY(1, SNMP_ASN1_TYPE_INTEGER, mib2_get_value);
+static const struct snmp_node *const mib2_nodes[] = { &mib2_scalar.node.node };
+static const struct snmp_tree_node mib2_root = SNMP_CREATE_TREE_NODE(1, mib2_nodes);
+static const u32_t mib2_base_oid[] = { 1, 3, 6, 1, 2, 1 };
+const struct snmp_mib mib2 = SNMP_MIB_CREATE(mib2_base_oid, &mib2_root.node);
+
+static void set_ptp(int32_t n)
+{
+    int i;
+
+    memset(&ptp_ds, 0, sizeof(ptp_ds));
+    memset(&ptp_counters, 0, sizeof(ptp_counters));
+
+    for (i = 0; i < CLOCK_IDENTITY_LENGTH; i++) {
+        ptp_ds.defaultDS.clockIdentity[i] = (octet_t)(0x10 + i + n);
+        ptp_ds.parentDS.parentPortIdentity.clockIdentity[i] = (octet_t)(0x20 + i + n);
+        ptp_ds.parentDS.grandmasterIdentity[i] = (octet_t)(0x30 + i + n);
+    }
+    ptp_ds.defaultDS.twoStepFlag = TRUE;
+    ptp_ds.defaultDS.priority1 = 128;
+    ptp_ds.defaultDS.priority2 = 127;
+    ptp_ds.defaultDS.domainNumber = 4;
+    ptp_ds.defaultDS.clockQuality.clockClass = 248;
+    ptp_ds.defaultDS.clockQuality.clockAccuracy = 0xFE;
+    ptp_ds.defaultDS.clockQuality.offsetScaledLogVariance = -1;
+    ptp_ds.currentDS.stepsRemoved = 1;
+    ptp_ds.parentDS.parentPortIdentity.portNumber = 2;
+    ptp_ds.parentDS.grandmasterPriority1 = 100;
+    ptp_ds.parentDS.grandmasterPriority2 = 101;
+    ptp_ds.parentDS.grandmasterClockQuality.clockClass = 6;
+    ptp_ds.parentDS.grandmasterClockQuality.clockAccuracy = 0x21;
+    ptp_ds.parentDS.grandmasterClockQuality.offsetScaledLogVariance = 0x4E5D;
+    ptp_ds.portDS.portState = PTP_SLAVE;
+    ptp_ds.portDS.logSyncInterval = -3;
+    ptp_ds.portDS.logAnnounceInterval = 1;
+    ptp_ds.portDS.logMinDelayReqInterval = -2;
+    ptp_ds.portDS.delayMechanism = 2;
+    ptp_ds.portDS.peerMeanPathDelay.nanoseconds = 1234 + n;
+
+    ptp_counters.offsetFromMaster = -57 - n;
+    ptp_counters.meanPathDelay = 4800 + n;
+    ptp_counters.observedDrift = -12345;
+    ptp_counters.servoUpdates = 1000 + n;
+    ptp_counters.clockSteps = 2;
+    ptp_counters.stateChanges = 5;
+    ptp_counters.standbySwitches = 1;
+    ptp_counters.syncSequenceGaps = 11;
+    ptp_counters.orphanSyncs = 12;
+    ptp_counters.orphanFollowUps = 13;
+    ptp_counters.lateDelayResps = 14;
+    ptp_counters.expiredDelayReqs = 15;
+    for (i = 0; i < RX_DROP_COUNT; i++) {
+        ptp_counters.rxDropped[i] = 100 + i + n;
+    }
+}
+
+/* Value and type an object must read as, from the data set given */
+static int expected(u32_t group, u32_t id, u8_t *type, s64_t *n, const void **octets)
+{
+    const PtpDataSets *ds = &ptp_ds;
+    const PtpCounters *c = &ptp_counters;
+    u8_t i32 = SNMP_ASN1_TYPE_INTEGER, u32 = SNMP_ASN1_TYPE_UNSIGNED32, cnt = SNMP_ASN1_TYPE_COUNTER32;
+
+    *octets = NULL;
+    *type = i32;
+
+#define V(t, v) do { *type = (t); *n = (v); return 1; } while (0)
+#define O(v)    do { *type = SNMP_ASN1_TYPE_OCTET_STRING; *octets = (v); return 1; } while (0)
+
+    switch (group * 100 + id) {
+        case 101: O(ds->defaultDS.clockIdentity);
+        case 102: V(i32, ds->defaultDS.twoStepFlag);
+        case 103: V(i32, ds->defaultDS.slaveOnly);
+        case 104: V(u32, ds->defaultDS.priority1);
+        case 105: V(u32, ds->defaultDS.priority2);
+        case 106: V(u32, ds->defaultDS.domainNumber);
+        case 107: V(u32, ds->defaultDS.clockQuality.clockClass);
+        case 108: V(u32, ds->defaultDS.clockQuality.clockAccuracy);
+        case 109: V(i32, ds->defaultDS.clockQuality.offsetScaledLogVariance);
+        case 201: V(u32, ds->currentDS.stepsRemoved);
+        case 202: V(i32, c->offsetFromMaster);
+        case 203: V(i32, c->meanPathDelay);
+        case 301: O(ds->parentDS.parentPortIdentity.clockIdentity);
+        case 302: V(u32, ds->parentDS.parentPortIdentity.portNumber);
+        case 303: O(ds->parentDS.grandmasterIdentity);
+        case 304: V(u32, ds->parentDS.grandmasterPriority1);
+        case 305: V(u32, ds->parentDS.grandmasterPriority2);
+        case 306: V(u32, ds->parentDS.grandmasterClockQuality.clockClass);
+        case 307: V(u32, ds->parentDS.grandmasterClockQuality.clockAccuracy);
+        case 308: V(i32, ds->parentDS.grandmasterClockQuality.offsetScaledLogVariance);
+        case 401: V(i32, ds->portDS.portState);
+        case 402: V(i32, ds->portDS.logSyncInterval);
+        case 403: V(i32, ds->portDS.logAnnounceInterval);
+        case 404: V(i32, ds->portDS.logMinDelayReqInterval);
+        case 405: V(i32, ds->portDS.delayMechanism);
+        case 406: V(i32, ds->portDS.peerMeanPathDelay.nanoseconds);
+        case 501: V(i32, c->observedDrift);
+        case 502: V(cnt, c->servoUpdates);
+        case 503: V(cnt, c->clockSteps);
+        case 504: V(cnt, c->stateChanges);
+        case 505: V(cnt, c->standbySwitches);
+        case 601: V(cnt, c->syncSequenceGaps);
+        case 602: V(cnt, c->orphanSyncs);
+        case 603: V(cnt, c->orphanFollowUps);
+        case 604: V(cnt, c->lateDelayResps);
+        case 605: V(cnt, c->expiredDelayReqs);
+        default:
+            if (group == 6 && id >= 6 && id < 6 + RX_DROP_COUNT) {
+                V(cnt, c->rxDropped[id - 6]);
+            }
+            return 0;
+    }
+
+#undef V
+#undef O
+}
+
+static void read_value(struct snmp_node_instance *inst, object_t *o)
+{
+    memset(o->value, 0, sizeof(o->value));
+    o->type = inst->asn1_type;
+    o->size = inst->get_value(inst, o->value);
+
+    if (inst->release_instance != NULL) {
+        inst->release_instance(inst);
+    }
+}
+
+/* GETNEXT from the start of the subtree until it is left */
+static void walk(void)
+{
+    static const u32_t base[] = SNMP_AGENT_PTP_OID;
+    struct snmp_obj_id oid, next;
+    struct snmp_node_instance inst;
+
+    snmp_oid_assign(&oid, base, LWIP_ARRAYSIZE(base));
+    walked_count = 0;
+
+    while (walked_count < LWIP_ARRAYSIZE(walked)) {
+        object_t *o = &walked[walked_count];
+
+        memset(&inst, 0, sizeof(inst));
+        if (snmp_get_next_node_instance_from_oid(oid.id, oid.len, NULL, NULL, &next, &inst) != SNMP_ERR_NOERROR) {
+            break;
+        }
+        if (next.len < LWIP_ARRAYSIZE(base) || memcmp(next.id, base, sizeof(base)) != 0) {
+            if (inst.release_instance != NULL) {
+                inst.release_instance(&inst);
+            }
+            break;
+        }
+
+        memcpy(o->oid, next.id, next.len * sizeof(u32_t));
+        o->len = next.len;
+        read_value(&inst, o);
+        walked_count++;
+        oid = next;
+    }
+}
+
+/* Every object of the subtree in order, with the type and value of the data sets */
+static void check_walk(const char *what)
+{
+    static const u32_t base[] = SNMP_AGENT_PTP_OID;
+    const u8_t n = LWIP_ARRAYSIZE(base);
+    u32_t total = 0, k = 0, group, id;
+
+    for (group = 0; group < GROUPS; group++) {
+        total += group_objects[group];
+    }
+    CHECK(walked_count == total, "%s: %u objects walked, %u expected", what, walked_count, total);
+
+    for (group = 1; group <= GROUPS; group++) {
+        for (id = 1; id <= group_objects[group - 1] && k < walked_count; id++, k++) {
+            const object_t *o = &walked[k];
+            const void *octets;
+            u8_t type;
+            s64_t v = 0;
+
+            if (!(o->len == n + 3 && o->oid[n] == group && o->oid[n + 1] == id && o->oid[n + 2] == 0)) {
+                CHECK(0, "%s: object %u is not %u.%u.0", what, k, group, id);
+                continue;
+            }
+            if (!expected(group, id, &type, &v, &octets)) {
+                CHECK(0, "%s: %u.%u has no expected value", what, group, id);
+                continue;
+            }
+            CHECK(o->type == type, "%s: %u.%u type 0x%02x, expected 0x%02x", what, group, id, o->type, type);
+
+            if (octets != NULL) {
+                CHECK(o->size == CLOCK_IDENTITY_LENGTH && memcmp(o->value, octets, CLOCK_IDENTITY_LENGTH) == 0,
+                      "%s: %u.%u identity differs", what, group, id);
+            } else if (type == SNMP_ASN1_TYPE_INTEGER) {
+                s32_t got;
+
+                memcpy(&got, o->value, sizeof(got));
+                CHECK(o->size == sizeof(s32_t) && got == v, "%s: %u.%u is %ld, expected %lld",
+                      what, group, id, (long)got, (long long)v);
+            } else {
+                u32_t got;
+
+                memcpy(&got, o->value, sizeof(got));
+                CHECK(o->size == sizeof(u32_t) && got == (u32_t)v, "%s: %u.%u is %lu, expected %lld",
+                      what, group, id, (unsigned long)got, (long long)v);
+            }
+        }
+    }
+}
+
+static void test_walk(void)
+{
+    set_ptp(0);
+    now = 1000;
+    snmpa.valid = 0;
+
+    walk();
+    check_walk("walk");
+}
+
+static void test_get(void)
+{
+    static const u32_t offset[] = { 1, 3, 6, 1, 4, 1, 26381, 319, 2, 2, 0 };
+    static const u32_t missing[] = { 1, 3, 6, 1, 4, 1, 26381, 319, 6, 6 + RX_DROP_COUNT, 0 };
+    static const u32_t no_instance[] = { 1, 3, 6, 1, 4, 1, 26381, 319, 2, 2, 1 };
+    struct snmp_node_instance inst;
+    object_t o;
+    s32_t v;
+
+    set_ptp(3);
+    now += SNMP_AGENT_SNAPSHOT_MS;
+
+    memset(&inst, 0, sizeof(inst));
+    if (snmp_get_node_instance_from_oid(offset, LWIP_ARRAYSIZE(offset), &inst) != SNMP_ERR_NOERROR) {
+        CHECK(0, "GET offsetFromMaster failed");
+    } else {
+        read_value(&inst, &o);
+        memcpy(&v, o.value, sizeof(v));
+        CHECK(o.type == SNMP_ASN1_TYPE_INTEGER && v == ptp_counters.offsetFromMaster,
+              "GET offsetFromMaster %ld, expected %ld", (long)v, (long)ptp_counters.offsetFromMaster);
+    }
+
+    memset(&inst, 0, sizeof(inst));
+    CHECK(snmp_get_node_instance_from_oid(missing, LWIP_ARRAYSIZE(missing), &inst) != SNMP_ERR_NOERROR,
+          "GET past the last error counter answered");
+    memset(&inst, 0, sizeof(inst));
+    CHECK(snmp_get_node_instance_from_oid(no_instance, LWIP_ARRAYSIZE(no_instance), &inst) != SNMP_ERR_NOERROR,
+          "GET of instance 1 of a scalar answered");
+}
+
+/* Requests within SNMP_AGENT_SNAPSHOT_MS read one snapshot */
+static void test_snapshot(void)
+{
+    u32_t reads;
+
+    set_ptp(0);
+    now += SNMP_AGENT_SNAPSHOT_MS;
+    walk();
+    reads = ptp_reads;
+
+    /* ptpd moves on, the walk still reads the old instant */
+    set_ptp(7);
+    now += SNMP_AGENT_SNAPSHOT_MS - 1;
+    walk();
+    CHECK(ptp_reads == reads, "%u snapshots taken within the snapshot age", ptp_reads - reads);
+    set_ptp(0);
+    check_walk("cached walk");
+
+    /* Older than the snapshot age, the next request takes a new one */
+    set_ptp(7);
+    now += 1;
+    walk();
+    CHECK(ptp_reads == reads + 1, "%u snapshots taken after the snapshot age", ptp_reads - reads);
+    check_walk("refreshed walk");
+
+    /* The tick counter wraps */
+    set_ptp(9);
+    now = UINT32_MAX - 100;
+    snmpa.valid = 0;
+    walk();
+    now += 200;
+    set_ptp(10);
+    walk();
+    set_ptp(9);
+    check_walk("walk over the wrap");
+}
+
+/* Values that do not fit the SNMP types saturate */
+static void test_encoding(void)
+{
+    TimeInternal t;
+
+    t.seconds = 5; t.nanoseconds = 0;
+    CHECK(snmp_ns(&t) == INT32_MAX, "5 s is %ld", (long)snmp_ns(&t));
+    t.seconds = -5; t.nanoseconds = 0;
+    CHECK(snmp_ns(&t) == INT32_MIN, "-5 s is %ld", (long)snmp_ns(&t));
+    t.seconds = 1; t.nanoseconds = -500000000;
+    CHECK(snmp_ns(&t) == 500000000, "1 s - 500 ms is %ld", (long)snmp_ns(&t));
+
+    /* The step counters are 16 bit, negative values are not sign extended */
+    set_ptp(0);
+    ptp_ds.currentDS.stepsRemoved = -1;
+    ptp_ds.parentDS.parentPortIdentity.portNumber = -1;
+    now += SNMP_AGENT_SNAPSHOT_MS;
+    walk();
+    CHECK(walked_count > 17 && memcmp(walked[9].value, &(u32_t){ 0xFFFF }, 4) == 0, "stepsRemoved not 16 bit");
+    CHECK(walked_count > 17 && memcmp(walked[13].value, &(u32_t){ 0xFFFF }, 4) == 0, "portNumber not 16 bit");
+}
+
+/* GETNEXT leaves MIB-2 into the subtree and ends after it */
+static void test_bounds(void)
+{
+    static const u32_t last[] = { 1, 3, 6, 1, 4, 1, 26381, 319, 6, 5 + RX_DROP_COUNT, 0 };
+    struct snmp_obj_id next;
+    struct snmp_node_instance inst;
+    u8_t err;
+
+    memset(&inst, 0, sizeof(inst));
+    err = snmp_get_next_node_instance_from_oid(mib2_base_oid, LWIP_ARRAYSIZE(mib2_base_oid), NULL, NULL, &next, &inst);
+    CHECK(err == SNMP_ERR_NOERROR && next.len == 8, "GETNEXT of MIB-2 did not find its object");
+    if (err == SNMP_ERR_NOERROR && inst.release_instance != NULL) {
+        inst.release_instance(&inst);
+    }
+
+    memset(&inst, 0, sizeof(inst));
+    err = snmp_get_next_node_instance_from_oid(next.id, next.len, NULL, NULL, &next, &inst);
+    CHECK(err == SNMP_ERR_NOERROR && next.len == 11 && next.id[8] == 1 && next.id[9] == 1,
+          "GETNEXT after MIB-2 is not the PTP clockIdentity");
+    if (err == SNMP_ERR_NOERROR && inst.release_instance != NULL) {
+        inst.release_instance(&inst);
+    }
+
+    memset(&inst, 0, sizeof(inst));
+    err = snmp_get_next_node_instance_from_oid(last, LWIP_ARRAYSIZE(last), NULL, NULL, &next, &inst);
+    CHECK(err != SNMP_ERR_NOERROR, "GETNEXT past the last object answered");
+}
+
+/* SNMP messages, BER encoded the way a manager sends them */
+
+#define NO_SUCH_OBJECT      (SNMP_ASN1_CLASS_CONTEXT | SNMP_ASN1_CONTEXT_VARBIND_NO_SUCH_OBJECT)
+#define NO_SUCH_INSTANCE    (SNMP_ASN1_CLASS_CONTEXT | SNMP_ASN1_CONTEXT_VARBIND_NO_SUCH_INSTANCE)
+#define END_OF_MIB_VIEW     (SNMP_ASN1_CLASS_CONTEXT | SNMP_ASN1_CONTEXT_VARBIND_END_OF_MIB_VIEW)
+
+typedef struct response {
+    s32_t version;
+    s32_t id;
+    s32_t error_status;
+    s32_t error_index;
+    u32_t oid[SNMP_MAX_OBJ_ID_LEN];
+    u8_t oid_len;
+    u8_t type;
+    u16_t size;
+    u8_t value[SNMP_MAX_VALUE_SIZE];
+} response_t;
+
+static u8_t sent[SNMP_MAX_OCTET_STRING_LEN + 256];
+static u16_t sent_len;
+static u32_t sent_count;
+static u32_t authfail_traps;
+
+err_t snmp_sendto(void *handle, struct pbuf *p, const ip_addr_t *dst, u16_t port)
+{
+    (void)handle; (void)dst; (void)port;
+
+    sent_len = pbuf_copy_partial(p, sent, sizeof(sent), 0);
+    sent_count++;
+    return ERR_OK;
+}
+
+void snmp_authfail_trap(void)
+{
+    authfail_traps++;
+}
+
+/* Tag, short form length and content, all requests are under 128 octets.
+ * The content may be at out already, containers wrap what was encoded */
+static size_t ber(u8_t *out, u8_t type, const u8_t *content, size_t len)
+{
+    if (len > 0) {
+        memmove(out + 2, content, len);
+    }
+    out[0] = type;
+    out[1] = (u8_t)len;
+
+    return len + 2;
+}
+
+static size_t ber_int(u8_t *out, s32_t v)
+{
+    u8_t content[4];
+    size_t n = 4;
+
+    content[0] = (u8_t)(v >> 24); content[1] = (u8_t)(v >> 16);
+    content[2] = (u8_t)(v >> 8);  content[3] = (u8_t)v;
+    /* Shortest two's complement */
+    while (n > 1 && ((content[4 - n] == 0x00 && !(content[5 - n] & 0x80)) ||
+                     (content[4 - n] == 0xFF && (content[5 - n] & 0x80)))) {
+        n--;
+    }
+
+    return ber(out, SNMP_ASN1_TYPE_INTEGER, content + 4 - n, n);
+}
+
+static size_t ber_oid(u8_t *out, const u32_t *oid, u8_t len)
+{
+    u8_t content[SNMP_MAX_OBJ_ID_LEN * 5];
+    size_t n = 0;
+    u8_t i;
+
+    content[n++] = (u8_t)(oid[0] * 40 + oid[1]);
+    for (i = 2; i < len; i++) {
+        int shift;
+
+        for (shift = 28; shift > 0 && (oid[i] >> shift) == 0; shift -= 7) {
+        }
+        for (; shift > 0; shift -= 7) {
+            content[n++] = (u8_t)(0x80 | (oid[i] >> shift));
+        }
+        content[n++] = (u8_t)(oid[i] & 0x7F);
+    }
+
+    return ber(out, SNMP_ASN1_TYPE_OBJECT_ID, content, n);
+}
+
+/* One varbind request with a NULL value */
+static size_t request(u8_t *msg, s32_t version, const char *community, u8_t pdu_type, s32_t id,
+                      const u32_t *oid, u8_t oid_len)
+{
+    u8_t vb[96], pdu[128];
+    size_t n, m;
+
+    n = ber_oid(vb, oid, oid_len);
+    n += ber(vb + n, SNMP_ASN1_TYPE_NULL, NULL, 0);
+    n = ber(vb, SNMP_ASN1_TYPE_SEQUENCE, vb, n);
+    n = ber(vb, SNMP_ASN1_TYPE_SEQUENCE, vb, n);
+
+    m = ber_int(pdu, id);
+    m += ber_int(pdu + m, 0);
+    m += ber_int(pdu + m, 0);
+    memcpy(pdu + m, vb, n);
+    m = ber(pdu, SNMP_ASN1_CLASS_CONTEXT | SNMP_ASN1_CONTENTTYPE_CONSTRUCTED | pdu_type, pdu, m + n);
+
+    n = ber_int(msg, version);
+    n += ber(msg + n, SNMP_ASN1_TYPE_OCTET_STRING, (const u8_t *)community, strlen(community));
+    memcpy(msg + n, pdu, m);
+
+    return ber(msg, SNMP_ASN1_TYPE_SEQUENCE, msg, n + m);
+}
+
+/* Tag and length at *p, short and long form, 0 when it runs past end */
+static int tlv(const u8_t **p, const u8_t *end, u8_t *type, u16_t *len)
+{
+    const u8_t *q = *p;
+
+    if (end - q < 2) {
+        return 0;
+    }
+    *type = *q++;
+    if (*q & 0x80) {
+        u8_t octets = *q++ & 0x7F;
+
+        if (octets == 0 || octets > 2 || end - q < octets) {
+            return 0;
+        }
+        for (*len = 0; octets > 0; octets--) {
+            *len = (u16_t)((*len << 8) | *q++);
+        }
+    } else {
+        *len = *q++;
+    }
+    if (end - q < *len) {
+        return 0;
+    }
+    *p = q;
+
+    return 1;
+}
+
+static int dec_int(const u8_t **p, const u8_t *end, s32_t *v)
+{
+    u8_t type;
+    u16_t len, i;
+
+    if (!tlv(p, end, &type, &len) || type != SNMP_ASN1_TYPE_INTEGER || len < 1 || len > 4) {
+        return 0;
+    }
+    *v = (**p & 0x80) ? -1 : 0;
+    for (i = 0; i < len; i++) {
+        *v = (s32_t)(((u32_t)*v << 8) | *(*p)++);
+    }
+
+    return 1;
+}
+
+/* The one varbind response sent last */
+static int parse_response(response_t *r)
+{
+    const u8_t *p = sent, *end = sent + sent_len;
+    u8_t type;
+    u16_t len, i;
+
+    memset(r, 0, sizeof(*r));
+
+    if (!tlv(&p, end, &type, &len) || type != SNMP_ASN1_TYPE_SEQUENCE || !dec_int(&p, end, &r->version) ||
+        !tlv(&p, end, &type, &len) || type != SNMP_ASN1_TYPE_OCTET_STRING) {
+        return 0;
+    }
+    p += len;
+    if (!tlv(&p, end, &type, &len) ||
+        type != (SNMP_ASN1_CLASS_CONTEXT | SNMP_ASN1_CONTENTTYPE_CONSTRUCTED | SNMP_ASN1_CONTEXT_PDU_GET_RESP) ||
+        !dec_int(&p, end, &r->id) || !dec_int(&p, end, &r->error_status) || !dec_int(&p, end, &r->error_index) ||
+        !tlv(&p, end, &type, &len) || type != SNMP_ASN1_TYPE_SEQUENCE ||
+        !tlv(&p, end, &type, &len) || type != SNMP_ASN1_TYPE_SEQUENCE ||
+        !tlv(&p, end, &type, &len) || type != SNMP_ASN1_TYPE_OBJECT_ID || len < 1) {
+        return 0;
+    }
+
+    r->oid[0] = p[0] / 40;
+    r->oid[1] = p[0] % 40;
+    r->oid_len = 2;
+    for (i = 1; i < len && r->oid_len < SNMP_MAX_OBJ_ID_LEN; r->oid_len++) {
+        u32_t sub = 0;
+
+        do {
+            sub = (sub << 7) | (p[i] & 0x7F);
+        } while ((p[i++] & 0x80) && i < len);
+        r->oid[r->oid_len] = sub;
+    }
+    p += len;
+
+    if (!tlv(&p, end, &r->type, &r->size) || r->size > sizeof(r->value)) {
+        return 0;
+    }
+    memcpy(r->value, p, r->size);
+
+    return p + r->size == end;
+}
+
+/* Value of an INTEGER or unsigned response */
+static s64_t response_number(const response_t *r)
+{
+    s64_t v = (r->type == SNMP_ASN1_TYPE_INTEGER && r->size > 0 && (r->value[0] & 0x80)) ? -1 : 0;
+    u16_t i;
+
+    for (i = 0; i < r->size; i++) {
+        v = (s64_t)(((u64_t)v << 8) | r->value[i]);
+    }
+
+    return v;
+}
+
+/* Send a request through the message layer, 1 with the response parsed */
+static int transact(s32_t version, const char *community, u8_t pdu_type, const u32_t *oid, u8_t oid_len,
+                    response_t *r)
+{
+    static s32_t id = 0x7F00;
+    static const ip_addr_t manager = IPADDR4_INIT_BYTES(192, 168, 1, 10);
+    u8_t msg[128];
+    size_t len = request(msg, version, community, pdu_type, ++id, oid, oid_len);
+    struct pbuf *p = pbuf_alloc(PBUF_RAW, (u16_t)len, PBUF_RAM);
+    u32_t count = sent_count;
+
+    pbuf_take(p, msg, (u16_t)len);
+    snmp_receive(NULL, p, &manager, 50000);
+    pbuf_free(p);
+
+    if (sent_count == count) {
+        return 0;
+    }
+    CHECK(parse_response(r), "response to request %ld does not decode", (long)id);
+    CHECK(r->version == version && r->id == id, "response version %ld id %ld, expected %ld %ld",
+          (long)r->version, (long)r->id, (long)version, (long)id);
+
+    return 1;
+}
+
+/* snmpwalk of the subtree, GETNEXT PDUs from MIB-2 on */
+static void test_pdu_walk(void)
+{
+    static const u32_t base[] = SNMP_AGENT_PTP_OID;
+    const u8_t n = LWIP_ARRAYSIZE(base);
+    u32_t oid[SNMP_MAX_OBJ_ID_LEN];
+    u8_t len = LWIP_ARRAYSIZE(mib2_base_oid);
+    u32_t k = 0, group = 1, id = 1;
+    response_t r;
+
+    set_ptp(5);
+    now += SNMP_AGENT_SNAPSHOT_MS;
+    memcpy(oid, mib2_base_oid, sizeof(mib2_base_oid));
+
+    /* MIB-2 object first */
+    if (!transact(SNMP_VERSION_2c, SNMP_COMMUNITY, SNMP_ASN1_CONTEXT_PDU_GET_NEXT_REQ, oid, len, &r)) {
+        CHECK(0, "no response to GETNEXT of MIB-2");
+        return;
+    }
+    CHECK(r.error_status == SNMP_ERR_NOERROR && r.oid_len == 8, "GETNEXT of MIB-2: error %ld, OID length %u",
+          (long)r.error_status, r.oid_len);
+
+    while (k < LWIP_ARRAYSIZE(walked)) {
+        const void *octets;
+        u8_t type;
+        s64_t v = 0;
+
+        memcpy(oid, r.oid, r.oid_len * sizeof(u32_t));
+        len = r.oid_len;
+        if (!transact(SNMP_VERSION_2c, SNMP_COMMUNITY, SNMP_ASN1_CONTEXT_PDU_GET_NEXT_REQ, oid, len, &r)) {
+            CHECK(0, "no response to GETNEXT %u", k);
+            return;
+        }
+        if (r.type == END_OF_MIB_VIEW) {
+            break;
+        }
+        if (!(r.error_status == SNMP_ERR_NOERROR && r.oid_len == n + 3 && memcmp(r.oid, base, sizeof(base)) == 0)) {
+            CHECK(0, "GETNEXT %u left the subtree, error %ld", k, (long)r.error_status);
+            return;
+        }
+        CHECK(r.oid[n] == group && r.oid[n + 1] == id && r.oid[n + 2] == 0, "GETNEXT %u answered %lu.%lu.%lu, expected %u.%u.0",
+              k, (unsigned long)r.oid[n], (unsigned long)r.oid[n + 1], (unsigned long)r.oid[n + 2], group, id);
+        if (!expected(r.oid[n], r.oid[n + 1], &type, &v, &octets)) {
+            CHECK(0, "GETNEXT %u: %lu.%lu has no expected value", k, (unsigned long)r.oid[n], (unsigned long)r.oid[n + 1]);
+        } else if (octets != NULL) {
+            CHECK(r.type == type && r.size == CLOCK_IDENTITY_LENGTH && memcmp(r.value, octets, CLOCK_IDENTITY_LENGTH) == 0,
+                  "GETNEXT %u: identity type 0x%02x size %u", k, r.type, r.size);
+        } else {
+            CHECK(r.type == type && response_number(&r) == (type == SNMP_ASN1_TYPE_INTEGER ? (s64_t)(s32_t)v : (s64_t)(u32_t)v),
+                  "GETNEXT %u: %u.%u type 0x%02x value %lld, expected 0x%02x %lld",
+                  k, group, id, r.type, (long long)response_number(&r), type, (long long)v);
+        }
+        if (++id > group_objects[group - 1]) {
+            group++;
+            id = 1;
+        }
+        k++;
+    }
+
+    group = 0;
+    for (id = 0; id < GROUPS; id++) {
+        group += group_objects[id];
+    }
+    CHECK(k == group, "%u objects walked in PDUs, %u expected", k, group);
+    CHECK(r.type == END_OF_MIB_VIEW && r.error_status == SNMP_ERR_NOERROR,
+          "walk did not end in endOfMibView");
+}
+
+/* GET PDUs in both versions, missing objects and a wrong community */
+static void test_pdu_get(void)
+{
+    static const u32_t offset[] = { 1, 3, 6, 1, 4, 1, 26381, 319, 2, 2, 0 };
+    static const u32_t missing[] = { 1, 3, 6, 1, 4, 1, 26381, 319, 6, 6 + RX_DROP_COUNT, 0 };
+    static const u32_t no_instance[] = { 1, 3, 6, 1, 4, 1, 26381, 319, 2, 2, 1 };
+    static const u32_t last[] = { 1, 3, 6, 1, 4, 1, 26381, 319, 6, 5 + RX_DROP_COUNT, 0 };
+    static const u32_t no_group[] = { 1, 3, 6, 1, 4, 1, 26381, 319, GROUPS + 1, 1, 0 };
+    u32_t traps = authfail_traps;
+    response_t r;
+
+    set_ptp(-70);
+    now += SNMP_AGENT_SNAPSHOT_MS;
+
+    /* offsetFromMaster is 13, one octet on the wire */
+    CHECK(transact(SNMP_VERSION_1, SNMP_COMMUNITY, SNMP_ASN1_CONTEXT_PDU_GET_REQ, offset, LWIP_ARRAYSIZE(offset), &r) &&
+          r.error_status == SNMP_ERR_NOERROR && r.type == SNMP_ASN1_TYPE_INTEGER && r.size == 1 &&
+          response_number(&r) == ptp_counters.offsetFromMaster,
+          "v1 GET offsetFromMaster: error %ld type 0x%02x value %lld", (long)r.error_status, r.type, (long long)response_number(&r));
+
+    /* and -32824 three */
+    set_ptp(INT16_MAX);
+    now += SNMP_AGENT_SNAPSHOT_MS;
+    CHECK(transact(SNMP_VERSION_2c, SNMP_COMMUNITY, SNMP_ASN1_CONTEXT_PDU_GET_REQ, offset, LWIP_ARRAYSIZE(offset), &r) &&
+          r.error_status == SNMP_ERR_NOERROR && r.type == SNMP_ASN1_TYPE_INTEGER && r.size == 3 &&
+          response_number(&r) == ptp_counters.offsetFromMaster && r.oid_len == LWIP_ARRAYSIZE(offset) &&
+          memcmp(r.oid, offset, sizeof(offset)) == 0,
+          "v2c GET offsetFromMaster: error %ld type 0x%02x value %lld", (long)r.error_status, r.type, (long long)response_number(&r));
+
+    /* SNMPv2c answers per varbind, v1 with noSuchName for the PDU */
+    CHECK(transact(SNMP_VERSION_2c, SNMP_COMMUNITY, SNMP_ASN1_CONTEXT_PDU_GET_REQ, no_group, LWIP_ARRAYSIZE(no_group), &r) &&
+          r.error_status == SNMP_ERR_NOERROR && r.type == NO_SUCH_OBJECT && r.size == 0,
+          "v2c GET of a group past the last: error %ld type 0x%02x", (long)r.error_status, r.type);
+    CHECK(transact(SNMP_VERSION_2c, SNMP_COMMUNITY, SNMP_ASN1_CONTEXT_PDU_GET_REQ, missing, LWIP_ARRAYSIZE(missing), &r) &&
+          r.error_status == SNMP_ERR_NOERROR && r.type == NO_SUCH_INSTANCE && r.size == 0,
+          "v2c GET past the last error counter: error %ld type 0x%02x", (long)r.error_status, r.type);
+    CHECK(transact(SNMP_VERSION_2c, SNMP_COMMUNITY, SNMP_ASN1_CONTEXT_PDU_GET_REQ, no_instance, LWIP_ARRAYSIZE(no_instance), &r) &&
+          r.error_status == SNMP_ERR_NOERROR && r.type == NO_SUCH_INSTANCE,
+          "v2c GET of instance 1 of a scalar: error %ld type 0x%02x", (long)r.error_status, r.type);
+    CHECK(transact(SNMP_VERSION_1, SNMP_COMMUNITY, SNMP_ASN1_CONTEXT_PDU_GET_REQ, missing, LWIP_ARRAYSIZE(missing), &r) &&
+          r.error_status == SNMP_ERR_NOSUCHNAME && r.error_index == 1,
+          "v1 GET past the last error counter: error %ld index %ld", (long)r.error_status, (long)r.error_index);
+    CHECK(transact(SNMP_VERSION_2c, SNMP_COMMUNITY, SNMP_ASN1_CONTEXT_PDU_GET_NEXT_REQ, last, LWIP_ARRAYSIZE(last), &r) &&
+          r.error_status == SNMP_ERR_NOERROR && r.type == END_OF_MIB_VIEW,
+          "v2c GETNEXT past the last object: error %ld type 0x%02x", (long)r.error_status, r.type);
+
+    /* A wrong community is not answered */
+    CHECK(!transact(SNMP_VERSION_2c, "privat", SNMP_ASN1_CONTEXT_PDU_GET_REQ, offset, LWIP_ARRAYSIZE(offset), &r) &&
+          authfail_traps == traps + 1, "wrong community answered, %u traps", authfail_traps - traps);
+}
+
+int main(void)
+{
+    snmp_agent_init();
+
+    test_walk();
+    test_get();
+    test_snapshot();
+    test_encoding();
+    test_bounds();
+    test_pdu_walk();
+    test_pdu_get();
+
+    return check_result("snmp_agent");
+}
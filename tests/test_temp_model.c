@@ -0,0 +1,194 @@
+/*
+ * Host test of the oscillator temperature model of app/src/temp_model.c.
+ *
+ * Without arguments, synthetic oscillators are fitted and the slope and
+ * the predicted bias are checked. With `tcomp trace on` captures of the
+ * console, lines "tcomp,<s>,<mdegC>,<ppb>", each capture is replayed the
+ * way the board learns it: the bias predicted before a sample is added is
+ * compared with the frequency the servo found.
+ *
+ *     ./test_temp_model [capture.log ...]
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "check.h"
+#include "temp_model.h"
+
+/* Oscillator at slope ppb/K around 30 degC, temperature swinging by swing */
+static void feed(temp_model_t *m, uint32_t n, float slope, float swing, float freq_noise, uint32_t phase)
+{
+    uint32_t i;
+
+    for (i = 0; i < n; i++) {
+        float temp = 30.0f + swing * sinf((i + phase) * 0.01f) + noisef(0.05f);
+        float freq = 1500.0f + slope * (temp - 30.0f) + noisef(freq_noise);
+
+        temp_model_add(m, temp, freq);
+    }
+}
+
+static void test_fit(void)
+{
+    temp_model_t m;
+
+    temp_model_init(&m);
+    feed(&m, 2000, -45.0f, 3.0f, 5.0f, 0);
+
+    CHECK(m.valid, "model not valid after 2000 samples");
+    CHECK(fabsf(m.slope + 45.0f) < 1.0f, "slope %.2f, expected -45", m.slope);
+
+    /* The bias is the temperature dependent part only */
+    CHECK(fabsf(temp_model_bias(&m, m.ref)) < 1e-3f, "bias at ref %.3f", temp_model_bias(&m, m.ref));
+    CHECK(fabsf(temp_model_bias(&m, m.ref + 2.0f) + 90.0f) < 2.0f, "bias at ref+2 %.2f, expected -90",
+          temp_model_bias(&m, m.ref + 2.0f));
+}
+
+static void test_learning(void)
+{
+    temp_model_t m;
+
+    /* Too few samples */
+    temp_model_init(&m);
+    feed(&m, TEMP_MODEL_MIN_SAMPLES - 1, -45.0f, 3.0f, 5.0f, 0);
+    CHECK(!m.valid, "valid after %u samples", m.samples);
+    CHECK(temp_model_bias(&m, 35.0f) == 0, "bias before the model is valid");
+
+    /* The temperature never moved */
+    temp_model_init(&m);
+    feed(&m, 2000, -45.0f, 0.0f, 5.0f, 0);
+    CHECK(!m.valid, "valid with a spread of %.3f degC", m.spread);
+}
+
+static void test_limits(void)
+{
+    temp_model_t m;
+
+    /* A slope past slope_max is not a crystal, the fit is dropped */
+    temp_model_init(&m);
+    feed(&m, 2000, 2.0f * TEMP_MODEL_SLOPE_MAX, 3.0f, 5.0f, 0);
+    CHECK(!m.valid, "slope %.0f accepted", m.slope);
+}
+
+static void test_ageing(void)
+{
+    temp_model_t m;
+
+    /* The fit follows a changed slope within a few memories */
+    temp_model_init(&m);
+    feed(&m, 4000, -45.0f, 3.0f, 5.0f, 0);
+    feed(&m, 4 * TEMP_MODEL_MEMORY, -30.0f, 3.0f, 5.0f, 4000);
+    CHECK(m.valid && fabsf(m.slope + 30.0f) < 2.0f, "slope %.2f after ageing, expected -30", m.slope);
+}
+
+/* Replay a capture, 0 if the compensation helps */
+static int replay(const char *path)
+{
+    char line[256];
+    const char *p;
+    unsigned long sec;
+    long mdeg, ppb;
+    double raw = 0, raw_mean = 0, residual = 0, residual_mean = 0;
+    uint32_t n = 0, predicted = 0;
+    temp_model_t m;
+    FILE *f = fopen(path, "r");
+
+    if (f == NULL) {
+        perror(path);
+        return 1;
+    }
+
+    temp_model_init(&m);
+
+    while (fgets(line, sizeof(line), f) != NULL) {
+        /* Console colours and prompts may come first */
+        p = strstr(line, "tcomp,");
+        if (p == NULL || sscanf(p, "tcomp,%lu,%ld,%ld", &sec, &mdeg, &ppb) != 3) {
+            continue;
+        }
+
+        /* Frequency left once the bias predicted so far is removed */
+        if (m.valid) {
+            double y = ppb - m.y0;
+            double e = y - temp_model_bias(&m, mdeg / 1000.0f);
+
+            raw_mean += y;
+            raw += y * y;
+            residual_mean += e;
+            residual += e * e;
+            predicted++;
+        }
+
+        temp_model_add(&m, mdeg / 1000.0f, (float)ppb);
+        n++;
+    }
+    fclose(f);
+
+    if (predicted == 0) {
+        printf("%s: %u samples, model never valid (spread %.3f degC)\n", path, n, m.spread);
+        return 1;
+    }
+
+    /* The servo keeps the mean, only the deviations matter */
+    raw_mean /= predicted;
+    residual_mean /= predicted;
+    raw = sqrt(raw / predicted - raw_mean * raw_mean);
+    residual = sqrt(residual / predicted - residual_mean * residual_mean);
+
+    printf("%s: %u samples, slope %.2f ppb/K at %.2f degC, spread %.2f degC\n",
+           path, n, m.slope, m.ref, m.spread);
+    printf("  frequency deviation %.1f ppb rms, %.1f ppb once the predicted bias is removed\n", raw, residual);
+
+    return residual > raw;
+}
+
+/* A capture as the console shows it, run through the replay */
+static void test_capture(void)
+{
+    char path[] = "/tmp/tcomp_XXXXXX";
+    int fd = mkstemp(path);
+    FILE *f = fd >= 0 ? fdopen(fd, "w") : NULL;
+    uint32_t i;
+
+    if (f == NULL) {
+        CHECK(0, "cannot create %s", path);
+        return;
+    }
+
+    fprintf(f, "tcomp trace on\n");
+    for (i = 0; i < 3000; i++) {
+        float temp = 35.0f + 4.0f * sinf(i * 0.005f) + noisef(0.1f);
+        float freq = -800.0f + 25.0f * (temp - 35.0f) + noisef(10.0f);
+
+        fprintf(f, "%stcomp,%u,%ld,%ld\n", i % 7 ? "" : "\033[0m> ", 60 * i, (long)(temp * 1000), (long)freq);
+        if (i % 100 == 0) {
+            fprintf(f, "ptp: state SLAVE\n");
+        }
+    }
+    fclose(f);
+
+    CHECK(replay(path) == 0, "compensation of %s did not help", path);
+    remove(path);
+}
+
+int main(int argc, char **argv)
+{
+    int i;
+
+    if (argc > 1) {
+        for (i = 1; i < argc; i++) {
+            failures += replay(argv[i]);
+        }
+        return failures != 0;
+    }
+
+    test_fit();
+    test_learning();
+    test_limits();
+    test_ageing();
+    test_capture();
+
+    return check_result("temp_model");
+}
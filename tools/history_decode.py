@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+"""Decode the servo history exported by GET /history.bin.
+
+Prints one CSV line per update, or with --stats the compression ratio and
+the decode speed. The block layout is history_block_t in app/inc/history.h.
+"""
+
+import argparse
+import struct
+import sys
+import time
+
+BLOCK = 4096
+HEADER = struct.Struct("<IIIIiiiB3xI")
+RAW_UPDATE = 21     # seconds, nanoseconds, offset, delay, drift and state
+
+
+def varint(data, pos):
+    value = shift = 0
+    while True:
+        byte = data[pos]
+        pos += 1
+        value |= (byte & 0x7F) << shift
+        if not byte & 0x80:
+            return value, pos
+        shift += 7
+
+
+def unzigzag(v):
+    return (v >> 1) ^ -(v & 1)
+
+
+def decode_block(block):
+    seq, fill, sec, nsec, offset, delay, drift, state, _ = HEADER.unpack_from(block)
+    if seq == 0:
+        return
+    count, used = fill >> 16, fill & 0xFFFF
+    data = block[HEADER.size:HEADER.size + used]
+    t = sec * 1000000000 + nsec
+    interval = pos = 0
+
+    yield t, offset, delay, drift, state
+    for _ in range(count - 1):
+        head, pos = varint(data, pos)
+        d_offset, pos = varint(data, pos)
+        d_delay, pos = varint(data, pos)
+        d_drift, pos = varint(data, pos)
+        interval += unzigzag(head >> 1)
+        t += interval
+        offset += unzigzag(d_offset)
+        delay += unzigzag(d_delay)
+        drift += unzigzag(d_drift)
+        if head & 1:
+            state = data[pos]
+            pos += 1
+        yield t, offset, delay, drift, state
+
+
+def blocks(data):
+    found = []
+    for i in range(0, len(data) - BLOCK + 1, BLOCK):
+        block = data[i:i + BLOCK]
+        seq, fill = struct.unpack_from("<II", block)
+        if seq:
+            found.append((seq, fill, block))
+    # Export order is by slot, sort back to time order
+    return sorted(found, key=lambda b: b[0])
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("file", help="history.bin, - for stdin")
+    parser.add_argument("--stats", action="store_true", help="print compression and decode speed only")
+    args = parser.parse_args()
+
+    data = sys.stdin.buffer.read() if args.file == "-" else open(args.file, "rb").read()
+    found = blocks(data)
+
+    if not args.stats:
+        out = sys.stdout
+        out.write("seconds,nanoseconds,offset,delay,drift,state\n")
+        for _, _, block in found:
+            for t, offset, delay, drift, state in decode_block(block):
+                out.write("%d,%09d,%d,%d,%d,%d\n" % (t // 1000000000, t % 1000000000, offset, delay, drift, state))
+        return
+
+    start = time.perf_counter()
+    updates = sum(1 for _, _, block in found for _ in decode_block(block))
+    elapsed = time.perf_counter() - start
+    stored = sum(HEADER.size + (fill & 0xFFFF) for _, fill, _ in found)
+
+    print("blocks: %d, updates: %d" % (len(found), updates))
+    if updates:
+        print("bytes per update: %.2f, raw %d, ratio %.1f" %
+              (stored / updates, RAW_UPDATE, RAW_UPDATE * updates / stored))
+        print("decode: %.0f updates/s" % (updates / elapsed if elapsed else float("inf")))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,154 @@
+#!/usr/bin/env python3
+"""Generate app/src/fsdata_custom.c from the web files in Fs/.
+
+Every file gets a complete HTTP header stored with it in flash, so the
+server sends header and body straight from flash without copying: status,
+Content-Type, Content-Length, a strong ETag for conditional GETs and a
+Cache-Control policy. Files that gzip well get a second entry, the name
+with .gz appended, holding the precompressed body and Content-Encoding:
+gzip; the server picks it when the request accepts gzip.
+
+Run from the repository root after changing Fs/:
+
+    tools/makefsdata.py [Fs] [app/src/fsdata_custom.c]
+"""
+
+import gzip
+import os
+import sys
+import zlib
+
+SERVER = "disco-ptp"
+GZIP_MIN_SAVING = 0.125     # keep a .gz variant only if at least this much smaller
+
+TYPES = {
+    ".html": "text/html",
+    ".htm": "text/html",
+    ".css": "text/css",
+    ".js": "application/javascript",
+    ".json": "application/json",
+    ".svg": "image/svg+xml",
+    ".txt": "text/plain",
+    ".gif": "image/gif",
+    ".jpg": "image/jpeg",
+    ".png": "image/png",
+    ".ico": "image/x-icon",
+}
+
+# Pages are revalidated on every load, the rest is kept a day
+CACHE_PAGE = "no-cache"
+CACHE_ASSET = "max-age=86400"
+
+# FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT
+FLAGS = 0x03
+
+
+def header(name, body, etag, encoding=None, vary=False):
+    ext = os.path.splitext(name)[1].lower()
+    ctype = TYPES.get(ext, "application/octet-stream")
+    lines = []
+
+    if name == "/404.html":
+        lines.append("HTTP/1.0 404 File not found")
+    else:
+        lines.append("HTTP/1.0 200 OK")
+    lines.append("Server: " + SERVER)
+    lines.append("Content-Type: " + ctype)
+    lines.append("Content-Length: %d" % len(body))
+    if name != "/404.html":
+        lines.append('ETag: "%s"' % etag)
+        lines.append("Cache-Control: " + (CACHE_PAGE if ctype == "text/html" else CACHE_ASSET))
+    if encoding:
+        lines.append("Content-Encoding: " + encoding)
+    if vary:
+        lines.append("Vary: Accept-Encoding")
+
+    return lines
+
+
+def c_ident(name):
+    return "".join(c if c.isalnum() else "_" for c in name)
+
+
+def c_bytes(data):
+    out = []
+    for i in range(0, len(data), 16):
+        out.append("".join("0x%02x," % b for b in data[i:i + 16]))
+    return "\n".join(out)
+
+
+def entry(name, lines, body):
+    ident = c_ident(name)
+    name_bytes = name.encode() + b"\0"
+    name_bytes += b"\0" * (-len(name_bytes) % 4)
+    hdr = "".join(l + "\r\n" for l in lines) + "\r\n"
+
+    text = []
+    text.append("static const unsigned int dummy_align_%s = 0;" % ident)
+    text.append("static const unsigned char data_%s[] = {" % ident)
+    text.append("/* %s (%d chars) */" % (name, len(name) + 1))
+    text.append(c_bytes(name_bytes))
+    text.append("")
+    text.append("/* HTTP header */")
+    for l in lines + [""]:
+        raw = (l + "\r\n").encode()
+        text.append('/* "%s" (%d bytes) */' % (l, len(raw)))
+        text.append(c_bytes(raw))
+    text.append("/* raw file data (%d bytes) */" % len(body))
+    text.append(c_bytes(body) + "};")
+    text.append("")
+    text.append("")
+
+    return ident, len(name_bytes), "\n".join(text), len(hdr) + len(body)
+
+
+def files(root):
+    found = []
+    for path, dirs, names in os.walk(root):
+        dirs.sort()
+        for n in sorted(names):
+            full = os.path.join(path, n)
+            found.append(("/" + os.path.relpath(full, root).replace(os.sep, "/"), full))
+    return found
+
+
+def main():
+    root = sys.argv[1] if len(sys.argv) > 1 else "Fs"
+    out = sys.argv[2] if len(sys.argv) > 2 else "app/src/fsdata_custom.c"
+    entries = []
+    plain = packed = 0
+
+    for name, path in files(root):
+        body = open(path, "rb").read()
+        etag = "%08x" % (zlib.crc32(body) & 0xFFFFFFFF)
+        gz = gzip.compress(body, 9, mtime=0)
+        compress = name != "/404.html" and len(gz) <= len(body) * (1 - GZIP_MIN_SAVING)
+
+        entries.append(entry(name, header(name, body, etag, vary=compress), body))
+        plain += len(body)
+        if compress:
+            entries.append(entry(name + ".gz", header(name, gz, etag + "-gz", "gzip", True), gz))
+            packed += len(gz)
+            print("%-32s %6d -> %6d gzip" % (name, len(body), len(gz)))
+        else:
+            packed += len(body)
+            print("%-32s %6d" % (name, len(body)))
+
+    with open(out, "w", newline="\n") as f:
+        f.write("/* Generated by tools/makefsdata.py from %s/, do not edit */\n" % root)
+        f.write('#include "lwip/apps/fs.h"\n#include "lwip/def.h"\n\n\n')
+        f.write("#define file_NULL (struct fsdata_file *) NULL\n\n\n")
+        for _, _, text, _ in entries:
+            f.write(text + "\n")
+        prev = "file_NULL"
+        for ident, offset, _, _ in entries:
+            f.write("const struct fsdata_file file_%s[] = { {\n%s,\ndata_%s,\ndata_%s + %d,\n"
+                    "sizeof(data_%s) - %d,\n%d,\n}};\n\n" % (ident, prev, ident, ident, offset, ident, offset, FLAGS))
+            prev = "file_" + ident
+        f.write("#define FS_ROOT %s\n#define FS_NUMFILES %d\n" % (prev, len(entries)))
+
+    print("%d entries, %d bytes of files, %d sent to gzip clients" % (len(entries), plain, packed))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,255 @@
+#!/usr/bin/env python3
+"""Stand-in MQTT broker checking the telemetry published by the board.
+
+Listens for the board's MQTT client, answers CONNECT, PINGREQ and QoS 0
+PUBLISH like a broker would and checks every message:
+
+  - payload format: JSON with the state, counters and, when servo updates
+    were queued, their statistics and [ms, offset, delay] triples
+  - batching: at most --batch updates per message, "n" matching the triples,
+    the statistics matching the offsets, batches continuing in time
+  - backoff: with --refuse N the first N connections are refused, the waits
+    between attempts must double from --period up to --backoff-max
+
+Start it, then on the board: mqtt start <host ip> [port]
+
+    tools/mqtt_check.py --port 1883 --messages 30
+    tools/mqtt_check.py --refuse 5 --messages 5
+"""
+
+import argparse
+import json
+import math
+import socket
+import struct
+import sys
+import time
+
+CONNECT, CONNACK, PUBLISH, PINGREQ, PINGRESP, DISCONNECT = 1, 2, 3, 12, 13, 14
+CONNACK_ACCEPTED, CONNACK_SERVER_UNAVAILABLE = 0, 3
+
+STATE_KEYS = ("state", "offset", "delay", "drift", "steps", "changes", "gaps", "drops", "lost")
+BATCH_KEYS = ("n", "mean", "min", "max", "sd", "t", "s")
+
+
+class Closed(Exception):
+    pass
+
+
+def recv_exact(conn, n):
+    data = b""
+    while len(data) < n:
+        chunk = conn.recv(n - len(data))
+        if not chunk:
+            raise Closed()
+        data += chunk
+    return data
+
+
+def read_packet(conn):
+    """Returns (type, flags, body) of the next control packet."""
+    first = recv_exact(conn, 1)[0]
+    length, shift = 0, 0
+    while True:
+        b = recv_exact(conn, 1)[0]
+        length |= (b & 0x7F) << shift
+        shift += 7
+        if not b & 0x80:
+            break
+        if shift > 21:
+            raise ValueError("remaining length over 4 bytes")
+    return first >> 4, first & 0x0F, recv_exact(conn, length)
+
+
+def read_string(body, pos):
+    n = struct.unpack_from("!H", body, pos)[0]
+    return body[pos + 2:pos + 2 + n].decode(), pos + 2 + n
+
+
+class Checker:
+    def __init__(self, args):
+        self.args = args
+        self.errors = []
+        self.messages = 0
+        self.updates = 0
+        self.last_t = None          # time of the last update of the previous batch
+        self.lost = None
+
+    def error(self, msg):
+        self.errors.append(msg)
+        print("  FAIL %s" % msg)
+
+    def connect(self, body):
+        proto, pos = read_string(body, 0)
+        level, flags, keep_alive = struct.unpack_from("!BBH", body, pos)
+        client_id, _ = read_string(body, pos + 4)
+        if proto != "MQTT" or level != 4:
+            self.error("protocol %s level %d, expected MQTT 3.1.1" % (proto, level))
+        if not flags & 0x02:
+            self.error("no clean session")
+        return client_id, keep_alive
+
+    def publish(self, flags, body):
+        topic, pos = read_string(body, 0)
+        qos = (flags >> 1) & 3
+        if qos:
+            pos += 2                # packet identifier
+            self.error("QoS %d, telemetry is published with QoS 0" % qos)
+        if topic != self.args.topic:
+            self.error("topic %s, expected %s" % (topic, self.args.topic))
+
+        payload = body[pos:]
+        if len(payload) >= self.args.payload:
+            self.error("payload of %d bytes, buffer is %d" % (len(payload), self.args.payload))
+        try:
+            msg = json.loads(payload)
+        except ValueError as e:
+            self.error("payload not JSON (%s): %r" % (e, payload[:80]))
+            return
+
+        self.messages += 1
+        self.check(msg)
+
+    def check(self, msg):
+        for key in STATE_KEYS:
+            if not isinstance(msg.get(key), int):
+                self.error("%s missing or not an integer" % key)
+                return
+
+        if self.lost is not None and msg["lost"] < self.lost:
+            self.error("lost went back from %d to %d" % (self.lost, msg["lost"]))
+        self.lost = msg["lost"]
+
+        if "s" not in msg:
+            if any(key in msg for key in BATCH_KEYS):
+                self.error("statistics without updates")
+            print("  state %d offset %d, no updates" % (msg["state"], msg["offset"]))
+            return
+
+        missing = [key for key in BATCH_KEYS if key not in msg]
+        if missing:
+            self.error("batch without %s" % ", ".join(missing))
+            return
+
+        s = msg["s"]
+        if not s or len(s) > self.args.batch:
+            self.error("%d updates in a message, at most %d" % (len(s), self.args.batch))
+        if msg["n"] != len(s):
+            # Statistics cover the batch, the triples may stop short of the payload
+            if msg["n"] < len(s) or msg["n"] > self.args.batch:
+                self.error("n %d for %d updates" % (msg["n"], len(s)))
+        if any(not isinstance(u, list) or len(u) != 3 for u in s):
+            self.error("update not an [ms, offset, delay] triple")
+            return
+
+        ms = [u[0] for u in s]
+        offsets = [u[1] for u in s]
+        if ms[0] != 0 or any(b < a for a, b in zip(ms, ms[1:])):
+            self.error("update times not increasing from 0: %s" % ms[:8])
+        if msg["n"] == len(s):
+            mean = sum(offsets) / len(offsets)
+            if msg["min"] != min(offsets) or msg["max"] != max(offsets):
+                self.error("min/max %d/%d, updates give %d/%d" % (msg["min"], msg["max"], min(offsets), max(offsets)))
+            if abs(msg["mean"] - mean) > 1:
+                self.error("mean %d, updates give %.1f" % (msg["mean"], mean))
+            if len(offsets) > 1:
+                sd = math.sqrt(sum((o - mean) ** 2 for o in offsets) / (len(offsets) - 1))
+                if abs(msg["sd"] - sd) > max(2, sd * 0.01):
+                    self.error("sd %d, updates give %.1f" % (msg["sd"], sd))
+
+        # Batches follow each other, the next one starts after the last update
+        t = float(msg["t"])
+        if self.last_t is not None and t <= self.last_t:
+            self.error("batch at %.9f does not follow the previous update at %.9f" % (t, self.last_t))
+        self.last_t = t + ms[-1] / 1000.0
+
+        self.updates += len(s)
+        print("  state %d offset %d, %d updates, mean %d sd %d" %
+              (msg["state"], msg["offset"], len(s), msg["mean"], msg["sd"]))
+
+    def check_backoff(self, attempts):
+        waits = [round((b - a) * 1000) for a, b in zip(attempts, attempts[1:])]
+        expected = self.args.period
+        for i, wait in enumerate(waits):
+            # Attempts are made on the client tick, up to a period late
+            if wait < expected - 100 or wait > expected + self.args.period + 200:
+                self.error("wait after refusal %d: %d ms, expected %d ms" % (i + 1, wait, expected))
+            expected = min(expected * 2, self.args.backoff_max)
+        print("backoff waits ms: %s" % waits)
+
+
+def serve(checker, conn):
+    args = checker.args
+    while checker.messages < args.messages:
+        kind, flags, body = read_packet(conn)
+        if kind == PUBLISH:
+            checker.publish(flags, body)
+        elif kind == PINGREQ:
+            conn.sendall(bytes((PINGRESP << 4, 0)))
+        elif kind == DISCONNECT:
+            raise Closed()
+        else:
+            checker.error("unexpected packet type %d" % kind)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("--bind", default="0.0.0.0")
+    ap.add_argument("--port", type=int, default=1883)
+    ap.add_argument("--topic", default="ptp/telemetry")
+    ap.add_argument("--messages", type=int, default=10, help="messages to check before exiting")
+    ap.add_argument("--refuse", type=int, default=0, help="connections refused first, to check the backoff")
+    ap.add_argument("--batch", type=int, default=32, help="MQTT_TELEMETRY_BATCH")
+    ap.add_argument("--payload", type=int, default=1024, help="MQTT_TELEMETRY_PAYLOAD")
+    ap.add_argument("--period", type=int, default=1000, help="MQTT_TELEMETRY_PERIOD, ms")
+    ap.add_argument("--backoff-max", type=int, default=64000, help="MQTT_TELEMETRY_BACKOFF_MAX, ms")
+    ap.add_argument("--timeout", type=float, default=120, help="seconds without traffic before giving up")
+    args = ap.parse_args()
+
+    checker = Checker(args)
+    attempts = []
+
+    srv = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+    srv.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    srv.bind((args.bind, args.port))
+    srv.listen(1)
+    srv.settimeout(args.timeout)
+    print("listening on %s:%d" % (args.bind, args.port))
+
+    try:
+        while checker.messages < args.messages:
+            conn, peer = srv.accept()
+            conn.settimeout(args.timeout)
+            with conn:
+                try:
+                    kind, _, body = read_packet(conn)
+                    if kind != CONNECT:
+                        checker.error("first packet type %d, expected CONNECT" % kind)
+                        continue
+                    client_id, keep_alive = checker.connect(body)
+                    attempts.append(time.monotonic())
+
+                    if len(attempts) <= args.refuse:
+                        print("%s refused %s (%d of %d)" % (peer[0], client_id, len(attempts), args.refuse))
+                        conn.sendall(bytes((CONNACK << 4, 2, 0, CONNACK_SERVER_UNAVAILABLE)))
+                        continue
+
+                    print("%s connected as %s, keep alive %d s" % (peer[0], client_id, keep_alive))
+                    conn.sendall(bytes((CONNACK << 4, 2, 0, CONNACK_ACCEPTED)))
+                    serve(checker, conn)
+                except Closed:
+                    print("%s disconnected" % peer[0])
+    except socket.timeout:
+        checker.error("no traffic for %.0f s" % args.timeout)
+    except KeyboardInterrupt:
+        pass
+
+    if args.refuse:
+        checker.check_backoff(attempts[:args.refuse + 1])
+
+    print("%d messages, %d updates, %d errors" % (checker.messages, checker.updates, len(checker.errors)))
+    return 1 if checker.errors or checker.messages == 0 else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
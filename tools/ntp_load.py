@@ -0,0 +1,208 @@
+#!/usr/bin/env python3
+"""Load and check the NTP server of the board from a Linux workstation.
+
+Load mode sends client requests from several sockets at a fixed rate, or as
+fast as the window of outstanding requests allows, and reports requests and
+replies per second, losses and round trip times:
+
+    tools/ntp_load.py 192.168.1.10 --rate 2000 --duration 10 --clients 8
+    tools/ntp_load.py 192.168.1.10 --rate 0 --window 32
+
+Interleaved mode exchanges requests one at a time the way chrony does with
+xleave and checks that the replies carry the hardware transmit timestamp of
+the previous reply, printing offset and delay of both modes:
+
+    tools/ntp_load.py 192.168.1.10 --interleaved --count 20
+"""
+
+import argparse
+import os
+import selectors
+import socket
+import struct
+import sys
+import time
+
+NTP_PORT = 123
+NTP_UNIX_OFFSET = 2208988800
+PACKET = struct.Struct("!BBbbIII8s8s8s8s")
+
+
+def ntp_now():
+    ns = time.time_ns()
+    s, ns = divmod(ns, 1000000000)
+    return ((s + NTP_UNIX_OFFSET) << 32) | ((ns << 32) // 1000000000)
+
+
+def ntp_ns(ts):
+    return (ts >> 32) * 1000000000 + (((ts & 0xFFFFFFFF) * 1000000000) >> 32)
+
+
+def ts_bytes(ts):
+    return struct.pack("!Q", ts)
+
+
+def ts_value(b):
+    return struct.unpack("!Q", b)[0]
+
+
+def request(orig=0, rx=0, tx=0):
+    # LI 0, version 4, mode 3 (client)
+    return PACKET.pack(0x23, 0, 0, 0, 0, 0, 0, ts_bytes(0), ts_bytes(orig), ts_bytes(rx), ts_bytes(tx))
+
+
+def parse(data):
+    if len(data) < PACKET.size:
+        return None
+    f = PACKET.unpack(data[:PACKET.size])
+    return {
+        "mode": f[0] & 7,
+        "stratum": f[1],
+        "orig": ts_value(f[8]),
+        "rx": ts_value(f[9]),
+        "tx": ts_value(f[10]),
+    }
+
+
+def percentile(values, p):
+    if not values:
+        return 0
+    values = sorted(values)
+    return values[min(len(values) - 1, int(len(values) * p / 100))]
+
+
+def load(args):
+    sel = selectors.DefaultSelector()
+    socks = []
+    for _ in range(args.clients):
+        s = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        s.setblocking(False)
+        s.connect((args.host, args.port))
+        sel.register(s, selectors.EVENT_READ)
+        socks.append(s)
+
+    pending = {}                # transmit timestamp -> send time
+    rtts = []
+    sent = received = stray = 0
+    interval = 1.0 / args.rate if args.rate > 0 else 0
+    start = time.monotonic()
+    next_send = start
+    end = start + args.duration
+
+    while True:
+        now = time.monotonic()
+        if now >= end and (not pending or now >= end + args.timeout):
+            break
+
+        if now < end and (interval == 0 and len(pending) < args.window or interval and now >= next_send):
+            tx = ntp_now() ^ int.from_bytes(os.urandom(2), "big")   # unique, matched on the reply origin
+            try:
+                socks[sent % len(socks)].send(request(tx=tx))
+                pending[tx] = time.monotonic()
+                sent += 1
+            except BlockingIOError:
+                pass
+            next_send += interval
+            if interval and next_send < now - 1:
+                next_send = now     # cannot keep up, do not burst
+            continue
+
+        wait = max(0, min(next_send - now, 0.01)) if interval else 0.01
+        for key, _ in sel.select(wait):
+            while True:
+                try:
+                    data = key.fileobj.recv(512)
+                except (BlockingIOError, ConnectionRefusedError):
+                    break
+                reply = parse(data)
+                if reply is None or reply["orig"] not in pending:
+                    stray += 1
+                    continue
+                rtts.append((time.monotonic() - pending.pop(reply["orig"])) * 1e6)
+                received += 1
+
+        # Expire requests that will not be answered
+        limit = time.monotonic() - args.timeout
+        for tx in [t for t, at in pending.items() if at < limit]:
+            del pending[tx]
+
+    elapsed = time.monotonic() - start
+    lost = sent - received
+    print("sent %d, received %d, lost %d (%.2f%%), stray %d in %.1f s" %
+          (sent, received, lost, 100.0 * lost / sent if sent else 0, stray, elapsed))
+    print("requests %.0f/s, replies %.0f/s" % (sent / args.duration, received / args.duration))
+    if rtts:
+        print("rtt us: min %.0f, median %.0f, p99 %.0f, max %.0f" %
+              (min(rtts), percentile(rtts, 50), percentile(rtts, 99), max(rtts)))
+    return 0 if received else 1
+
+
+def exchange(sock, orig, rx, timeout):
+    t1 = ntp_now()
+    sock.send(request(orig, rx, t1))
+    sock.settimeout(timeout)
+    while True:
+        data = sock.recv(512)
+        t4 = ntp_now()
+        reply = parse(data)
+        if reply is not None:
+            return t1, reply, t4
+
+
+def interleaved(args):
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.connect((args.host, args.port))
+    prev = None                 # (t1, reply, t4) of the previous exchange
+    count = 0
+
+    print("%5s %12s %12s %12s %12s" % ("n", "offset ns", "delay ns", "xl offset", "xl delay"))
+    for n in range(args.count):
+        # Origin: receive timestamp of the last reply, receive: when it arrived
+        orig, rx = (prev[1]["rx"], prev[2]) if prev is not None else (0, 0)
+
+        try:
+            t1, reply, t4 = exchange(sock, orig, rx, args.timeout)
+        except socket.timeout:
+            print("%5d timeout" % n)
+            prev = None
+            continue
+
+        t2, t3 = ntp_ns(reply["rx"]), ntp_ns(reply["tx"])
+        line = "%5d" % n
+
+        if prev is not None and reply["orig"] == prev[2]:
+            # Transmit timestamp belongs to the previous reply
+            p1, p2, p4 = ntp_ns(prev[0]), ntp_ns(prev[1]["rx"]), ntp_ns(prev[2])
+            line += " %12s %12s %12d %12d" % ("", "", ((p2 - p1) + (t3 - p4)) // 2, (p4 - p1) - (t3 - p2))
+            count += 1
+        else:
+            line += " %12d %12d" % (((t2 - ntp_ns(t1)) + (t3 - ntp_ns(t4))) // 2,
+                                    (ntp_ns(t4) - ntp_ns(t1)) - (t3 - t2))
+        print(line)
+
+        prev = (t1, reply, t4)
+        time.sleep(args.interval)
+
+    print("%d of %d replies interleaved" % (count, args.count))
+    return 0 if count else 1
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("host")
+    ap.add_argument("--port", type=int, default=NTP_PORT)
+    ap.add_argument("--rate", type=float, default=1000, help="requests per second, 0 for as fast as the window allows")
+    ap.add_argument("--window", type=int, default=16, help="outstanding requests with --rate 0")
+    ap.add_argument("--duration", type=float, default=10, help="seconds")
+    ap.add_argument("--clients", type=int, default=4, help="sockets, each a client to the server")
+    ap.add_argument("--timeout", type=float, default=1, help="seconds before a request is lost")
+    ap.add_argument("--interleaved", action="store_true", help="check the interleaved mode instead")
+    ap.add_argument("--count", type=int, default=10, help="exchanges with --interleaved")
+    ap.add_argument("--interval", type=float, default=0.5, help="seconds between exchanges with --interleaved")
+    args = ap.parse_args()
+
+    return interleaved(args) if args.interleaved else load(args)
+
+
+if __name__ == "__main__":
+    sys.exit(main())